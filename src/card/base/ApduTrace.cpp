@@ -0,0 +1,248 @@
+/**
+ * Copyright (c) 2025 Governikus GmbH & Co. KG, Germany
+ */
+
+#include "ApduTrace.h"
+
+#include <QDataStream>
+#include <QFile>
+#include <QLoggingCategory>
+#include <QSaveFile>
+
+
+using namespace governikus;
+
+
+Q_DECLARE_LOGGING_CATEGORY(card)
+
+
+ApduTrace::ApduTrace(const QString& pReaderName, bool pBasicReader)
+	: mReaderName(pReaderName)
+	, mBasicReader(pBasicReader)
+	, mTimer()
+	, mPaceRunning(false)
+	, mEntries()
+{
+	mTimer.start();
+}
+
+
+const QString& ApduTrace::getReaderName() const
+{
+	return mReaderName;
+}
+
+
+bool ApduTrace::isBasicReader() const
+{
+	return mBasicReader;
+}
+
+
+const QList<ApduTrace::Entry>& ApduTrace::getEntries() const
+{
+	return mEntries;
+}
+
+
+bool ApduTrace::isEmpty() const
+{
+	return mEntries.isEmpty();
+}
+
+
+void ApduTrace::append(const ApduTrace& pOther)
+{
+	const qint64 offset = mEntries.isEmpty() ? 0 : mEntries.constLast().mOffset + mEntries.constLast().mDuration;
+	for (auto entry : pOther.getEntries())
+	{
+		entry.mOffset += offset;
+		mEntries << entry;
+	}
+}
+
+
+void ApduTrace::setPaceRunning(bool pRunning)
+{
+	mPaceRunning = pRunning;
+}
+
+
+void ApduTrace::addEntry(Entry pEntry, qint64 pDuration)
+{
+	pEntry.mDuration = pDuration;
+	pEntry.mOffset = qMax<qint64>(0, mTimer.nsecsElapsed() / 1000 - pDuration);
+	mEntries << pEntry;
+}
+
+
+void ApduTrace::addTransmit(const CommandApdu& pCommand, const ResponseApduResult& pResult, qint64 pDuration,
+		const QByteArray& pSecuredCommand, const QByteArray& pSecuredResponse)
+{
+	Entry entry;
+	entry.mType = mPaceRunning ? ApduTraceEntryType::PACE_TRANSMIT : ApduTraceEntryType::TRANSMIT;
+	entry.mReturnCode = pResult.mReturnCode;
+	entry.mCommand = redact(pCommand);
+	entry.mResponse = pResult.mResponseApdu;
+	entry.mSecuredCommand = pSecuredCommand;
+	entry.mSecuredResponse = pSecuredResponse;
+	addEntry(entry, pDuration);
+}
+
+
+void ApduTrace::addEstablishPaceChannel(PacePasswordId pPasswordId, const QByteArray& pChat, const EstablishPaceChannelOutput& pOutput, qint64 pDuration)
+{
+	Entry entry;
+	entry.mType = ApduTraceEntryType::ESTABLISH_PACE_CHANNEL;
+	entry.mReturnCode = pOutput.getPaceReturnCode();
+	entry.mCommand = QByteArray(1, Enum<PacePasswordId>::getValue(pPasswordId)) + pChat;
+	entry.mResponse = pOutput.toCcid();
+	addEntry(entry, pDuration);
+}
+
+
+void ApduTrace::addDestroyPaceChannel(CardReturnCode pReturnCode, qint64 pDuration)
+{
+	Entry entry;
+	entry.mType = ApduTraceEntryType::DESTROY_PACE_CHANNEL;
+	entry.mReturnCode = pReturnCode;
+	addEntry(entry, pDuration);
+}
+
+
+void ApduTrace::addSetEidPin(const ResponseApduResult& pResult, qint64 pDuration)
+{
+	Entry entry;
+	entry.mType = ApduTraceEntryType::SET_EID_PIN;
+	entry.mReturnCode = pResult.mReturnCode;
+	entry.mResponse = pResult.mResponseApdu;
+	addEntry(entry, pDuration);
+}
+
+
+QByteArray ApduTrace::toBinary() const
+{
+	QByteArray data;
+	QDataStream stream(&data, QIODevice::WriteOnly);
+	stream.setVersion(QDataStream::Qt_6_0);
+
+	stream << cMagic << cVersion << mReaderName << mBasicReader << static_cast<quint32>(mEntries.size());
+	for (const auto& entry : std::as_const(mEntries))
+	{
+		stream << static_cast<quint8>(entry.mType)
+			   << entry.mOffset
+			   << entry.mDuration
+			   << static_cast<qint32>(entry.mReturnCode)
+			   << entry.mCommand
+			   << entry.mResponse
+			   << entry.mSecuredCommand
+			   << entry.mSecuredResponse;
+	}
+
+	return data;
+}
+
+
+bool ApduTrace::fromBinary(const QByteArray& pData)
+{
+	QDataStream stream(pData);
+	stream.setVersion(QDataStream::Qt_6_0);
+
+	quint32 magic = 0;
+	quint8 version = 0;
+	stream >> magic >> version;
+	if (magic != cMagic || version != cVersion)
+	{
+		qCWarning(card) << "Unsupported APDU trace version:" << version;
+		return false;
+	}
+
+	QString readerName;
+	bool basicReader = true;
+	quint32 count = 0;
+	stream >> readerName >> basicReader >> count;
+
+	QList<Entry> entries;
+	for (quint32 i = 0; i < count && stream.status() == QDataStream::Ok; ++i)
+	{
+		quint8 type = 0;
+		qint32 returnCode = 0;
+		Entry entry;
+		stream >> type
+		>> entry.mOffset
+		>> entry.mDuration
+		>> returnCode
+		>> entry.mCommand
+		>> entry.mResponse
+		>> entry.mSecuredCommand
+		>> entry.mSecuredResponse;
+
+		if (!Enum<ApduTraceEntryType>::isValue(static_cast<int>(type)) || !Enum<CardReturnCode>::isValue(returnCode))
+		{
+			qCWarning(card) << "Invalid APDU trace entry:" << i;
+			return false;
+		}
+
+		entry.mType = static_cast<ApduTraceEntryType>(type);
+		entry.mReturnCode = static_cast<CardReturnCode>(returnCode);
+		entries << entry;
+	}
+
+	if (stream.status() != QDataStream::Ok)
+	{
+		qCWarning(card) << "APDU trace is truncated";
+		return false;
+	}
+
+	mReaderName = readerName;
+	mBasicReader = basicReader;
+	mEntries = entries;
+	return true;
+}
+
+
+bool ApduTrace::save(const QString& pFile) const
+{
+	QSaveFile file(pFile);
+	if (!file.open(QIODevice::WriteOnly) || file.write(toBinary()) < 0 || !file.commit())
+	{
+		qCWarning(card) << "Cannot write APDU trace:" << pFile << file.errorString();
+		return false;
+	}
+
+	qCDebug(card) << "APDU trace written:" << pFile << "| Entries:" << mEntries.size();
+	return true;
+}
+
+
+bool ApduTrace::load(const QString& pFile)
+{
+	QFile file(pFile);
+	if (!file.open(QIODevice::ReadOnly))
+	{
+		qCWarning(card) << "Cannot read APDU trace:" << pFile << file.errorString();
+		return false;
+	}
+
+	return fromBinary(file.readAll());
+}
+
+
+QByteArray ApduTrace::redact(const CommandApdu& pCommand)
+{
+	switch (pCommand.getINS())
+	{
+		case Ins::VERIFY:
+		case Ins::RESET_RETRY_COUNTER:
+			if (!pCommand.getData().isEmpty())
+			{
+				return CommandApdu(pCommand.getHeaderBytes(), QByteArray(pCommand.getData().size(), '\0'), pCommand.getLe());
+			}
+			break;
+
+		default:
+			break;
+	}
+
+	return pCommand;
+}
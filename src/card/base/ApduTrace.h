@@ -0,0 +1,99 @@
+/**
+ * Copyright (c) 2025 Governikus GmbH & Co. KG, Germany
+ */
+
+#pragma once
+
+#include "CardReturnCode.h"
+#include "EnumHelper.h"
+#include "SmartCardDefinitions.h"
+#include "apdu/CommandApdu.h"
+#include "apdu/ResponseApdu.h"
+#include "pinpad/EstablishPaceChannelOutput.h"
+
+#include <QByteArray>
+#include <QElapsedTimer>
+#include <QList>
+#include <QString>
+
+
+namespace governikus
+{
+
+defineEnumType(ApduTraceEntryType,
+		TRANSMIT,
+		PACE_TRANSMIT,
+		ESTABLISH_PACE_CHANNEL,
+		DESTROY_PACE_CHANNEL,
+		SET_EID_PIN
+		)
+
+/*!
+ * Compact binary recording of the card communication of a single
+ * CardConnectionWorker. Transmits are stored plain and, if the worker
+ * established secure messaging, additionally secured as sent to the card.
+ * The data of commands that carry a PIN is overwritten with zeros and
+ * PACE passwords are never stored.
+ *
+ * PACE_TRANSMIT entries are the APDUs of PACE with a basic reader. They
+ * are followed by a single ESTABLISH_PACE_CHANNEL entry with the result
+ * and the overall duration, so a trace of a basic reader can be replayed
+ * as a comfort reader.
+ */
+class ApduTrace
+{
+	public:
+		struct Entry
+		{
+			ApduTraceEntryType mType = ApduTraceEntryType::TRANSMIT;
+			qint64 mOffset = 0;
+			qint64 mDuration = 0;
+			CardReturnCode mReturnCode = CardReturnCode::UNDEFINED;
+			QByteArray mCommand = QByteArray();
+			QByteArray mResponse = QByteArray();
+			QByteArray mSecuredCommand = QByteArray();
+			QByteArray mSecuredResponse = QByteArray();
+		};
+
+	private:
+		QString mReaderName;
+		bool mBasicReader;
+		QElapsedTimer mTimer;
+		bool mPaceRunning;
+		QList<Entry> mEntries;
+
+		void addEntry(Entry pEntry, qint64 pDuration);
+
+	public:
+		static constexpr quint32 cMagic = 0x41415452; // AATR
+		static constexpr quint8 cVersion = 1;
+
+		explicit ApduTrace(const QString& pReaderName = QString(), bool pBasicReader = true);
+
+		[[nodiscard]] const QString& getReaderName() const;
+		[[nodiscard]] bool isBasicReader() const;
+		[[nodiscard]] const QList<Entry>& getEntries() const;
+		[[nodiscard]] bool isEmpty() const;
+
+		void append(const ApduTrace& pOther);
+
+		void setPaceRunning(bool pRunning);
+		void addTransmit(const CommandApdu& pCommand, const ResponseApduResult& pResult, qint64 pDuration,
+				const QByteArray& pSecuredCommand = QByteArray(), const QByteArray& pSecuredResponse = QByteArray());
+		void addEstablishPaceChannel(PacePasswordId pPasswordId, const QByteArray& pChat, const EstablishPaceChannelOutput& pOutput, qint64 pDuration);
+		void addDestroyPaceChannel(CardReturnCode pReturnCode, qint64 pDuration);
+		void addSetEidPin(const ResponseApduResult& pResult, qint64 pDuration);
+
+		[[nodiscard]] QByteArray toBinary() const;
+		[[nodiscard]] bool fromBinary(const QByteArray& pData);
+
+		[[nodiscard]] bool save(const QString& pFile) const;
+		[[nodiscard]] bool load(const QString& pFile);
+
+		/*!
+		 * Returns a copy of the command without PIN data.
+		 */
+		[[nodiscard]] static QByteArray redact(const CommandApdu& pCommand);
+};
+
+} // namespace governikus
@@ -0,0 +1,127 @@
+/**
+ * Copyright (c) 2025 Governikus GmbH & Co. KG, Germany
+ */
+
+#include "ApduTracer.h"
+
+#include "SingletonHelper.h"
+
+#include <QDateTime>
+#include <QDir>
+#include <QLoggingCategory>
+
+
+using namespace governikus;
+
+
+defineSingleton(ApduTracer)
+
+
+Q_DECLARE_LOGGING_CATEGORY(card)
+
+
+ApduTracer::ApduTracer()
+	: mDirectory()
+	, mReplayFiles()
+	, mReplayScale(1.0)
+	, mCounter(0)
+	, mMutex()
+{
+}
+
+
+void ApduTracer::setDirectory(const QString& pDirectory)
+{
+	if (!pDirectory.isEmpty() && !QDir().mkpath(pDirectory))
+	{
+		qCWarning(card) << "Cannot create APDU trace directory:" << pDirectory;
+		return;
+	}
+
+	const QMutexLocker locker(&mMutex);
+	mDirectory = pDirectory;
+}
+
+
+QString ApduTracer::getDirectory() const
+{
+	const QMutexLocker locker(&mMutex);
+	return mDirectory;
+}
+
+
+QSharedPointer<ApduTrace> ApduTracer::createTrace(const QString& pReaderName, bool pBasicReader) const
+{
+	if (getDirectory().isEmpty())
+	{
+		return nullptr;
+	}
+
+	return QSharedPointer<ApduTrace>::create(pReaderName, pBasicReader);
+}
+
+
+void ApduTracer::save(const ApduTrace& pTrace)
+{
+	if (pTrace.isEmpty())
+	{
+		return;
+	}
+
+	const QMutexLocker locker(&mMutex);
+	if (mDirectory.isEmpty())
+	{
+		return;
+	}
+
+	const auto& name = QStringLiteral("apdu-%1-%2.trace")
+			.arg(QDateTime::currentDateTime().toString(QStringLiteral("yyyyMMdd-hhmmss")))
+			.arg(++mCounter, 4, 10, QLatin1Char('0'));
+	Q_UNUSED(pTrace.save(QDir(mDirectory).filePath(name)))
+}
+
+
+void ApduTracer::setReplay(const QStringList& pFiles, double pScale)
+{
+	const QMutexLocker locker(&mMutex);
+	mReplayFiles = pFiles;
+	mReplayScale = qMax(0.0, pScale);
+}
+
+
+QStringList ApduTracer::getReplayFiles() const
+{
+	const QMutexLocker locker(&mMutex);
+	return mReplayFiles;
+}
+
+
+double ApduTracer::getReplayScale() const
+{
+	const QMutexLocker locker(&mMutex);
+	return mReplayScale;
+}
+
+
+ApduTrace ApduTracer::loadReplay() const
+{
+	const auto& files = getReplayFiles();
+
+	ApduTrace result;
+	for (qsizetype i = 0; i < files.size(); ++i)
+	{
+		ApduTrace trace;
+		if (!trace.load(files.at(i)))
+		{
+			return ApduTrace();
+		}
+
+		if (i == 0)
+		{
+			result = ApduTrace(trace.getReaderName(), trace.isBasicReader());
+		}
+		result.append(trace);
+	}
+
+	return result;
+}
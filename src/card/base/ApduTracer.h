@@ -0,0 +1,64 @@
+/**
+ * Copyright (c) 2025 Governikus GmbH & Co. KG, Germany
+ */
+
+#pragma once
+
+#include "ApduTrace.h"
+
+#include <QMutex>
+#include <QObject>
+#include <QSharedPointer>
+#include <QString>
+#include <QStringList>
+
+
+namespace governikus
+{
+
+/*!
+ * Configuration of --apdu-trace and --apdu-replay. Every CardConnectionWorker
+ * records into its own ApduTrace while a directory is set and saves it on
+ * destruction. The ReplayReaderManagerPlugin is only enabled if replay files
+ * are set.
+ */
+class ApduTracer
+{
+	Q_GADGET
+	Q_DISABLE_COPY(ApduTracer)
+	friend class Env;
+
+	private:
+		QString mDirectory;
+		QStringList mReplayFiles;
+		double mReplayScale;
+		int mCounter;
+		mutable QMutex mMutex;
+
+	protected:
+		ApduTracer();
+		~ApduTracer() = default;
+		static ApduTracer& getInstance();
+
+	public:
+		void setDirectory(const QString& pDirectory);
+		[[nodiscard]] QString getDirectory() const;
+
+		[[nodiscard]] QSharedPointer<ApduTrace> createTrace(const QString& pReaderName, bool pBasicReader) const;
+		void save(const ApduTrace& pTrace);
+
+		void setReplay(const QStringList& pFiles, double pScale = 1.0);
+		[[nodiscard]] QStringList getReplayFiles() const;
+
+		/*!
+		 * Factor for the recorded durations. 0 replays without any delay.
+		 */
+		[[nodiscard]] double getReplayScale() const;
+
+		/*!
+		 * Loads and concatenates all replay files. Returns an empty trace on any error.
+		 */
+		[[nodiscard]] ApduTrace loadReplay() const;
+};
+
+} // namespace governikus
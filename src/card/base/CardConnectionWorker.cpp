@@ -4,12 +4,18 @@
 
 #include "CardConnectionWorker.h"
 
+#include "ApduTracer.h"
+#include "Env.h"
+#include "Metrics.h"
+#include "Tracer.h"
 #include "apdu/CommandApdu.h"
 #include "apdu/FileCommand.h"
 #include "apdu/PacePinStatus.h"
 #include "pace/PaceHandler.h"
 
+#include <QElapsedTimer>
 #include <QLoggingCategory>
+#include <QScopeGuard>
 #include <QThread>
 
 using namespace governikus;
@@ -19,12 +25,26 @@ Q_DECLARE_LOGGING_CATEGORY(card)
 Q_DECLARE_LOGGING_CATEGORY(support)
 
 
+namespace
+{
+Metrics::Labels getMetricLabels(const Reader* pReader)
+{
+	return {{QLatin1StringView("reader"), Enum<ReaderManagerPluginType>::getName(pReader->getReaderInfo().getPluginType())}};
+}
+
+
+} // namespace
+
+
 CardConnectionWorker::CardConnectionWorker(Reader* pReader)
 	: QObject()
 	, QEnableSharedFromThis()
 	, mReader(pReader)
 	, mSecureMessaging()
 	, mKeepAliveTimer()
+	, mTrace(Env::getSingleton<ApduTracer>()->createTrace(pReader->getName(), pReader->getReaderInfo().isBasicReader()))
+	, mApduDuration(Env::getSingleton<Metrics>()->getSeries(Metric::APDU_DURATION, getMetricLabels(pReader)))
+	, mPaceDuration(Env::getSingleton<Metrics>()->getSeries(Metric::PACE_DURATION, getMetricLabels(pReader)))
 {
 	connect(mReader.data(), &Reader::fireCardInserted, this, &CardConnectionWorker::fireReaderInfoChanged);
 	connect(mReader.data(), &Reader::fireCardRemoved, this, &CardConnectionWorker::fireReaderInfoChanged);
@@ -42,6 +62,11 @@ CardConnectionWorker::~CardConnectionWorker()
 	{
 		card->releaseConnection();
 	}
+
+	if (mTrace)
+	{
+		Env::getSingleton<ApduTracer>()->save(*mTrace);
+	}
 }
 
 
@@ -173,8 +198,17 @@ ResponseApduResult CardConnectionWorker::transmit(const CommandApdu& pCommandApd
 		return {CardReturnCode::CARD_NOT_FOUND};
 	}
 
+	Tracer::ScopedSpan span(QLatin1String("card"), QStringLiteral("APDU"));
+	if (span.isActive())
+	{
+		span.setArg(QStringLiteral("ins"), QString::number(static_cast<uchar>(pCommandApdu.getINS()), 16));
+		span.setArg(QStringLiteral("command"), pCommandApdu.getData().size());
+		span.setArg(QStringLiteral("sm"), !mSecureMessaging.isNull());
+	}
+
+	const bool secured = !mSecureMessaging.isNull();
 	CommandApdu commandApdu = pCommandApdu;
-	if (mSecureMessaging)
+	if (secured)
 	{
 		commandApdu = mSecureMessaging->encrypt(pCommandApdu);
 		if (commandApdu.isEmpty())
@@ -183,7 +217,27 @@ ResponseApduResult CardConnectionWorker::transmit(const CommandApdu& pCommandApd
 		}
 	}
 
+	QElapsedTimer timer;
+	timer.start();
 	ResponseApduResult result = card->transmit(commandApdu);
+	const qint64 duration = timer.nsecsElapsed() / 1000;
+	Metrics::record(mApduDuration, duration);
+
+	const ResponseApdu securedResponse = result.mResponseApdu;
+	const auto traceGuard = qScopeGuard([this, &pCommandApdu, &commandApdu, &result, &securedResponse, secured, duration] {
+				if (mTrace)
+				{
+					mTrace->addTransmit(pCommandApdu, result, duration,
+							secured ? QByteArray(commandApdu) : QByteArray(),
+							secured ? QByteArray(securedResponse) : QByteArray());
+				}
+			});
+
+	if (span.isActive())
+	{
+		span.setArg(QStringLiteral("response"), result.mResponseApdu.getData().size());
+		span.setArg(QStringLiteral("sw"), QString::number(static_cast<quint16>(result.mResponseApdu.getStatusCode()), 16));
+	}
 	if (result.mResponseApdu.getStatusCode() == StatusCode::WRONG_LENGTH)
 	{
 		return {CardReturnCode::WRONG_LENGTH};
@@ -304,12 +358,23 @@ EstablishPaceChannelOutput CardConnectionWorker::establishPaceChannel(PacePasswo
 	EstablishPaceChannelOutput output;
 
 	qCInfo(support) << "Starting PACE for" << pPasswordId;
+	QElapsedTimer timer;
+	timer.start();
 	if (mReader->getReaderInfo().isBasicReader())
 	{
 		Q_ASSERT(!pPasswordValue.isEmpty());
 		PaceHandler paceHandler(sharedFromThis());
 		paceHandler.setChat(pChat);
+		if (mTrace)
+		{
+			mTrace->setPaceRunning(true);
+		}
 		const auto returnCode = paceHandler.establishPaceChannel(pPasswordId, pPasswordValue);
+		if (mTrace)
+		{
+			mTrace->setPaceRunning(false);
+		}
+		Metrics::record(mPaceDuration, timer.nsecsElapsed() / 1000);
 		output.setPaceReturnCode(returnCode);
 		output.setStatusMseSetAt(paceHandler.getStatusMseSetAt());
 
@@ -353,6 +418,11 @@ EstablishPaceChannelOutput CardConnectionWorker::establishPaceChannel(PacePasswo
 		}
 	}
 
+	if (mTrace)
+	{
+		mTrace->addEstablishPaceChannel(pPasswordId, pChat, output, timer.nsecsElapsed() / 1000);
+	}
+
 	if (output.getPaceReturnCode() == CardReturnCode::INVALID_PASSWORD)
 	{
 		CardReturnCode invalidPasswordId;
@@ -402,18 +472,27 @@ CardReturnCode CardConnectionWorker::destroyPaceChannel()
 	}
 
 	qCInfo(support) << "Destroying PACE channel";
+	QElapsedTimer timer;
+	timer.start();
+	CardReturnCode returnCode;
 	if (mReader->getReaderInfo().isBasicReader())
 	{
 		qCDebug(::card) << "Destroying PACE channel with invalid command causing 6700 as return code";
 		stopSecureMessaging();
 
 		CommandApdu cmdApdu(Ins::MSE_SET, CommandApdu::PACE, CommandApdu::AUTHENTICATION_TEMPLATE);
-		return card->transmit(cmdApdu).mReturnCode;
+		returnCode = card->transmit(cmdApdu).mReturnCode;
 	}
 	else
 	{
-		return card->destroyPaceChannel();
+		returnCode = card->destroyPaceChannel();
+	}
+
+	if (mTrace)
+	{
+		mTrace->addDestroyPaceChannel(returnCode, timer.nsecsElapsed() / 1000);
 	}
+	return returnCode;
 }
 
 
@@ -435,7 +514,13 @@ ResponseApduResult CardConnectionWorker::setEidPin(const QByteArray& pNewPin, qu
 	else
 	{
 		Q_ASSERT(pNewPin.isEmpty());
+		QElapsedTimer timer;
+		timer.start();
 		result = card->setEidPin(pTimeoutSeconds);
+		if (mTrace)
+		{
+			mTrace->addSetEidPin(result, timer.nsecsElapsed() / 1000);
+		}
 	}
 
 	if (result.mReturnCode == CardReturnCode::OK && result.mResponseApdu.getStatusCode() != StatusCode::SUCCESS)
@@ -4,8 +4,10 @@
 
 #pragma once
 
+#include "ApduTrace.h"
 #include "CardReturnCode.h"
 #include "FileRef.h"
+#include "Metrics.h"
 #include "Reader.h"
 #include "SmartCardDefinitions.h"
 #include "apdu/CommandApdu.h"
@@ -40,6 +42,14 @@ class CardConnectionWorker
 
 		QTimer mKeepAliveTimer;
 
+		/*!
+		 * Recording of the card communication if enabled by ApduTracer
+		 */
+		QSharedPointer<ApduTrace> mTrace;
+
+		Metrics::Series* const mApduDuration;
+		Metrics::Series* const mPaceDuration;
+
 		inline QSharedPointer<const EFCardAccess> getEfCardAccess() const;
 
 		void stopSecureMessaging();
@@ -209,3 +209,27 @@ void ReaderInfo::setMaxApduLength(int pMaxApduLength)
 {
 	return mMaxApduLength >= 0 && mMaxApduLength < 500;
 }
+
+
+[[nodiscard]] ReaderInfo::Changes ReaderInfo::getChanges(const ReaderInfo& pPrevious) const
+{
+	Changes changes = NoChange;
+	changes.setFlag(PluginTypeChanged, mPluginType != pPrevious.mPluginType);
+	changes.setFlag(BasicReaderChanged, mBasicReader != pPrevious.mBasicReader);
+	changes.setFlag(MaxApduLengthChanged, mMaxApduLength != pPrevious.mMaxApduLength);
+	changes.setFlag(ShelvedCardChanged, mShelvedCard != pPrevious.mShelvedCard);
+
+	const auto& previousCardInfo = pPrevious.mCardInfo;
+	const bool cardAccessChanged = mCardInfo.getEfCardAccess() != previousCardInfo.getEfCardAccess()
+			|| mCardInfo.getApplication() != previousCardInfo.getApplication()
+			|| mCardInfo.getTagType() != previousCardInfo.getTagType();
+	const bool pinStateChanged = mCardInfo.isPinDeactivated() != previousCardInfo.isPinDeactivated()
+			|| mCardInfo.isPukInoperative() != previousCardInfo.isPukInoperative()
+			|| mCardInfo.isPinInitial() != previousCardInfo.isPinInitial();
+
+	changes.setFlag(CardTypeChanged, mCardInfo.getCardType() != previousCardInfo.getCardType());
+	changes.setFlag(CardAccessChanged, cardAccessChanged);
+	changes.setFlag(RetryCounterChanged, mCardInfo.getRetryCounter() != previousCardInfo.getRetryCounter());
+	changes.setFlag(PinStateChanged, pinStateChanged);
+	return changes;
+}
@@ -8,6 +8,7 @@
 #include "ReaderConfigurationInfo.h"
 #include "ReaderManagerPluginInfo.h"
 
+#include <QFlags>
 #include <QString>
 #include <QVariant>
 
@@ -17,6 +18,22 @@ class ReaderInfo
 {
 	friend class Reader;
 
+	public:
+		enum Change
+		{
+			NoChange = 0x00,
+			PluginTypeChanged = 0x01,
+			BasicReaderChanged = 0x02,
+			MaxApduLengthChanged = 0x04,
+			CardTypeChanged = 0x08,
+			CardAccessChanged = 0x10,
+			RetryCounterChanged = 0x20,
+			PinStateChanged = 0x40,
+			ShelvedCardChanged = 0x80,
+			AllChanged = 0xFF
+		};
+		Q_DECLARE_FLAGS(Changes, Change)
+
 	private:
 		ReaderManagerPluginType mPluginType;
 		QString mName;
@@ -62,6 +79,13 @@ class ReaderInfo
 		void setMaxApduLength(int pMaxApduLength);
 		[[nodiscard]] int getMaxApduLength() const;
 		[[nodiscard]] bool insufficientApduLength() const;
+
+		/*!
+		 * Returns the fields that differ from the previous state of the same reader.
+		 */
+		[[nodiscard]] Changes getChanges(const ReaderInfo& pPrevious) const;
 };
 
 } // namespace governikus
+
+Q_DECLARE_OPERATORS_FOR_FLAGS(governikus::ReaderInfo::Changes)
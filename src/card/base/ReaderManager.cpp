@@ -4,6 +4,8 @@
 
 #include "ReaderManager.h"
 
+#include "Metrics.h"
+
 
 using namespace governikus;
 
@@ -25,8 +27,24 @@ ReaderManager::ReaderManager()
 	, mMutex()
 	, mThread()
 	, mWorker()
+	, mReaderInfoCache()
+	, mReaderInfoVersion(0)
+	, mPluginInfoCache()
 {
 	mThread.setObjectName(QStringLiteral("ReaderManagerThread"));
+
+	connect(this, &ReaderManager::fireReaderAdded, this, [](const ReaderInfo& pInfo){
+				Env::getSingleton<Metrics>()->increment(Metric::READER_EVENTS, {
+							{QLatin1StringView("event"), QStringLiteral("added")},
+							{QLatin1StringView("reader"), Enum<ReaderManagerPluginType>::getName(pInfo.getPluginType())}
+						});
+			});
+	connect(this, &ReaderManager::fireReaderRemoved, this, [](const ReaderInfo& pInfo){
+				Env::getSingleton<Metrics>()->increment(Metric::READER_EVENTS, {
+							{QLatin1StringView("event"), QStringLiteral("removed")},
+							{QLatin1StringView("reader"), Enum<ReaderManagerPluginType>::getName(pInfo.getPluginType())}
+						});
+			});
 }
 
 
@@ -171,9 +189,60 @@ void ReaderManager::shutdown()
 		mThread.quit();
 		mThread.wait(5000);
 		mReaderInfoCache.clear();
+		++mReaderInfoVersion;
 		mPluginInfoCache.clear();
 		qCDebug(card).noquote() << mThread.objectName() << "stopped:" << !mThread.isRunning();
 	}
+	else if (mThread.isRunning())
+	{
+		// requestShutdown() is still in progress
+		mThread.wait(5000);
+	}
+}
+
+
+void ReaderManager::requestShutdown()
+{
+	const QMutexLocker mutexLocker(&mMutex);
+
+	if (!mThread.isRunning())
+	{
+		QMetaObject::invokeMethod(this, &ReaderManager::fireShutdownFinished, Qt::QueuedConnection);
+		return;
+	}
+
+	if (mThread.isInterruptionRequested())
+	{
+		qCDebug(card) << "ReaderManager already shutting down";
+		return;
+	}
+
+	qCDebug(card) << "Shutdown ReaderManager in background...";
+	mThread.requestInterruption(); // do not try to stop AGAIN from dtor
+	connect(&mThread, &QThread::finished, this, &ReaderManager::onThreadFinished, Qt::SingleShotConnection);
+	if (mWorker)
+	{
+		QMetaObject::invokeMethod(mWorker.data(), [worker = mWorker.data()] {
+					worker->shutdown();
+					QThread::currentThread()->quit();
+				}, Qt::QueuedConnection);
+		return;
+	}
+
+	mThread.quit();
+}
+
+
+void ReaderManager::onThreadFinished()
+{
+	{
+		const QMutexLocker mutexLocker(&mMutex);
+		mReaderInfoCache.clear();
+		mPluginInfoCache.clear();
+		qCDebug(card).noquote() << mThread.objectName() << "stopped";
+	}
+
+	Q_EMIT fireShutdownFinished();
 }
 
 
@@ -250,10 +319,29 @@ ReaderManagerPluginInfo ReaderManager::getPluginInfo(ReaderManagerPluginType pTy
 
 void ReaderManager::doUpdateCacheEntry(const ReaderInfo& pInfo)
 {
-	const QMutexLocker mutexLocker(&mMutex);
+	ReaderInfo::Changes changes = ReaderInfo::AllChanged;
+
+	{
+		const QMutexLocker mutexLocker(&mMutex);
+
+		const auto entry = mReaderInfoCache.constFind(pInfo.getName());
+		if (entry != mReaderInfoCache.constEnd())
+		{
+			changes = pInfo.getChanges(entry.value());
+		}
+
+		if (changes == ReaderInfo::NoChange)
+		{
+			qCDebug(card).noquote() << "Skip unchanged cache entry:" << pInfo.getName();
+			return;
+		}
+
+		qCDebug(card).noquote() << "Update cache entry:" << pInfo.getName();
+		mReaderInfoCache.insert(pInfo.getName(), pInfo);
+		++mReaderInfoVersion;
+	}
 
-	qCDebug(card).noquote() << "Update cache entry:" << pInfo.getName();
-	mReaderInfoCache.insert(pInfo.getName(), pInfo);
+	Q_EMIT fireReaderInfoChanged(pInfo, changes);
 }
 
 
@@ -262,7 +350,10 @@ void ReaderManager::doRemoveCacheEntry(const ReaderInfo& pInfo)
 	const QMutexLocker mutexLocker(&mMutex);
 
 	qCDebug(card).noquote() << "Remove cache entry:" << pInfo.getName();
-	mReaderInfoCache.remove(pInfo.getName());
+	if (mReaderInfoCache.remove(pInfo.getName()) > 0)
+	{
+		++mReaderInfoVersion;
+	}
 }
 
 
@@ -289,8 +380,23 @@ void ReaderManager::doUpdatePluginCache(const ReaderManagerPluginInfo& pInfo)
 QList<ReaderInfo> ReaderManager::getReaderInfos(const ReaderFilter& pFilter) const
 {
 	Q_ASSERT(mThread.isRunning() || mThread.isFinished());
+
+	// The cache is implicitly shared, so the copy is only a reference to the current
+	// state. Updates detach the cache and leave this snapshot untouched.
+	QMap<QString, ReaderInfo> snapshot;
+	{
+		const QMutexLocker mutexLocker(&mMutex);
+		snapshot = mReaderInfoCache;
+	}
+
+	return pFilter.apply(snapshot.values());
+}
+
+
+quint64 ReaderManager::getReaderInfoVersion() const
+{
 	const QMutexLocker mutexLocker(&mMutex);
-	return pFilter.apply(mReaderInfoCache.values());
+	return mReaderInfoVersion;
 }
 
 
@@ -35,6 +35,7 @@ class ReaderManager
 		QThread mThread;
 		QPointer<ReaderManagerWorker> mWorker;
 		QMap<QString, ReaderInfo> mReaderInfoCache;
+		quint64 mReaderInfoVersion;
 		QMap<ReaderManagerPluginType, ReaderManagerPluginInfo> mPluginInfoCache;
 
 	protected:
@@ -91,6 +92,13 @@ class ReaderManager
 
 		virtual ReaderManagerPluginInfo getPluginInfo(ReaderManagerPluginType pType) const;
 		virtual QList<ReaderInfo> getReaderInfos(const ReaderFilter& pFilter = ReaderFilter()) const;
+
+		/*!
+		 * Returns the version of the reader cache. It increases with every
+		 * change, so a result of getReaderInfos() stays current as long
+		 * as the version is unchanged.
+		 */
+		[[nodiscard]] quint64 getReaderInfoVersion() const;
 		ReaderInfo getReaderInfo(const QString& pReaderName) const;
 		void updateReaderInfo(const QString& pReaderName) const;
 
@@ -171,6 +179,7 @@ class ReaderManager
 		void clearCache()
 		{
 			mReaderInfoCache.clear();
+			++mReaderInfoVersion;
 			mPluginInfoCache.clear();
 		}
 
@@ -211,13 +220,22 @@ class ReaderManager
 		void fireCardInserted(const ReaderInfo& pInfo);
 		void fireCardRemoved(const ReaderInfo& pInfo);
 		void fireCardInfoChanged(const ReaderInfo& pInfo);
+
+		/*!
+		 * Emitted after the cache entry of a reader was updated.
+		 * A new reader reports all fields as changed. Updates without any
+		 * change are dropped and do not emit this signal.
+		 */
+		void fireReaderInfoChanged(const ReaderInfo& pInfo, ReaderInfo::Changes pChanges);
 		void fireInitialized();
 		void fireInitialScanFinished();
+		void fireShutdownFinished();
 
 	private Q_SLOTS:
 		void doUpdateCacheEntry(const ReaderInfo& pInfo);
 		void doRemoveCacheEntry(const ReaderInfo& pInfo);
 		void doUpdatePluginCache(const ReaderManagerPluginInfo& pInfo);
+		void onThreadFinished();
 
 	public Q_SLOTS:
 		/*!
@@ -225,6 +243,12 @@ class ReaderManager
 		 * The thread is terminated and the plug-ins are unloaded.
 		 */
 		void shutdown();
+
+		/*!
+		 * Shuts down the reader manager service without blocking the caller.
+		 * Emits fireShutdownFinished() once the thread is terminated.
+		 */
+		void requestShutdown();
 };
 
 } // namespace governikus
@@ -23,6 +23,7 @@ defineEnumTypeQmlExposed(ReaderManagerPluginType
 		, LOCAL_IFD
 		, SMART
 		, SIMULATOR
+		, REPLAY
 		)
 
 
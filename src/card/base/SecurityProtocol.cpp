@@ -7,6 +7,8 @@
 
 #include <QLoggingCategory>
 
+#include <array>
+
 
 using namespace Qt::Literals::StringLiterals;
 using namespace governikus;
@@ -15,64 +17,91 @@ using namespace governikus;
 Q_DECLARE_LOGGING_CATEGORY(card)
 
 
-const QMap<char, ProtocolType> SecurityProtocol::cProtocol = {
-	{2, ProtocolType::TA},
-	{3, ProtocolType::CA},
-	{4, ProtocolType::PACE},
-	{5, ProtocolType::RI}
+namespace
+{
+using HashAlgorithm = std::optional<QCryptographicHash::Algorithm>;
+
+// Indexed by the arcs of the OID below bsi-de-protocols-smartcard
+constexpr std::array cProtocol = {
+	ProtocolType::UNDEFINED,
+	ProtocolType::UNDEFINED,
+	ProtocolType::TA,
+	ProtocolType::CA,
+	ProtocolType::PACE,
+	ProtocolType::RI
 };
 
 
-const QMap<char, KeyAgreementType> SecurityProtocol::cKeyAgreement = {
-	{1, KeyAgreementType::DH},
-	{2, KeyAgreementType::ECDH},
-	{3, KeyAgreementType::DH},
-	{4, KeyAgreementType::ECDH},
-	{6, KeyAgreementType::ECDH}
+constexpr std::array cKeyAgreement = {
+	KeyAgreementType::UNDEFINED,
+	KeyAgreementType::DH,
+	KeyAgreementType::ECDH,
+	KeyAgreementType::DH,
+	KeyAgreementType::ECDH,
+	KeyAgreementType::UNDEFINED,
+	KeyAgreementType::ECDH
 };
 
 
-const QMap<char, MappingType> SecurityProtocol::cMapping = {
-	{1, MappingType::GM},
-	{2, MappingType::GM},
-	{3, MappingType::IM},
-	{4, MappingType::IM},
-	{6, MappingType::CAM}
+constexpr std::array cMapping = {
+	MappingType::UNDEFINED,
+	MappingType::GM,
+	MappingType::GM,
+	MappingType::IM,
+	MappingType::IM,
+	MappingType::UNDEFINED,
+	MappingType::CAM
 };
 
 
-const QMap<char, CipherType> SecurityProtocol::cCipher = {
-	{1, CipherType::DES3_CBC},
-	{2, CipherType::AES_128_CBC},
-	{3, CipherType::AES_192_CBC},
-	{4, CipherType::AES_256_CBC}
+constexpr std::array cCipher = {
+	CipherType::UNDEFINED,
+	CipherType::DES3_CBC,
+	CipherType::AES_128_CBC,
+	CipherType::AES_192_CBC,
+	CipherType::AES_256_CBC
 };
 
-const QMap<char, SignatureType> SecurityProtocol::cSignature = {
-	{1, SignatureType::RSA},
-	{2, SignatureType::ECDSA}
+
+constexpr std::array cSignature = {
+	SignatureType::UNDEFINED,
+	SignatureType::RSA,
+	SignatureType::ECDSA
 };
 
 
-const QMap<char, std::optional<QCryptographicHash::Algorithm>> SecurityProtocol::cHashAlgorithm = {
-	{1, std::optional<QCryptographicHash::Algorithm>(QCryptographicHash::Sha1)},
-	{2, std::optional<QCryptographicHash::Algorithm>(QCryptographicHash::Sha224)},
-	{3, std::optional<QCryptographicHash::Algorithm>(QCryptographicHash::Sha256)},
-	{4, std::optional<QCryptographicHash::Algorithm>(QCryptographicHash::Sha384)},
-	{5, std::optional<QCryptographicHash::Algorithm>(QCryptographicHash::Sha512)}
+constexpr std::array<HashAlgorithm, 6> cHashAlgorithm = {
+	std::nullopt,
+	QCryptographicHash::Sha1,
+	QCryptographicHash::Sha224,
+	QCryptographicHash::Sha256,
+	QCryptographicHash::Sha384,
+	QCryptographicHash::Sha512
 };
 
 
-const QMap<char, std::optional<QCryptographicHash::Algorithm>> SecurityProtocol::cRsaHashAlgorithm = {
-	{1, std::optional<QCryptographicHash::Algorithm>(QCryptographicHash::Sha1)},
-	{2, std::optional<QCryptographicHash::Algorithm>(QCryptographicHash::Sha256)},
-	{3, std::optional<QCryptographicHash::Algorithm>(QCryptographicHash::Sha1)},
-	{4, std::optional<QCryptographicHash::Algorithm>(QCryptographicHash::Sha256)},
-	{5, std::optional<QCryptographicHash::Algorithm>(QCryptographicHash::Sha512)},
-	{6, std::optional<QCryptographicHash::Algorithm>(QCryptographicHash::Sha512)}
+constexpr std::array<HashAlgorithm, 7> cRsaHashAlgorithm = {
+	std::nullopt,
+	QCryptographicHash::Sha1,
+	QCryptographicHash::Sha256,
+	QCryptographicHash::Sha1,
+	QCryptographicHash::Sha256,
+	QCryptographicHash::Sha512,
+	QCryptographicHash::Sha512
 };
 
 
+template<typename T, std::size_t N>
+constexpr T lookup(const std::array<T, N>& pTable, char pArc)
+{
+	const auto index = static_cast<uchar>(pArc);
+	return index < N ? pTable[index] : pTable[0];
+}
+
+
+} // namespace
+
+
 void SecurityProtocol::logCritical(const QLatin1String& pTopic) const
 {
 	qCCritical(card) << pTopic << "OID:" << mOid;
@@ -89,13 +118,13 @@ SecurityProtocol::SecurityProtocol(const Oid& pOid)
 	, mHashAlgorithm(std::nullopt)
 {
 	const QByteArray rawOid(mOid);
-	if (rawOid.size() < 8 || !rawOid.startsWith(QByteArray(Oid(KnownOid::BSI_DE_PROTOCOLS_SMARTCARD))))
+	if (rawOid.size() < 8 || !rawOid.startsWith(Oid::getRawOid(KnownOid::BSI_DE_PROTOCOLS_SMARTCARD)))
 	{
 		logCritical("Unknown"_L1);
 		return;
 	}
 
-	mProtocol = cProtocol.value(rawOid.at(7), ProtocolType::UNDEFINED);
+	mProtocol = lookup(cProtocol, rawOid.at(7));
 	if (mProtocol == ProtocolType::UNDEFINED)
 	{
 		logCritical("Unsupported"_L1);
@@ -110,24 +139,21 @@ SecurityProtocol::SecurityProtocol(const Oid& pOid)
 	const char keyAgreement = rawOid.at(8);
 	const char algorithm = rawOid.at(9);
 
-	const auto* hashBase = &cHashAlgorithm;
+	bool rsaHashAlgorithm = false;
 	switch (mProtocol)
 	{
 		case ProtocolType::TA:
-			mSignature = cSignature.value(keyAgreement, SignatureType::UNDEFINED);
+			mSignature = lookup(cSignature, keyAgreement);
 			if (mSignature == SignatureType::UNDEFINED)
 			{
 				logCritical("Unsupported"_L1);
 				return;
 			}
-			if (mSignature == SignatureType::RSA)
-			{
-				hashBase = &cRsaHashAlgorithm;
-			}
+			rsaHashAlgorithm = mSignature == SignatureType::RSA;
 			Q_FALLTHROUGH();
 
 		case ProtocolType::RI:
-			mHashAlgorithm = hashBase->value(algorithm, std::nullopt);
+			mHashAlgorithm = rsaHashAlgorithm ? lookup(cRsaHashAlgorithm, algorithm) : lookup(cHashAlgorithm, algorithm);
 			if (!mHashAlgorithm.has_value())
 			{
 				logCritical("Unknown"_L1);
@@ -135,7 +161,7 @@ SecurityProtocol::SecurityProtocol(const Oid& pOid)
 			return;
 
 		case ProtocolType::PACE:
-			mMapping = cMapping.value(keyAgreement, MappingType::UNDEFINED);
+			mMapping = lookup(cMapping, keyAgreement);
 			if (mMapping == MappingType::UNDEFINED)
 			{
 				logCritical("Unknown"_L1);
@@ -144,13 +170,13 @@ SecurityProtocol::SecurityProtocol(const Oid& pOid)
 			Q_FALLTHROUGH();
 
 		case ProtocolType::CA:
-			mKeyAgreement = cKeyAgreement.value(keyAgreement, KeyAgreementType::UNDEFINED);
+			mKeyAgreement = lookup(cKeyAgreement, keyAgreement);
 			if (mKeyAgreement == KeyAgreementType::UNDEFINED)
 			{
 				logCritical("Unknown"_L1);
 				return;
 			}
-			mCipher = cCipher.value(algorithm, CipherType::UNDEFINED);
+			mCipher = lookup(cCipher, algorithm);
 			if (mCipher == CipherType::UNDEFINED)
 			{
 				logCritical("Unknown"_L1);
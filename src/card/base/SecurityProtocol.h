@@ -9,7 +9,6 @@
 
 #include <QByteArray>
 #include <QCryptographicHash>
-#include <QMap>
 #include <openssl/evp.h>
 
 #include <optional>
@@ -27,14 +26,6 @@ defineEnumType(SignatureType, UNDEFINED, RSA, ECDSA)
 class SecurityProtocol
 {
 	private:
-		static const QMap<char, ProtocolType> cProtocol;
-		static const QMap<char, KeyAgreementType> cKeyAgreement;
-		static const QMap<char, MappingType> cMapping;
-		static const QMap<char, CipherType> cCipher;
-		static const QMap<char, SignatureType> cSignature;
-		static const QMap<char, std::optional<QCryptographicHash::Algorithm>> cHashAlgorithm;
-		static const QMap<char, std::optional<QCryptographicHash::Algorithm>> cRsaHashAlgorithm;
-
 		const Oid mOid;
 
 		ProtocolType mProtocol;
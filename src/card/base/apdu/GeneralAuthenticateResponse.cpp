@@ -5,7 +5,6 @@
 #include "GeneralAuthenticateResponse.h"
 
 #include "PacePinStatus.h"
-#include "asn1/ASN1Util.h"
 
 #include <QLoggingCategory>
 
@@ -54,35 +53,28 @@ int GAResponseApdu::getRetryCounter() const
 }
 
 
-namespace governikus
+BerTlv GAResponseApdu::findDynamicAuthenticationData(QByteArrayView pData, quint32 pTag)
 {
+	const auto dynamicAuthenticationData = BerTlv::parse(pData);
+	if (dynamicAuthenticationData.getTag() != cTagDynamicAuthenticationData)
+	{
+		return BerTlv();
+	}
 
-ASN1_SEQUENCE(ga_encryptednoncedata_st) = {
-	ASN1_IMP(ga_encryptednoncedata_st, mEncryptedNonce, ASN1_OCTET_STRING, 0x00)
+	return BerTlv::find(dynamicAuthenticationData.getValue(), pTag);
 }
 
 
-ASN1_SEQUENCE_END(ga_encryptednoncedata_st)
-
-
-ASN1_ITEM_TEMPLATE(GA_ENCRYPTEDNONCEDATA) =
-			ASN1_EX_TEMPLATE_TYPE(ASN1_TFLG_IMPTAG | ASN1_TFLG_APPLICATION, 0x1C, GA_ENCRYPTEDNONCEDATA, ga_encryptednoncedata_st)
-ASN1_ITEM_TEMPLATE_END(GA_ENCRYPTEDNONCEDATA)
-IMPLEMENT_ASN1_FUNCTIONS(GA_ENCRYPTEDNONCEDATA)
-IMPLEMENT_ASN1_OBJECT(GA_ENCRYPTEDNONCEDATA)
-
-}  // namespace governikus
-
-
 void GAEncryptedNonceResponse::parseDynamicAuthenticationData()
 {
-	auto data = decodeObject<GA_ENCRYPTEDNONCEDATA>(getResponseData());
-	if (data == nullptr)
+	const auto& data = getResponseData();
+	const auto object = findDynamicAuthenticationData(data, cTagEncryptedNonce);
+	if (!object.isValid())
 	{
 		qCCritical(card) << "Cannot parse encrypted nonce, return empty byte array";
 		return;
 	}
-	mEncryptedNonce = Asn1OctetStringUtil::getValue(data->mEncryptedNonce);
+	mEncryptedNonce = object.toByteArray();
 }
 
 
@@ -103,35 +95,16 @@ const QByteArray& GAEncryptedNonceResponse::getEncryptedNonce() const
 }
 
 
-namespace governikus
-{
-
-ASN1_SEQUENCE(ga_mapnoncedata_st) = {
-	ASN1_IMP(ga_mapnoncedata_st, mMappingData, ASN1_OCTET_STRING, 0x02)
-}
-
-
-ASN1_SEQUENCE_END(ga_mapnoncedata_st)
-
-
-ASN1_ITEM_TEMPLATE(GA_MAPNONCEDATA) =
-			ASN1_EX_TEMPLATE_TYPE(ASN1_TFLG_IMPTAG | ASN1_TFLG_APPLICATION, 0x1C, GA_MAPNONCEDATA, ga_mapnoncedata_st)
-ASN1_ITEM_TEMPLATE_END(GA_MAPNONCEDATA)
-IMPLEMENT_ASN1_FUNCTIONS(GA_MAPNONCEDATA)
-IMPLEMENT_ASN1_OBJECT(GA_MAPNONCEDATA)
-
-}  // namespace governikus
-
-
 void GAMapNonceResponse::parseDynamicAuthenticationData()
 {
-	auto data = decodeObject<GA_MAPNONCEDATA>(getResponseData());
-	if (data == nullptr)
+	const auto& data = getResponseData();
+	const auto object = findDynamicAuthenticationData(data, cTagMappingData);
+	if (!object.isValid())
 	{
 		qCCritical(card) << "Cannot parse mapping data, return empty byte array";
 		return;
 	}
-	mMappingData = Asn1OctetStringUtil::getValue(data->mMappingData);
+	mMappingData = object.toByteArray();
 }
 
 
@@ -152,35 +125,16 @@ const QByteArray& GAMapNonceResponse::getMappingData() const
 }
 
 
-namespace governikus
-{
-
-ASN1_SEQUENCE(ga_performkeyagreementdata_st) = {
-	ASN1_IMP(ga_performkeyagreementdata_st, mEphemeralPublicKey, ASN1_OCTET_STRING, 0x04)
-}
-
-
-ASN1_SEQUENCE_END(ga_performkeyagreementdata_st)
-
-
-ASN1_ITEM_TEMPLATE(GA_PERFORMKEYAGREEMENTDATA) =
-			ASN1_EX_TEMPLATE_TYPE(ASN1_TFLG_IMPTAG | ASN1_TFLG_APPLICATION, 0x1C, GA_PERFORMKEYAGREEMENTDATA, ga_performkeyagreementdata_st)
-ASN1_ITEM_TEMPLATE_END(GA_PERFORMKEYAGREEMENTDATA)
-IMPLEMENT_ASN1_FUNCTIONS(GA_PERFORMKEYAGREEMENTDATA)
-IMPLEMENT_ASN1_OBJECT(GA_PERFORMKEYAGREEMENTDATA)
-
-}  // namespace governikus
-
-
 void GAPerformKeyAgreementResponse::parseDynamicAuthenticationData()
 {
-	auto data = decodeObject<GA_PERFORMKEYAGREEMENTDATA>(getResponseData());
-	if (data == nullptr)
+	const auto& data = getResponseData();
+	const auto object = findDynamicAuthenticationData(data, cTagEphemeralPublicKey);
+	if (!object.isValid())
 	{
 		qCCritical(card) << "Cannot parse ephemeral public key, return empty byte array";
 		return;
 	}
-	mEphemeralPublicKey = Asn1OctetStringUtil::getValue(data->mEphemeralPublicKey);
+	mEphemeralPublicKey = object.toByteArray();
 }
 
 
@@ -201,39 +155,18 @@ const QByteArray& GAPerformKeyAgreementResponse::getEphemeralPublicKey() const
 }
 
 
-namespace governikus
-{
-
-ASN1_SEQUENCE(ga_mutualauthenticationdata_st) = {
-	ASN1_IMP(ga_mutualauthenticationdata_st, mAuthenticationToken, ASN1_OCTET_STRING, 0x06),
-	ASN1_IMP_OPT(ga_mutualauthenticationdata_st, mCarCurr, ASN1_OCTET_STRING, 0x07),
-	ASN1_IMP_OPT(ga_mutualauthenticationdata_st, mCarPrev, ASN1_OCTET_STRING, 0x08),
-}
-
-
-ASN1_SEQUENCE_END(ga_mutualauthenticationdata_st)
-
-
-ASN1_ITEM_TEMPLATE(GA_MUTUALAUTHENTICATIONDATA) =
-			ASN1_EX_TEMPLATE_TYPE(ASN1_TFLG_IMPTAG | ASN1_TFLG_APPLICATION, 0x1C, GA_MUTUALAUTHENTICATIONDATA, ga_mutualauthenticationdata_st)
-ASN1_ITEM_TEMPLATE_END(GA_MUTUALAUTHENTICATIONDATA)
-IMPLEMENT_ASN1_FUNCTIONS(GA_MUTUALAUTHENTICATIONDATA)
-IMPLEMENT_ASN1_OBJECT(GA_MUTUALAUTHENTICATIONDATA)
-
-}  // namespace governikus
-
-
 void GAMutualAuthenticationResponse::parseDynamicAuthenticationData()
 {
-	auto data = decodeObject<GA_MUTUALAUTHENTICATIONDATA>(getResponseData());
-	if (data == nullptr)
+	const auto& data = getResponseData();
+	const auto authenticationToken = findDynamicAuthenticationData(data, cTagAuthenticationToken);
+	if (!authenticationToken.isValid())
 	{
 		qCCritical(card) << "Cannot parse authentication token, return empty byte array";
 		return;
 	}
-	mAuthenticationToken = Asn1OctetStringUtil::getValue(data->mAuthenticationToken);
-	mCarCurr = Asn1OctetStringUtil::getValue(data->mCarCurr);
-	mCarPrev = Asn1OctetStringUtil::getValue(data->mCarPrev);
+	mAuthenticationToken = authenticationToken.toByteArray();
+	mCarCurr = findDynamicAuthenticationData(data, cTagCarCurr).toByteArray();
+	mCarPrev = findDynamicAuthenticationData(data, cTagCarPrev).toByteArray();
 
 	qCDebug(card) << "mCarCurr" << mCarCurr;
 	qCDebug(card) << "mCarPrev" << mCarPrev;
@@ -271,38 +204,19 @@ const QByteArray& GAMutualAuthenticationResponse::getCarPrev() const
 }
 
 
-namespace governikus
-{
-
-ASN1_SEQUENCE(ga_chipauthenticationdata_st) = {
-	ASN1_IMP(ga_chipauthenticationdata_st, mNonce, ASN1_OCTET_STRING, 0x01),
-	ASN1_IMP(ga_chipauthenticationdata_st, mAuthenticationToken, ASN1_OCTET_STRING, 0x02),
-}
-
-
-ASN1_SEQUENCE_END(ga_chipauthenticationdata_st)
-
-
-ASN1_ITEM_TEMPLATE(GA_CHIPAUTHENTICATIONDATA) =
-			ASN1_EX_TEMPLATE_TYPE(ASN1_TFLG_IMPTAG | ASN1_TFLG_APPLICATION, 0x1C, GA_CHIPAUTHENTICATIONDATA, ga_chipauthenticationdata_st)
-ASN1_ITEM_TEMPLATE_END(GA_CHIPAUTHENTICATIONDATA)
-IMPLEMENT_ASN1_FUNCTIONS(GA_CHIPAUTHENTICATIONDATA)
-IMPLEMENT_ASN1_OBJECT(GA_CHIPAUTHENTICATIONDATA)
-
-}  // namespace governikus
-
-
 void GAChipAuthenticationResponse::parseDynamicAuthenticationData()
 {
-	auto data = decodeObject<GA_CHIPAUTHENTICATIONDATA>(getResponseData(), false);
-	if (data == nullptr)
+	const auto& data = getResponseData();
+	const auto nonce = findDynamicAuthenticationData(data, cTagNonce);
+	const auto authenticationToken = findDynamicAuthenticationData(data, cTagAuthenticationToken);
+	if (!nonce.isValid() || !authenticationToken.isValid())
 	{
 		qCCritical(card) << "Cannot parse chip authentication response";
 		return;
 	}
 
-	mNonce = Asn1OctetStringUtil::getValue(data->mNonce);
-	mAuthenticationToken = Asn1OctetStringUtil::getValue(data->mAuthenticationToken);
+	mNonce = nonce.toByteArray();
+	mAuthenticationToken = authenticationToken.toByteArray();
 }
 
 
@@ -5,7 +5,7 @@
 #pragma once
 
 #include "ResponseApdu.h"
-#include "asn1/ASN1TemplateUtil.h"
+#include "asn1/BerTlv.h"
 
 
 namespace governikus
@@ -20,7 +20,14 @@ class GAResponseApdu
 		[[nodiscard]] bool isValid() const;
 		[[nodiscard]] QByteArray getResponseData() const;
 
+		/*!
+		 * Returns the data object with the tag inside of the dynamic authentication data.
+		 */
+		[[nodiscard]] static BerTlv findDynamicAuthenticationData(QByteArrayView pData, quint32 pTag);
+
 	public:
+		static constexpr quint32 cTagDynamicAuthenticationData = 0x7C;
+
 		explicit GAResponseApdu(const ResponseApdu& pResponseApdu);
 		[[nodiscard]] bool isEmpty() const;
 		[[nodiscard]] SW1 getSW1() const;
@@ -34,13 +41,6 @@ class GAResponseApdu
  *
  * EncryptedNonce ::= APPLICATION [0x00] IMPLICIT OCTET_STRING
  */
-using GA_ENCRYPTEDNONCEDATA = struct ga_encryptednoncedata_st
-{
-	ASN1_OCTET_STRING* mEncryptedNonce;
-};
-DECLARE_ASN1_OBJECT(GA_ENCRYPTEDNONCEDATA)
-
-
 class GAEncryptedNonceResponse
 	: public GAResponseApdu
 {
@@ -49,6 +49,8 @@ class GAEncryptedNonceResponse
 		QByteArray mEncryptedNonce;
 
 	public:
+		static constexpr quint32 cTagEncryptedNonce = 0x80;
+
 		explicit GAEncryptedNonceResponse(const ResponseApdu& pResponseApdu);
 		[[nodiscard]] const QByteArray& getEncryptedNonce() const;
 };
@@ -60,13 +62,6 @@ class GAEncryptedNonceResponse
  *
  * MappingData ::= APPLICATION [0x02] IMPLICIT OCTET_STRING
  */
-using GA_MAPNONCEDATA = struct ga_mapnoncedata_st
-{
-	ASN1_OCTET_STRING* mMappingData;
-};
-DECLARE_ASN1_OBJECT(GA_MAPNONCEDATA)
-
-
 class GAMapNonceResponse
 	: public GAResponseApdu
 {
@@ -75,6 +70,8 @@ class GAMapNonceResponse
 		QByteArray mMappingData;
 
 	public:
+		static constexpr quint32 cTagMappingData = 0x82;
+
 		explicit GAMapNonceResponse(const ResponseApdu& pResponseApdu);
 		[[nodiscard]] const QByteArray& getMappingData() const;
 };
@@ -86,13 +83,6 @@ class GAMapNonceResponse
  *
  * EphemeralPublicKey ::= APPLICATION [0x04] IMPLICIT OCTET_STRING
  */
-using GA_PERFORMKEYAGREEMENTDATA = struct ga_performkeyagreementdata_st
-{
-	ASN1_OCTET_STRING* mEphemeralPublicKey;
-};
-DECLARE_ASN1_OBJECT(GA_PERFORMKEYAGREEMENTDATA)
-
-
 class GAPerformKeyAgreementResponse
 	: public GAResponseApdu
 {
@@ -101,6 +91,8 @@ class GAPerformKeyAgreementResponse
 		QByteArray mEphemeralPublicKey;
 
 	public:
+		static constexpr quint32 cTagEphemeralPublicKey = 0x84;
+
 		explicit GAPerformKeyAgreementResponse(const ResponseApdu& pResponseApdu);
 		[[nodiscard]] const QByteArray& getEphemeralPublicKey() const;
 };
@@ -114,15 +106,6 @@ class GAPerformKeyAgreementResponse
  * CarCurr             ::= APPLICATION [0x00] IMPLICIT OCTET_STRING OPTIONAL
  * CarPrev             ::= APPLICATION [0x00] IMPLICIT OCTET_STRING OPTIONAL
  */
-using GA_MUTUALAUTHENTICATIONDATA = struct ga_mutualauthenticationdata_st
-{
-	ASN1_OCTET_STRING* mAuthenticationToken;
-	ASN1_OCTET_STRING* mCarCurr;
-	ASN1_OCTET_STRING* mCarPrev;
-};
-DECLARE_ASN1_OBJECT(GA_MUTUALAUTHENTICATIONDATA)
-
-
 class GAMutualAuthenticationResponse
 	: public GAResponseApdu
 {
@@ -133,6 +116,10 @@ class GAMutualAuthenticationResponse
 		QByteArray mCarPrev;
 
 	public:
+		static constexpr quint32 cTagAuthenticationToken = 0x86;
+		static constexpr quint32 cTagCarCurr = 0x87;
+		static constexpr quint32 cTagCarPrev = 0x88;
+
 		explicit GAMutualAuthenticationResponse(const ResponseApdu& pResponseApdu);
 		[[nodiscard]] const QByteArray& getAuthenticationToken() const;
 		[[nodiscard]] const QByteArray& getCarCurr() const;
@@ -147,14 +134,6 @@ class GAMutualAuthenticationResponse
  * Nonce               ::= APPLICATION [0x01] IMPLICIT OCTET_STRING
  * AuthenticationToken ::= APPLICATION [0x02] IMPLICIT OCTET_STRING
  */
-using GA_CHIPAUTHENTICATIONDATA = struct ga_chipauthenticationdata_st
-{
-	ASN1_OCTET_STRING* mNonce;
-	ASN1_OCTET_STRING* mAuthenticationToken;
-};
-DECLARE_ASN1_OBJECT(GA_CHIPAUTHENTICATIONDATA)
-
-
 class GAChipAuthenticationResponse
 	: public GAResponseApdu
 {
@@ -164,6 +143,9 @@ class GAChipAuthenticationResponse
 		QByteArray mAuthenticationToken;
 
 	public:
+		static constexpr quint32 cTagNonce = 0x81;
+		static constexpr quint32 cTagAuthenticationToken = 0x82;
+
 		explicit GAChipAuthenticationResponse(const ResponseApdu& pResponseApdu);
 		[[nodiscard]] const QByteArray& getNonce() const;
 		[[nodiscard]] const QByteArray& getAuthenticationToken() const;
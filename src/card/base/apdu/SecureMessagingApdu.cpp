@@ -4,9 +4,6 @@
 
 #include "SecureMessagingApdu.h"
 
-#include "asn1/ASN1TemplateUtil.h"
-#include "asn1/ASN1Util.h"
-
 #include <QLoggingCategory>
 
 
@@ -16,38 +13,43 @@ using namespace governikus;
 Q_DECLARE_LOGGING_CATEGORY(card)
 
 
-SecureMessagingApdu::SecureMessagingApdu()
+SecureMessagingApdu::SecureMessagingApdu(const QByteArray& pData)
 	: mValid(false)
+	, mData(pData)
 	, mEncryptedData()
 {
 }
 
 
-bool SecureMessagingApdu::decodeData(QByteArray& pData)
+bool SecureMessagingApdu::decodeData(BerTlvReader& pReader)
 {
-	if (pData.isEmpty())
+	if (pReader.atEnd())
 	{
 		qCCritical(card) << "No data to decrypt";
 		return false;
 	}
 
-	if (auto tmp = decodeObject<SM_ENCRYPTED_DATA>(pData, false))
+	mEncryptedData = pReader.take(cTagEncryptedData);
+	if (mEncryptedData.isValid())
 	{
-		mEncryptedData = tmp;
-		const auto encryptedDataValue = Asn1OctetStringUtil::getValue(mEncryptedData.data());
-		if (encryptedDataValue.isEmpty() || encryptedDataValue.at(0) != 0x01)
+		const auto encryptedDataValue = mEncryptedData.getValue();
+		if (encryptedDataValue.isEmpty() || encryptedDataValue.front() != 0x01)
 		{
 			qCCritical(card) << "Error on decoding encrypted data";
 			return false;
 		}
-
-		pData = pData.mid(encodeObject(mEncryptedData.data()).length());
 	}
 
 	return true;
 }
 
 
+QByteArrayView SecureMessagingApdu::getData() const
+{
+	return mData;
+}
+
+
 void SecureMessagingApdu::setValid()
 {
 	mValid = true;
@@ -56,13 +58,23 @@ void SecureMessagingApdu::setValid()
 
 QByteArray SecureMessagingApdu::getEncryptedData() const
 {
-	return Asn1OctetStringUtil::getValue(mEncryptedData.data()).mid(1);
+	if (!mEncryptedData.isValid())
+	{
+		return QByteArray();
+	}
+
+	return mEncryptedData.getValue().sliced(1).toByteArray();
 }
 
 
 QByteArray SecureMessagingApdu::getEncryptedDataObjectEncoded() const
 {
-	return encodeObject(mEncryptedData.data());
+	if (!mEncryptedData.isValid())
+	{
+		return QByteArray();
+	}
+
+	return mEncryptedData.getEncoded().toByteArray();
 }
 
 
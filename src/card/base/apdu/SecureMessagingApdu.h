@@ -4,7 +4,7 @@
 
 #pragma once
 
-#include "SecureMessagingTypes.h"
+#include "asn1/BerTlv.h"
 
 #include <QByteArray>
 
@@ -16,16 +16,27 @@ class SecureMessagingApdu
 {
 	private:
 		bool mValid;
-		QSharedPointer<SM_ENCRYPTED_DATA> mEncryptedData;
+		QByteArray mData;
+		BerTlv mEncryptedData;
 
 	protected:
-		SecureMessagingApdu();
+		explicit SecureMessagingApdu(const QByteArray& pData);
 
-		bool decodeData(QByteArray& pData);
+		/*!
+		 * Reads the optional encrypted data. The data objects are views of the
+		 * data given to the constructor.
+		 */
+		bool decodeData(BerTlvReader& pReader);
+		[[nodiscard]] QByteArrayView getData() const;
 
 		void setValid();
 
 	public:
+		static constexpr quint32 cTagEncryptedData = 0x87;
+		static constexpr quint32 cTagProtectedLe = 0x97;
+		static constexpr quint32 cTagProcessingStatus = 0x99;
+		static constexpr quint32 cTagChecksum = 0x8E;
+
 		/*!
 		 * Returns the encrypted data without padding-content indicator.
 		 */
@@ -4,9 +4,6 @@
 
 #include "SecureMessagingCommand.h"
 
-#include "asn1/ASN1TemplateUtil.h"
-#include "asn1/ASN1Util.h"
-
 #include <QLoggingCategory>
 #include <QtEndian>
 
@@ -18,24 +15,19 @@ Q_DECLARE_LOGGING_CATEGORY(card)
 
 
 SecureMessagingCommand::SecureMessagingCommand(const CommandApdu& pApdu)
-	: SecureMessagingApdu()
+	: SecureMessagingApdu(pApdu.getData())
 	, mExpectedLength()
 	, mChecksum()
 {
-	QByteArray data = pApdu.getData();
-	if (!decodeData(data))
+	BerTlvReader reader(getData());
+	if (!decodeData(reader))
 	{
 		return;
 	}
 
-	mExpectedLength = decodeObject<SM_PROTECTED_LE>(data, false);
-	if (mExpectedLength)
-	{
-		data = data.mid(encodeObject(mExpectedLength.data()).length());
-	}
-
-	mChecksum = decodeObject<SM_CHECKSUM>(data, false);
-	if (mChecksum == nullptr || mChecksum->length != 8)
+	mExpectedLength = reader.take(cTagProtectedLe);
+	mChecksum = reader.take(cTagChecksum);
+	if (!mChecksum.isValid() || mChecksum.getValue().size() != 8)
 	{
 		qCCritical(card) << "Error on decoding mac";
 		return;
@@ -47,7 +39,7 @@ SecureMessagingCommand::SecureMessagingCommand(const CommandApdu& pApdu)
 
 int SecureMessagingCommand::getExpectedLength() const
 {
-	const QByteArray expectedLength = Asn1OctetStringUtil::getValue(mExpectedLength.data());
+	const auto expectedLength = mExpectedLength.getValue();
 
 	if (expectedLength.isEmpty())
 	{
@@ -75,11 +67,16 @@ int SecureMessagingCommand::getExpectedLength() const
 
 QByteArray SecureMessagingCommand::getExpectedLengthObjectEncoded() const
 {
-	return encodeObject(mExpectedLength.data());
+	if (!mExpectedLength.isValid())
+	{
+		return QByteArray();
+	}
+
+	return mExpectedLength.getEncoded().toByteArray();
 }
 
 
 QByteArray SecureMessagingCommand::getMac() const
 {
-	return Asn1OctetStringUtil::getValue(mChecksum.data());
+	return mChecksum.toByteArray();
 }
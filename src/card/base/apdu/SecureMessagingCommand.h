@@ -26,8 +26,8 @@ class SecureMessagingCommand
 	friend class ::test_SecureMessaging;
 
 	private:
-		QSharedPointer<SM_PROTECTED_LE> mExpectedLength;
-		QSharedPointer<SM_CHECKSUM> mChecksum;
+		BerTlv mExpectedLength;
+		BerTlv mChecksum;
 
 	public:
 		explicit SecureMessagingCommand(const CommandApdu& pApdu);
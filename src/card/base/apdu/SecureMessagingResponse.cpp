@@ -4,9 +4,6 @@
 
 #include "SecureMessagingResponse.h"
 
-#include "asn1/ASN1TemplateUtil.h"
-#include "asn1/ASN1Util.h"
-
 #include <QLoggingCategory>
 
 
@@ -17,28 +14,25 @@ Q_DECLARE_LOGGING_CATEGORY(card)
 
 
 SecureMessagingResponse::SecureMessagingResponse(const ResponseApdu& pApdu)
-	: SecureMessagingApdu()
+	: SecureMessagingApdu(pApdu.getData())
 	, mProcessingStatus()
 	, mChecksum()
 {
-	QByteArray data = pApdu.getData();
-	if (!decodeData(data))
+	BerTlvReader reader(getData());
+	if (!decodeData(reader))
 	{
 		return;
 	}
 
-
-	mProcessingStatus = decodeObject<SM_PROCESSING_STATUS>(data);
-	if (mProcessingStatus == nullptr || mProcessingStatus->length != 2)
+	mProcessingStatus = reader.take(cTagProcessingStatus);
+	if (!mProcessingStatus.isValid() || mProcessingStatus.getValue().size() != 2)
 	{
 		qCCritical(card) << "Error on decoding status";
 		return;
 	}
-	data = data.mid(encodeObject(mProcessingStatus.data()).length());
-
 
-	mChecksum = decodeObject<SM_CHECKSUM>(data);
-	if (mChecksum == nullptr || mChecksum->length != 8)
+	mChecksum = reader.take(cTagChecksum);
+	if (!mChecksum.isValid() || mChecksum.getValue().size() != 8)
 	{
 		qCCritical(card) << "Error on decoding mac";
 		return;
@@ -50,7 +44,7 @@ SecureMessagingResponse::SecureMessagingResponse(const ResponseApdu& pApdu)
 
 QByteArray SecureMessagingResponse::getMac() const
 {
-	return Asn1OctetStringUtil::getValue(mChecksum.data());
+	return mChecksum.toByteArray();
 }
 
 
@@ -74,11 +68,16 @@ StatusCode SecureMessagingResponse::getSecuredStatusCode() const
 
 QByteArray SecureMessagingResponse::getSecuredStatusCodeBytes() const
 {
-	return Asn1OctetStringUtil::getValue(mProcessingStatus.data());
+	return mProcessingStatus.toByteArray();
 }
 
 
 QByteArray SecureMessagingResponse::getSecuredStatusCodeObjectEncoded() const
 {
-	return encodeObject(mProcessingStatus.data());
+	if (!mProcessingStatus.isValid())
+	{
+		return QByteArray();
+	}
+
+	return mProcessingStatus.getEncoded().toByteArray();
 }
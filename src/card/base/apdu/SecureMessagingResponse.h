@@ -21,8 +21,8 @@ class SecureMessagingResponse
 	Q_DISABLE_COPY(SecureMessagingResponse)
 
 	private:
-		QSharedPointer<SM_PROCESSING_STATUS> mProcessingStatus;
-		QSharedPointer<SM_CHECKSUM> mChecksum;
+		BerTlv mProcessingStatus;
+		BerTlv mChecksum;
 
 	public:
 		explicit SecureMessagingResponse(const ResponseApdu& pApdu);
@@ -0,0 +1,313 @@
+/**
+ * Copyright (c) 2025 Governikus GmbH & Co. KG, Germany
+ */
+
+#pragma once
+
+#include "AccessRoleAndRight.h"
+
+#include <QDebug>
+#include <QList>
+#include <QtAlgorithms>
+
+#include <initializer_list>
+#include <iterator>
+
+
+namespace governikus
+{
+
+/*!
+ * Set of AccessRight stored in the bit positions of the CHAT discretionary data.
+ * Bits 38 and 39 hold the AccessRole and are never part of the set.
+ *
+ * The interface follows QSet, iteration is ordered by the bit position.
+ */
+class AccessRights
+{
+	public:
+		static constexpr uint cBitCount = 38;
+		static constexpr quint64 cMask = (Q_UINT64_C(1) << cBitCount) - 1;
+
+		class const_iterator
+		{
+			private:
+				quint64 mBits;
+
+			public:
+				using iterator_category = std::forward_iterator_tag;
+				using value_type = AccessRight;
+				using difference_type = qptrdiff;
+				using pointer = const AccessRight*;
+				using reference = AccessRight;
+
+				constexpr explicit const_iterator(quint64 pBits = 0)
+					: mBits(pBits)
+				{
+				}
+
+
+				[[nodiscard]] constexpr AccessRight operator*() const
+				{
+					return static_cast<AccessRight>(qCountTrailingZeroBits(mBits));
+				}
+
+
+				constexpr const_iterator& operator++()
+				{
+					mBits &= mBits - 1;
+					return *this;
+				}
+
+
+				constexpr const_iterator operator++(int)
+				{
+					const auto copy = *this;
+					++*this;
+					return copy;
+				}
+
+
+				[[nodiscard]] constexpr bool operator==(const const_iterator& pOther) const
+				{
+					return mBits == pOther.mBits;
+				}
+
+
+				[[nodiscard]] constexpr bool operator!=(const const_iterator& pOther) const
+				{
+					return mBits != pOther.mBits;
+				}
+
+
+		};
+
+	private:
+		quint64 mBits;
+
+		[[nodiscard]] static constexpr quint64 toBit(AccessRight pRight)
+		{
+			const auto index = static_cast<uint>(pRight);
+			return index < cBitCount ? Q_UINT64_C(1) << index : 0;
+		}
+
+	public:
+		constexpr AccessRights()
+			: mBits(0)
+		{
+		}
+
+
+		constexpr AccessRights(std::initializer_list<AccessRight> pRights)
+			: mBits(0)
+		{
+			for (const auto right : pRights)
+			{
+				mBits |= toBit(right);
+			}
+		}
+
+
+		template<typename InputIterator>
+		AccessRights(InputIterator pFirst, InputIterator pLast)
+			: mBits(0)
+		{
+			for (; pFirst != pLast; ++pFirst)
+			{
+				mBits |= toBit(*pFirst);
+			}
+		}
+
+
+		[[nodiscard]] static constexpr AccessRights fromBits(quint64 pBits)
+		{
+			AccessRights rights;
+			rights.mBits = pBits & cMask;
+			return rights;
+		}
+
+
+		[[nodiscard]] constexpr quint64 toBits() const
+		{
+			return mBits;
+		}
+
+
+		[[nodiscard]] constexpr bool isEmpty() const
+		{
+			return mBits == 0;
+		}
+
+
+		[[nodiscard]] constexpr qsizetype size() const
+		{
+			return static_cast<qsizetype>(qPopulationCount(mBits));
+		}
+
+
+		[[nodiscard]] constexpr bool contains(AccessRight pRight) const
+		{
+			const auto bit = toBit(pRight);
+			return bit != 0 && (mBits & bit) == bit;
+		}
+
+
+		[[nodiscard]] constexpr bool contains(const AccessRights& pOther) const
+		{
+			return (mBits & pOther.mBits) == pOther.mBits;
+		}
+
+
+		constexpr void insert(AccessRight pRight)
+		{
+			mBits |= toBit(pRight);
+		}
+
+
+		constexpr bool remove(AccessRight pRight)
+		{
+			const bool contained = contains(pRight);
+			mBits &= ~toBit(pRight);
+			return contained;
+		}
+
+
+		constexpr void clear()
+		{
+			mBits = 0;
+		}
+
+
+		constexpr AccessRights& unite(const AccessRights& pOther)
+		{
+			mBits |= pOther.mBits;
+			return *this;
+		}
+
+
+		constexpr AccessRights& intersect(const AccessRights& pOther)
+		{
+			mBits &= pOther.mBits;
+			return *this;
+		}
+
+
+		constexpr AccessRights& subtract(const AccessRights& pOther)
+		{
+			mBits &= ~pOther.mBits;
+			return *this;
+		}
+
+
+		[[nodiscard]] QList<AccessRight> values() const
+		{
+			QList<AccessRight> list;
+			list.reserve(size());
+			for (const auto right : *this)
+			{
+				list << right;
+			}
+			return list;
+		}
+
+
+		[[nodiscard]] constexpr const_iterator begin() const
+		{
+			return const_iterator(mBits);
+		}
+
+
+		[[nodiscard]] constexpr const_iterator end() const
+		{
+			return const_iterator();
+		}
+
+
+		constexpr AccessRights& operator+=(AccessRight pRight)
+		{
+			insert(pRight);
+			return *this;
+		}
+
+
+		constexpr AccessRights& operator-=(AccessRight pRight)
+		{
+			remove(pRight);
+			return *this;
+		}
+
+
+		constexpr AccessRights& operator+=(const AccessRights& pOther)
+		{
+			return unite(pOther);
+		}
+
+
+		constexpr AccessRights& operator|=(const AccessRights& pOther)
+		{
+			return unite(pOther);
+		}
+
+
+		constexpr AccessRights& operator&=(const AccessRights& pOther)
+		{
+			return intersect(pOther);
+		}
+
+
+		constexpr AccessRights& operator-=(const AccessRights& pOther)
+		{
+			return subtract(pOther);
+		}
+
+
+		[[nodiscard]] friend constexpr AccessRights operator+(AccessRights pLeft, const AccessRights& pRight)
+		{
+			return pLeft.unite(pRight);
+		}
+
+
+		[[nodiscard]] friend constexpr AccessRights operator|(AccessRights pLeft, const AccessRights& pRight)
+		{
+			return pLeft.unite(pRight);
+		}
+
+
+		[[nodiscard]] friend constexpr AccessRights operator&(AccessRights pLeft, const AccessRights& pRight)
+		{
+			return pLeft.intersect(pRight);
+		}
+
+
+		[[nodiscard]] friend constexpr AccessRights operator-(AccessRights pLeft, const AccessRights& pRight)
+		{
+			return pLeft.subtract(pRight);
+		}
+
+
+		[[nodiscard]] friend constexpr bool operator==(const AccessRights& pLeft, const AccessRights& pRight)
+		{
+			return pLeft.mBits == pRight.mBits;
+		}
+
+
+		[[nodiscard]] friend constexpr bool operator!=(const AccessRights& pLeft, const AccessRights& pRight)
+		{
+			return pLeft.mBits != pRight.mBits;
+		}
+
+
+};
+
+
+inline QDebug operator<<(QDebug pDbg, const AccessRights& pRights)
+{
+	QDebugStateSaver saver(pDbg);
+	pDbg.nospace() << "AccessRights" << pRights.values();
+	return pDbg;
+}
+
+
+} // namespace governikus
+
+Q_DECLARE_TYPEINFO(governikus::AccessRights, Q_PRIMITIVE_TYPE);
@@ -0,0 +1,324 @@
+/**
+ * Copyright (c) 2025 Governikus GmbH & Co. KG, Germany
+ */
+
+#pragma once
+
+#include <QByteArray>
+#include <QByteArrayView>
+
+
+namespace governikus
+{
+
+/*!
+ * Data object of ISO 7816-4 BER-TLV. The tag is stored with all its bytes,
+ * e.g. 0x7C or 0x7F49. Value and encoding are views of the parsed data,
+ * so the data must outlive the object.
+ *
+ * This is meant for the simple data objects of the APDU path like secure
+ * messaging and dynamic authentication data. Signed structures are still
+ * decoded by the OpenSSL templates.
+ */
+class BerTlv
+{
+	public:
+		static constexpr qsizetype cMaxLength = 0xFFFFFF;
+
+	private:
+		quint32 mTag;
+		QByteArrayView mValue;
+		QByteArrayView mEncoded;
+
+		static bool parseTag(QByteArrayView pData, qsizetype& pOffset, quint32& pTag)
+		{
+			if (pOffset >= pData.size())
+			{
+				return false;
+			}
+
+			pTag = static_cast<uchar>(pData[pOffset++]);
+			if ((pTag & 0x1F) != 0x1F)
+			{
+				return true;
+			}
+
+			for (int i = 0; i < 3; ++i)
+			{
+				if (pOffset >= pData.size())
+				{
+					return false;
+				}
+
+				const auto tagByte = static_cast<uchar>(pData[pOffset++]);
+				if (i == 0 && tagByte == 0x80)
+				{
+					return false;
+				}
+
+				pTag = (pTag << 8) | tagByte;
+				if ((tagByte & 0x80) == 0)
+				{
+					return true;
+				}
+			}
+
+			return false;
+		}
+
+
+		static bool parseLength(QByteArrayView pData, qsizetype& pOffset, qsizetype& pLength)
+		{
+			if (pOffset >= pData.size())
+			{
+				return false;
+			}
+
+			const auto first = static_cast<uchar>(pData[pOffset++]);
+			if (first < 0x80)
+			{
+				pLength = first;
+				return true;
+			}
+
+			const int count = first & 0x7F;
+			if (count == 0 || count > 3 || count > pData.size() - pOffset)
+			{
+				return false;
+			}
+
+			pLength = 0;
+			for (int i = 0; i < count; ++i)
+			{
+				pLength = (pLength << 8) | static_cast<uchar>(pData[pOffset++]);
+			}
+			return true;
+		}
+
+	public:
+		BerTlv()
+			: mTag(0)
+			, mValue()
+			, mEncoded()
+		{
+		}
+
+
+		/*!
+		 * Parses the first data object of the data. Trailing data is ignored.
+		 */
+		[[nodiscard]] static BerTlv parse(QByteArrayView pData)
+		{
+			BerTlv tlv;
+			qsizetype offset = 0;
+			qsizetype length = 0;
+			if (!parseTag(pData, offset, tlv.mTag) || !parseLength(pData, offset, length) || length > pData.size() - offset)
+			{
+				return BerTlv();
+			}
+
+			tlv.mValue = pData.sliced(offset, length);
+			tlv.mEncoded = pData.first(offset + length);
+			return tlv;
+		}
+
+
+		/*!
+		 * Returns the first data object with the tag on the top level of the data.
+		 */
+		[[nodiscard]] static BerTlv find(QByteArrayView pData, quint32 pTag)
+		{
+			while (!pData.isEmpty())
+			{
+				const auto tlv = parse(pData);
+				if (!tlv.isValid() || tlv.getTag() == pTag)
+				{
+					return tlv;
+				}
+				pData.slice(tlv.getEncoded().size());
+			}
+
+			return BerTlv();
+		}
+
+
+		static void append(QByteArray& pData, quint32 pTag, QByteArrayView pValue)
+		{
+			Q_ASSERT(pValue.size() <= cMaxLength);
+
+			for (int shift = 24; shift > 0; shift -= 8)
+			{
+				if (const auto tagByte = static_cast<char>(pTag >> shift); tagByte != 0)
+				{
+					pData += tagByte;
+				}
+			}
+			pData += static_cast<char>(pTag);
+
+			const auto length = pValue.size();
+			if (length >= 0x10000)
+			{
+				pData += static_cast<char>(0x83);
+				pData += static_cast<char>(length >> 16);
+				pData += static_cast<char>(length >> 8);
+			}
+			else if (length >= 0x100)
+			{
+				pData += static_cast<char>(0x82);
+				pData += static_cast<char>(length >> 8);
+			}
+			else if (length >= 0x80)
+			{
+				pData += static_cast<char>(0x81);
+			}
+			pData += static_cast<char>(length);
+			pData += pValue;
+		}
+
+
+		[[nodiscard]] static QByteArray encode(quint32 pTag, QByteArrayView pValue)
+		{
+			QByteArray data;
+			data.reserve(pValue.size() + 8);
+			append(data, pTag, pValue);
+			return data;
+		}
+
+
+		[[nodiscard]] bool isValid() const
+		{
+			return !mEncoded.isEmpty();
+		}
+
+
+		[[nodiscard]] quint32 getTag() const
+		{
+			return mTag;
+		}
+
+
+		[[nodiscard]] bool isConstructed() const
+		{
+			quint32 first = mTag;
+			while (first > 0xFF)
+			{
+				first >>= 8;
+			}
+			return (first & 0x20) != 0;
+		}
+
+
+		[[nodiscard]] QByteArrayView getValue() const
+		{
+			return mValue;
+		}
+
+
+		[[nodiscard]] QByteArrayView getEncoded() const
+		{
+			return mEncoded;
+		}
+
+
+		/*!
+		 * Returns an owning copy of the value or a null QByteArray if the object is invalid.
+		 */
+		[[nodiscard]] QByteArray toByteArray() const
+		{
+			return isValid() ? mValue.toByteArray() : QByteArray();
+		}
+
+
+};
+
+
+/*!
+ * Sequential reader for the data objects on one level of BER-TLV data.
+ * After a malformed object the reader stays at the end and reports an error.
+ */
+class BerTlvReader
+{
+	private:
+		QByteArrayView mData;
+		bool mError;
+
+	public:
+		explicit BerTlvReader(QByteArrayView pData)
+			: mData(pData)
+			, mError(false)
+		{
+		}
+
+
+		[[nodiscard]] bool atEnd() const
+		{
+			return mError || mData.isEmpty();
+		}
+
+
+		[[nodiscard]] bool hasError() const
+		{
+			return mError;
+		}
+
+
+		[[nodiscard]] QByteArrayView getRemaining() const
+		{
+			return mError ? QByteArrayView() : mData;
+		}
+
+
+		/*!
+		 * Returns the next data object or an invalid one at the end or on error.
+		 */
+		BerTlv next()
+		{
+			if (atEnd())
+			{
+				return BerTlv();
+			}
+
+			const auto tlv = BerTlv::parse(mData);
+			if (!tlv.isValid())
+			{
+				mError = true;
+				return tlv;
+			}
+
+			mData.slice(tlv.getEncoded().size());
+			return tlv;
+		}
+
+
+		/*!
+		 * Returns the next data object if it has the tag. Otherwise the reader
+		 * is not advanced and an invalid object is returned, so optional
+		 * objects can be skipped.
+		 */
+		BerTlv take(quint32 pTag)
+		{
+			if (atEnd())
+			{
+				return BerTlv();
+			}
+
+			const auto tlv = BerTlv::parse(mData);
+			if (!tlv.isValid())
+			{
+				mError = true;
+				return tlv;
+			}
+
+			if (tlv.getTag() != pTag)
+			{
+				return BerTlv();
+			}
+
+			mData.slice(tlv.getEncoded().size());
+			return tlv;
+		}
+
+
+};
+
+}  // namespace governikus
@@ -135,7 +135,7 @@ AccessRole CHAT::getAccessRole() const
 }
 
 
-QSet<AccessRight> CHAT::getAccessRights() const
+quint64 chat_st::getTemplateBits() const
 {
 	quint64 accessRoleAndRights = 0;
 	for (int i = 0; i < mTemplate->length; ++i)
@@ -143,25 +143,32 @@ QSet<AccessRight> CHAT::getAccessRights() const
 		accessRoleAndRights <<= 8;
 		accessRoleAndRights += mTemplate->data[i];
 	}
+	return accessRoleAndRights;
+}
+
 
-	QSet<AccessRight> accessRights;
-	for (auto accessRight : AccessRoleAndRightsUtil::allRights())
+void chat_st::setTemplateBits(quint64 pBits)
+{
+	std::array<uchar, 5> bytes {};
+	for (size_t i = 0; i < bytes.size(); ++i)
 	{
-		quint64 mask = 1ULL << static_cast<uint>(accessRight);
-		if ((accessRoleAndRights & mask) == mask)
-		{
-			accessRights.insert(accessRight);
-		}
+		bytes[i] = static_cast<uchar>(pBits >> (8 * (bytes.size() - 1 - i)));
 	}
-	return accessRights;
+	ASN1_OCTET_STRING_set(mTemplate, bytes.data(), static_cast<int>(bytes.size()));
+}
+
+
+AccessRights CHAT::getAccessRights() const
+{
+	return AccessRights::fromBits(getTemplateBits());
 }
 
 
-void CHAT::setAccessRights(const QSet<AccessRight>& pAccessRights)
+void CHAT::setAccessRights(const AccessRights& pAccessRights)
 {
-	for (auto accessRight : pAccessRights)
+	if (!pAccessRights.isEmpty())
 	{
-		setTemplateBit(static_cast<uint>(accessRight), true);
+		setTemplateBits(getTemplateBits() | pAccessRights.toBits());
 	}
 }
 
@@ -174,10 +181,9 @@ bool CHAT::hasAccessRight(AccessRight pAccessRight) const
 
 void CHAT::removeAllAccessRights()
 {
-	const auto& rights = getAccessRights();
-	for (auto accessRight : rights)
+	if (const auto bits = getTemplateBits(); (bits & AccessRights::cMask) != 0)
 	{
-		removeAccessRight(accessRight);
+		setTemplateBits(bits & ~AccessRights::cMask);
 	}
 }
 
@@ -5,7 +5,7 @@
 #pragma once
 
 #include "ASN1TemplateUtil.h"
-#include "AccessRoleAndRight.h"
+#include "AccessRights.h"
 #include "Oid.h"
 
 #include <openssl/asn1t.h>
@@ -78,13 +78,15 @@ using CHAT = struct chat_st
 	[[nodiscard]] QByteArray getTemplate() const;
 	[[nodiscard]] AccessRole getAccessRole() const;
 
-	[[nodiscard]] QSet<AccessRight> getAccessRights() const;
-	void setAccessRights(const QSet<AccessRight>& pAccessRights);
+	[[nodiscard]] AccessRights getAccessRights() const;
+	void setAccessRights(const AccessRights& pAccessRights);
 	[[nodiscard]] bool hasAccessRight(AccessRight pAccessRight) const;
 	void removeAllAccessRights();
 	void removeAccessRight(AccessRight pAccessRight);
 
 	private:
+		[[nodiscard]] quint64 getTemplateBits() const;
+		void setTemplateBits(quint64 pBits);
 		void setTemplateBit(uint pBitIndex, bool pOn);
 
 	public:
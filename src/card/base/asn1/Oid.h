@@ -11,8 +11,12 @@
 #include "EnumHelper.h"
 
 #include <QByteArray>
+#include <QByteArrayView>
+#include <QList>
 #include <openssl/objects.h>
 
+#include <optional>
+
 
 class test_Oid;
 
@@ -137,13 +141,19 @@ class Oid
 	friend class ::test_Oid;
 
 	private:
-		static QMap<KnownOid, int> cKnownOids;
+		static QList<int> cKnownNids;
 
 		ASN1_OBJECT* mObject;
 
 	public:
 		static void createKnownOids();
 
+		/*!
+		 * Returns the content bytes of the DER encoding from the compile time registry.
+		 */
+		[[nodiscard]] static QByteArrayView getRawOid(KnownOid pOid);
+		[[nodiscard]] static std::optional<KnownOid> toKnownOid(QByteArrayView pRawOid);
+
 		Oid();
 		Oid(KnownOid pOid);
 		explicit Oid(const ASN1_OBJECT* pObject);
@@ -155,6 +165,7 @@ class Oid
 		Oid& operator=(const Oid& pOid);
 		Oid& operator=(Oid&&) noexcept;
 
+		[[nodiscard]] std::optional<KnownOid> getKnownOid() const;
 		bool isUndefined() const;
 
 		explicit operator QByteArray() const;
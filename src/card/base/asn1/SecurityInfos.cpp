@@ -5,6 +5,8 @@
 #include "SecurityInfos.h"
 
 #include "ASN1TemplateUtil.h"
+#include "BerTlv.h"
+#include "Oid.h"
 
 #include <QLoggingCategory>
 
@@ -26,6 +28,60 @@ IMPLEMENT_ASN1_OBJECT(securityinfos_st)
 } // namespace governikus
 
 
+namespace
+{
+enum class SecurityInfoType
+{
+	MOBILE_EID_TYPE,
+	PACE,
+	CA,
+	OTHER
+};
+
+
+constexpr quint32 cTagSet = 0x31;
+constexpr quint32 cTagSequence = 0x30;
+
+
+SecurityInfoType guessType(const BerTlv& pSecurityInfo)
+{
+	const auto smartcardProtocols = Oid::getRawOid(KnownOid::BSI_DE_PROTOCOLS_SMARTCARD);
+	const auto mobileEIDType = Oid::getRawOid(KnownOid::ID_MOBILE_EID_TYPE);
+
+	const auto protocol = BerTlv::parse(pSecurityInfo.getValue());
+	if (protocol.getTag() != V_ASN1_OBJECT)
+	{
+		return SecurityInfoType::OTHER;
+	}
+
+	const auto rawOid = protocol.getValue();
+	if (rawOid.startsWith(mobileEIDType))
+	{
+		return SecurityInfoType::MOBILE_EID_TYPE;
+	}
+
+	if (rawOid.size() > smartcardProtocols.size() && rawOid.startsWith(smartcardProtocols))
+	{
+		switch (rawOid.at(smartcardProtocols.size()))
+		{
+			case 3:
+				return SecurityInfoType::CA;
+
+			case 4:
+				return SecurityInfoType::PACE;
+
+			default:
+				break;
+		}
+	}
+
+	return SecurityInfoType::OTHER;
+}
+
+
+} // namespace
+
+
 QSharedPointer<SecurityInfos> SecurityInfos::fromHex(const QByteArray& pHexString)
 {
 	return SecurityInfos::decode(QByteArray::fromHex(pHexString));
@@ -34,9 +90,10 @@ QSharedPointer<SecurityInfos> SecurityInfos::fromHex(const QByteArray& pHexStrin
 
 QSharedPointer<SecurityInfos> SecurityInfos::decode(const QByteArray& pBytes)
 {
-	auto securityInfosStruct = decodeObject<securityinfos_st>(pBytes);
-	if (securityInfosStruct == nullptr)
+	const auto set = BerTlv::parse(pBytes);
+	if (set.getTag() != cTagSet)
 	{
+		qCWarning(card) << "Cannot decode SecurityInfos";
 		return QSharedPointer<SecurityInfos>();
 	}
 
@@ -45,40 +102,62 @@ QSharedPointer<SecurityInfos> SecurityInfos::decode(const QByteArray& pBytes)
 	QList<QSharedPointer<const ChipAuthenticationInfo>> chipAuthenticationInfos;
 	QSharedPointer<const MobileEIDTypeInfo> mobileEIDTypeInfo;
 
-	for (int i = 0; i < sk_securityinfo_st_num(securityInfosStruct.data()); ++i)
+	BerTlvReader reader(set.getValue());
+	while (!reader.atEnd())
 	{
-		securityinfo_st* secInfoStruct = sk_securityinfo_st_value(securityInfosStruct.data(), i);
-		QByteArray bytes = encodeObject(secInfoStruct);
+		const auto element = reader.next();
+		if (!element.isValid() || element.getTag() != cTagSequence)
+		{
+			qCCritical(card) << "Cannot parse as SecurityInfo" << pBytes.toHex();
+			return QSharedPointer<SecurityInfos>();
+		}
+
+		// The elements are decoded by OpenSSL which copies the data, so it is not necessary to copy them here.
+		const auto bytes = QByteArray::fromRawData(element.getEncoded().data(), element.getEncoded().size());
+		const auto type = guessType(element);
+		const auto count = securityInfos.size();
 
-		if (auto meid = MobileEIDTypeInfo::decode(bytes))
+		if (type == SecurityInfoType::MOBILE_EID_TYPE)
 		{
-			if (mobileEIDTypeInfo)
+			if (auto meid = MobileEIDTypeInfo::decode(bytes))
 			{
-				qCCritical(card) << "More than one MobileEIDTypeInfo found:" << meid;
-				return QSharedPointer<SecurityInfos>();
+				if (mobileEIDTypeInfo)
+				{
+					qCCritical(card) << "More than one MobileEIDTypeInfo found:" << meid;
+					return QSharedPointer<SecurityInfos>();
+				}
+				mobileEIDTypeInfo = meid;
+				securityInfos << meid;
 			}
-			mobileEIDTypeInfo = meid;
-			securityInfos << meid;
-		}
-		else if (auto pi = PaceInfo::decode(bytes))
-		{
-			paceInfos << pi;
-			securityInfos << pi;
 		}
-		else if (auto cai = ChipAuthenticationInfo::decode(bytes))
+		else if (type == SecurityInfoType::PACE)
 		{
-			chipAuthenticationInfos << cai;
-			securityInfos << cai;
+			if (auto pi = PaceInfo::decode(bytes))
+			{
+				paceInfos << pi;
+				securityInfos << pi;
+			}
 		}
-		else if (auto secInfo = SecurityInfo::decode(bytes))
+		else if (type == SecurityInfoType::CA)
 		{
-			securityInfos << secInfo;
+			if (auto cai = ChipAuthenticationInfo::decode(bytes))
+			{
+				chipAuthenticationInfos << cai;
+				securityInfos << cai;
+			}
 		}
 
-		if (securityInfos.size() == i)
+		if (securityInfos.size() == count)
 		{
-			qCCritical(card) << "Cannot parse as SecurityInfo" << pBytes.toHex();
-			return QSharedPointer<SecurityInfos>();
+			if (auto secInfo = SecurityInfo::decode(bytes))
+			{
+				securityInfos << secInfo;
+			}
+			else
+			{
+				qCCritical(card) << "Cannot parse as SecurityInfo" << pBytes.toHex();
+				return QSharedPointer<SecurityInfos>();
+			}
 		}
 	}
 
@@ -6,11 +6,13 @@
 
 #include "CardReturnCode.h"
 #include "GlobalStatus.h"
+#include "HexCodec.h"
 #include "InputAPDUInfo.h"
 
 #include <QLoggingCategory>
 
 #include <algorithm>
+#include <array>
 
 
 Q_DECLARE_LOGGING_CATEGORY(card)
@@ -25,7 +27,7 @@ TransmitCommand::TransmitCommand(QSharedPointer<CardConnectionWorker> pCardConne
 	: BaseCardCommand(pCardConnectionWorker)
 	, mInputApduInfos(pInputApduInfos)
 	, mSlotHandle(pSlotHandle)
-	, mOutputApduAsHex()
+	, mOutputApdus()
 	, mSecureMessagingStopped(false)
 {
 	connect(pCardConnectionWorker.data(), &CardConnectionWorker::fireSecureMessagingStopped, this, [this](){
@@ -43,7 +45,12 @@ bool TransmitCommand::isAcceptable(const InputAPDUInfo& pInputApduInfo, const Re
 		return true;
 	}
 
-	const auto& responseBytes = pResponse.getStatusBytes().toHex();
+	const auto& statusBytes = pResponse.getStatusBytes();
+	Q_ASSERT(statusBytes.size() <= 2);
+	std::array<char, 4> buffer {};
+	hex::encode(statusBytes, buffer.data());
+	const QByteArrayView responseBytes(buffer.data(), hex::getEncodedSize(statusBytes.size()));
+
 	return std::any_of(acceptableStatusCodes.constBegin(), acceptableStatusCodes.constEnd(),
 			[&responseBytes](const auto& pCode)
 			{
@@ -52,10 +59,22 @@ bool TransmitCommand::isAcceptable(const InputAPDUInfo& pInputApduInfo, const Re
 }
 
 
+QByteArrayList TransmitCommand::getOutputApduAsHex() const
+{
+	QByteArrayList result;
+	result.reserve(mOutputApdus.size());
+	for (const auto& apdu : mOutputApdus)
+	{
+		result += hex::encode(apdu);
+	}
+	return result;
+}
+
+
 void TransmitCommand::internalExecute()
 {
 	Q_ASSERT(!mInputApduInfos.isEmpty());
-	Q_ASSERT(mOutputApduAsHex.isEmpty());
+	Q_ASSERT(mOutputApdus.isEmpty());
 
 	for (const auto& inputApduInfo : mInputApduInfos)
 	{
@@ -75,7 +94,7 @@ void TransmitCommand::internalExecute()
 			return;
 		}
 
-		mOutputApduAsHex += QByteArray(response).toHex();
+		mOutputApdus += QByteArray(response);
 		if (isAcceptable(inputApduInfo, response))
 		{
 			continue;
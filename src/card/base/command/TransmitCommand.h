@@ -24,7 +24,7 @@ class TransmitCommand
 	private:
 		const QList<InputAPDUInfo> mInputApduInfos;
 		const QString mSlotHandle;
-		QByteArrayList mOutputApduAsHex;
+		QByteArrayList mOutputApdus;
 		bool mSecureMessagingStopped;
 
 	protected:
@@ -38,12 +38,15 @@ class TransmitCommand
 
 		static bool isAcceptable(const InputAPDUInfo& pInputApduInfo, const ResponseApdu& pResponse);
 
-		[[nodiscard]] const QByteArrayList& getOutputApduAsHex() const
+		[[nodiscard]] const QByteArrayList& getOutputApdus() const
 		{
-			return mOutputApduAsHex;
+			return mOutputApdus;
 		}
 
 
+		[[nodiscard]] QByteArrayList getOutputApduAsHex() const;
+
+
 		[[nodiscard]] const QString& getSlotHandle() const
 		{
 			return mSlotHandle;
@@ -5,6 +5,7 @@
 #include "pace/PaceHandler.h"
 
 #include "SecurityProtocol.h"
+#include "Tracer.h"
 #include "apdu/CommandApdu.h"
 #include "apdu/PacePinStatus.h"
 #include "asn1/ASN1Struct.h"
@@ -44,6 +45,12 @@ SecurityProtocol PaceHandler::getPaceProtocol() const
 
 CardReturnCode PaceHandler::establishPaceChannel(PacePasswordId pPasswordId, const QByteArray& pPassword)
 {
+	Tracer::ScopedSpan span(QLatin1String("card"), QStringLiteral("PACE"));
+	if (span.isActive())
+	{
+		span.setArg(QStringLiteral("password"), Enum<PacePasswordId>::getName(pPasswordId));
+	}
+
 	auto efCardAccess = mCardConnectionWorker->getReaderInfo().getCardInfo().getEfCardAccess();
 	if (!initialize(efCardAccess))
 	{
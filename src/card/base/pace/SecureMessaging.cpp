@@ -4,7 +4,7 @@
 
 #include "apdu/SecureMessagingCommand.h"
 #include "apdu/SecureMessagingResponse.h"
-#include "asn1/ASN1Util.h"
+#include "asn1/BerTlv.h"
 #include "pace/SecureMessaging.h"
 
 #include <QLoggingCategory>
@@ -99,18 +99,14 @@ CommandApdu SecureMessaging::encrypt(const CommandApdu& pCommandApdu)
 		mCipher.setIv(getEncryptedIv());
 		QByteArray encryptedData = mCipher.encrypt(paddedASN1Struct).prepend(0x01);
 
-		auto encryptedDataObject = newObject<SM_ENCRYPTED_DATA>();
-		Asn1OctetStringUtil::setValue(encryptedData, encryptedDataObject.data());
-		formattedEncryptedData = encodeObject(encryptedDataObject.data());
+		formattedEncryptedData = BerTlv::encode(SecureMessagingApdu::cTagEncryptedData, encryptedData);
 	}
 
 	QByteArray securedHeader = createSecuredHeader(pCommandApdu);
 	QByteArray securedLe;
 	if (pCommandApdu.getLe() > CommandApdu::NO_LE)
 	{
-		auto protectedLeObject = newObject<SM_PROTECTED_LE>();
-		Asn1OctetStringUtil::setValue(pCommandApdu.generateLengthField(pCommandApdu.getLe()), protectedLeObject.data());
-		securedLe = encodeObject(protectedLeObject.data());
+		securedLe = BerTlv::encode(SecureMessagingApdu::cTagProtectedLe, pCommandApdu.generateLengthField(pCommandApdu.getLe()));
 	}
 	QByteArray mac = createMac(securedHeader, formattedEncryptedData, securedLe);
 	QByteArray securedData = formattedEncryptedData + securedLe + mac;
@@ -184,10 +180,7 @@ QByteArray SecureMessaging::createMac(const QByteArray& pSecuredHeader,
 	}
 	dataToMac.prepend(getSendSequenceCounter());
 
-	QByteArray mac = mCipherMac.generate(dataToMac);
-	auto macObject = newObject<SM_CHECKSUM>();
-	Asn1OctetStringUtil::setValue(mac, macObject.data());
-	return encodeObject(macObject.data());
+	return BerTlv::encode(SecureMessagingApdu::cTagChecksum, mCipherMac.generate(dataToMac));
 }
 
 
@@ -233,21 +226,16 @@ ResponseApdu SecureMessaging::encrypt(const ResponseApdu& pResponseApdu)
 		mCipher.setIv(getEncryptedIv());
 		QByteArray encryptedData = mCipher.encrypt(paddedResponseData).prepend(0x01);
 
-		auto encryptedDataObject = newObject<SM_ENCRYPTED_DATA>();
-		Asn1OctetStringUtil::setValue(encryptedData, encryptedDataObject.data());
-		formattedEncryptedData = encodeObject(encryptedDataObject.data());
+		formattedEncryptedData = BerTlv::encode(SecureMessagingApdu::cTagEncryptedData, encryptedData);
 	}
 
 	const QByteArray status = pResponseApdu.getStatusBytes();
-	auto formattedStatus = newObject<SM_PROCESSING_STATUS>();
-	Asn1OctetStringUtil::setValue(status, formattedStatus.data());
-	formattedEncryptedData += encodeObject(formattedStatus.data());
+	BerTlv::append(formattedEncryptedData, SecureMessagingApdu::cTagProcessingStatus, status);
 
 	QByteArray mac = mCipherMac.generate(getSendSequenceCounter() + padToCipherBlockSize(formattedEncryptedData));
-	auto macObject = newObject<SM_CHECKSUM>();
-	Asn1OctetStringUtil::setValue(mac, macObject.data());
+	BerTlv::append(formattedEncryptedData, SecureMessagingApdu::cTagChecksum, mac);
 
-	return ResponseApdu(formattedEncryptedData + encodeObject(macObject.data()) + status);
+	return ResponseApdu(formattedEncryptedData + status);
 }
 
 
@@ -31,6 +31,21 @@ ReaderDetector::~ReaderDetector()
 }
 
 
+void ReaderDetector::shutdown()
+{
+#ifdef Q_OS_LINUX
+	if (mDeviceListener && mDeviceListener->isRunning())
+	{
+		connect(mDeviceListener, &QThread::finished, this, &ReaderDetector::fireShutdownFinished, Qt::SingleShotConnection);
+		mDeviceListener->requestInterruption();
+		return;
+	}
+#endif
+
+	QMetaObject::invokeMethod(this, &ReaderDetector::fireShutdownFinished, Qt::QueuedConnection);
+}
+
+
 QList<ReaderConfigurationInfo> ReaderDetector::getAttachedSupportedDevices() const
 {
 	const auto& readerConfiguration = Env::getSingleton<ReaderConfiguration>();
@@ -69,8 +69,15 @@ class ReaderDetector
 
 		[[nodiscard]] ReaderConfigurationInfo getReaderConfigurationInfo(const QString& pReaderName) const;
 
+		/*!
+		 * Stops the detection of native events without waiting for it.
+		 * Emits fireShutdownFinished() once it is stopped.
+		 */
+		void shutdown();
+
 	Q_SIGNALS:
 		void fireReaderChangeDetected();
+		void fireShutdownFinished();
 };
 
 } // namespace governikus
@@ -0,0 +1,168 @@
+/**
+ * Copyright (c) 2025 Governikus GmbH & Co. KG, Germany
+ */
+
+#include "ReplayCard.h"
+
+#include <QLoggingCategory>
+#include <QThread>
+
+
+using namespace governikus;
+
+
+Q_DECLARE_LOGGING_CATEGORY(card_replay)
+
+
+ReplayCard::ReplayCard(const ApduTrace& pTrace, double pScale)
+	: Card()
+	, mTrace(pTrace)
+	, mScale(pScale)
+	, mConnected(false)
+	, mPosition(0)
+{
+}
+
+
+const ApduTrace::Entry* ReplayCard::take(const std::function<bool(const ApduTrace::Entry&)>& pMatch, bool pWrap)
+{
+	const auto& entries = mTrace.getEntries();
+	const auto count = entries.size();
+	for (qsizetype i = 0; i < (pWrap ? count : count - mPosition); ++i)
+	{
+		const auto index = (mPosition + i) % count;
+		if (pMatch(entries.at(index)))
+		{
+			mPosition = index + 1;
+			return &entries.at(index);
+		}
+	}
+
+	return nullptr;
+}
+
+
+void ReplayCard::delay(const ApduTrace::Entry& pEntry) const
+{
+	const auto duration = static_cast<double>(pEntry.mDuration) * mScale;
+	if (duration >= 1)
+	{
+		QThread::usleep(static_cast<unsigned long>(duration));
+	}
+}
+
+
+CardReturnCode ReplayCard::establishConnection()
+{
+	mConnected = true;
+	return CardReturnCode::OK;
+}
+
+
+CardReturnCode ReplayCard::releaseConnection()
+{
+	mConnected = false;
+	return CardReturnCode::OK;
+}
+
+
+bool ReplayCard::isConnected() const
+{
+	return mConnected;
+}
+
+
+ResponseApduResult ReplayCard::transmit(const CommandApdu& pCmd)
+{
+	const auto& command = ApduTrace::redact(pCmd);
+	const auto* entry = take([&command](const ApduTrace::Entry& pEntry){
+				return pEntry.mType == ApduTraceEntryType::TRANSMIT && pEntry.mCommand == command;
+			});
+
+	if (entry == nullptr && pCmd.isSecureMessaging())
+	{
+		const auto& header = pCmd.getHeaderBytes();
+		entry = take([&header](const ApduTrace::Entry& pEntry){
+				return pEntry.mType == ApduTraceEntryType::TRANSMIT && pEntry.mCommand.startsWith(header);
+			}, false);
+	}
+
+	if (entry == nullptr)
+	{
+		qCWarning(card_replay) << "No recorded response for" << pCmd;
+		return {CardReturnCode::COMMAND_FAILED};
+	}
+
+	delay(*entry);
+	return {entry->mReturnCode, ResponseApdu(entry->mResponse)};
+}
+
+
+EstablishPaceChannelOutput ReplayCard::establishPaceChannel(PacePasswordId pPasswordId, int pPreferredPinLength, const QByteArray& pChat, const QByteArray& pCertificateDescription)
+{
+	Q_UNUSED(pPreferredPinLength)
+	Q_UNUSED(pChat)
+	Q_UNUSED(pCertificateDescription)
+
+	const char passwordId = Enum<PacePasswordId>::getValue(pPasswordId);
+	const auto* entry = take([passwordId](const ApduTrace::Entry& pEntry){
+				return pEntry.mType == ApduTraceEntryType::ESTABLISH_PACE_CHANNEL && pEntry.mCommand.startsWith(passwordId);
+			});
+
+	if (entry == nullptr)
+	{
+		qCWarning(card_replay) << "No recorded PACE channel for" << pPasswordId;
+		return EstablishPaceChannelOutput(CardReturnCode::COMMAND_FAILED);
+	}
+
+	delay(*entry);
+	EstablishPaceChannelOutput output;
+	if (!output.parseFromCcid(entry->mResponse))
+	{
+		return EstablishPaceChannelOutput(CardReturnCode::COMMAND_FAILED);
+	}
+	output.setPaceReturnCode(entry->mReturnCode);
+	return output;
+}
+
+
+CardReturnCode ReplayCard::destroyPaceChannel()
+{
+	const auto* entry = take([](const ApduTrace::Entry& pEntry){
+				return pEntry.mType == ApduTraceEntryType::DESTROY_PACE_CHANNEL;
+			});
+
+	if (entry == nullptr)
+	{
+		return CardReturnCode::OK;
+	}
+
+	delay(*entry);
+	return entry->mReturnCode;
+}
+
+
+ResponseApduResult ReplayCard::setEidPin(quint8 pTimeoutSeconds)
+{
+	Q_UNUSED(pTimeoutSeconds)
+
+	const auto* entry = take([](const ApduTrace::Entry& pEntry){
+				return pEntry.mType == ApduTraceEntryType::SET_EID_PIN
+					   || (pEntry.mType == ApduTraceEntryType::TRANSMIT && CommandApdu(pEntry.mCommand).getINS() == Ins::RESET_RETRY_COUNTER);
+			});
+
+	if (entry == nullptr)
+	{
+		qCWarning(card_replay) << "No recorded response for set eID PIN";
+		return {CardReturnCode::COMMAND_FAILED};
+	}
+
+	delay(*entry);
+	return {entry->mReturnCode, ResponseApdu(entry->mResponse)};
+}
+
+
+qsizetype ReplayCard::getPosition() const
+{
+	return mPosition;
+}
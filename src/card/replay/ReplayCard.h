@@ -0,0 +1,57 @@
+/**
+ * Copyright (c) 2025 Governikus GmbH & Co. KG, Germany
+ */
+
+#pragma once
+
+#include "ApduTrace.h"
+#include "Card.h"
+
+#include <functional>
+
+
+namespace governikus
+{
+
+/*!
+ * Answers every command with the response of the ApduTrace. A transmit
+ * takes the next entry with the same command, searching from the
+ * current position and wrapping around once. Commands with secure messaging
+ * of the eService never match exactly, they take the next entry with the
+ * same header instead.
+ *
+ * Every answer is delayed by the recorded duration multiplied by the scale.
+ */
+class ReplayCard
+	: public Card
+{
+	Q_OBJECT
+
+	private:
+		const ApduTrace mTrace;
+		const double mScale;
+		bool mConnected;
+		qsizetype mPosition;
+
+		[[nodiscard]] const ApduTrace::Entry* take(const std::function<bool(const ApduTrace::Entry&)>& pMatch, bool pWrap = true);
+		void delay(const ApduTrace::Entry& pEntry) const;
+
+	public:
+		explicit ReplayCard(const ApduTrace& pTrace, double pScale = 1.0);
+
+		CardReturnCode establishConnection() override;
+		CardReturnCode releaseConnection() override;
+		bool isConnected() const override;
+
+		ResponseApduResult transmit(const CommandApdu& pCmd) override;
+
+		EstablishPaceChannelOutput establishPaceChannel(PacePasswordId pPasswordId, int pPreferredPinLength, const QByteArray& pChat, const QByteArray& pCertificateDescription) override;
+
+		CardReturnCode destroyPaceChannel() override;
+
+		ResponseApduResult setEidPin(quint8 pTimeoutSeconds) override;
+
+		[[nodiscard]] qsizetype getPosition() const;
+};
+
+} // namespace governikus
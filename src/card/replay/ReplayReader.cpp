@@ -0,0 +1,70 @@
+/**
+ * Copyright (c) 2025 Governikus GmbH & Co. KG, Germany
+ */
+
+#include "ReplayReader.h"
+
+#include <QLoggingCategory>
+
+
+using namespace governikus;
+
+
+Q_DECLARE_LOGGING_CATEGORY(card_replay)
+
+
+ReplayReader::ReplayReader(const ApduTrace& pTrace, double pScale)
+	: ConnectableReader(ReaderManagerPluginType::REPLAY, QStringLiteral("Replay"))
+	, mTrace(pTrace)
+	, mScale(pScale)
+	, mCard()
+{
+	// PACE of a basic reader cannot be replayed, the recorded result is used instead.
+	setInfoBasicReader(false);
+}
+
+
+Card* ReplayReader::getCard() const
+{
+	return mCard.data();
+}
+
+
+void ReplayReader::insertCard(const QVariant& pData)
+{
+	Q_UNUSED(pData)
+
+	if (getReaderInfo().hasCard())
+	{
+		qCDebug(card_replay) << "Already inserted";
+		return;
+	}
+
+	mCard.reset(new ReplayCard(mTrace, mScale));
+	fetchCardInfo();
+
+	qCInfo(card_replay) << "Card inserted:" << getReaderInfo().getCardInfo();
+	Q_EMIT fireCardInserted(getReaderInfo());
+}
+
+
+void ReplayReader::connectReader()
+{
+	qCDebug(card_replay) << "Replay trace of" << mTrace.getReaderName() << "| Entries:" << mTrace.getEntries().size() << "| Scale:" << mScale;
+	insertCard();
+}
+
+
+void ReplayReader::disconnectReader(const QString& pError)
+{
+	Q_UNUSED(pError)
+
+	if (mCard)
+	{
+		mCard.reset();
+		removeCardInfo();
+
+		qCInfo(card_replay) << "Card removed";
+		Q_EMIT fireCardRemoved(getReaderInfo());
+	}
+}
@@ -0,0 +1,35 @@
+/**
+ * Copyright (c) 2025 Governikus GmbH & Co. KG, Germany
+ */
+
+#pragma once
+
+#include "ApduTrace.h"
+#include "Reader.h"
+#include "ReplayCard.h"
+
+
+namespace governikus
+{
+
+class ReplayReader
+	: public ConnectableReader
+{
+	Q_OBJECT
+
+	private:
+		const ApduTrace mTrace;
+		const double mScale;
+		QScopedPointer<ReplayCard, QScopedPointerDeleteLater> mCard;
+
+	public:
+		ReplayReader(const ApduTrace& pTrace, double pScale);
+
+		[[nodiscard]] Card* getCard() const override;
+		void insertCard(const QVariant& pData = QVariant()) override;
+		void connectReader() override;
+		void disconnectReader(const QString& pError) override;
+};
+
+
+} // namespace governikus
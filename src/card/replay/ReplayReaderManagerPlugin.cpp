@@ -0,0 +1,114 @@
+/**
+ * Copyright (c) 2025 Governikus GmbH & Co. KG, Germany
+ */
+
+#include "ReplayReaderManagerPlugin.h"
+
+#include "ApduTracer.h"
+#include "Env.h"
+
+#include <QLoggingCategory>
+
+
+using namespace governikus;
+
+
+Q_DECLARE_LOGGING_CATEGORY(card_replay)
+
+
+ReplayReaderManagerPlugin::ReplayReaderManagerPlugin()
+	: ReaderManagerPlugin(ReaderManagerPluginType::REPLAY)
+	, mTrace()
+	, mReader()
+{
+}
+
+
+void ReplayReaderManagerPlugin::init()
+{
+	ReaderManagerPlugin::init();
+
+	const auto* tracer = Env::getSingleton<ApduTracer>();
+	if (tracer->getReplayFiles().isEmpty())
+	{
+		return;
+	}
+
+	mTrace = tracer->loadReplay();
+	if (mTrace.isEmpty())
+	{
+		qCWarning(card_replay) << "Cannot replay APDU traces:" << tracer->getReplayFiles();
+		return;
+	}
+
+	setPluginAvailable(true);
+	setPluginEnabled(true);
+}
+
+
+QPointer<Reader> ReplayReaderManagerPlugin::getReader(const QString& pReaderName) const
+{
+	if (getInfo().isEnabled() && mReader && mReader->getName() == pReaderName)
+	{
+		return mReader.data();
+	}
+
+	return nullptr;
+}
+
+
+void ReplayReaderManagerPlugin::startScan(bool pAutoConnect)
+{
+	if (getInfo().isEnabled())
+	{
+		mReader.reset(new ReplayReader(mTrace, Env::getSingleton<ApduTracer>()->getReplayScale()));
+
+		connect(mReader.data(), &ReplayReader::fireReaderPropertiesUpdated, this, &ReplayReaderManagerPlugin::fireReaderPropertiesUpdated);
+		connect(mReader.data(), &ReplayReader::fireCardInserted, this, &ReplayReaderManagerPlugin::fireCardInserted);
+		connect(mReader.data(), &ReplayReader::fireCardRemoved, this, &ReplayReaderManagerPlugin::fireCardRemoved);
+		qCDebug(card_replay) << "fireReaderAdded" << mReader->getName();
+		Q_EMIT fireReaderAdded(mReader->getReaderInfo());
+
+		mReader->connectReader();
+		ReaderManagerPlugin::startScan(pAutoConnect);
+		setInitialScanState(ReaderManagerPluginInfo::InitialScan::SUCCEEDED);
+	}
+}
+
+
+void ReplayReaderManagerPlugin::stopScan(const QString& pError)
+{
+	if (mReader)
+	{
+		mReader->disconnectReader(pError);
+
+		auto info = mReader->getReaderInfo();
+		mReader.reset();
+		Q_EMIT fireReaderRemoved(info);
+	}
+	ReaderManagerPlugin::stopScan(pError);
+}
+
+
+void ReplayReaderManagerPlugin::insert(const QString& pReaderName, const QVariant& pData)
+{
+	Q_UNUSED(pReaderName)
+
+	if (!getInfo().isScanRunning() || !mReader)
+	{
+		return;
+	}
+
+	// Start the trace from the beginning
+	mReader->disconnectReader(QString());
+	mReader->insertCard(pData);
+}
+
+
+void ReplayReaderManagerPlugin::shelveAll() const
+{
+	if (getInfo().isEnabled() && mReader)
+	{
+		shelve(mReader.data());
+	}
+}
@@ -0,0 +1,43 @@
+/**
+ * Copyright (c) 2025 Governikus GmbH & Co. KG, Germany
+ */
+
+#pragma once
+
+#include "ApduTrace.h"
+#include "ReaderManagerPlugin.h"
+#include "ReplayReader.h"
+
+#include <QScopedPointer>
+
+
+namespace governikus
+{
+
+class ReplayReaderManagerPlugin
+	: public ReaderManagerPlugin
+{
+	Q_OBJECT
+	Q_PLUGIN_METADATA(IID "governikus.ReaderManagerPlugin" FILE "metadata.json")
+	Q_INTERFACES(governikus::ReaderManagerPlugin)
+
+	private:
+		ApduTrace mTrace;
+		QScopedPointer<ReplayReader> mReader;
+
+	public:
+		ReplayReaderManagerPlugin();
+
+		[[nodiscard]] QPointer<Reader> getReader(const QString& pReaderName) const override;
+
+		void init() override;
+
+		void startScan(bool pAutoConnect) override;
+		void stopScan(const QString& pError) override;
+
+		void insert(const QString& pReaderName, const QVariant& pData) override;
+
+		void shelveAll() const override;
+};
+
+} // namespace governikus
@@ -13,6 +13,7 @@
 #include "asn1/ASN1TemplateUtil.h"
 #include "asn1/ASN1Util.h"
 #include "asn1/AuthenticatedAuxiliaryData.h"
+#include "asn1/BerTlv.h"
 #include "asn1/SignatureChecker.h"
 #include "pace/CipherMac.h"
 #include "pace/KeyDerivationFunction.h"
@@ -33,10 +34,11 @@ Q_DECLARE_LOGGING_CATEGORY(card_simulator)
 Q_DECLARE_LOGGING_CATEGORY(secure)
 
 
-SimulatorCard::SimulatorCard(const SimulatorFileSystem& pFileSystem)
+SimulatorCard::SimulatorCard(const SimulatorFileSystem& pFileSystem, const SimulatorProfile& pProfile)
 	: Card()
 	, mConnected(false)
 	, mFileSystem(pFileSystem)
+	, mProfile(pProfile)
 	, mSecureMessaging()
 	, mNewSecureMessaging()
 	, mSelectedProtocol()
@@ -88,6 +90,21 @@ ResponseApduResult SimulatorCard::transmit(const CommandApdu& pCmd)
 	CommandApdu commandApdu = pCmd;
 	qCDebug(card_simulator) << "Transmit command APDU:" << commandApdu;
 
+	if (mProfile.isCardLost())
+	{
+		qCInfo(card_simulator) << "Simulate loss of the card";
+		mConnected = false;
+		Q_EMIT fireCardLost();
+		return {CardReturnCode::CARD_NOT_FOUND};
+	}
+
+	if (!mProfile.isSupported(commandApdu))
+	{
+		qCDebug(card_simulator) << "Command APDU exceeds the supported length of the reader";
+		simulateTransmission(QByteArray(commandApdu).size());
+		return {CardReturnCode::OK, ResponseApdu(StatusCode::WRONG_LENGTH)};
+	}
+
 	if (mSecureMessaging)
 	{
 		if (commandApdu.isSecureMessaging())
@@ -126,6 +143,7 @@ ResponseApduResult SimulatorCard::transmit(const CommandApdu& pCmd)
 	}
 
 	qCDebug(card_simulator) << "Transmit response APDU:" << result;
+	simulateTransmission(QByteArray(pCmd).size() + QByteArray(result).size());
 
 	if (mNewSecureMessaging)
 	{
@@ -145,6 +163,7 @@ EstablishPaceChannelOutput SimulatorCard::establishPaceChannel(PacePasswordId pP
 	Q_UNUSED(pCertificateDescription)
 
 	QThread::msleep(Env::getSingleton<VolatileSettings>()->getDelay());
+	simulateTransmission(pChat.size());
 
 	EstablishPaceChannelOutput output(CardReturnCode::OK);
 	output.setPaceReturnCode(CardReturnCode::OK);
@@ -198,6 +217,15 @@ ResponseApduResult SimulatorCard::setEidPin(quint8 pTimeoutSeconds)
 }
 
 
+void SimulatorCard::simulateTransmission(qsizetype pBytes)
+{
+	if (const auto duration = mProfile.getDuration(pBytes); duration > 0)
+	{
+		QThread::usleep(static_cast<unsigned long>(duration));
+	}
+}
+
+
 ResponseApdu SimulatorCard::executeCommand(const CommandApdu& pCommandApdu)
 {
 	switch (pCommandApdu.getINS())
@@ -435,9 +463,7 @@ ResponseApdu SimulatorCard::executeGeneralAuthenticate(const CommandApdu& pCmd)
 				SymmetricCipher nonceDecrypter(protocol, symmetricKey);
 				const auto& encryptedNonce = nonceDecrypter.encrypt(mPaceNonce);
 
-				auto asn1Nonce = newObject<GA_ENCRYPTEDNONCEDATA>();
-				Asn1OctetStringUtil::setValue(encryptedNonce, asn1Nonce->mEncryptedNonce);
-				responseData = encodeObject(asn1Nonce.data());
+				responseData = BerTlv::encode(GAResponseApdu::cTagDynamicAuthenticationData, BerTlv::encode(GAEncryptedNonceResponse::cTagEncryptedNonce, encryptedNonce));
 				break;
 			}
 
@@ -450,9 +476,7 @@ ResponseApdu SimulatorCard::executeGeneralAuthenticate(const CommandApdu& pCmd)
 				mCardKey = EcUtil::generateKey(mapping.getCurve());
 				mPaceNonce.clear();
 
-				auto asn1Mapping = newObject<GA_MAPNONCEDATA>();
-				Asn1OctetStringUtil::setValue(localMappingData, asn1Mapping->mMappingData);
-				responseData = encodeObject(asn1Mapping.data());
+				responseData = BerTlv::encode(GAResponseApdu::cTagDynamicAuthenticationData, BerTlv::encode(GAMapNonceResponse::cTagMappingData, localMappingData));
 				break;
 			}
 
@@ -460,10 +484,8 @@ ResponseApdu SimulatorCard::executeGeneralAuthenticate(const CommandApdu& pCmd)
 			{
 				mPaceTerminalKey = cmdData.getData(V_ASN1_CONTEXT_SPECIFIC, ASN1Struct::PACE_EPHEMERAL_PUBLIC_KEY);
 
-				auto asn1KeyAgreement = newObject<GA_PERFORMKEYAGREEMENTDATA>();
 				const auto& encodedPublicKey = EcUtil::getEncodedPublicKey(mCardKey);
-				Asn1OctetStringUtil::setValue(encodedPublicKey, asn1KeyAgreement->mEphemeralPublicKey);
-				responseData = encodeObject(asn1KeyAgreement.data());
+				responseData = BerTlv::encode(GAResponseApdu::cTagDynamicAuthenticationData, BerTlv::encode(GAPerformKeyAgreementResponse::cTagEphemeralPublicKey, encodedPublicKey));
 				break;
 			}
 
@@ -485,16 +507,14 @@ ResponseApdu SimulatorCard::executeGeneralAuthenticate(const CommandApdu& pCmd)
 					return ResponseApdu(StatusCode::PIN_RETRY_COUNT_2);
 				}
 
-				auto ga = newObject<GA_MUTUALAUTHENTICATIONDATA>();
-				Asn1OctetStringUtil::setValue(mutualAuthenticationDataTerminal, ga->mAuthenticationToken);
+				QByteArray ga = BerTlv::encode(GAMutualAuthenticationResponse::cTagAuthenticationToken, mutualAuthenticationDataTerminal);
 				if (mTaCertificate)
 				{
 					mTaSigningData = EcUtil::getEncodedPublicKey(mCardKey, true);
 
-					ga->mCarCurr = ASN1_OCTET_STRING_new();
-					Asn1OctetStringUtil::setValue(mTaCertificate->getBody().getCertificateHolderReference(), ga->mCarCurr);
+					BerTlv::append(ga, GAMutualAuthenticationResponse::cTagCarCurr, mTaCertificate->getBody().getCertificateHolderReference());
 				}
-				responseData = encodeObject(ga.data());
+				responseData = BerTlv::encode(GAResponseApdu::cTagDynamicAuthenticationData, ga);
 				break;
 			}
 
@@ -516,10 +536,9 @@ ResponseApdu SimulatorCard::executeGeneralAuthenticate(const CommandApdu& pCmd)
 		const QByteArray nonce = QByteArray::fromHex("0001020304050607");
 		const QByteArray& authenticationToken = generateAuthenticationToken(caKey, nonce);
 
-		auto ga = newObject<GA_CHIPAUTHENTICATIONDATA>();
-		Asn1OctetStringUtil::setValue(nonce, ga->mNonce);
-		Asn1OctetStringUtil::setValue(authenticationToken, ga->mAuthenticationToken);
-		return ResponseApdu(encodeObject(ga.data()) + QByteArray::fromHex("9000"));
+		QByteArray ga = BerTlv::encode(GAChipAuthenticationResponse::cTagNonce, nonce);
+		BerTlv::append(ga, GAChipAuthenticationResponse::cTagAuthenticationToken, authenticationToken);
+		return ResponseApdu(BerTlv::encode(GAResponseApdu::cTagDynamicAuthenticationData, ga) + QByteArray::fromHex("9000"));
 	}
 
 	if (mSelectedProtocol == KnownOid::ID_RI_ECDH_SHA_256)
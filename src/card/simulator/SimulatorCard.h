@@ -6,13 +6,13 @@
 
 #include "Card.h"
 #include "SimulatorFileSystem.h"
+#include "SimulatorProfile.h"
 #include "SmartCardDefinitions.h"
-#include "asn1/AccessRoleAndRight.h"
+#include "asn1/AccessRights.h"
 #include "asn1/CVCertificate.h"
 #include "asn1/Oid.h"
 #include "pace/SecureMessaging.h"
 
-#include <QSet>
 
 #include <memory>
 #include <openssl/ec.h>
@@ -30,11 +30,12 @@ class SimulatorCard
 	private:
 		bool mConnected;
 		SimulatorFileSystem mFileSystem;
+		SimulatorProfile mProfile;
 		std::unique_ptr<SecureMessaging> mSecureMessaging;
 		std::unique_ptr<SecureMessaging> mNewSecureMessaging;
 		Oid mSelectedProtocol;
 		int mChainingStep;
-		QSet<AccessRight> mAccessRights;
+		AccessRights mAccessRights;
 		PacePasswordId mPacePassword;
 		int mPaceKeyId;
 		QByteArray mPaceNonce;
@@ -49,7 +50,7 @@ class SimulatorCard
 		QByteArray mTaAuxData;
 
 	public:
-		explicit SimulatorCard(const SimulatorFileSystem& pFileSystem);
+		explicit SimulatorCard(const SimulatorFileSystem& pFileSystem, const SimulatorProfile& pProfile = SimulatorProfile());
 
 		CardReturnCode establishConnection() override;
 		CardReturnCode releaseConnection() override;
@@ -63,7 +64,11 @@ class SimulatorCard
 
 		ResponseApduResult setEidPin(quint8 pTimeoutSeconds) override;
 
+	Q_SIGNALS:
+		void fireCardLost();
+
 	private:
+		void simulateTransmission(qsizetype pBytes);
 		ResponseApdu executeCommand(const CommandApdu& pCmd);
 		ResponseApdu executeFileCommand(const CommandApdu& pCmd);
 		ResponseApdu executeMseSetAt(const CommandApdu& pCmd);
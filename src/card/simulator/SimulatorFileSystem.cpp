@@ -5,6 +5,7 @@
 #include "SimulatorFileSystem.h"
 
 #include "FileRef.h"
+#include "HexCodec.h"
 #include "apdu/CommandApdu.h"
 #include "apdu/ResponseApdu.h"
 #include "asn1/ASN1TemplateUtil.h"
@@ -259,6 +260,20 @@ SimulatorFileSystem::SimulatorFileSystem(const QJsonObject& pData)
 
 		parseKey(value.toObject());
 	}
+
+	if (const auto& trustPoint = pData[QLatin1String("trustPoint")]; !trustPoint.isUndefined())
+	{
+		const auto& raw = hex::decode(trustPoint.toString());
+		const auto& certificate = raw ? CVCertificate::fromRaw(*raw) : QSharedPointer<const CVCertificate>();
+		if (certificate.isNull())
+		{
+			qCWarning(card_simulator) << "Skipping trust point. Expected hex encoded CV certificate, got" << trustPoint;
+		}
+		else
+		{
+			mTrustPoint = certificate;
+		}
+	}
 }
 
 
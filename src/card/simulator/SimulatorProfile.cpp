@@ -0,0 +1,153 @@
+/**
+ * Copyright (c) 2025 Governikus GmbH & Co. KG, Germany
+ */
+
+#include "SimulatorProfile.h"
+
+#include <QLoggingCategory>
+
+#include <algorithm>
+#include <limits>
+#include <type_traits>
+
+
+using namespace governikus;
+
+
+Q_DECLARE_LOGGING_CATEGORY(card_simulator)
+
+
+namespace
+{
+constexpr int cShortApduLength = 261;
+} // namespace
+
+
+SimulatorProfile::SimulatorProfile()
+	: mLatency(0)
+	, mJitter(0)
+	, mBytesPerSecond(0)
+	, mMaxApduLength(-1)
+	, mExtendedLength(true)
+	, mCardLoss(0)
+	, mRandom(QRandomGenerator::securelySeeded())
+{
+}
+
+
+SimulatorProfile::SimulatorProfile(const QJsonObject& pProfile)
+	: SimulatorProfile()
+{
+	const auto& parseNumber = [&pProfile](const char* pName, double pMax, auto& pTarget){
+			const auto& value = pProfile[QLatin1String(pName)];
+			if (value.isUndefined())
+			{
+				return;
+			}
+
+			if (!value.isDouble() || value.toDouble() < 0 || value.toDouble() > pMax)
+			{
+				qCWarning(card_simulator) << "Skipping profile parameter" << pName << "Expected number between 0 and" << pMax << "got" << value;
+				return;
+			}
+
+			pTarget = static_cast<std::remove_reference_t<decltype(pTarget)>>(value.toDouble());
+		};
+
+	parseNumber("latency", 60000, mLatency);
+	parseNumber("jitter", 60000, mJitter);
+	parseNumber("bytesPerSecond", std::numeric_limits<int>::max(), mBytesPerSecond);
+	parseNumber("maxApduLength", 65544, mMaxApduLength);
+	parseNumber("cardLoss", 1, mCardLoss);
+
+	if (const auto& extendedLength = pProfile[QLatin1String("extendedLength")]; !extendedLength.isUndefined())
+	{
+		if (extendedLength.isBool())
+		{
+			mExtendedLength = extendedLength.toBool();
+		}
+		else
+		{
+			qCWarning(card_simulator) << "Skipping profile parameter extendedLength. Expected boolean, got" << extendedLength;
+		}
+	}
+
+	if (const auto& seed = pProfile[QLatin1String("seed")]; seed.isDouble())
+	{
+		mRandom.seed(static_cast<quint32>(seed.toInteger()));
+	}
+
+	if (!mExtendedLength)
+	{
+		mMaxApduLength = mMaxApduLength < 0 ? cShortApduLength : std::min(mMaxApduLength, cShortApduLength);
+	}
+}
+
+
+double SimulatorProfile::getLatency() const
+{
+	return mLatency;
+}
+
+
+double SimulatorProfile::getJitter() const
+{
+	return mJitter;
+}
+
+
+int SimulatorProfile::getBytesPerSecond() const
+{
+	return mBytesPerSecond;
+}
+
+
+bool SimulatorProfile::isExtendedLength() const
+{
+	return mExtendedLength;
+}
+
+
+double SimulatorProfile::getCardLoss() const
+{
+	return mCardLoss;
+}
+
+
+int SimulatorProfile::getMaxApduLength() const
+{
+	return mMaxApduLength;
+}
+
+
+bool SimulatorProfile::isSupported(const CommandApdu& pCmd) const
+{
+	if (mMaxApduLength >= 0 && QByteArray(pCmd).size() > mMaxApduLength)
+	{
+		return false;
+	}
+
+	return mExtendedLength || !pCmd.isExtendedLength();
+}
+
+
+qint64 SimulatorProfile::getDuration(qsizetype pBytes)
+{
+	double duration = mLatency * 1000;
+	if (mBytesPerSecond > 0)
+	{
+		duration += static_cast<double>(pBytes) * 1000000 / mBytesPerSecond;
+	}
+	if (mJitter > 0)
+	{
+		duration += (mRandom.generateDouble() * 2 - 1) * mJitter * 1000;
+	}
+
+	return std::max(qint64(0), static_cast<qint64>(duration));
+}
+
+
+bool SimulatorProfile::isCardLost()
+{
+	return mCardLoss > 0 && mRandom.generateDouble() < mCardLoss;
+}
@@ -0,0 +1,56 @@
+/**
+ * Copyright (c) 2025 Governikus GmbH & Co. KG, Germany
+ */
+
+#pragma once
+
+#include "apdu/CommandApdu.h"
+
+#include <QJsonObject>
+#include <QRandomGenerator>
+
+
+namespace governikus
+{
+
+/*!
+ * Transmission characteristics of a simulated card reader, e.g. the latency
+ * of a mobile NFC interface or a reader without extended length support.
+ * The default profile transmits without any delay or limitation.
+ */
+class SimulatorProfile
+{
+	private:
+		double mLatency;
+		double mJitter;
+		int mBytesPerSecond;
+		int mMaxApduLength;
+		bool mExtendedLength;
+		double mCardLoss;
+		QRandomGenerator mRandom;
+
+	public:
+		SimulatorProfile();
+		explicit SimulatorProfile(const QJsonObject& pProfile);
+
+		[[nodiscard]] double getLatency() const;
+		[[nodiscard]] double getJitter() const;
+		[[nodiscard]] int getBytesPerSecond() const;
+		[[nodiscard]] bool isExtendedLength() const;
+		[[nodiscard]] double getCardLoss() const;
+
+		/*!
+		 * Maximum APDU length as announced in the ReaderInfo, -1 if unlimited.
+		 */
+		[[nodiscard]] int getMaxApduLength() const;
+
+		[[nodiscard]] bool isSupported(const CommandApdu& pCmd) const;
+
+		/*!
+		 * Duration in microseconds to transmit pBytes including latency and jitter.
+		 */
+		[[nodiscard]] qint64 getDuration(qsizetype pBytes);
+		[[nodiscard]] bool isCardLost();
+};
+
+} // namespace governikus
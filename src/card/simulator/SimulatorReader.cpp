@@ -38,8 +38,12 @@ void SimulatorReader::insertCard(const QVariant& pData)
 
 	const auto& data = pData.toJsonObject();
 	const auto& filesystem = data.isEmpty() ? SimulatorFileSystem() : SimulatorFileSystem(data);
+	const SimulatorProfile profile(data[QLatin1String("profile")].toObject());
 
-	mCard.reset(new SimulatorCard(filesystem));
+	mCard.reset(new SimulatorCard(filesystem, profile));
+	connect(mCard.data(), &SimulatorCard::fireCardLost, this, &SimulatorReader::onCardLost, Qt::QueuedConnection);
+	const auto maxApduLength = profile.getMaxApduLength();
+	setInfoMaxApduLength(maxApduLength < 0 ? ReaderInfo().getMaxApduLength() : maxApduLength);
 	fetchCardInfo();
 
 	qCInfo(card_simulator) << "Card inserted:" << getReaderInfo().getCardInfo();
@@ -47,6 +51,12 @@ void SimulatorReader::insertCard(const QVariant& pData)
 }
 
 
+void SimulatorReader::onCardLost()
+{
+	disconnectReader(QStringLiteral("Card lost"));
+}
+
+
 void SimulatorReader::connectReader()
 {
 	qCDebug(card_simulator) << "targetDetected, type: Simulator";
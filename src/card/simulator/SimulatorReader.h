@@ -19,6 +19,9 @@ class SimulatorReader
 	private:
 		QScopedPointer<SimulatorCard, QScopedPointerDeleteLater> mCard;
 
+	private Q_SLOTS:
+		void onCardLost();
+
 	public:
 		SimulatorReader();
 
@@ -8,9 +8,12 @@
 #include "LanguageLoader.h"
 #include "LogHandler.h"
 #include "NetworkManager.h"
+#include "ReaderDetector.h"
 #include "ReaderManager.h"
 #include "ResourceLoader.h"
 #include "SecureStorage.h"
+#include "ShutdownCoordinator.h"
+#include "StartupProfile.h"
 #include "UiLoader.h"
 #include "UiPlugin.h"
 #include "VolatileSettings.h"
@@ -20,7 +23,7 @@
 #include <QDir>
 #include <QLoggingCategory>
 #include <QStandardPaths>
-#include <QTimer>
+#include <QtConcurrent>
 
 #if defined(Q_OS_WIN)
 	#include <windows.h>
@@ -48,6 +51,7 @@ AppController::AppController()
 	, mUiDomination(nullptr)
 	, mRestartApplication(false)
 	, mExitCode(EXIT_SUCCESS)
+	, mPrefetch()
 {
 	setObjectName(QStringLiteral("AppController"));
 
@@ -56,18 +60,42 @@ AppController::AppController()
 #endif
 
 	Env::getSingleton<VolatileSettings>(); // just init in MainThread because of QObject
-	ResourceLoader::getInstance().init();
 
-	connect(&Env::getSingleton<AppSettings>()->getGeneralSettings(), &GeneralSettings::fireLanguageChanged, this, &AppController::onLanguageChanged);
-	onLanguageChanged();
+	{
+		const StartupProfile::ScopedStep step(QStringLiteral("Load resources"));
+		ResourceLoader::getInstance().init();
+	}
+
+	// SecureStorage is no QObject and parses its configuration without any dependency to the
+	// MainThread. Load it in parallel to the remaining initialization until start() needs it.
+	mPrefetch = QtConcurrent::run([] {
+				const StartupProfile::ScopedStep step(QStringLiteral("Load SecureStorage"));
+				Q_UNUSED(Env::getSingleton<SecureStorage>())
+			});
 
-	NetworkManager::setApplicationProxyFactory();
-	connect(Env::getSingleton<NetworkManager>(), &NetworkManager::fireProxyAuthenticationRequired, this, &AppController::fireProxyAuthenticationRequired);
+	{
+		const StartupProfile::ScopedStep step(QStringLiteral("Load translations"));
+		connect(&Env::getSingleton<AppSettings>()->getGeneralSettings(), &GeneralSettings::fireLanguageChanged, this, &AppController::onLanguageChanged);
+		onLanguageChanged();
+	}
+
+	{
+		const StartupProfile::ScopedStep step(QStringLiteral("Initialize NetworkManager"));
+		NetworkManager::setApplicationProxyFactory();
+		connect(Env::getSingleton<NetworkManager>(), &NetworkManager::fireProxyAuthenticationRequired, this, &AppController::fireProxyAuthenticationRequired);
+	}
 
 	connect(this, &AppController::fireShutdown, Env::getSingleton<NetworkManager>(), &NetworkManager::onShutdown, Qt::QueuedConnection);
 }
 
 
+AppController::~AppController()
+{
+	// start() is not called if the initialization fails, so the prefetch may still be running.
+	mPrefetch.waitForFinished();
+}
+
+
 bool AppController::canStartNewWorkflow() const
 {
 	return mActiveWorkflow.isNull();
@@ -121,6 +149,7 @@ void AppController::start()
 				}, Qt::QueuedConnection);
 			});
 
+	mPrefetch.waitForFinished();
 	if (!Env::getSingleton<SecureStorage>()->isValid())
 	{
 		qCCritical(init) << "SecureStorage not valid";
@@ -135,27 +164,34 @@ void AppController::start()
 	}
 #endif
 
+	auto* profile = Env::getSingleton<StartupProfile>();
 	auto* uiLoader = Env::getSingleton<UiLoader>();
 	connect(uiLoader, &UiLoader::fireLoadedPlugin, this, &AppController::onUiPlugin);
+	const auto loadStart = profile->now();
 	if (!uiLoader->load() || !uiLoader->hasActiveUI())
 	{
 		qCCritical(init) << "Cannot start without active UI";
 		return;
 	}
+	profile->addStep(QStringLiteral("Load UI plugins"), loadStart);
 
+	const auto initializeStart = profile->now();
 	if (!uiLoader->initialize())
 	{
 		qCCritical(init) << "Cannot initialize UI";
 		return;
 	}
+	profile->addStep(QStringLiteral("Initialize UI plugins"), initializeStart);
 
 	if (uiLoader->requiresReaderManager())
 	{
 		// Start the ReaderManager *after* initializing the UIs. Otherwise the TrayIcon
 		// will be created even when we're just showing an error message and shutdown after that.
 		auto* readerManager = Env::getSingleton<ReaderManager>();
-		connect(this, &AppController::fireShutdown, readerManager, &ReaderManager::shutdown, Qt::QueuedConnection);
 		connect(readerManager, &ReaderManager::fireInitialized, this, &AppController::fireStarted, Qt::QueuedConnection);
+		connect(readerManager, &ReaderManager::fireInitialized, this, [profile] {
+					profile->mark(QStringLiteral("ReaderManager initialized"));
+				});
 		readerManager->init();
 	}
 	else
@@ -216,6 +252,7 @@ void AppController::onWorkflowRequested(const QSharedPointer<WorkflowRequest>& p
 {
 	Q_ASSERT(pRequest && !pRequest->isInitialized());
 	qDebug() << "New workflow requested:" << pRequest->getAction();
+	Env::getSingleton<StartupProfile>()->mark(QStringLiteral("Workflow requested"));
 
 	if (canStartNewWorkflow())
 	{
@@ -335,61 +372,50 @@ void AppController::completeShutdown()
 	qCDebug(init) << "Emit fire shutdown";
 	Q_EMIT fireShutdown();
 
-	const auto& uiShutdown = [this] {
-				const auto& exitApp = [this] {
-							ResourceLoader::getInstance().shutdown();
-							qCDebug(init) << "Quit event loop of QCoreApplication";
-							QCoreApplication::exit(mExitCode);
-						};
+	// Every component drains in parallel under one deadline instead of blocking the MainThread.
+	auto* coordinator = new ShutdownCoordinator(ShutdownCoordinator::cDeadline, this);
 
-				auto* uiLoader = Env::getSingleton<UiLoader>();
-				if (uiLoader->isLoaded())
-				{
-					connect(uiLoader, &UiLoader::fireRemovedAllPlugins, this, exitApp, Qt::QueuedConnection);
-					uiLoader->shutdown();
-				}
-				else
+	// The UI plugins can leave sockets that write their last response in the background, see HttpRequest.
+	auto* networkManager = Env::getSingleton<NetworkManager>();
+	const auto& networkClosed = coordinator->addComponent(QStringLiteral("network connections"));
+	connect(networkManager, &NetworkManager::fireConnectionsClosed, coordinator, networkClosed);
+	const auto& checkNetworkClosed = [networkManager, networkClosed] {
+				if (networkManager->getOpenConnectionCount() == 0)
 				{
-					exitApp();
+					networkClosed();
 				}
 			};
 
-	if (Env::getSingleton<NetworkManager>()->getOpenConnectionCount() > 0)
+	auto* uiLoader = Env::getSingleton<UiLoader>();
+	if (uiLoader->requiresReaderManager())
+	{
+		auto* readerManager = Env::getSingleton<ReaderManager>();
+		connect(readerManager, &ReaderManager::fireShutdownFinished, coordinator, coordinator->addComponent(QStringLiteral("ReaderManager")));
+		readerManager->requestShutdown();
+
+		auto* readerDetector = Env::getSingleton<ReaderDetector>();
+		connect(readerDetector, &ReaderDetector::fireShutdownFinished, coordinator, coordinator->addComponent(QStringLiteral("ReaderDetector")));
+		readerDetector->shutdown();
+	}
+
+	if (uiLoader->isLoaded())
 	{
-		waitForNetworkConnections(uiShutdown);
+		connect(uiLoader, &UiLoader::fireRemovedAllPlugins, coordinator, coordinator->addComponent(QStringLiteral("UI plugins")));
+		connect(uiLoader, &UiLoader::fireRemovedAllPlugins, coordinator, checkNetworkClosed);
+		uiLoader->shutdown();
 	}
 	else
 	{
-		uiShutdown();
+		checkNetworkClosed();
 	}
-}
-
 
-void AppController::waitForNetworkConnections(const std::function<void()>& pExitFunc)
-{
-	auto* timer = new QTimer(this);
-	static const int TIMER_INTERVAL = 50;
-	timer->setInterval(TIMER_INTERVAL);
-	connect(timer, &QTimer::timeout, this, [timer, pExitFunc](){
-				const int openConnectionCount = Env::getSingleton<NetworkManager>()->getOpenConnectionCount();
-				if (openConnectionCount > 0)
-				{
-					static int timesInvoked = 0;
-					const int THREE_SECONDS = 3000;
-					if (++timesInvoked < THREE_SECONDS / TIMER_INTERVAL)
-					{
-						return;
-					}
-
-					qCWarning(init) << "Closing with" << openConnectionCount << "pending network connections.";
-					Q_ASSERT(false);
-				}
-
-				timer->deleteLater();
-				pExitFunc();
+	connect(coordinator, &ShutdownCoordinator::fireFinished, this, [this, coordinator] {
+				coordinator->deleteLater();
+				ResourceLoader::getInstance().shutdown();
+				qCDebug(init) << "Quit event loop of QCoreApplication";
+				QCoreApplication::exit(mExitCode);
 			});
-
-	timer->start();
+	coordinator->start();
 }
 
 
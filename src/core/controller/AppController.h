@@ -10,6 +10,7 @@
 
 #include <QAbstractNativeEventFilter>
 #include <QAuthenticator>
+#include <QFuture>
 #include <QNetworkProxy>
 #include <QSharedPointer>
 
@@ -40,13 +41,14 @@ class AppController final
 		const UiPlugin* mUiDomination;
 		bool mRestartApplication;
 		int mExitCode;
+		QFuture<void> mPrefetch;
 
 		[[nodiscard]] bool canStartNewWorkflow() const;
 		void completeShutdown();
-		void waitForNetworkConnections(const std::function<void()>& pExitFunc);
 
 	public:
 		AppController();
+		~AppController() override;
 
 		bool eventFilter(QObject* pObj, QEvent* pEvent) override;
 		bool nativeEventFilter(const QByteArray& pEventType, void* pMessage, qintptr* pResult) override;
@@ -0,0 +1,112 @@
+/**
+ * Copyright (c) 2025 Governikus GmbH & Co. KG, Germany
+ */
+
+#include "ShutdownCoordinator.h"
+
+#include <QLoggingCategory>
+
+#include <algorithm>
+
+
+using namespace governikus;
+
+
+Q_DECLARE_LOGGING_CATEGORY(init)
+
+
+ShutdownCoordinator::ShutdownCoordinator(int pDeadline, QObject* pParent)
+	: QObject(pParent)
+	, mElapsed()
+	, mDeadline()
+	, mComponents()
+	, mStarted(false)
+	, mFinished(false)
+{
+	mElapsed.start();
+	mDeadline.setSingleShot(true);
+	mDeadline.setInterval(pDeadline);
+	connect(&mDeadline, &QTimer::timeout, this, &ShutdownCoordinator::onDeadline);
+}
+
+
+bool ShutdownCoordinator::isPending() const
+{
+	return std::any_of(mComponents.cbegin(), mComponents.cend(), [](const Component& pComponent){
+				return pComponent.mDuration < 0;
+			});
+}
+
+
+std::function<void()> ShutdownCoordinator::addComponent(const QString& pName)
+{
+	Q_ASSERT(!mStarted);
+
+	const auto index = mComponents.size();
+	mComponents << Component {pName, -1};
+
+	return [this, index] {
+				onComponentFinished(index);
+			};
+}
+
+
+void ShutdownCoordinator::start()
+{
+	mStarted = true;
+	qCDebug(init) << "Wait for the shutdown of" << mComponents.size() << "components";
+
+	if (isPending())
+	{
+		mDeadline.start();
+		return;
+	}
+
+	QMetaObject::invokeMethod(this, &ShutdownCoordinator::finish, Qt::QueuedConnection);
+}
+
+
+void ShutdownCoordinator::onComponentFinished(qsizetype pIndex)
+{
+	auto& component = mComponents[pIndex];
+	if (component.mDuration >= 0)
+	{
+		return;
+	}
+
+	component.mDuration = mElapsed.elapsed();
+	qCDebug(init) << "Shutdown of" << component.mName << "finished after" << component.mDuration << "ms";
+
+	if (mStarted && !isPending())
+	{
+		finish();
+	}
+}
+
+
+void ShutdownCoordinator::onDeadline()
+{
+	for (const auto& component : std::as_const(mComponents))
+	{
+		if (component.mDuration < 0)
+		{
+			qCWarning(init) << "Shutdown of" << component.mName << "did not finish within" << mDeadline.interval() << "ms";
+		}
+	}
+
+	finish();
+}
+
+
+void ShutdownCoordinator::finish()
+{
+	if (mFinished)
+	{
+		return;
+	}
+
+	mFinished = true;
+	mDeadline.stop();
+	qCDebug(init) << "Shutdown of components finished after" << mElapsed.elapsed() << "ms";
+	Q_EMIT fireFinished();
+}
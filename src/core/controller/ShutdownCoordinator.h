@@ -0,0 +1,69 @@
+/**
+ * Copyright (c) 2025 Governikus GmbH & Co. KG, Germany
+ */
+
+#pragma once
+
+#include <QElapsedTimer>
+#include <QList>
+#include <QObject>
+#include <QString>
+#include <QTimer>
+
+#include <functional>
+
+
+class test_ShutdownCoordinator;
+
+
+namespace governikus
+{
+
+/*!
+ * Waits for the shutdown of several components in parallel. Every
+ * component reports its end by the callback of addComponent(). The
+ * coordinator finishes if all components are done or the deadline
+ * expired and logs the duration of every component.
+ */
+class ShutdownCoordinator
+	: public QObject
+{
+	Q_OBJECT
+	friend class ::test_ShutdownCoordinator;
+
+	private:
+		struct Component
+		{
+			QString mName;
+			qint64 mDuration;
+		};
+
+		QElapsedTimer mElapsed;
+		QTimer mDeadline;
+		QList<Component> mComponents;
+		bool mStarted;
+		bool mFinished;
+
+		[[nodiscard]] bool isPending() const;
+		void onComponentFinished(qsizetype pIndex);
+		void onDeadline();
+		void finish();
+
+	public:
+		static constexpr int cDeadline = 5000;
+
+		explicit ShutdownCoordinator(int pDeadline = cDeadline, QObject* pParent = nullptr);
+
+		/*!
+		 * Registers a component. The returned callback must be called in the
+		 * thread of the coordinator once the component is shut down, e.g. by
+		 * a connection with the coordinator as context. Further calls are ignored.
+		 */
+		[[nodiscard]] std::function<void()> addComponent(const QString& pName);
+		void start();
+
+	Q_SIGNALS:
+		void fireFinished();
+};
+
+} // namespace governikus
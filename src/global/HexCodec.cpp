@@ -0,0 +1,308 @@
+/**
+ * Copyright (c) 2025 Governikus GmbH & Co. KG, Germany
+ */
+
+#include "HexCodec.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define HEX_CODEC_SSE2
+	#include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+	#define HEX_CODEC_NEON
+	#include <arm_neon.h>
+#endif
+
+
+using namespace governikus;
+
+
+namespace
+{
+// SSE2 and NEON are part of the baseline of x86-64 and AArch64, so no
+// dispatch at runtime is necessary. Every other platform uses the loops.
+constexpr qsizetype cBlockSize = 16;
+
+
+constexpr char cDigits[] = "0123456789abcdef";
+
+
+inline int toNibble(char16_t pChar)
+{
+	if (pChar >= u'0' && pChar <= u'9')
+	{
+		return pChar - u'0';
+	}
+
+	const auto lower = static_cast<char16_t>(pChar | 0x20);
+	if (lower >= u'a' && lower <= u'f')
+	{
+		return lower - u'a' + 10;
+	}
+
+	return -1;
+}
+
+
+template<typename T>
+bool decodeScalar(const T* pInput, qsizetype pSize, char* pOutput)
+{
+	for (qsizetype i = 0; i < pSize; i += 2)
+	{
+		const auto high = toNibble(static_cast<char16_t>(pInput[i]));
+		const auto low = toNibble(static_cast<char16_t>(pInput[i + 1]));
+		if (high < 0 || low < 0)
+		{
+			return false;
+		}
+		*pOutput++ = static_cast<char>((high << 4) | low);
+	}
+
+	return true;
+}
+
+
+#if defined(HEX_CODEC_SSE2)
+inline __m128i toAscii(__m128i pNibbles)
+{
+	// '0' + n for 0-9 and 'a' - 10 + n for 10-15
+	const auto letters = _mm_cmpgt_epi8(pNibbles, _mm_set1_epi8(9));
+	const auto digits = _mm_add_epi8(pNibbles, _mm_set1_epi8('0'));
+	return _mm_add_epi8(digits, _mm_and_si128(letters, _mm_set1_epi8('a' - '0' - 10)));
+}
+
+
+inline void encodeBlock(const char* pInput, char* pOutput)
+{
+	const auto mask = _mm_set1_epi8(0x0F);
+	const auto input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pInput));
+	const auto high = toAscii(_mm_and_si128(_mm_srli_epi16(input, 4), mask));
+	const auto low = toAscii(_mm_and_si128(input, mask));
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(pOutput), _mm_unpacklo_epi8(high, low));
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(pOutput + cBlockSize), _mm_unpackhi_epi8(high, low));
+}
+
+
+inline __m128i inRange(__m128i pChars, char pMin, char pMax)
+{
+	return _mm_and_si128(_mm_cmpgt_epi8(pChars, _mm_set1_epi8(static_cast<char>(pMin - 1))), _mm_cmplt_epi8(pChars, _mm_set1_epi8(static_cast<char>(pMax + 1))));
+}
+
+
+// Converts 16 characters to 8 bytes in the low byte of every 16 bit lane.
+// Characters with the highest bit set are negative and therefore invalid.
+inline bool toBytes(__m128i pChars, __m128i& pBytes)
+{
+	const auto lower = _mm_or_si128(pChars, _mm_set1_epi8(0x20));
+	const auto isDigit = inRange(pChars, '0', '9');
+	const auto isLetter = inRange(lower, 'a', 'f');
+	if (_mm_movemask_epi8(_mm_or_si128(isDigit, isLetter)) != 0xFFFF)
+	{
+		return false;
+	}
+
+	const auto digits = _mm_and_si128(isDigit, _mm_sub_epi8(pChars, _mm_set1_epi8('0')));
+	const auto letters = _mm_and_si128(isLetter, _mm_sub_epi8(lower, _mm_set1_epi8('a' - 10)));
+	const auto nibbles = _mm_or_si128(digits, letters);
+
+	const auto high = _mm_and_si128(nibbles, _mm_set1_epi16(0x00FF));
+	const auto low = _mm_srli_epi16(nibbles, 8);
+	pBytes = _mm_or_si128(_mm_slli_epi16(high, 4), low);
+	return true;
+}
+
+
+inline bool decodeBlock(__m128i pFirst, __m128i pSecond, char* pOutput)
+{
+	__m128i first;
+	__m128i second;
+	if (!toBytes(pFirst, first) || !toBytes(pSecond, second))
+	{
+		return false;
+	}
+
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(pOutput), _mm_packus_epi16(first, second));
+	return true;
+}
+
+
+inline bool decodeBlock(const char* pInput, char* pOutput)
+{
+	return decodeBlock(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pInput)),
+			_mm_loadu_si128(reinterpret_cast<const __m128i*>(pInput + cBlockSize)),
+			pOutput);
+}
+
+
+inline __m128i narrow(const char16_t* pInput)
+{
+	// Characters above 0x7FFF are negative and saturate to 0, above 0xFF saturate to 0xFF.
+	return _mm_packus_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pInput)),
+			_mm_loadu_si128(reinterpret_cast<const __m128i*>(pInput + 8)));
+}
+
+
+inline bool decodeBlock(const char16_t* pInput, char* pOutput)
+{
+	return decodeBlock(narrow(pInput), narrow(pInput + cBlockSize), pOutput);
+}
+
+
+#elif defined(HEX_CODEC_NEON)
+inline void encodeBlock(const char* pInput, char* pOutput)
+{
+	const auto digits = vld1q_u8(reinterpret_cast<const uint8_t*>(cDigits));
+	const auto input = vld1q_u8(reinterpret_cast<const uint8_t*>(pInput));
+	uint8x16x2_t output;
+	output.val[0] = vqtbl1q_u8(digits, vshrq_n_u8(input, 4));
+	output.val[1] = vqtbl1q_u8(digits, vandq_u8(input, vdupq_n_u8(0x0F)));
+	vst2q_u8(reinterpret_cast<uint8_t*>(pOutput), output);
+}
+
+
+inline bool toNibbles(uint8x16_t pChars, uint8x16_t& pNibbles)
+{
+	const auto digits = vsubq_u8(pChars, vdupq_n_u8('0'));
+	const auto letters = vsubq_u8(vorrq_u8(pChars, vdupq_n_u8(0x20)), vdupq_n_u8('a'));
+	const auto isDigit = vcleq_u8(digits, vdupq_n_u8(9));
+	const auto isLetter = vcleq_u8(letters, vdupq_n_u8(5));
+	if (vminvq_u8(vorrq_u8(isDigit, isLetter)) != 0xFF)
+	{
+		return false;
+	}
+
+	pNibbles = vbslq_u8(isDigit, digits, vaddq_u8(letters, vdupq_n_u8(10)));
+	return true;
+}
+
+
+inline bool decodeBlock(uint8x16_t pHigh, uint8x16_t pLow, char* pOutput)
+{
+	uint8x16_t high;
+	uint8x16_t low;
+	if (!toNibbles(pHigh, high) || !toNibbles(pLow, low))
+	{
+		return false;
+	}
+
+	vst1q_u8(reinterpret_cast<uint8_t*>(pOutput), vorrq_u8(vshlq_n_u8(high, 4), low));
+	return true;
+}
+
+
+inline bool decodeBlock(const char* pInput, char* pOutput)
+{
+	const auto chars = vld2q_u8(reinterpret_cast<const uint8_t*>(pInput));
+	return decodeBlock(chars.val[0], chars.val[1], pOutput);
+}
+
+
+inline uint8x16_t narrow(const char16_t* pInput)
+{
+	// Characters above 0xFF saturate to 0xFF and are therefore invalid.
+	const auto* input = reinterpret_cast<const uint16_t*>(pInput);
+	return vcombine_u8(vqmovn_u16(vld1q_u16(input)), vqmovn_u16(vld1q_u16(input + 8)));
+}
+
+
+inline bool decodeBlock(const char16_t* pInput, char* pOutput)
+{
+	const auto first = narrow(pInput);
+	const auto second = narrow(pInput + cBlockSize);
+	return decodeBlock(vuzp1q_u8(first, second), vuzp2q_u8(first, second), pOutput);
+}
+
+
+#endif
+
+
+template<typename T>
+bool decodeAll(const T* pInput, qsizetype pSize, char* pOutput)
+{
+	if (pSize % 2 != 0)
+	{
+		return false;
+	}
+
+	qsizetype offset = 0;
+#if defined(HEX_CODEC_SSE2) || defined(HEX_CODEC_NEON)
+	for (; offset + 2 * cBlockSize <= pSize; offset += 2 * cBlockSize)
+	{
+		if (!decodeBlock(pInput + offset, pOutput + offset / 2))
+		{
+			return false;
+		}
+	}
+#endif
+
+	return decodeScalar(pInput + offset, pSize - offset, pOutput + offset / 2);
+}
+
+
+template<typename T>
+std::optional<QByteArray> decodeToByteArray(const T* pInput, qsizetype pSize)
+{
+	QByteArray result(pSize / 2, Qt::Uninitialized);
+	if (!decodeAll(pInput, pSize, result.data()))
+	{
+		return std::nullopt;
+	}
+
+	return result;
+}
+
+
+} // namespace
+
+
+void hex::encode(QByteArrayView pInput, char* pOutput)
+{
+	const auto* input = pInput.data();
+	const auto size = pInput.size();
+
+	qsizetype offset = 0;
+#if defined(HEX_CODEC_SSE2) || defined(HEX_CODEC_NEON)
+	for (; offset + cBlockSize <= size; offset += cBlockSize)
+	{
+		encodeBlock(input + offset, pOutput + 2 * offset);
+	}
+#endif
+
+	for (; offset < size; ++offset)
+	{
+		const auto value = static_cast<uchar>(input[offset]);
+		pOutput[2 * offset] = cDigits[value >> 4];
+		pOutput[2 * offset + 1] = cDigits[value & 0x0F];
+	}
+}
+
+
+QByteArray hex::encode(QByteArrayView pInput)
+{
+	QByteArray result(getEncodedSize(pInput.size()), Qt::Uninitialized);
+	encode(pInput, result.data());
+	return result;
+}
+
+
+bool hex::decode(QByteArrayView pInput, char* pOutput)
+{
+	return decodeAll(pInput.data(), pInput.size(), pOutput);
+}
+
+
+bool hex::decode(QStringView pInput, char* pOutput)
+{
+	return decodeAll(pInput.utf16(), pInput.size(), pOutput);
+}
+
+
+std::optional<QByteArray> hex::decode(QByteArrayView pInput)
+{
+	return decodeToByteArray(pInput.data(), pInput.size());
+}
+
+
+std::optional<QByteArray> hex::decode(QStringView pInput)
+{
+	return decodeToByteArray(pInput.utf16(), pInput.size());
+}
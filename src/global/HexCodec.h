@@ -0,0 +1,40 @@
+/**
+ * Copyright (c) 2025 Governikus GmbH & Co. KG, Germany
+ */
+
+#pragma once
+
+#include <QByteArray>
+#include <QByteArrayView>
+#include <QStringView>
+
+#include <optional>
+
+
+namespace governikus::hex
+{
+[[nodiscard]] constexpr qsizetype getEncodedSize(qsizetype pSize)
+{
+	return pSize * 2;
+}
+
+
+/*!
+ * Writes the lower case hex string of \a pInput to \a pOutput,
+ * which must provide getEncodedSize(pInput.size()) characters.
+ */
+void encode(QByteArrayView pInput, char* pOutput);
+[[nodiscard]] QByteArray encode(QByteArrayView pInput);
+
+/*!
+ * Writes the bytes of the hex string \a pInput to \a pOutput, which must
+ * provide pInput.size() / 2 bytes. Returns false if \a pInput has an odd
+ * length or contains other characters than 0-9, a-f and A-F. The content
+ * of \a pOutput is undefined in that case.
+ */
+[[nodiscard]] bool decode(QByteArrayView pInput, char* pOutput);
+[[nodiscard]] bool decode(QStringView pInput, char* pOutput);
+
+[[nodiscard]] std::optional<QByteArray> decode(QByteArrayView pInput);
+[[nodiscard]] std::optional<QByteArray> decode(QStringView pInput);
+} // namespace governikus::hex
@@ -11,6 +11,7 @@ Q_LOGGING_CATEGORY(card_nfc, "card_nfc")
 Q_LOGGING_CATEGORY(card_remote, "card_remote")
 Q_LOGGING_CATEGORY(card_smart, "card_smart")
 Q_LOGGING_CATEGORY(card_simulator, "card_simulator")
+Q_LOGGING_CATEGORY(card_replay, "card_replay")
 Q_LOGGING_CATEGORY(ifd, "ifd")
 Q_LOGGING_CATEGORY(card_drivers, "card_drivers")
 Q_LOGGING_CATEGORY(statemachine, "statemachine")
@@ -91,3 +92,8 @@ Q_LOGGING_CATEGORY(settings, "settings")
  * Logging category for ApplicationModel::showFeedback
  */
 Q_LOGGING_CATEGORY(feedback, "feedback")
+
+/*!
+ * Logging category for workflow traces
+ */
+Q_LOGGING_CATEGORY(tracing, "tracing")
@@ -4,6 +4,8 @@
 
 #include "LogPrivacy.h"
 
+#include "HexCodec.h"
+
 #include <QLoggingCategory>
 
 using namespace governikus;
@@ -18,14 +20,19 @@ QDebug privacy::logApdu(QDebug pDbg, const QByteArray& pApdu)
 	constexpr auto END = 2;
 	if (secure().isDebugEnabled() || pApdu.size() < (START + END))
 	{
-		pDbg << pApdu.toHex();
+		pDbg << hex::encode(pApdu);
 	}
 	else
 	{
+		char start[hex::getEncodedSize(START)];
+		char end[hex::getEncodedSize(END)];
+		hex::encode(QByteArrayView(pApdu).first(START), start);
+		hex::encode(QByteArrayView(pApdu).last(END), end);
+
 		pDbg.noquote().nospace() << '"'
-								 << pApdu.first(START).toHex()
+								 << QByteArrayView(start, sizeof(start))
 								 << '~'
-								 << pApdu.last(END).toHex()
+								 << QByteArrayView(end, sizeof(end))
 								 << "\" ("
 								 << pApdu.size()
 								 << ')';
@@ -0,0 +1,381 @@
+/**
+ * Copyright (c) 2025 Governikus GmbH & Co. KG, Germany
+ */
+
+#include "Metrics.h"
+
+#include "SingletonHelper.h"
+
+#include <QJsonArray>
+#include <QtAlgorithms>
+
+#include <cmath>
+
+
+using namespace governikus;
+
+
+defineSingleton(Metrics)
+
+
+namespace
+{
+struct Definition
+{
+	QLatin1StringView mName;
+	QLatin1StringView mHelp;
+	bool mHistogram;
+};
+
+
+constexpr std::array<Definition, 7> cDefinitions = {{
+			{QLatin1StringView("ausweisapp_apdu_duration_seconds"), QLatin1StringView("Duration of APDUs by type of the reader."), true},
+			{QLatin1StringView("ausweisapp_pace_duration_seconds"), QLatin1StringView("Duration of PACE by type of the reader."), true},
+			{QLatin1StringView("ausweisapp_paos_round_trip_seconds"), QLatin1StringView("Duration of PAOS round trips by state."), true},
+			{QLatin1StringView("ausweisapp_tls_handshake_seconds"), QLatin1StringView("Duration from connecting the socket to the finished TLS handshake."), true},
+			{QLatin1StringView("ausweisapp_workflows_total"), QLatin1StringView("Finished workflows by type and status."), false},
+			{QLatin1StringView("ausweisapp_reader_events_total"), QLatin1StringView("Added and removed readers by type of the reader."), false},
+			{QLatin1StringView("ausweisapp_ifd_reconnects_total"), QLatin1StringView("Automatic connection attempts to paired smartphones after a lost connection."), false}
+		}};
+
+// Buckets of the Prometheus export in microseconds, 2^10 (~1 ms) to 2^27 (~134 s)
+constexpr int cExportExponentMin = 10;
+constexpr int cExportExponentMax = 27;
+
+
+const Definition& getDefinition(Metric pMetric)
+{
+	const auto index = static_cast<size_t>(pMetric);
+	Q_ASSERT(index < cDefinitions.size());
+	return cDefinitions.at(index);
+}
+
+
+QByteArray toSeconds(quint64 pMicroseconds)
+{
+	return QByteArray::number(static_cast<double>(pMicroseconds) / 1000000, 'g', 10);
+}
+
+
+QByteArray escapeLabelValue(const QString& pValue)
+{
+	auto value = pValue.toUtf8();
+	value.replace('\\', "\\\\");
+	value.replace('"', "\\\"");
+	value.replace('\n', "\\n");
+	return value;
+}
+
+
+} // namespace
+
+
+Metrics::Histogram::Histogram()
+	: mBuckets()
+	, mCount(0)
+	, mSum(0)
+{
+}
+
+
+int Metrics::Histogram::getIndex(quint64 pValue)
+{
+	// The upper bounds are inclusive like the "le" buckets of Prometheus.
+	const auto value = pValue == 0 ? 0 : pValue - 1;
+	if (value < cSubBuckets)
+	{
+		return static_cast<int>(value);
+	}
+
+	const int exponent = 63 - qCountLeadingZeroBits(value);
+	if (exponent > cMaxExponent)
+	{
+		return cBucketCount - 1;
+	}
+
+	const auto shift = exponent - cSubBucketBits;
+	const auto subBucket = static_cast<int>(value >> shift) - cSubBuckets;
+	return cSubBuckets + shift * cSubBuckets + subBucket;
+}
+
+
+quint64 Metrics::Histogram::getUpperBound(int pIndex)
+{
+	if (pIndex < cSubBuckets)
+	{
+		return static_cast<quint64>(pIndex) + 1;
+	}
+
+	const auto shift = (pIndex - cSubBuckets) / cSubBuckets;
+	const auto subBucket = (pIndex - cSubBuckets) % cSubBuckets;
+	return static_cast<quint64>(cSubBuckets + subBucket + 1) << shift;
+}
+
+
+void Metrics::Histogram::record(qint64 pMicroseconds)
+{
+	const auto value = static_cast<quint64>(std::max<qint64>(pMicroseconds, 0));
+	mBuckets[static_cast<size_t>(getIndex(value))].fetch_add(1, std::memory_order_relaxed);
+	mSum.fetch_add(value, std::memory_order_relaxed);
+	mCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+
+quint64 Metrics::Histogram::getCount() const
+{
+	return mCount.load(std::memory_order_relaxed);
+}
+
+
+quint64 Metrics::Histogram::getSum() const
+{
+	return mSum.load(std::memory_order_relaxed);
+}
+
+
+quint64 Metrics::Histogram::getCountUpTo(quint64 pMicroseconds) const
+{
+	quint64 count = 0;
+	for (int i = 0; i < cBucketCount && getUpperBound(i) <= pMicroseconds; ++i)
+	{
+		count += mBuckets[static_cast<size_t>(i)].load(std::memory_order_relaxed);
+	}
+	return count;
+}
+
+
+quint64 Metrics::Histogram::getQuantile(double pQuantile) const
+{
+	const auto total = getCount();
+	if (total == 0)
+	{
+		return 0;
+	}
+
+	const auto rank = std::max<quint64>(1, static_cast<quint64>(std::ceil(pQuantile * static_cast<double>(total))));
+	quint64 count = 0;
+	for (int i = 0; i < cBucketCount; ++i)
+	{
+		count += mBuckets[static_cast<size_t>(i)].load(std::memory_order_relaxed);
+		if (count >= rank)
+		{
+			return getUpperBound(i);
+		}
+	}
+
+	return getUpperBound(cBucketCount - 1);
+}
+
+
+Metrics::Metrics()
+	: mIndex()
+	, mSeries()
+	, mExportEnabled(false)
+	, mMutex()
+{
+}
+
+
+QLatin1StringView Metrics::getName(Metric pMetric)
+{
+	return getDefinition(pMetric).mName;
+}
+
+
+QLatin1StringView Metrics::getHelp(Metric pMetric)
+{
+	return getDefinition(pMetric).mHelp;
+}
+
+
+bool Metrics::isHistogram(Metric pMetric)
+{
+	return getDefinition(pMetric).mHistogram;
+}
+
+
+void Metrics::setExportEnabled(bool pEnabled)
+{
+	mExportEnabled = pEnabled;
+}
+
+
+bool Metrics::isExportEnabled() const
+{
+	return mExportEnabled;
+}
+
+
+Metrics::Series* Metrics::getSeries(Metric pMetric, const Labels& pLabels)
+{
+	QString key = QString::number(static_cast<int>(pMetric));
+	for (const auto& [name, value] : pLabels)
+	{
+		key += QLatin1Char('|');
+		key += name;
+		key += QLatin1Char('=');
+		key += value;
+	}
+
+	const QMutexLocker locker(&mMutex);
+	if (const auto series = mIndex.constFind(key); series != mIndex.constEnd())
+	{
+		return series->data();
+	}
+
+	if (mSeries.size() >= cMaxSeries)
+	{
+		return nullptr;
+	}
+
+	const auto series = QSharedPointer<Series>::create();
+	series->mMetric = pMetric;
+	series->mLabels = pLabels;
+	mIndex.insert(key, series);
+	mSeries << series;
+	return series.data();
+}
+
+
+QList<QSharedPointer<Metrics::Series>> Metrics::getSeriesList() const
+{
+	const QMutexLocker locker(&mMutex);
+	return mSeries;
+}
+
+
+void Metrics::increment(Metric pMetric, const Labels& pLabels)
+{
+	Q_ASSERT(!isHistogram(pMetric));
+	increment(getSeries(pMetric, pLabels));
+}
+
+
+void Metrics::record(Metric pMetric, qint64 pMicroseconds, const Labels& pLabels)
+{
+	Q_ASSERT(isHistogram(pMetric));
+	record(getSeries(pMetric, pLabels), pMicroseconds);
+}
+
+
+void Metrics::increment(Series* pSeries)
+{
+	if (pSeries)
+	{
+		Q_ASSERT(!isHistogram(pSeries->mMetric));
+		pSeries->mValue.fetch_add(1, std::memory_order_relaxed);
+	}
+}
+
+
+void Metrics::record(Series* pSeries, qint64 pMicroseconds)
+{
+	if (pSeries)
+	{
+		Q_ASSERT(isHistogram(pSeries->mMetric));
+		pSeries->mHistogram.record(pMicroseconds);
+	}
+}
+
+
+QByteArray Metrics::toLabelString(const Labels& pLabels, const QByteArray& pExtra)
+{
+	QByteArrayList labels;
+	for (const auto& [name, value] : pLabels)
+	{
+		labels << QByteArray(name.data(), name.size()) + "=\"" + escapeLabelValue(value) + '"';
+	}
+	if (!pExtra.isEmpty())
+	{
+		labels << pExtra;
+	}
+
+	return labels.isEmpty() ? QByteArray() : '{' + labels.join(',') + '}';
+}
+
+
+QByteArray Metrics::toPrometheus() const
+{
+	const auto& seriesList = getSeriesList();
+
+	QByteArray result;
+	for (const auto metric : Enum<Metric>::getList())
+	{
+		const QByteArray name(getName(metric).data(), getName(metric).size());
+		const bool histogram = isHistogram(metric);
+		result += "# HELP " + name + ' ' + QByteArray(getHelp(metric).data(), getHelp(metric).size()) + '\n';
+		result += "# TYPE " + name + (histogram ? " histogram\n" : " counter\n");
+
+		for (const auto& series : seriesList)
+		{
+			if (series->mMetric != metric)
+			{
+				continue;
+			}
+
+			if (!histogram)
+			{
+				result += name + toLabelString(series->mLabels) + ' ' + QByteArray::number(series->mValue.load(std::memory_order_relaxed)) + '\n';
+				continue;
+			}
+
+			const auto& values = series->mHistogram;
+			const auto count = values.getCount();
+			for (int exponent = cExportExponentMin; exponent <= cExportExponentMax; ++exponent)
+			{
+				const auto bound = quint64(1) << exponent;
+				result += name + "_bucket" + toLabelString(series->mLabels, "le=\"" + toSeconds(bound) + '"') + ' ' + QByteArray::number(values.getCountUpTo(bound)) + '\n';
+			}
+			result += name + "_bucket" + toLabelString(series->mLabels, QByteArrayLiteral("le=\"+Inf\"")) + ' ' + QByteArray::number(count) + '\n';
+			result += name + "_sum" + toLabelString(series->mLabels) + ' ' + toSeconds(values.getSum()) + '\n';
+			result += name + "_count" + toLabelString(series->mLabels) + ' ' + QByteArray::number(count) + '\n';
+		}
+	}
+
+	return result;
+}
+
+
+QJsonObject Metrics::toJson() const
+{
+	const auto& seriesList = getSeriesList();
+
+	QJsonObject result;
+	for (const auto metric : Enum<Metric>::getList())
+	{
+		QJsonArray entries;
+		for (const auto& series : seriesList)
+		{
+			if (series->mMetric != metric)
+			{
+				continue;
+			}
+
+			QJsonObject labels;
+			for (const auto& [name, value] : std::as_const(series->mLabels))
+			{
+				labels[name] = value;
+			}
+
+			QJsonObject entry;
+			entry[QLatin1String("labels")] = labels;
+			if (isHistogram(metric))
+			{
+				const auto& values = series->mHistogram;
+				entry[QLatin1String("count")] = static_cast<qint64>(values.getCount());
+				entry[QLatin1String("sum")] = static_cast<double>(values.getSum()) / 1000000;
+				entry[QLatin1String("p50")] = static_cast<double>(values.getQuantile(0.5)) / 1000000;
+				entry[QLatin1String("p90")] = static_cast<double>(values.getQuantile(0.9)) / 1000000;
+				entry[QLatin1String("p99")] = static_cast<double>(values.getQuantile(0.99)) / 1000000;
+			}
+			else
+			{
+				entry[QLatin1String("value")] = static_cast<qint64>(series->mValue.load(std::memory_order_relaxed));
+			}
+			entries += entry;
+		}
+		result[getName(metric)] = entries;
+	}
+
+	return result;
+}
@@ -0,0 +1,140 @@
+/**
+ * Copyright (c) 2025 Governikus GmbH & Co. KG, Germany
+ */
+
+#pragma once
+
+#include "EnumHelper.h"
+
+#include <QByteArray>
+#include <QHash>
+#include <QJsonObject>
+#include <QList>
+#include <QMutex>
+#include <QSharedPointer>
+#include <QString>
+
+#include <array>
+#include <atomic>
+#include <utility>
+
+
+class test_Metrics;
+
+
+namespace governikus
+{
+
+defineEnumType(Metric,
+		APDU_DURATION,
+		PACE_DURATION,
+		PAOS_ROUND_TRIP,
+		TLS_HANDSHAKE,
+		WORKFLOWS,
+		READER_EVENTS,
+		IFD_RECONNECTS
+		)
+
+/*!
+ * Counters and latency histograms of the running application. Updates of a
+ * series are atomic, only the lookup of a series takes a short lock. Hot paths
+ * resolve their series once by getSeries(). Series are never removed, so the
+ * memory is bounded by cMaxSeries and a resolved series stays valid.
+ * Histograms use logarithmic buckets with four linear sub-buckets each, so
+ * every recorded value is accurate to 25 percent.
+ */
+class Metrics
+{
+	Q_GADGET
+	Q_DISABLE_COPY(Metrics)
+	friend class Env;
+	friend class ::test_Metrics;
+
+	public:
+		using Labels = QList<std::pair<QLatin1StringView, QString>>;
+
+		class Histogram
+		{
+			Q_DISABLE_COPY(Histogram)
+			friend class ::test_Metrics;
+
+			public:
+				static constexpr int cSubBucketBits = 2;
+				static constexpr int cSubBuckets = 1 << cSubBucketBits;
+				static constexpr int cMaxExponent = 37;
+				static constexpr int cBucketCount = cSubBuckets + (cMaxExponent - cSubBucketBits + 1) * cSubBuckets;
+
+			private:
+				std::array<std::atomic<quint64>, cBucketCount> mBuckets;
+				std::atomic<quint64> mCount;
+				std::atomic<quint64> mSum;
+
+				[[nodiscard]] static int getIndex(quint64 pValue);
+				[[nodiscard]] static quint64 getUpperBound(int pIndex);
+
+			public:
+				Histogram();
+
+				void record(qint64 pMicroseconds);
+				[[nodiscard]] quint64 getCount() const;
+				[[nodiscard]] quint64 getSum() const;
+
+				/*!
+				 * Returns the number of values less than or equal to \a pMicroseconds.
+				 * The result is exact if \a pMicroseconds is a power of two.
+				 */
+				[[nodiscard]] quint64 getCountUpTo(quint64 pMicroseconds) const;
+
+				/*!
+				 * Returns the upper bound of the bucket that contains the quantile \a pQuantile.
+				 */
+				[[nodiscard]] quint64 getQuantile(double pQuantile) const;
+		};
+
+		struct Series
+		{
+			Metric mMetric;
+			Labels mLabels;
+			std::atomic<quint64> mValue;
+			Histogram mHistogram;
+		};
+
+	private:
+		QHash<QString, QSharedPointer<Series>> mIndex;
+		QList<QSharedPointer<Series>> mSeries;
+		std::atomic_bool mExportEnabled;
+		mutable QMutex mMutex;
+
+		[[nodiscard]] QList<QSharedPointer<Series>> getSeriesList() const;
+		[[nodiscard]] static QByteArray toLabelString(const Labels& pLabels, const QByteArray& pExtra = QByteArray());
+
+	protected:
+		Metrics();
+		~Metrics() = default;
+		static Metrics& getInstance();
+
+	public:
+		static constexpr int cMaxSeries = 1024;
+
+		[[nodiscard]] static QLatin1StringView getName(Metric pMetric);
+		[[nodiscard]] static QLatin1StringView getHelp(Metric pMetric);
+		[[nodiscard]] static bool isHistogram(Metric pMetric);
+
+		void setExportEnabled(bool pEnabled);
+		[[nodiscard]] bool isExportEnabled() const;
+
+		/*!
+		 * Returns the series of \a pMetric with \a pLabels or nullptr if cMaxSeries is reached.
+		 */
+		[[nodiscard]] Series* getSeries(Metric pMetric, const Labels& pLabels = Labels());
+
+		void increment(Metric pMetric, const Labels& pLabels = Labels());
+		void record(Metric pMetric, qint64 pMicroseconds, const Labels& pLabels = Labels());
+		static void increment(Series* pSeries);
+		static void record(Series* pSeries, qint64 pMicroseconds);
+
+		[[nodiscard]] QByteArray toPrometheus() const;
+		[[nodiscard]] QJsonObject toJson() const;
+};
+
+} // namespace governikus
@@ -0,0 +1,156 @@
+/**
+ * Copyright (c) 2025 Governikus GmbH & Co. KG, Germany
+ */
+
+#include "StartupProfile.h"
+
+#include "SingletonHelper.h"
+
+#include <QLoggingCategory>
+#include <QThread>
+
+#include <algorithm>
+
+
+using namespace governikus;
+
+
+defineSingleton(StartupProfile)
+
+
+Q_DECLARE_LOGGING_CATEGORY(init)
+
+
+namespace
+{
+QString toMilliseconds(qint64 pMicroseconds)
+{
+	return QString::number(static_cast<double>(pMicroseconds) / 1000, 'f', 3);
+}
+
+
+} // namespace
+
+
+StartupProfile::ScopedStep::ScopedStep(const QString& pName)
+	: mName(pName)
+	, mStart(StartupProfile::getInstance().now())
+{
+}
+
+
+StartupProfile::ScopedStep::~ScopedStep()
+{
+	StartupProfile::getInstance().addStep(mName, mStart);
+}
+
+
+StartupProfile::StartupProfile()
+	: mTimer()
+	, mSteps()
+	, mEnabled(false)
+	, mFinished(false)
+	, mMutex()
+{
+	mTimer.start();
+}
+
+
+void StartupProfile::setEnabled(bool pEnabled)
+{
+	const QMutexLocker locker(&mMutex);
+	mEnabled = pEnabled;
+}
+
+
+bool StartupProfile::isEnabled() const
+{
+	const QMutexLocker locker(&mMutex);
+	return mEnabled;
+}
+
+
+qint64 StartupProfile::now() const
+{
+	return mTimer.nsecsElapsed() / 1000;
+}
+
+
+void StartupProfile::addStep(const QString& pName, qint64 pStart)
+{
+	const auto end = now();
+	const auto* thread = QThread::currentThread();
+	Step step {pName, pStart, end - pStart, thread->objectName()};
+
+	const QMutexLocker locker(&mMutex);
+	if (mFinished)
+	{
+		if (mEnabled)
+		{
+			qCInfo(init).noquote() << "Startup profile:" << pName << "after" << toMilliseconds(end) << "ms";
+			mEnabled = false;
+		}
+		return;
+	}
+
+	if (mSteps.size() < cMaxSteps)
+	{
+		mSteps << step;
+	}
+}
+
+
+void StartupProfile::mark(const QString& pName)
+{
+	addStep(pName, now());
+}
+
+
+void StartupProfile::finish()
+{
+	mark(QStringLiteral("Started"));
+
+	QMutexLocker locker(&mMutex);
+	mFinished = true;
+	if (!mEnabled)
+	{
+		return;
+	}
+
+	locker.unlock();
+	const auto& report = toReport();
+	for (const auto& line : report)
+	{
+		qCInfo(init).noquote() << line;
+	}
+}
+
+
+QList<StartupProfile::Step> StartupProfile::getSteps() const
+{
+	const QMutexLocker locker(&mMutex);
+	auto steps = mSteps;
+	std::stable_sort(steps.begin(), steps.end(), [](const Step& pLeft, const Step& pRight){
+				// enclosing steps first
+				return pLeft.mStart < pRight.mStart || (pLeft.mStart == pRight.mStart && pLeft.mDuration > pRight.mDuration);
+			});
+	return steps;
+}
+
+
+QStringList StartupProfile::toReport() const
+{
+	const auto& steps = getSteps();
+
+	QStringList report;
+	report << QStringLiteral("Startup profile (start | duration in ms):");
+	for (const auto& step : steps)
+	{
+		report << QStringLiteral("%1 | %2 | %3%4").arg(
+				toMilliseconds(step.mStart).rightJustified(10),
+				toMilliseconds(step.mDuration).rightJustified(10),
+				step.mName,
+				step.mThread.isEmpty() ? QString() : QStringLiteral(" (%1)").arg(step.mThread));
+	}
+	return report;
+}
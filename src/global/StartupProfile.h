@@ -0,0 +1,84 @@
+/**
+ * Copyright (c) 2025 Governikus GmbH & Co. KG, Germany
+ */
+
+#pragma once
+
+#include <QElapsedTimer>
+#include <QList>
+#include <QMutex>
+#include <QObject>
+#include <QString>
+
+
+class test_StartupProfile;
+
+
+namespace governikus
+{
+
+/*!
+ * Timeline of the application start. Steps are always recorded, the
+ * report is only logged if the profile is enabled by --startup-profile.
+ * After finish() only the next step is logged, e.g. the first workflow.
+ */
+class StartupProfile
+{
+	Q_GADGET
+	Q_DISABLE_COPY(StartupProfile)
+	friend class Env;
+	friend class ::test_StartupProfile;
+
+	public:
+		struct Step
+		{
+			QString mName;
+			qint64 mStart;
+			qint64 mDuration;
+			QString mThread;
+		};
+
+		class ScopedStep
+		{
+			Q_DISABLE_COPY(ScopedStep)
+
+			private:
+				const QString mName;
+				const qint64 mStart;
+
+			public:
+				explicit ScopedStep(const QString& pName);
+				~ScopedStep();
+		};
+
+	private:
+		QElapsedTimer mTimer;
+		QList<Step> mSteps;
+		bool mEnabled;
+		bool mFinished;
+		mutable QMutex mMutex;
+
+	protected:
+		StartupProfile();
+		~StartupProfile() = default;
+		static StartupProfile& getInstance();
+
+	public:
+		static constexpr int cMaxSteps = 256;
+
+		void setEnabled(bool pEnabled);
+		[[nodiscard]] bool isEnabled() const;
+
+		/*!
+		 * Returns the elapsed time since the start of the application in microseconds.
+		 */
+		[[nodiscard]] qint64 now() const;
+		void addStep(const QString& pName, qint64 pStart);
+		void mark(const QString& pName);
+		void finish();
+
+		[[nodiscard]] QList<Step> getSteps() const;
+		[[nodiscard]] QStringList toReport() const;
+};
+
+} // namespace governikus
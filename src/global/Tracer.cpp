@@ -0,0 +1,421 @@
+/**
+ * Copyright (c) 2025 Governikus GmbH & Co. KG, Germany
+ */
+
+#include "Tracer.h"
+
+#include "SingletonHelper.h"
+
+#include <QCoreApplication>
+#include <QDir>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QLoggingCategory>
+#include <QRandomGenerator>
+#include <QThread>
+#include <QtEndian>
+
+#include <algorithm>
+
+#include "moc_Tracer.cpp"
+
+using namespace governikus;
+
+defineSingleton(Tracer)
+
+Q_DECLARE_LOGGING_CATEGORY(tracing)
+
+
+namespace
+{
+QString toUnixNano(const Tracer::Trace& pTrace, qint64 pTimestamp)
+{
+	const auto offset = pTimestamp - pTrace.mStart;
+	return QString::number(pTrace.mStartTime.toMSecsSinceEpoch() * 1000000 + offset * 1000);
+}
+
+
+QByteArray toSpanId(quint64 pIndex)
+{
+	QByteArray id(sizeof(quint64), Qt::Uninitialized);
+	qToBigEndian(pIndex + 1, id.data());
+	return id.toHex();
+}
+
+
+QJsonObject toOtlpValue(const QJsonValue& pValue)
+{
+	switch (pValue.type())
+	{
+		case QJsonValue::Bool:
+			return {{QLatin1String("boolValue"), pValue.toBool()}};
+
+		case QJsonValue::Double:
+		{
+			const auto value = pValue.toDouble();
+			if (value == static_cast<double>(pValue.toInteger()))
+			{
+				// OTLP/JSON encodes 64 bit integers as strings
+				return {{QLatin1String("intValue"), QString::number(pValue.toInteger())}};
+			}
+			return {{QLatin1String("doubleValue"), value}};
+		}
+
+		case QJsonValue::String:
+			return {{QLatin1String("stringValue"), pValue.toString()}};
+
+		case QJsonValue::Array:
+			return {{QLatin1String("stringValue"), QString::fromUtf8(QJsonDocument(pValue.toArray()).toJson(QJsonDocument::Compact))}};
+
+		case QJsonValue::Object:
+			return {{QLatin1String("stringValue"), QString::fromUtf8(QJsonDocument(pValue.toObject()).toJson(QJsonDocument::Compact))}};
+
+		default:
+			return {{QLatin1String("stringValue"), QString()}};
+	}
+}
+
+
+QJsonArray toOtlpAttributes(const QJsonObject& pArgs)
+{
+	QJsonArray attributes;
+	for (auto iter = pArgs.constBegin(); iter != pArgs.constEnd(); ++iter)
+	{
+		attributes += QJsonObject {
+			{QLatin1String("key"), iter.key()},
+			{QLatin1String("value"), toOtlpValue(iter.value())}
+		};
+	}
+	return attributes;
+}
+
+
+} // namespace
+
+
+Tracer::ScopedSpan::ScopedSpan(QLatin1StringView pCategory, const QString& pName)
+	: mCategory(pCategory)
+	, mName(pName)
+	, mStart(Tracer::getInstance().now())
+	, mArgs()
+{
+}
+
+
+Tracer::ScopedSpan::~ScopedSpan()
+{
+	if (isActive())
+	{
+		Tracer::getInstance().addSpan(mCategory, mName, mStart, mArgs);
+	}
+}
+
+
+bool Tracer::ScopedSpan::isActive() const
+{
+	return mStart >= 0;
+}
+
+
+void Tracer::ScopedSpan::setArg(const QString& pKey, const QJsonValue& pValue)
+{
+	if (isActive())
+	{
+		mArgs.insert(pKey, pValue);
+	}
+}
+
+
+Tracer::Tracer()
+	: mTimer()
+	, mEnabled(true)
+	, mTracing(false)
+	, mCurrent()
+	, mTraces()
+	, mExportDirectory()
+	, mExportFormat(TraceFormat::CHROME)
+	, mExportPool()
+	, mMutex()
+{
+	mTimer.start();
+	mExportPool.setMaxThreadCount(1);
+}
+
+
+void Tracer::setEnabled(bool pEnabled)
+{
+	mEnabled = pEnabled;
+	if (!pEnabled)
+	{
+		const QMutexLocker locker(&mMutex);
+		mTracing = false;
+	}
+}
+
+
+bool Tracer::isEnabled() const
+{
+	return mEnabled;
+}
+
+
+void Tracer::setExport(const QString& pDirectory, TraceFormat pFormat)
+{
+	const QMutexLocker locker(&mMutex);
+	mExportDirectory = pDirectory;
+	mExportFormat = pFormat;
+}
+
+
+void Tracer::startTrace(const QString& pName)
+{
+	if (!mEnabled)
+	{
+		return;
+	}
+
+	if (mTracing)
+	{
+		qCDebug(tracing) << "Finishing unfinished trace" << mCurrent.mName;
+		finishTrace();
+	}
+
+	QByteArray id(16, Qt::Uninitialized);
+	QRandomGenerator::global()->fillRange(reinterpret_cast<quint32*>(id.data()), id.size() / static_cast<qsizetype>(sizeof(quint32)));
+
+	const QMutexLocker locker(&mMutex);
+	mCurrent = {id, pName, QDateTime::currentDateTimeUtc(), mTimer.nsecsElapsed() / 1000, 0, {}, 0};
+	mCurrent.mSpans.reserve(256);
+	mTracing = true;
+}
+
+
+void Tracer::finishTrace()
+{
+	Trace finished;
+	QString directory;
+	{
+		const QMutexLocker locker(&mMutex);
+		if (!mTracing)
+		{
+			return;
+		}
+
+		mTracing = false;
+		mCurrent.mDuration = mTimer.nsecsElapsed() / 1000 - mCurrent.mStart;
+		if (mCurrent.mDroppedSpans > 0)
+		{
+			qCWarning(tracing) << "Dropped" << mCurrent.mDroppedSpans << "spans of trace" << mCurrent.mName;
+		}
+
+		mTraces << std::move(mCurrent);
+		mCurrent = Trace();
+		while (mTraces.size() > cMaxTraces)
+		{
+			mTraces.removeFirst();
+		}
+
+		directory = mExportDirectory;
+		finished = mTraces.constLast();
+	}
+
+	qCDebug(tracing) << "Finished trace" << finished.mName << "after" << finished.mDuration / 1000 << "msecs with" << finished.mSpans.size() << "spans";
+	if (!directory.isEmpty())
+	{
+		exportTrace(finished);
+	}
+}
+
+
+bool Tracer::isTracing() const
+{
+	return mTracing;
+}
+
+
+qint64 Tracer::now() const
+{
+	return mTracing ? mTimer.nsecsElapsed() / 1000 : -1;
+}
+
+
+void Tracer::addSpan(QLatin1StringView pCategory, const QString& pName, qint64 pStart, const QJsonObject& pArgs)
+{
+	if (pStart < 0 || !mTracing)
+	{
+		return;
+	}
+
+	const auto end = mTimer.nsecsElapsed() / 1000;
+	const auto thread = static_cast<quint64>(reinterpret_cast<quintptr>(QThread::currentThreadId()));
+
+	const QMutexLocker locker(&mMutex);
+	if (!mTracing || pStart < mCurrent.mStart)
+	{
+		return;
+	}
+
+	if (mCurrent.mSpans.size() >= cMaxSpans)
+	{
+		++mCurrent.mDroppedSpans;
+		return;
+	}
+
+	mCurrent.mSpans += Span {pCategory, pName, pStart, end - pStart, thread, pArgs};
+}
+
+
+QList<Tracer::Trace> Tracer::getTraces(int pCount) const
+{
+	const QMutexLocker locker(&mMutex);
+	if (pCount >= mTraces.size())
+	{
+		return mTraces;
+	}
+	return mTraces.mid(mTraces.size() - std::max(pCount, 0));
+}
+
+
+QJsonObject Tracer::toChromeTrace(const Trace& pTrace)
+{
+	QJsonArray events;
+	events += QJsonObject {
+		{QLatin1String("name"), pTrace.mName},
+		{QLatin1String("cat"), QLatin1String("workflow")},
+		{QLatin1String("ph"), QLatin1String("X")},
+		{QLatin1String("ts"), 0},
+		{QLatin1String("dur"), pTrace.mDuration},
+		{QLatin1String("pid"), 1},
+		{QLatin1String("tid"), 0}
+	};
+
+	for (const auto& span : std::as_const(pTrace.mSpans))
+	{
+		QJsonObject event {
+			{QLatin1String("name"), span.mName},
+			{QLatin1String("cat"), span.mCategory},
+			{QLatin1String("ph"), QLatin1String("X")},
+			{QLatin1String("ts"), span.mStart - pTrace.mStart},
+			{QLatin1String("dur"), span.mDuration},
+			{QLatin1String("pid"), 1},
+			{QLatin1String("tid"), static_cast<qint64>(span.mThread)}
+		};
+		if (!span.mArgs.isEmpty())
+		{
+			event.insert(QLatin1String("args"), span.mArgs);
+		}
+		events += event;
+	}
+
+	return {
+		{QLatin1String("traceEvents"), events},
+		{QLatin1String("displayTimeUnit"), QLatin1String("ms")},
+		{QLatin1String("otherData"), QJsonObject {
+			 {QLatin1String("workflow"), pTrace.mName},
+			 {QLatin1String("startTime"), pTrace.mStartTime.toString(Qt::ISODateWithMs)},
+			 {QLatin1String("droppedSpans"), pTrace.mDroppedSpans}
+		 }
+		}
+	};
+}
+
+
+QJsonObject Tracer::toOtlp(const Trace& pTrace)
+{
+	const auto& traceId = QString::fromLatin1(pTrace.mId.toHex());
+	const auto& rootId = QString::fromLatin1(toSpanId(0));
+
+	QJsonArray spans;
+	spans += QJsonObject {
+		{QLatin1String("traceId"), traceId},
+		{QLatin1String("spanId"), rootId},
+		{QLatin1String("name"), pTrace.mName},
+		{QLatin1String("kind"), 1},
+		{QLatin1String("startTimeUnixNano"), toUnixNano(pTrace, pTrace.mStart)},
+		{QLatin1String("endTimeUnixNano"), toUnixNano(pTrace, pTrace.mStart + pTrace.mDuration)}
+	};
+
+	for (qsizetype i = 0; i < pTrace.mSpans.size(); ++i)
+	{
+		const auto& span = pTrace.mSpans.at(i);
+		auto attributes = toOtlpAttributes(span.mArgs);
+		attributes += QJsonObject {
+			{QLatin1String("key"), QLatin1String("category")},
+			{QLatin1String("value"), toOtlpValue(span.mCategory)}
+		};
+
+		spans += QJsonObject {
+			{QLatin1String("traceId"), traceId},
+			{QLatin1String("spanId"), QString::fromLatin1(toSpanId(static_cast<quint64>(i) + 1))},
+			{QLatin1String("parentSpanId"), rootId},
+			{QLatin1String("name"), span.mName},
+			{QLatin1String("kind"), 1},
+			{QLatin1String("startTimeUnixNano"), toUnixNano(pTrace, span.mStart)},
+			{QLatin1String("endTimeUnixNano"), toUnixNano(pTrace, span.mStart + span.mDuration)},
+			{QLatin1String("attributes"), attributes}
+		};
+	}
+
+	const QJsonObject resource {
+		{QLatin1String("attributes"), toOtlpAttributes({
+				{QLatin1String("service.name"), QCoreApplication::applicationName()},
+				{QLatin1String("service.version"), QCoreApplication::applicationVersion()}
+			})
+		}
+	};
+
+	const QJsonObject scopeSpans {
+		{QLatin1String("scope"), QJsonObject {{QLatin1String("name"), QLatin1String("governikus.tracer")}}},
+		{QLatin1String("spans"), spans}
+	};
+
+	return {
+		{QLatin1String("resourceSpans"), QJsonArray {
+			 QJsonObject {
+				 {QLatin1String("resource"), resource},
+				 {QLatin1String("scopeSpans"), QJsonArray {scopeSpans}}
+			 }
+		 }
+		}
+	};
+}
+
+
+bool Tracer::writeTrace(const Trace& pTrace, const QString& pFile, TraceFormat pFormat)
+{
+	QFile file(pFile);
+	if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+	{
+		qCWarning(tracing) << "Cannot write trace to" << pFile << ':' << file.errorString();
+		return false;
+	}
+
+	const auto& json = pFormat == TraceFormat::OTLP ? toOtlp(pTrace) : toChromeTrace(pTrace);
+	const auto& data = QJsonDocument(json).toJson(QJsonDocument::Compact);
+	return file.write(data) == data.size();
+}
+
+
+void Tracer::exportTrace(const Trace& pTrace)
+{
+	QString directory;
+	TraceFormat format;
+	{
+		const QMutexLocker locker(&mMutex);
+		directory = mExportDirectory;
+		format = mExportFormat;
+	}
+
+	const auto& suffix = format == TraceFormat::OTLP ? QLatin1String(".otlp.json") : QLatin1String(".json");
+	const auto& name = QStringLiteral("trace-%1-%2").arg(pTrace.mStartTime.toString(QStringLiteral("yyyyMMdd-HHmmsszzz")), pTrace.mName.toLower());
+	const auto& path = QDir(directory).absoluteFilePath(name + suffix);
+
+	// Serialising a trace with thousands of spans should not block the caller.
+	mExportPool.start([pTrace, path, format] {
+				if (writeTrace(pTrace, path, format))
+				{
+					qCDebug(tracing) << "Exported trace to" << path;
+				}
+			});
+}
@@ -0,0 +1,127 @@
+/**
+ * Copyright (c) 2025 Governikus GmbH & Co. KG, Germany
+ */
+
+#pragma once
+
+#include "EnumHelper.h"
+
+#include <QDateTime>
+#include <QElapsedTimer>
+#include <QJsonObject>
+#include <QList>
+#include <QMutex>
+#include <QString>
+#include <QThreadPool>
+
+#include <atomic>
+
+
+class test_Tracer;
+
+
+namespace governikus
+{
+
+defineEnumType(TraceFormat,
+		CHROME,
+		OTLP
+		)
+
+class Tracer
+{
+	Q_GADGET
+	Q_DISABLE_COPY(Tracer)
+	friend class Env;
+	friend class ::test_Tracer;
+
+	public:
+		struct Span
+		{
+			QLatin1StringView mCategory;
+			QString mName;
+			qint64 mStart;
+			qint64 mDuration;
+			quint64 mThread;
+			QJsonObject mArgs;
+		};
+
+		struct Trace
+		{
+			QByteArray mId;
+			QString mName;
+			QDateTime mStartTime;
+			qint64 mStart;
+			qint64 mDuration;
+			QList<Span> mSpans;
+			int mDroppedSpans;
+		};
+
+		class ScopedSpan
+		{
+			Q_DISABLE_COPY(ScopedSpan)
+
+			private:
+				const QLatin1StringView mCategory;
+				const QString mName;
+				const qint64 mStart;
+				QJsonObject mArgs;
+
+			public:
+				ScopedSpan(QLatin1StringView pCategory, const QString& pName);
+				~ScopedSpan();
+
+				[[nodiscard]] bool isActive() const;
+				void setArg(const QString& pKey, const QJsonValue& pValue);
+		};
+
+	private:
+		QElapsedTimer mTimer;
+		std::atomic_bool mEnabled;
+		std::atomic_bool mTracing;
+		Trace mCurrent;
+		QList<Trace> mTraces;
+		QString mExportDirectory;
+		TraceFormat mExportFormat;
+		QThreadPool mExportPool;
+		mutable QMutex mMutex;
+
+		void exportTrace(const Trace& pTrace);
+
+	protected:
+		Tracer();
+		~Tracer() = default;
+		static Tracer& getInstance();
+
+	public:
+		static constexpr int cMaxTraces = 10;
+		static constexpr int cMaxSpans = 4096;
+
+		void setEnabled(bool pEnabled);
+		[[nodiscard]] bool isEnabled() const;
+		void setExport(const QString& pDirectory, TraceFormat pFormat);
+
+		void startTrace(const QString& pName);
+		void finishTrace();
+		[[nodiscard]] bool isTracing() const;
+
+		/*!
+		 * Returns the current timestamp in microseconds or -1 if no trace is running.
+		 * Use it as start of a span that does not fit into a single scope.
+		 */
+		[[nodiscard]] qint64 now() const;
+
+		/*!
+		 * Adds a span to the running trace. Check isTracing() before building
+		 * the name or arguments as they are discarded if no trace is running.
+		 */
+		void addSpan(QLatin1StringView pCategory, const QString& pName, qint64 pStart, const QJsonObject& pArgs = QJsonObject());
+
+		[[nodiscard]] QList<Trace> getTraces(int pCount = cMaxTraces) const;
+
+		[[nodiscard]] static QJsonObject toChromeTrace(const Trace& pTrace);
+		[[nodiscard]] static QJsonObject toOtlp(const Trace& pTrace);
+		static bool writeTrace(const Trace& pTrace, const QString& pFile, TraceFormat pFormat);
+};
+
+} // namespace governikus
@@ -31,3 +31,10 @@ QList<QSharedPointer<IfdListEntry>> IfdList::getIfdList() const
 {
 	return QList<QSharedPointer<IfdListEntry>>();
 }
+
+
+bool IfdList::refresh(const QByteArray& pIfdId)
+{
+	Q_UNUSED(pIfdId)
+	return false;
+}
@@ -28,6 +28,7 @@ class IfdList
 		~IfdList() override = default;
 
 		virtual void update(const Discovery& pDiscovery) = 0;
+		virtual bool refresh(const QByteArray& pIfdId);
 		virtual void clear() = 0;
 		[[nodiscard]] virtual QList<QSharedPointer<IfdListEntry>> getIfdList() const;
 };
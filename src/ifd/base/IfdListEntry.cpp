@@ -21,6 +21,8 @@ IfdListEntry::IfdListEntry(const Discovery& pDiscovery)
 	: mDiscovery(pDiscovery)
 	, mLastSeen(QTime::currentTime())
 	, mLastSeenHistory()
+	, mHistoryBegin(0)
+	, mHistoryCount(0)
 {
 }
 
@@ -29,7 +31,16 @@ void IfdListEntry::setLastSeenToNow()
 {
 	if (mLastSeen.isValid())
 	{
-		mLastSeenHistory += mLastSeen;
+		// The oldest timestamp will be overwritten if the history is full.
+		mLastSeenHistory[static_cast<size_t>((mHistoryBegin + mHistoryCount) % cHistorySize)] = mLastSeen;
+		if (mHistoryCount < cHistorySize)
+		{
+			++mHistoryCount;
+		}
+		else
+		{
+			mHistoryBegin = (mHistoryBegin + 1) % cHistorySize;
+		}
 	}
 
 	mLastSeen = QTime::currentTime();
@@ -41,9 +52,14 @@ bool IfdListEntry::cleanUpSeenTimestamps(int pReaderResponsiveTimeout)
 	const auto visibilityOld = getPercentSeen();
 	const QTime threshold(QTime::currentTime().addMSecs(-pReaderResponsiveTimeout));
 
-	const auto removed = erase_if(mLastSeenHistory, [&threshold](const auto pValue){
-				return pValue < threshold;
-			});
+	// Timestamps are added in chronological order, so only the oldest ones can expire.
+	int removed = 0;
+	while (mHistoryCount > 0 && mLastSeenHistory[static_cast<size_t>(mHistoryBegin)] < threshold)
+	{
+		mHistoryBegin = (mHistoryBegin + 1) % cHistorySize;
+		--mHistoryCount;
+		++removed;
+	}
 
 	return removed > 0 && getPercentSeen() != visibilityOld;
 }
@@ -51,7 +67,7 @@ bool IfdListEntry::cleanUpSeenTimestamps(int pReaderResponsiveTimeout)
 
 int IfdListEntry::getPercentSeen(int pCheckInterval, int pTimeFrame) const
 {
-	const auto count = static_cast<int>(mLastSeenHistory.size());
+	const auto count = mHistoryCount;
 	const int expectedMax = pTimeFrame / pCheckInterval;
 	const int percent = 100 * count / expectedMax;
 
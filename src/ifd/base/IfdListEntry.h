@@ -6,9 +6,10 @@
 
 #include "messages/Discovery.h"
 
-#include <QList>
 #include <QTime>
 
+#include <array>
+
 
 namespace governikus
 {
@@ -18,9 +19,13 @@ class IfdListEntry
 	Q_DISABLE_COPY(IfdListEntry)
 
 	private:
+		static constexpr int cHistorySize = 16;
+
 		Discovery mDiscovery;
 		QTime mLastSeen;
-		QList<QTime> mLastSeenHistory;
+		std::array<QTime, cHistorySize> mLastSeenHistory;
+		int mHistoryBegin;
+		int mHistoryCount;
 
 	public:
 		explicit IfdListEntry(const Discovery& pDiscovery);
@@ -13,6 +13,7 @@ IfdListImpl::IfdListImpl(int pCheckInterval, int pReaderResponsiveTimeout)
 	, mTimer()
 	, mReaderResponsiveTimeout(pReaderResponsiveTimeout)
 	, mResponsiveList()
+	, mIndex()
 {
 	connect(&mTimer, &QTimer::timeout, this, &IfdListImpl::onProcessUnresponsiveRemoteReaders);
 	pCheckInterval = pCheckInterval / 2 - 1;  // Nyquist-Shannon sampling theorem. Enable smooth UI updates.
@@ -28,20 +29,18 @@ IfdListImpl::~IfdListImpl()
 
 void IfdListImpl::update(const Discovery& pDiscovery)
 {
-	for (const QSharedPointer<IfdListEntry>& entry : std::as_const(mResponsiveList))
+	if (const auto& entry = mIndex.value(pDiscovery.getIfdId()))
 	{
-		if (entry->containsIfdId(pDiscovery.getIfdId()))
-		{
-			entry->setLastSeenToNow();
-			entry->setDiscovery(pDiscovery);
-			Q_EMIT fireDeviceUpdated(entry);
-
-			return;
-		}
+		entry->setLastSeenToNow();
+		entry->setDiscovery(pDiscovery);
+		Q_EMIT fireDeviceUpdated(entry);
+
+		return;
 	}
 
 	const auto& newDevice = QSharedPointer<IfdListEntry>::create(pDiscovery);
 	mResponsiveList += newDevice;
+	mIndex.insert(pDiscovery.getIfdId(), newDevice);
 
 	if (!mTimer.isActive())
 	{
@@ -52,8 +51,23 @@ void IfdListImpl::update(const Discovery& pDiscovery)
 }
 
 
+bool IfdListImpl::refresh(const QByteArray& pIfdId)
+{
+	const auto& entry = mIndex.value(pIfdId);
+	if (entry.isNull())
+	{
+		return false;
+	}
+
+	entry->setLastSeenToNow();
+	Q_EMIT fireDeviceUpdated(entry);
+	return true;
+}
+
+
 void IfdListImpl::clear()
 {
+	mIndex.clear();
 	decltype(mResponsiveList) removedDevices;
 	mResponsiveList.swap(removedDevices);
 	for (const auto& entry : std::as_const(removedDevices))
@@ -76,6 +90,7 @@ void IfdListImpl::onProcessUnresponsiveRemoteReaders()
 	erase_if(mResponsiveList, [this, &threshold](const auto& pEntry) {
 				if (pEntry->getLastSeen() < threshold)
 				{
+					mIndex.remove(pEntry->getDiscovery().getIfdId());
 					Q_EMIT fireDeviceVanished(pEntry);
 					return true;
 				}
@@ -6,6 +6,7 @@
 
 #include "IfdList.h"
 
+#include <QHash>
 #include <QTimer>
 
 
@@ -21,6 +22,7 @@ class IfdListImpl
 		QTimer mTimer;
 		const int mReaderResponsiveTimeout;
 		QList<QSharedPointer<IfdListEntry>> mResponsiveList;
+		QHash<QByteArray, QSharedPointer<IfdListEntry>> mIndex;
 
 	private Q_SLOTS:
 		void onProcessUnresponsiveRemoteReaders();
@@ -30,6 +32,7 @@ class IfdListImpl
 		~IfdListImpl() override;
 
 		void update(const Discovery& pDiscovery) override;
+		bool refresh(const QByteArray& pIfdId) override;
 		void clear() override;
 		[[nodiscard]] QList<QSharedPointer<IfdListEntry>> getIfdList() const override;
 };
@@ -18,8 +18,6 @@ IfdReader::IfdReader(ReaderManagerPluginType pPluginType, const QString& pReader
 	, mCard(nullptr)
 	, mDispatcher(pDispatcher)
 {
-	setInfoBasicReader(!pIfdStatus.hasPinPad());
-
 	updateStatus(pIfdStatus);
 }
 
@@ -38,9 +36,11 @@ Card* IfdReader::getCard() const
 
 void IfdReader::updateStatus(const IfdStatus& pIfdStatus)
 {
-
-	if (getReaderInfo().getMaxApduLength() != pIfdStatus.getMaxApduLength())
+	const bool pinPadChanged = getReaderInfo().isBasicReader() == pIfdStatus.hasPinPad();
+	const bool maxApduLengthChanged = getReaderInfo().getMaxApduLength() != pIfdStatus.getMaxApduLength();
+	if (pinPadChanged || maxApduLengthChanged)
 	{
+		setInfoBasicReader(!pIfdStatus.hasPinPad());
 		setInfoMaxApduLength(pIfdStatus.getMaxApduLength());
 		Q_EMIT fireReaderPropertiesUpdated(getReaderInfo());
 
@@ -26,6 +26,8 @@
 
 #include <QLoggingCategory>
 
+#include <utility>
+
 
 Q_DECLARE_LOGGING_CATEGORY(ifd)
 
@@ -47,18 +49,22 @@ ServerMessageHandlerImpl::ServerMessageHandlerImpl(const QSharedPointer<DataChan
 	, mAllowedPluginTypes(pAllowedTypes)
 	, mAllowedCardTypes(pAllowedTypes)
 	, mCardConnections()
+	, mSentStatus()
+	, mPendingStatus()
+	, mStatusTimer()
 {
+	mStatusTimer.setSingleShot(true);
+	mStatusTimer.setInterval(cStatusCoalescingInterval);
+	connect(&mStatusTimer, &QTimer::timeout, this, &ServerMessageHandlerImpl::onStatusTimeout);
+
 	connect(mDispatcher.data(), &IfdDispatcherServer::fireReceived, this, &ServerMessageHandlerImpl::onMessage);
 	connect(mDispatcher.data(), &IfdDispatcherServer::fireClosed, this, &ServerMessageHandlerImpl::onClosed);
 	connect(mDispatcher.data(), &IfdDispatcherServer::fireNameChanged, this, &ServerMessageHandler::fireNameChanged);
 
 	connect(mDispatcher.data(), &IfdDispatcherServer::fireContextEstablished, this, [this] {
 				const auto* readerManager = Env::getSingleton<ReaderManager>();
-				connect(readerManager, &ReaderManager::fireReaderAdded, this, &ServerMessageHandlerImpl::onReaderChanged);
+				connect(readerManager, &ReaderManager::fireReaderInfoChanged, this, &ServerMessageHandlerImpl::onReaderChanged);
 				connect(readerManager, &ReaderManager::fireReaderRemoved, this, &ServerMessageHandlerImpl::onReaderRemoved);
-				connect(readerManager, &ReaderManager::fireReaderPropertiesUpdated, this, &ServerMessageHandlerImpl::onReaderChanged);
-				connect(readerManager, &ReaderManager::fireCardInserted, this, &ServerMessageHandlerImpl::onReaderChanged);
-				connect(readerManager, &ReaderManager::fireCardRemoved, this, &ServerMessageHandlerImpl::onReaderChanged);
 			});
 }
 
@@ -344,12 +350,58 @@ void ServerMessageHandlerImpl::handleIfdModifyPIN(const QJsonObject& pJsonObject
 }
 
 
+QSharedPointer<const IfdStatus> ServerMessageHandlerImpl::createIfdStatus(const ReaderInfo& pReaderInfo) const
+{
+	const bool isCardAllowed = mAllowedCardTypes.contains(pReaderInfo.getPluginType());
+	return QSharedPointer<IfdStatus>::create(pReaderInfo, isCardAllowed);
+}
+
+
+void ServerMessageHandlerImpl::sendIfdStatus(const QSharedPointer<const IfdStatus>& pIfdStatus)
+{
+	mPendingStatus.remove(pIfdStatus->getSlotName());
+	mSentStatus.insert(pIfdStatus->getSlotName(), pIfdStatus);
+	mDispatcher->send(pIfdStatus);
+}
+
+
 void ServerMessageHandlerImpl::sendIfdStatus(const ReaderInfo& pReaderInfo)
 {
 	if (!mDispatcher->getContextHandle().isEmpty())
 	{
-		const bool isCardAllowed = mAllowedCardTypes.contains(pReaderInfo.getPluginType());
-		mDispatcher->send(QSharedPointer<IfdStatus>::create(pReaderInfo, isCardAllowed));
+		sendIfdStatus(createIfdStatus(pReaderInfo));
+	}
+}
+
+
+void ServerMessageHandlerImpl::queueIfdStatus(const ReaderInfo& pReaderInfo)
+{
+	if (mDispatcher->getContextHandle().isEmpty())
+	{
+		return;
+	}
+
+	const auto& status = createIfdStatus(pReaderInfo);
+	const auto& sentStatus = mSentStatus.value(status->getSlotName());
+	if (sentStatus.isNull()
+			|| sentStatus->getConnectedReader() != status->getConnectedReader()
+			|| sentStatus->getCardAvailable() != status->getCardAvailable())
+	{
+		sendIfdStatus(status);
+		return;
+	}
+
+	if (sentStatus->hasEqualState(*status))
+	{
+		qCDebug(ifd) << "Skip unchanged IFDStatus for" << status->getSlotName();
+		mPendingStatus.remove(status->getSlotName());
+		return;
+	}
+
+	mPendingStatus.insert(status->getSlotName(), status);
+	if (!mStatusTimer.isActive())
+	{
+		mStatusTimer.start();
 	}
 }
 
@@ -398,7 +450,7 @@ void ServerMessageHandlerImpl::setAllowedCardTypes(const QList<ReaderManagerPlug
 		const auto& readerInfos = Env::getSingleton<ReaderManager>()->getReaderInfos(ReaderFilter(mAllowedPluginTypes));
 		for (const auto& readerInfo : readerInfos)
 		{
-			sendIfdStatus(readerInfo);
+			queueIfdStatus(readerInfo);
 		}
 	}
 }
@@ -418,10 +470,10 @@ void ServerMessageHandlerImpl::onTransmitCardCommandDone(QSharedPointer<BaseCard
 	}
 
 	QByteArray responseApdu;
-	Q_ASSERT(transmitCommand->getOutputApduAsHex().size() == 1); // may not happen, see TransmitCommand
-	if (transmitCommand->getOutputApduAsHex().size() == 1)
+	Q_ASSERT(transmitCommand->getOutputApdus().size() == 1); // may not happen, see TransmitCommand
+	if (transmitCommand->getOutputApdus().size() == 1)
 	{
-		responseApdu = QByteArray::fromHex(transmitCommand->getOutputApduAsHex().first());
+		responseApdu = transmitCommand->getOutputApdus().first();
 	}
 	qCInfo(ifd) << "Transmit for" << slotHandle << "succeeded";
 	const auto& response = QSharedPointer<IfdTransmitResponse>::create(slotHandle, responseApdu);
@@ -466,6 +518,10 @@ void ServerMessageHandlerImpl::onClosed()
 	}
 	mCardConnections.clear();
 
+	mStatusTimer.stop();
+	mPendingStatus.clear();
+	mSentStatus.clear();
+
 	Q_EMIT fireClosed();
 }
 
@@ -528,14 +584,20 @@ void ServerMessageHandlerImpl::onMessage(IfdMessageType pMessageType, const QJso
 }
 
 
-void ServerMessageHandlerImpl::onReaderChanged(const ReaderInfo& pInfo)
+void ServerMessageHandlerImpl::onReaderChanged(const ReaderInfo& pInfo, ReaderInfo::Changes pChanges)
 {
-	if (!mAllowedPluginTypes.contains(pInfo.getPluginType()))
+	// IFDStatus contains the pin pad, the APDU length and the presence of the card only.
+	// Updates of the retry counter or the PIN state are not visible to the client.
+	const ReaderInfo::Changes statusChanges = ReaderInfo::PluginTypeChanged
+			| ReaderInfo::BasicReaderChanged
+			| ReaderInfo::MaxApduLengthChanged
+			| ReaderInfo::CardTypeChanged;
+	if (!(pChanges & statusChanges) || !mAllowedPluginTypes.contains(pInfo.getPluginType()))
 	{
 		return;
 	}
 
-	if (!pInfo.hasEid())
+	if (pChanges.testFlag(ReaderInfo::CardTypeChanged) && !pInfo.hasEid())
 	{
 		const QString& slotHandle = slotHandleForReaderName(pInfo.getName());
 		if (mCardConnections.remove(slotHandle) > 0)
@@ -544,7 +606,7 @@ void ServerMessageHandlerImpl::onReaderChanged(const ReaderInfo& pInfo)
 		}
 	}
 
-	sendIfdStatus(pInfo);
+	queueIfdStatus(pInfo);
 }
 
 
@@ -555,7 +617,17 @@ void ServerMessageHandlerImpl::onReaderRemoved(const ReaderInfo& pInfo)
 		return;
 	}
 
-	sendIfdStatus(pInfo);
+	queueIfdStatus(pInfo);
+}
+
+
+void ServerMessageHandlerImpl::onStatusTimeout()
+{
+	const auto pendingStatus = std::exchange(mPendingStatus, {});
+	for (const auto& status : pendingStatus)
+	{
+		sendIfdStatus(status);
+	}
 }
 
 
@@ -12,12 +12,16 @@
 #include "command/BaseCardCommand.h"
 #include "command/CreateCardConnectionCommand.h"
 #include "messages/IfdMessage.h"
+#include "messages/IfdStatus.h"
 
 #include <QList>
 #include <QMap>
 #include <QPointer>
+#include <QTimer>
 
 
+class test_ServerMessageHandler;
+
 namespace governikus
 {
 
@@ -25,12 +29,16 @@ class ServerMessageHandlerImpl
 	: public ServerMessageHandler
 {
 	Q_OBJECT
+	friend class ::test_ServerMessageHandler;
 
 	private:
 		const QSharedPointer<IfdDispatcherServer> mDispatcher;
 		QList<ReaderManagerPluginType> mAllowedPluginTypes;
 		QList<ReaderManagerPluginType> mAllowedCardTypes;
 		QMap<QString, QSharedPointer<CardConnection>> mCardConnections;
+		QMap<QString, QSharedPointer<const IfdStatus>> mSentStatus;
+		QMap<QString, QSharedPointer<const IfdStatus>> mPendingStatus;
+		QTimer mStatusTimer;
 
 		[[nodiscard]] QString slotHandleForReaderName(const QString& pReaderName) const;
 		[[nodiscard]] bool isAllowed(const QSharedPointer<CardConnection>& pCardConnection, QStringView pCommand) const;
@@ -42,7 +50,10 @@ class ServerMessageHandlerImpl
 		void handleIfdEstablishPaceChannel(const QJsonObject& pJsonObject);
 		void handleIfdDestroyPaceChannel(const QJsonObject& pJsonObject);
 		void handleIfdModifyPIN(const QJsonObject& pJsonObject);
+		[[nodiscard]] QSharedPointer<const IfdStatus> createIfdStatus(const ReaderInfo& pReaderInfo) const;
+		void sendIfdStatus(const QSharedPointer<const IfdStatus>& pIfdStatus);
 		void sendIfdStatus(const ReaderInfo& pReaderInfo);
+		void queueIfdStatus(const ReaderInfo& pReaderInfo);
 
 	private Q_SLOTS:
 		void onCreateCardConnectionCommandDone(QSharedPointer<CreateCardConnectionCommand> pCommand);
@@ -50,11 +61,16 @@ class ServerMessageHandlerImpl
 		void onDestroyPaceChannelCommandDone(QSharedPointer<BaseCardCommand> pCommand);
 		void onClosed();
 		void onMessage(IfdMessageType pMessageType, const QJsonObject& pJsonObject);
-		void onReaderChanged(const ReaderInfo& pInfo);
+		void onReaderChanged(const ReaderInfo& pInfo, ReaderInfo::Changes pChanges);
 		void onReaderRemoved(const ReaderInfo& pInfo);
 		void onUpdateRetryCounterDone(QSharedPointer<BaseCardCommand> pCommand);
+		void onStatusTimeout();
 
 	public:
+		// Status updates of a slot within this interval are merged into one IFDStatus.
+		// Changes of the reader or card presence are sent immediately.
+		static constexpr int cStatusCoalescingInterval = 50;
+
 		explicit ServerMessageHandlerImpl(const QSharedPointer<DataChannel>& pDataChannel,
 				const QList<ReaderManagerPluginType>& pAllowedTypes = Enum<ReaderManagerPluginType>::getList());
 
@@ -5,6 +5,7 @@
 
 #include "IfdMessage.h"
 
+#include "HexCodec.h"
 #include "Initializer.h"
 
 #ifndef QT_NO_DEBUG
@@ -151,6 +152,37 @@ QString IfdMessage::getStringValue(const QJsonObject& pJsonObject, const QLatin1
 }
 
 
+QByteArray IfdMessage::decodeHexValue(QStringView pValue, const QLatin1String& pName)
+{
+	if (auto value = hex::decode(pValue))
+	{
+		return *value;
+	}
+
+	invalidType(pName, QLatin1String("hex string"));
+	return QByteArray();
+}
+
+
+QByteArray IfdMessage::getHexValue(const QJsonObject& pJsonObject, const QLatin1String& pName)
+{
+	if (pJsonObject.contains(pName))
+	{
+		const auto& value = pJsonObject.value(pName);
+		if (value.isString())
+		{
+			return decodeHexValue(value.toString(), pName);
+		}
+
+		invalidType(pName, QLatin1String("string"));
+		return QByteArray();
+	}
+
+	missingValue(pName);
+	return QByteArray();
+}
+
+
 QJsonObject IfdMessage::parseByteArray(const QByteArray& pMessage)
 {
 	QJsonParseError error {};
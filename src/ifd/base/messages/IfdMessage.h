@@ -59,6 +59,8 @@ class IfdMessage
 		bool getBoolValue(const QJsonObject& pJsonObject, const QLatin1String& pName);
 		int getIntValue(const QJsonObject& pJsonObject, const QLatin1String& pName, int pDefault);
 		QString getStringValue(const QJsonObject& pJsonObject, const QLatin1String& pName);
+		QByteArray decodeHexValue(QStringView pValue, const QLatin1String& pName);
+		QByteArray getHexValue(const QJsonObject& pJsonObject, const QLatin1String& pName);
 
 	public:
 		static QJsonObject parseByteArray(const QByteArray& pMessage);
@@ -163,6 +163,16 @@ bool IfdStatus::getCardAvailable() const
 }
 
 
+bool IfdStatus::hasEqualState(const IfdStatus& pOther) const
+{
+	return mSlotName == pOther.mSlotName
+		   && mHasPinPad == pOther.mHasPinPad
+		   && mMaxApduLength == pOther.mMaxApduLength
+		   && mConnectedReader == pOther.mConnectedReader
+		   && mCardAvailable == pOther.mCardAvailable;
+}
+
+
 QByteArray IfdStatus::toByteArray(IfdVersion::Version pIfdVersion, const QString& pContextHandle) const
 {
 	QJsonObject result = createMessageBody(pContextHandle);
@@ -42,6 +42,7 @@ class IfdStatus
 		[[nodiscard]] int getMaxApduLength() const;
 		[[nodiscard]] bool getConnectedReader() const;
 		[[nodiscard]] bool getCardAvailable() const;
+		[[nodiscard]] bool hasEqualState(const IfdStatus& pOther) const;
 		[[nodiscard]] QByteArray toByteArray(IfdVersion::Version pIfdVersion, const QString& pContextHandle) const override;
 };
 
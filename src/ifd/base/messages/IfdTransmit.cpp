@@ -5,6 +5,8 @@
 
 #include "IfdTransmit.h"
 
+#include "HexCodec.h"
+
 #include <QJsonArray>
 #include <QLoggingCategory>
 
@@ -39,8 +41,7 @@ void IfdTransmit::parseInputApdu(const QJsonObject& pMessageObject)
 			if (entry.isObject())
 			{
 				const QJsonObject& commandApdu = entry.toObject();
-				const QString& inputApdu = getStringValue(commandApdu, INPUT_APDU());
-				mInputApdu = QByteArray::fromHex(inputApdu.toUtf8());
+				mInputApdu = getHexValue(commandApdu, INPUT_APDU());
 			}
 			else
 			{
@@ -61,8 +62,7 @@ void IfdTransmit::parseInputApdu(const QJsonObject& pMessageObject)
 	if (!v0Supported || pMessageObject.contains(INPUT_APDU()))
 	{
 		inputApduFound = true;
-		const QString& inputApdu = getStringValue(pMessageObject, INPUT_APDU());
-		mInputApdu = QByteArray::fromHex(inputApdu.toUtf8());
+		mInputApdu = getHexValue(pMessageObject, INPUT_APDU());
 	}
 
 	if (!inputApduFound)
@@ -115,7 +115,7 @@ QByteArray IfdTransmit::toByteArray(IfdVersion::Version pIfdVersion, const QStri
 
 	if (pIfdVersion >= IfdVersion::Version::v2)
 	{
-		result[INPUT_APDU()] = QString::fromLatin1(mInputApdu.toHex());
+		result[INPUT_APDU()] = QString::fromLatin1(hex::encode(mInputApdu));
 		if (!mDisplayText.isNull())
 		{
 			result[DISPLAY_TEXT()] = mDisplayText;
@@ -125,7 +125,7 @@ QByteArray IfdTransmit::toByteArray(IfdVersion::Version pIfdVersion, const QStri
 	{
 		QJsonArray commandApdus;
 		QJsonObject commandApdu;
-		commandApdu[INPUT_APDU()] = QString::fromLatin1(mInputApdu.toHex());
+		commandApdu[INPUT_APDU()] = QString::fromLatin1(hex::encode(mInputApdu));
 		commandApdu[ACCEPTABLE_STATUS_CODES()] = QJsonValue();
 		commandApdus += commandApdu;
 		result[COMMAND_APDUS()] = commandApdus;
@@ -5,6 +5,8 @@
 
 #include "IfdTransmitResponse.h"
 
+#include "HexCodec.h"
+
 #include <QJsonArray>
 #include <QLoggingCategory>
 
@@ -36,7 +38,7 @@ void IfdTransmitResponse::parseResponseApdu(const QJsonObject& pMessageObject)
 			const auto& inputApduValue = value.toArray().at(0);
 			if (inputApduValue.isString())
 			{
-				mResponseApdu = QByteArray::fromHex(inputApduValue.toString().toUtf8());
+				mResponseApdu = decodeHexValue(inputApduValue.toString(), RESPONSE_APDUS());
 			}
 			else
 			{
@@ -57,8 +59,7 @@ void IfdTransmitResponse::parseResponseApdu(const QJsonObject& pMessageObject)
 	if (!v0Supported || pMessageObject.contains(RESPONSE_APDU()))
 	{
 		responseApduFound = true;
-		const QString& responseApdu = getStringValue(pMessageObject, RESPONSE_APDU());
-		mResponseApdu = QByteArray::fromHex(responseApdu.toUtf8());
+		mResponseApdu = getHexValue(pMessageObject, RESPONSE_APDU());
 	}
 
 	if (!responseApduFound)
@@ -98,12 +99,12 @@ QByteArray IfdTransmitResponse::toByteArray(IfdVersion::Version pIfdVersion, con
 
 	if (pIfdVersion >= IfdVersion::Version::v2)
 	{
-		result[RESPONSE_APDU()] = QString::fromLatin1(mResponseApdu.toHex());
+		result[RESPONSE_APDU()] = QString::fromLatin1(hex::encode(mResponseApdu));
 	}
 	else
 	{
 		QJsonArray responseApdus;
-		responseApdus += QString::fromLatin1(mResponseApdu.toHex());
+		responseApdus += QString::fromLatin1(hex::encode(mResponseApdu));
 		result[RESPONSE_APDUS()] = responseApdus;
 	}
 
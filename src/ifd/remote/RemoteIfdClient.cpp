@@ -32,6 +32,7 @@ RemoteIfdClient::RemoteIfdClient()
 	: IfdClientImpl()
 	, mDatagramHandler()
 	, mIfdList(Env::create<IfdList*>())
+	, mLastDatagrams()
 {
 	connect(mIfdList.data(), &IfdList::fireDeviceAppeared, this, &IfdClient::fireDeviceAppeared);
 	connect(mIfdList.data(), &IfdList::fireDeviceUpdated, this, &IfdClient::fireDeviceUpdated);
@@ -42,6 +43,15 @@ RemoteIfdClient::RemoteIfdClient()
 
 void RemoteIfdClient::onNewMessage(const QByteArray& pData, const QHostAddress& pAddress)
 {
+	// Devices repeat the same Discovery all the time. Avoid parsing it again.
+	if (const auto& last = mLastDatagrams.constFind(pAddress); last != mLastDatagrams.constEnd() && last->mData == pData)
+	{
+		if (mIfdList->refresh(last->mIfdId))
+		{
+			return;
+		}
+	}
+
 	QJsonObject obj;
 	{
 		obj = IfdMessage::parseByteArray(pData);
@@ -65,6 +75,12 @@ void RemoteIfdClient::onNewMessage(const QByteArray& pData, const QHostAddress&
 		}
 	}
 
+	if (mLastDatagrams.size() >= cMaxLastDatagrams && !mLastDatagrams.contains(pAddress))
+	{
+		mLastDatagrams.clear();
+	}
+	mLastDatagrams.insert(pAddress, {pData, discovery.getIfdId()});
+
 	mIfdList->update(discovery);
 }
 
@@ -86,6 +102,7 @@ void RemoteIfdClient::startDetection()
 void RemoteIfdClient::stopDetection()
 {
 	mDatagramHandler.reset();
+	mLastDatagrams.clear();
 	mIfdList->clear();
 	Q_EMIT fireDetectionChanged();
 }
@@ -8,6 +8,9 @@
 #include "Env.h"
 #include "IfdClientImpl.h"
 
+#include <QHash>
+#include <QHostAddress>
+
 class MockRemoteIfdClient;
 class test_RemoteIfdClient;
 
@@ -23,8 +26,17 @@ class RemoteIfdClient
 	friend class ::test_RemoteIfdClient;
 
 	private:
+		struct LastDatagram
+		{
+			QByteArray mData;
+			QByteArray mIfdId;
+		};
+
 		QSharedPointer<DatagramHandler> mDatagramHandler;
 		QScopedPointer<IfdList> mIfdList;
+		QHash<QHostAddress, LastDatagram> mLastDatagrams;
+
+		static constexpr qsizetype cMaxLastDatagrams = 64;
 
 		RemoteIfdClient();
 
@@ -5,6 +5,7 @@
 #include "RemoteIfdReaderManagerPlugin.h"
 
 #include "AppSettings.h"
+#include "Metrics.h"
 #include "RemoteIfdClient.h"
 
 #include <QLoggingCategory>
@@ -52,6 +53,7 @@ void RemoteIfdReaderManagerPlugin::continueConnectToPairedReaders(const QList<QS
 		if (getDispatchers().contains(ifdId))
 		{
 			mConnectionAttempts.removeAll(ifdId);
+			mEstablishedConnections.insert(ifdId);
 			continue;
 		}
 
@@ -60,6 +62,10 @@ void RemoteIfdReaderManagerPlugin::continueConnectToPairedReaders(const QList<QS
 		if (remoteInfo.getFingerprint() == ifdId && !mConnectionAttempts.contains(ifdId))
 		{
 			mConnectionAttempts << ifdId;
+			if (mEstablishedConnections.contains(ifdId))
+			{
+				Env::getSingleton<Metrics>()->increment(Metric::IFD_RECONNECTS);
+			}
 			QMetaObject::invokeMethod(ifdClient, [ifdClient, remoteDevice] {
 						ifdClient->establishConnection(remoteDevice, QByteArray());
 					}, Qt::QueuedConnection);
@@ -83,6 +89,11 @@ void RemoteIfdReaderManagerPlugin::onDeviceVanished(const QSharedPointer<IfdList
 void RemoteIfdReaderManagerPlugin::onEstablishConnectionDone(const QSharedPointer<IfdListEntry>& pEntry, const GlobalStatus& pStatus)
 {
 	const auto& ifdId = pEntry->getDiscovery().getIfdId();
+	if (pStatus.isNoError())
+	{
+		mEstablishedConnections.insert(ifdId);
+	}
+
 	if (mConnectionAttempts.contains(ifdId))
 	{
 		qCInfo(card_remote) << "Removing" << ifdId.toHex() << "from connection attempt list as the request finished with" << pStatus;
@@ -96,6 +107,7 @@ RemoteIfdReaderManagerPlugin::RemoteIfdReaderManagerPlugin()
 	, mScanTimer()
 	, mConnectToPairedReaders(true)
 	, mConnectionAttempts()
+	, mEstablishedConnections()
 {
 	mScanTimer.setInterval(1000);
 	connect(&mScanTimer, &QTimer::timeout, this, &RemoteIfdReaderManagerPlugin::connectToPairedReaders);
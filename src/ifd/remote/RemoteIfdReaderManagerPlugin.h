@@ -7,6 +7,7 @@
 #include "IfdList.h"
 #include "IfdReaderManagerPlugin.h"
 
+#include <QSet>
 #include <QStringList>
 #include <QTimer>
 
@@ -30,6 +31,7 @@ class RemoteIfdReaderManagerPlugin
 		QTimer mScanTimer;
 		bool mConnectToPairedReaders;
 		QByteArrayList mConnectionAttempts;
+		QSet<QByteArray> mEstablishedConnections;
 
 	private Q_SLOTS:
 		void connectToPairedReaders() const;
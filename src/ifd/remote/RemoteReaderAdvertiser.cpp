@@ -9,7 +9,8 @@
 #include "messages/Discovery.h"
 
 #include <QLoggingCategory>
-#include <QTimerEvent>
+
+#include <algorithm>
 
 
 Q_DECLARE_LOGGING_CATEGORY(ifd)
@@ -30,16 +31,7 @@ template<> RemoteReaderAdvertiser* createNewObject<RemoteReaderAdvertiser*, cons
 using namespace governikus;
 
 
-void RemoteReaderAdvertiserImpl::timerEvent(QTimerEvent* pEvent)
-{
-	if (pEvent->timerId() == mTimerId)
-	{
-		sendDiscovery();
-	}
-}
-
-
-void RemoteReaderAdvertiserImpl::sendDiscovery()
+bool RemoteReaderAdvertiserImpl::sendDiscovery()
 {
 	const auto& broadcastEntries = mHandler->getAllBroadcastEntries();
 
@@ -51,6 +43,31 @@ void RemoteReaderAdvertiserImpl::sendDiscovery()
 	mDiscovery.setAddresses(sender);
 
 	mHandler->send(mDiscovery.toByteArray(IfdVersion::Version::latest), broadcastEntries);
+	return !broadcastEntries.isEmpty();
+}
+
+
+void RemoteReaderAdvertiserImpl::startBurst()
+{
+	mCurrentInterval = std::max(1, mTimerInterval / cBurstDivisor);
+	sendDiscovery();
+	mTimer.start(mCurrentInterval);
+}
+
+
+void RemoteReaderAdvertiserImpl::onTimeout()
+{
+	// The interval must not exceed the regular one as long as someone could
+	// listen. Clients drop readers after a few missed announcements.
+	const int maxInterval = sendDiscovery() ? mTimerInterval : mTimerInterval * cMaxIdleFactor;
+	const int nextInterval = std::min(mCurrentInterval * 2, maxInterval);
+	if (nextInterval != mCurrentInterval && nextInterval > mTimerInterval)
+	{
+		qCDebug(ifd) << "No network available, advertising every" << nextInterval << "msecs";
+	}
+
+	mCurrentInterval = nextInterval;
+	mTimer.start(mCurrentInterval);
 }
 
 
@@ -63,15 +80,27 @@ RemoteReaderAdvertiserImpl::~RemoteReaderAdvertiserImpl()
 RemoteReaderAdvertiserImpl::RemoteReaderAdvertiserImpl(const QString& pIfdName, const QByteArray& pIfdId, quint16 pPort, bool pPairing, int pTimerInterval)
 	: RemoteReaderAdvertiser()
 	, mHandler(Env::create<DatagramHandler*>(false))
-	, mTimerId(startTimer(pTimerInterval))
+	, mTimerInterval(pTimerInterval)
+	, mCurrentInterval(pTimerInterval)
+	, mTimer()
 	, mDiscovery(Discovery(pIfdName, pIfdId, pPort, {IfdVersion::supported()}, pPairing))
 {
 	qCDebug(ifd) << "Start advertising every" << pTimerInterval << "msecs";
-	sendDiscovery();
+
+	mTimer.setSingleShot(true);
+	connect(&mTimer, &QTimer::timeout, this, &RemoteReaderAdvertiserImpl::onTimeout);
+	connect(mHandler.data(), &DatagramHandler::fireNetworkChanged, this, &RemoteReaderAdvertiserImpl::startBurst);
+	startBurst();
 }
 
 
 void RemoteReaderAdvertiserImpl::setPairing(bool pEnabled)
 {
+	if (mDiscovery.isPairing() == pEnabled)
+	{
+		return;
+	}
+
 	mDiscovery.setPairing(pEnabled);
+	startBurst();
 }
@@ -9,6 +9,10 @@
 
 #include <QObject>
 #include <QScopedPointer>
+#include <QTimer>
+
+
+class test_RemoteReaderAdvertiser;
 
 
 namespace governikus
@@ -36,16 +40,27 @@ class RemoteReaderAdvertiserImpl
 	: public RemoteReaderAdvertiser
 {
 	Q_OBJECT
+	friend class ::test_RemoteReaderAdvertiser;
 
 	private:
 		const QScopedPointer<DatagramHandler> mHandler;
-		const int mTimerId;
+		const int mTimerInterval;
+		int mCurrentInterval;
+		QTimer mTimer;
 		Discovery mDiscovery;
 
-		void timerEvent(QTimerEvent* pEvent) override;
-		void sendDiscovery();
+		bool sendDiscovery();
+		void startBurst();
+
+	private Q_SLOTS:
+		void onTimeout();
 
 	public:
+		// Announcements start with a quarter of the interval and double up to the interval.
+		// Without any usable network the interval doubles further until the idle maximum.
+		static constexpr int cBurstDivisor = 4;
+		static constexpr int cMaxIdleFactor = 8;
+
 		~RemoteReaderAdvertiserImpl() override;
 		RemoteReaderAdvertiserImpl(const QString& pIfdName, const QByteArray& pIfdId, quint16 pPort, bool pPairing = false, int pTimerInterval = 1000);
 
@@ -9,6 +9,7 @@
 #include "Env.h"
 #include "LogHandler.h"
 #include "SignalHandler.h"
+#include "StartupProfile.h"
 #include "controller/AppController.h"
 
 #include <openssl/crypto.h>
@@ -171,21 +172,36 @@ void governikus::shutdownApp()
 
 int governikus::initApp(int& argc, char** argv)
 {
+	auto* profile = Env::getSingleton<StartupProfile>();
+	const auto initQtStart = profile->now();
 	const QScopedPointer<QCoreApplication> app(initQt(argc, argv));
 	QThread::currentThread()->setObjectName(QStringLiteral("MainThread"));
+	profile->addStep(QStringLiteral("Initialize Qt"), initQtStart);
 
-	CommandLineParser::getInstance().parse();
-	Env::getSingleton<LogHandler>()->init();
-	Env::getSingleton<SignalHandler>()->init();
-	printInfo();
+	{
+		const StartupProfile::ScopedStep step(QStringLiteral("Parse command line"));
+		CommandLineParser::getInstance().parse();
+	}
+
+	{
+		const StartupProfile::ScopedStep step(QStringLiteral("Initialize logging"));
+		Env::getSingleton<LogHandler>()->init();
+		Env::getSingleton<SignalHandler>()->init();
+		printInfo();
+	}
 
 	const QMutexLocker mutexLocker(&cMutex);
+	const auto controllerStart = profile->now();
 	AppController controller;
+	profile->addStep(QStringLiteral("Create AppController"), controllerStart);
 	Env::getSingleton<SignalHandler>()->setController([&controller]{
 				QMetaObject::invokeMethod(&controller, [&controller]{
 					controller.doShutdown();
 				}, Qt::QueuedConnection);
 			});
+	QObject::connect(&controller, &AppController::fireStarted, &controller, [profile]{
+				profile->finish();
+			});
 	controller.start();
 
 	qCDebug(init) << "Enter main event loop...";
@@ -4,12 +4,16 @@
 
 #include "CommandLineParser.h"
 
+#include "ApduTracer.h"
 #include "Env.h"
 #include "HttpServer.h"
 #include "LogHandler.h"
+#include "Metrics.h"
 #include "NetworkManager.h"
 #include "PortFile.h"
 #include "SingletonHelper.h"
+#include "StartupProfile.h"
+#include "Tracer.h"
 #include "UiLoader.h"
 #include "controller/AppController.h"
 
@@ -32,6 +36,13 @@ CommandLineParser::CommandLineParser()
 	, mOptionUi(QStringLiteral("ui"), QStringLiteral("Use given UI plugin."), UiLoader::getDefault())
 	, mOptionPort(QStringLiteral("port"), QStringLiteral("Use listening port."), QString::number(PortFile::cDefaultPort))
 	, mOptionAddresses(QStringLiteral("address"), QStringLiteral("Use address binding."), HttpServer::getDefault())
+	, mOptionTrace(QStringLiteral("trace"), QStringLiteral("Export workflow traces to given directory."), QStringLiteral("directory"))
+	, mOptionTraceFormat(QStringLiteral("trace-format"), QStringLiteral("Use trace format: chrome, otlp."), QStringLiteral("format"), QStringLiteral("chrome"))
+	, mOptionStartupProfile(QStringLiteral("startup-profile"), QStringLiteral("Log a timeline of the application start."))
+	, mOptionMetrics(QStringLiteral("metrics"), QStringLiteral("Provide metrics on /metrics of the local HTTP server."))
+	, mOptionApduTrace(QStringLiteral("apdu-trace"), QStringLiteral("Record card communication to given directory."), QStringLiteral("directory"))
+	, mOptionApduReplay(QStringLiteral("apdu-replay"), QStringLiteral("Replay recorded card communication of given file."), QStringLiteral("file"))
+	, mOptionApduReplayScale(QStringLiteral("apdu-replay-scale"), QStringLiteral("Scale recorded latency of replay, 0 disables it."), QStringLiteral("factor"), QStringLiteral("1"))
 {
 	addOptions();
 }
@@ -54,6 +65,16 @@ void CommandLineParser::addOptions()
 	mParser.addOption(mOptionUi);
 	mParser.addOption(mOptionPort);
 	mParser.addOption(mOptionAddresses);
+	mParser.addOption(mOptionTrace);
+	mParser.addOption(mOptionTraceFormat);
+	mParser.addOption(mOptionStartupProfile);
+	mParser.addOption(mOptionMetrics);
+
+#if !defined(Q_OS_ANDROID) && !defined(Q_OS_IOS)
+	mParser.addOption(mOptionApduTrace);
+	mParser.addOption(mOptionApduReplay);
+	mParser.addOption(mOptionApduReplayScale);
+#endif
 }
 
 
@@ -66,6 +87,10 @@ void CommandLineParser::parse(const QCoreApplication* pApp)
 
 	mParser.process(*pApp);
 	parseUiPlugin();
+	parseTrace();
+	parseApduTrace();
+	Env::getSingleton<StartupProfile>()->setEnabled(mParser.isSet(mOptionStartupProfile));
+	Env::getSingleton<Metrics>()->setExportEnabled(mParser.isSet(mOptionMetrics));
 
 	auto* logHandler = Env::getSingleton<LogHandler>();
 	logHandler->setAutoRemove(!mParser.isSet(mOptionKeepLog));
@@ -114,3 +139,29 @@ void CommandLineParser::parseUiPlugin() const
 		UiLoader::setUserRequest(mParser.values(mOptionUi));
 	}
 }
+
+
+void CommandLineParser::parseTrace() const
+{
+	if (mParser.isSet(mOptionTrace))
+	{
+		const auto format = Enum<TraceFormat>::fromString(mParser.value(mOptionTraceFormat).toUpper(), TraceFormat::CHROME);
+		Env::getSingleton<Tracer>()->setExport(mParser.value(mOptionTrace), format);
+	}
+}
+
+
+void CommandLineParser::parseApduTrace() const
+{
+	if (mParser.isSet(mOptionApduTrace))
+	{
+		Env::getSingleton<ApduTracer>()->setDirectory(mParser.value(mOptionApduTrace));
+	}
+
+	if (mParser.isSet(mOptionApduReplay))
+	{
+		bool converted = false;
+		const double scale = mParser.value(mOptionApduReplayScale).toDouble(&converted);
+		Env::getSingleton<ApduTracer>()->setReplay(mParser.values(mOptionApduReplay), converted ? scale : 1.0);
+	}
+}
@@ -24,9 +24,18 @@ class CommandLineParser
 		const QCommandLineOption mOptionUi;
 		const QCommandLineOption mOptionPort;
 		const QCommandLineOption mOptionAddresses;
+		const QCommandLineOption mOptionTrace;
+		const QCommandLineOption mOptionTraceFormat;
+		const QCommandLineOption mOptionStartupProfile;
+		const QCommandLineOption mOptionMetrics;
+		const QCommandLineOption mOptionApduTrace;
+		const QCommandLineOption mOptionApduReplay;
+		const QCommandLineOption mOptionApduReplayScale;
 
 		void addOptions();
 		void parseUiPlugin() const;
+		void parseTrace() const;
+		void parseApduTrace() const;
 
 	protected:
 		CommandLineParser();
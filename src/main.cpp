@@ -17,6 +17,7 @@ Q_IMPORT_PLUGIN(RemoteIfdReaderManagerPlugin)
 
 #if !defined(Q_OS_ANDROID) && !defined(Q_OS_IOS) && !defined(Q_OS_WINRT)
 Q_IMPORT_PLUGIN(PcscReaderManagerPlugin)
+Q_IMPORT_PLUGIN(ReplayReaderManagerPlugin)
 
 	#if !defined(INTEGRATED_SDK) || defined(CONTAINER_SDK)
 Q_IMPORT_PLUGIN(UiPluginWebService)
@@ -28,6 +28,7 @@ class DatagramHandler
 
 	Q_SIGNALS:
 		void fireNewMessage(const QByteArray& pData, const QHostAddress& pAddress);
+		void fireNetworkChanged();
 };
 
 
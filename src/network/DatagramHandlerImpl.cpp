@@ -8,7 +8,7 @@
 
 #include <QLoggingCategory>
 #include <QMutexLocker>
-#include <QNetworkDatagram>
+#include <QNetworkInformation>
 #include <QNetworkProxy>
 #include <QWeakPointer>
 
@@ -44,11 +44,15 @@ DatagramHandlerImpl::DatagramHandlerImpl(bool pEnableListening, quint16 pPort)
 	, mSocket()
 	, mMulticastLock()
 	, mAllEntries()
+	, mBroadcastEntries()
+	, mBroadcastEntriesExpiry(0)
+	, mReceiveBuffer()
 	, mFailedAddresses()
 	, mUsedPort(pPort)
 	, mPortFile(QStringLiteral("udp"))
 	, mEnableListening(pEnableListening)
 {
+	watchNetworkChanges();
 	resetSocket();
 
 #if defined(Q_OS_IOS)
@@ -112,6 +116,28 @@ void DatagramHandlerImpl::resetSocket()
 }
 
 
+void DatagramHandlerImpl::watchNetworkChanges()
+{
+	// Without a backend the broadcast entries expire after cBroadcastEntriesLifetime.
+	if (!QNetworkInformation::loadBackendByFeatures(QNetworkInformation::Feature::Reachability))
+	{
+		return;
+	}
+
+	const auto* information = QNetworkInformation::instance();
+	connect(information, &QNetworkInformation::reachabilityChanged, this, &DatagramHandlerImpl::onNetworkChanged);
+	connect(information, &QNetworkInformation::transportMediumChanged, this, &DatagramHandlerImpl::onNetworkChanged);
+}
+
+
+void DatagramHandlerImpl::onNetworkChanged()
+{
+	qCDebug(network) << "Network changed, invalidating broadcast entries";
+	mBroadcastEntriesExpiry = QDeadlineTimer(0);
+	Q_EMIT fireNetworkChanged();
+}
+
+
 DatagramHandlerImpl::~DatagramHandlerImpl()
 {
 	if (DatagramHandlerImpl::isBound())
@@ -129,6 +155,18 @@ bool DatagramHandlerImpl::isBound() const
 
 
 QList<QNetworkAddressEntry> DatagramHandlerImpl::getAllBroadcastEntries() const
+{
+	if (mBroadcastEntriesExpiry.hasExpired())
+	{
+		mBroadcastEntries = collectBroadcastEntries();
+		mBroadcastEntriesExpiry.setRemainingTime(cBroadcastEntriesLifetime);
+	}
+
+	return mBroadcastEntries;
+}
+
+
+QList<QNetworkAddressEntry> DatagramHandlerImpl::collectBroadcastEntries() const
 {
 	QList<QNetworkAddressEntry> broadcastEntries;
 
@@ -322,15 +360,30 @@ void DatagramHandlerImpl::checkNetworkPermission()
 
 void DatagramHandlerImpl::onReadyRead()
 {
-	while (mSocket->hasPendingDatagrams())
+	// Drain a bounded batch into a reused buffer so a flood of
+	// datagrams cannot starve the event loop.
+	int count = 0;
+	for (; count < cMaxDatagramsPerRead && mSocket->hasPendingDatagrams(); ++count)
 	{
-		const QNetworkDatagram& datagram = mSocket->receiveDatagram();
-		if (!datagram.isValid())
+		const auto size = mSocket->pendingDatagramSize();
+		if (size > mReceiveBuffer.size())
+		{
+			mReceiveBuffer.resize(size);
+		}
+
+		QHostAddress sender;
+		const auto read = mSocket->readDatagram(mReceiveBuffer.data(), mReceiveBuffer.size(), &sender);
+		if (read < 0)
 		{
 			qCCritical(network) << "Cannot read datagram";
 			Q_ASSERT(false);
 			continue;
 		}
-		Q_EMIT fireNewMessage(datagram.data(), datagram.senderAddress());
+		Q_EMIT fireNewMessage(QByteArray(mReceiveBuffer.constData(), read), sender);
+	}
+
+	if (count == cMaxDatagramsPerRead && mSocket->hasPendingDatagrams())
+	{
+		QMetaObject::invokeMethod(this, &DatagramHandlerImpl::onReadyRead, Qt::QueuedConnection);
 	}
 }
@@ -9,6 +9,7 @@
 #include "MulticastLock.h"
 #include "PortFile.h"
 
+#include <QDeadlineTimer>
 #include <QHostAddress>
 #include <QList>
 #include <QNetworkAddressEntry>
@@ -31,12 +32,17 @@ class DatagramHandlerImpl
 		QScopedPointer<QUdpSocket, QScopedPointerDeleteLater> mSocket;
 		QScopedPointer<MulticastLock> mMulticastLock;
 		QList<QNetworkAddressEntry> mAllEntries;
+		mutable QList<QNetworkAddressEntry> mBroadcastEntries;
+		mutable QDeadlineTimer mBroadcastEntriesExpiry;
+		QByteArray mReceiveBuffer;
 		QList<QHostAddress> mFailedAddresses;
 		quint16 mUsedPort;
 		PortFile mPortFile;
 		bool mEnableListening;
 
 		void resetSocket();
+		void watchNetworkChanges();
+		[[nodiscard]] QList<QNetworkAddressEntry> collectBroadcastEntries() const;
 		[[nodiscard]] bool isValidBroadcastInterface(const QNetworkInterface& pInterface) const;
 		[[nodiscard]] bool isValidAddressEntry(const QNetworkAddressEntry& pEntry) const;
 		[[nodiscard]] QHostAddress getBroadcastAddress(const QNetworkAddressEntry& pEntry) const;
@@ -49,6 +55,10 @@ class DatagramHandlerImpl
 #endif
 
 	public:
+		// Fallback if the platform does not report network changes.
+		static constexpr int cBroadcastEntriesLifetime = 10000;
+		static constexpr int cMaxDatagramsPerRead = 64;
+
 		explicit DatagramHandlerImpl(bool pEnableListening = true, quint16 pPort = HttpServer::cPort);
 		~DatagramHandlerImpl() override;
 
@@ -58,6 +68,7 @@ class DatagramHandlerImpl
 
 	private Q_SLOTS:
 		void onReadyRead();
+		void onNetworkChanged();
 };
 
 
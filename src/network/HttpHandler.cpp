@@ -4,7 +4,9 @@
 
 #include "HttpHandler.h"
 
+#include "Env.h"
 #include "LanguageLoader.h"
+#include "Metrics.h"
 #include "NetworkManager.h"
 #include "Template.h"
 #include "UrlUtil.h"
@@ -12,7 +14,6 @@
 
 #include <QFile>
 #include <QLoggingCategory>
-#include <QUrlQuery>
 
 
 using namespace governikus;
@@ -45,6 +46,12 @@ void HttpHandler::handle(const QSharedPointer<HttpRequest>& pRequest)
 				qCDebug(network) << "Unhandled HTTP method:" << pRequest->getMethod();
 		}
 	}
+	else if (url.path() == QLatin1String("/metrics") && pRequest->getHttpMethod() == HTTP_GET && Env::getSingleton<Metrics>()->isExportEnabled())
+	{
+		qCDebug(network) << "Request type: metrics";
+		handleMetricsRequest(pRequest);
+		return;
+	}
 	else if (url.path() == QLatin1String("/favicon.ico"))
 	{
 		handleImageRequest(pRequest, QStringLiteral(":/images/desktop/npa.ico")); // it MUST be an ICO!
@@ -93,7 +100,7 @@ void HttpHandler::handleCorsRequest(const QSharedPointer<HttpRequest>& pRequest)
 
 bool HttpHandler::handleGetRequest(const QSharedPointer<HttpRequest>& pRequest, const QUrl& pUrl)
 {
-	const auto queryUrl = QUrlQuery(pUrl);
+	const auto& queryUrl = pRequest->getQuery();
 	UrlUtil::setHiddenSettings(queryUrl);
 	const auto [type, value] = UrlUtil::getRequest(queryUrl);
 	switch (type)
@@ -199,4 +206,13 @@ void HttpHandler::handleStatusRequest(StatusFormat pStatusFormat, const QSharedP
 }
 
 
+void HttpHandler::handleMetricsRequest(const QSharedPointer<HttpRequest>& pRequest) const
+{
+	// No CORS headers, websites must not read the metrics.
+	HttpResponse response(HTTP_STATUS_OK);
+	response.setBody(Env::getSingleton<Metrics>()->toPrometheus(), QByteArrayLiteral("text/plain; version=0.0.4; charset=utf-8"));
+	pRequest->send(response);
+}
+
+
 #include "moc_HttpHandler.cpp"
@@ -37,6 +37,7 @@ class HttpHandler
 
 		virtual void handleImageRequest(const QSharedPointer<HttpRequest>& pRequest, const QString& pImagePath) const;
 		virtual void handleStatusRequest(StatusFormat pStatusFormat, const QSharedPointer<HttpRequest>& pRequest) const;
+		virtual void handleMetricsRequest(const QSharedPointer<HttpRequest>& pRequest) const;
 		virtual void handleShowUiRequest(const QString& pUiModule, const QSharedPointer<HttpRequest>& pRequest) = 0;
 		virtual void handleWorkflowRequest(const QSharedPointer<HttpRequest>& pRequest) = 0;
 };
@@ -4,7 +4,10 @@
 
 #include "HttpRequest.h"
 
+#include "NetworkManager.h"
+
 #include <QLoggingCategory>
+#include <QTimer>
 
 using namespace governikus;
 
@@ -14,15 +17,18 @@ Q_DECLARE_LOGGING_CATEGORY(network)
 
 HttpRequest::HttpRequest(QTcpSocket* pSocket, QObject* pParent)
 	: QObject(pParent)
+	, mBuffer()
+	, mUrlSpan()
+	, mHeaders()
+	, mBodySpans()
 	, mUrl()
-	, mHeader()
+	, mQuery()
 	, mBody()
 	, mSocket(pSocket)
 	, mParser()
 	, mParserSettings()
 	, mFinished(false)
-	, mCurrentHeaderField()
-	, mCurrentHeaderValue()
+	, mHeaderValue(false)
 {
 	Q_ASSERT(mSocket);
 	mSocket->setParent(this);
@@ -58,11 +64,17 @@ HttpRequest::~HttpRequest()
 {
 	if (mSocket && mSocket->bytesToWrite() && mSocket->state() == QAbstractSocket::ConnectedState && !mSocket->flush())
 	{
-		qCDebug(network) << "Flush socket failed. Waiting for bytes:" << mSocket->bytesToWrite();
-		if (!mSocket->waitForBytesWritten())
-		{
-			qCWarning(network) << "Cannot wait for socket anymore... abort!";
-		}
+		// Do not block the destroying thread. The socket closes itself as soon as the pending bytes are written.
+		qCDebug(network) << "Flush socket failed. Continue in background with bytes:" << mSocket->bytesToWrite();
+		auto* socket = take();
+		Env::getSingleton<NetworkManager>()->trackSocket(socket);
+		connect(socket, &QAbstractSocket::disconnected, socket, &QObject::deleteLater);
+		QTimer::singleShot(cFlushTimeout, socket, [socket] {
+					qCWarning(network) << "Cannot wait for socket anymore... abort!";
+					socket->abort();
+					socket->deleteLater();
+				});
+		socket->disconnectFromHost();
 	}
 }
 
@@ -91,21 +103,36 @@ bool HttpRequest::isUpgrade() const
 }
 
 
-QByteArray HttpRequest::getHeader(const QByteArray& pKey) const
+QByteArray HttpRequest::getHeader(QByteArrayView pKey) const
+{
+	// The last header wins if a field is sent more than once.
+	for (auto header = mHeaders.crbegin(); header != mHeaders.crend(); ++header)
+	{
+		if (getView(header->mField).compare(pKey, Qt::CaseInsensitive) == 0)
+		{
+			return getView(header->mValue).toByteArray();
+		}
+	}
+
+	return QByteArray();
+}
+
+
+qsizetype HttpRequest::getHeaderCount() const
 {
-	return mHeader.value(pKey);
+	return mHeaders.size();
 }
 
 
-const QMap<QByteArray, QByteArray>& HttpRequest::getHeader() const
+const QUrl& HttpRequest::getUrl() const
 {
-	return mHeader;
+	return mUrl;
 }
 
 
-QUrl HttpRequest::getUrl() const
+const QUrlQuery& HttpRequest::getQuery() const
 {
-	return QUrl::fromEncoded(mUrl);
+	return mQuery;
 }
 
 
@@ -180,16 +207,9 @@ void HttpRequest::onReadyRead()
 
 	while (mSocket->bytesAvailable())
 	{
-		const auto& buffer = mSocket->readAll();
-		http_parser_execute(&mParser, &mParserSettings, buffer.constData(), static_cast<size_t>(buffer.size()));
-
-		// See macro HTTP_PARSER_ERRNO if http_errno fails.
-		// We do not use this to avoid -Wold-style-cast warning
-		const auto errorCode = static_cast<http_errno>(mParser.http_errno);
-		if (errorCode != HPE_OK)
-		{
-			qCWarning(network) << "Http request not well-formed:" << http_errno_name(errorCode) << '|' << http_errno_description(errorCode);
-		}
+		const auto offset = mBuffer.size();
+		mBuffer += mSocket->readAll();
+		parse(offset);
 	}
 
 	if (mFinished)
@@ -204,6 +224,47 @@ void HttpRequest::onReadyRead()
 }
 
 
+void HttpRequest::parse(qsizetype pOffset)
+{
+	const auto length = static_cast<size_t>(mBuffer.size() - pOffset);
+	http_parser_execute(&mParser, &mParserSettings, mBuffer.constData() + pOffset, length);
+
+	// See macro HTTP_PARSER_ERRNO if http_errno fails.
+	// We do not use this to avoid -Wold-style-cast warning
+	const auto errorCode = static_cast<http_errno>(mParser.http_errno);
+	if (errorCode != HPE_OK)
+	{
+		qCWarning(network) << "Http request not well-formed:" << http_errno_name(errorCode) << '|' << http_errno_description(errorCode);
+	}
+}
+
+
+qsizetype HttpRequest::getOffset(const char* const pPos) const
+{
+	Q_ASSERT(pPos >= mBuffer.constData() && pPos <= mBuffer.constData() + mBuffer.size());
+	return static_cast<qsizetype>(pPos - mBuffer.constData());
+}
+
+
+void HttpRequest::add(Span& pSpan, const char* const pPos, size_t pLength) const
+{
+	const auto offset = getOffset(pPos);
+	if (pSpan.mLength == 0)
+	{
+		pSpan.mOffset = offset;
+	}
+
+	// Parts split by the socket are consecutive in mBuffer.
+	pSpan.mLength = offset + static_cast<qsizetype>(pLength) - pSpan.mOffset;
+}
+
+
+QByteArrayView HttpRequest::getView(const Span& pSpan) const
+{
+	return QByteArrayView(mBuffer).sliced(pSpan.mOffset, pSpan.mLength);
+}
+
+
 int HttpRequest::onMessageBegin(http_parser* pParser)
 {
 	Q_UNUSED(pParser)
@@ -215,6 +276,26 @@ int HttpRequest::onMessageComplete(http_parser* pParser)
 {
 	CAST_OBJ(pParser)
 	obj->mFinished = true;
+
+	if (obj->mBodySpans.size() == 1)
+	{
+		obj->mBody = obj->getView(obj->mBodySpans.constFirst()).toByteArray();
+	}
+	else if (!obj->mBodySpans.isEmpty())
+	{
+		qsizetype size = 0;
+		for (const auto& span : std::as_const(obj->mBodySpans))
+		{
+			size += span.mLength;
+		}
+
+		obj->mBody.reserve(size);
+		for (const auto& span : std::as_const(obj->mBodySpans))
+		{
+			obj->mBody += obj->getView(span);
+		}
+	}
+
 	qCDebug(network) << "Message completed";
 	return 0;
 }
@@ -223,7 +304,13 @@ int HttpRequest::onMessageComplete(http_parser* pParser)
 int HttpRequest::onHeadersComplete(http_parser* pParser)
 {
 	CAST_OBJ(pParser)
-	obj->insertHeader();
+	for (const auto& header : std::as_const(obj->mHeaders))
+	{
+		qCDebug(network).nospace() << "Header | " << obj->getView(header.mField) << ": " << obj->getView(header.mValue);
+	}
+
+	obj->mUrl = QUrl::fromEncoded(obj->getView(obj->mUrlSpan));
+	obj->mQuery = QUrlQuery(obj->mUrl);
 	qCDebug(network) << obj->getMethod() << '|' << obj->getUrl();
 	qCDebug(network) << "Header completed";
 	return 0;
@@ -233,8 +320,14 @@ int HttpRequest::onHeadersComplete(http_parser* pParser)
 int HttpRequest::onHeaderField(http_parser* pParser, const char* const pPos, size_t pLength)
 {
 	CAST_OBJ(pParser)
-	obj->insertHeader();
-	add(obj->mCurrentHeaderField, pPos, pLength);
+	const auto offset = obj->getOffset(pPos);
+	if (obj->mHeaders.isEmpty() || obj->mHeaderValue || offset != obj->mHeaders.last().mField.mOffset + obj->mHeaders.last().mField.mLength)
+	{
+		obj->mHeaders.append(Header());
+	}
+
+	obj->mHeaderValue = false;
+	obj->add(obj->mHeaders.last().mField, pPos, pLength);
 	return 0;
 }
 
@@ -242,7 +335,11 @@ int HttpRequest::onHeaderField(http_parser* pParser, const char* const pPos, siz
 int HttpRequest::onHeaderValue(http_parser* pParser, const char* const pPos, size_t pLength)
 {
 	CAST_OBJ(pParser)
-	add(obj->mCurrentHeaderValue, pPos, pLength);
+	if (!obj->mHeaders.isEmpty())
+	{
+		obj->mHeaderValue = true;
+		obj->add(obj->mHeaders.last().mValue, pPos, pLength);
+	}
 	return 0;
 }
 
@@ -250,7 +347,14 @@ int HttpRequest::onHeaderValue(http_parser* pParser, const char* const pPos, siz
 int HttpRequest::onBody(http_parser* pParser, const char* const pPos, size_t pLength)
 {
 	CAST_OBJ(pParser)
-	add(obj->mBody, pPos, pLength);
+	const auto offset = obj->getOffset(pPos);
+	if (obj->mBodySpans.isEmpty() || offset != obj->mBodySpans.last().mOffset + obj->mBodySpans.last().mLength)
+	{
+		// Chunked bodies are interrupted by the chunk headers.
+		obj->mBodySpans.append(Span());
+	}
+
+	obj->add(obj->mBodySpans.last(), pPos, pLength);
 	return 0;
 }
 
@@ -258,18 +362,7 @@ int HttpRequest::onBody(http_parser* pParser, const char* const pPos, size_t pLe
 int HttpRequest::onUrl(http_parser* pParser, const char* const pPos, size_t pLength)
 {
 	CAST_OBJ(pParser)
-	add(obj->mUrl, pPos, pLength);
+	obj->add(obj->mUrlSpan, pPos, pLength);
 	return 0;
 }
 
-
-void HttpRequest::insertHeader()
-{
-	if (!mCurrentHeaderField.isEmpty() && !mCurrentHeaderValue.isEmpty())
-	{
-		qCDebug(network).nospace() << "Header | " << mCurrentHeaderField << ": " << mCurrentHeaderValue;
-		mHeader.insert(mCurrentHeaderField.toLower(), mCurrentHeaderValue);
-		mCurrentHeaderField.clear();
-		mCurrentHeaderValue.clear();
-	}
-}
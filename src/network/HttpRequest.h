@@ -7,11 +7,13 @@
 #include "HttpResponse.h"
 
 #include <QByteArray>
-#include <QMap>
+#include <QByteArrayView>
 #include <QObject>
 #include <QPointer>
 #include <QTcpSocket>
 #include <QUrl>
+#include <QUrlQuery>
+#include <QVarLengthArray>
 
 #include <http_parser.h>
 
@@ -32,6 +34,18 @@ class HttpRequest
 	friend class ::test_HttpRequest;
 
 	private:
+		struct Span
+		{
+			qsizetype mOffset = 0;
+			qsizetype mLength = 0;
+		};
+
+		struct Header
+		{
+			Span mField;
+			Span mValue;
+		};
+
 		[[nodiscard]] static int onMessageBegin(http_parser* pParser);
 		[[nodiscard]] static int onMessageComplete(http_parser* pParser);
 		[[nodiscard]] static int onHeadersComplete(http_parser* pParser);
@@ -40,26 +54,30 @@ class HttpRequest
 		[[nodiscard]] static int onBody(http_parser* pParser, const char* const pPos, size_t pLength);
 		[[nodiscard]] static int onUrl(http_parser* pParser, const char* const pPos, size_t pLength);
 
-		static inline void add(QByteArray& pDest, const char* const pPos, size_t pLength)
-		{
-			pDest += QByteArray(pPos, static_cast<int>(pLength));
-		}
-
-
-		QByteArray mUrl;
-		QMap<QByteArray, QByteArray> mHeader;
+		// The parser only gets pointers into mBuffer, so every part of the
+		// request is kept as a span of the raw data instead of a copy.
+		QByteArray mBuffer;
+		Span mUrlSpan;
+		QVarLengthArray<Header, 16> mHeaders;
+		QVarLengthArray<Span, 1> mBodySpans;
+		QUrl mUrl;
+		QUrlQuery mQuery;
 		QByteArray mBody;
 		QPointer<QTcpSocket> mSocket;
 		http_parser mParser;
 		http_parser_settings mParserSettings;
 
 		bool mFinished;
-		QByteArray mCurrentHeaderField;
-		QByteArray mCurrentHeaderValue;
+		bool mHeaderValue;
 
-		void insertHeader();
+		[[nodiscard]] qsizetype getOffset(const char* const pPos) const;
+		void add(Span& pSpan, const char* const pPos, size_t pLength) const;
+		[[nodiscard]] QByteArrayView getView(const Span& pSpan) const;
+		void parse(qsizetype pOffset);
 
 	public:
+		static constexpr int cFlushTimeout = 30000;
+
 		explicit HttpRequest(QTcpSocket* pSocket, QObject* pParent = nullptr);
 		~HttpRequest() override;
 
@@ -68,9 +86,10 @@ class HttpRequest
 		[[nodiscard]] QByteArray getMethod() const;
 		[[nodiscard]] http_method getHttpMethod() const;
 		[[nodiscard]] bool isUpgrade() const;
-		[[nodiscard]] QByteArray getHeader(const QByteArray& pKey) const;
-		[[nodiscard]] const QMap<QByteArray, QByteArray>& getHeader() const;
-		[[nodiscard]] QUrl getUrl() const;
+		[[nodiscard]] QByteArray getHeader(QByteArrayView pKey) const;
+		[[nodiscard]] qsizetype getHeaderCount() const;
+		[[nodiscard]] const QUrl& getUrl() const;
+		[[nodiscard]] const QUrlQuery& getQuery() const;
 		[[nodiscard]] const QByteArray& getBody() const;
 		[[nodiscard]] quint16 getPeerPort() const;
 		[[nodiscard]] quint16 getLocalPort() const;
@@ -0,0 +1,39 @@
+/**
+ * Copyright (c) 2025 Governikus GmbH & Co. KG, Germany
+ */
+
+#include "NetworkAccessManager.h"
+
+#include <utility>
+
+
+using namespace governikus;
+
+
+NetworkAccessManager::NetworkAccessManager()
+	: QNetworkAccessManager()
+	, mPreconnecting(false)
+	, mPreconnectReply()
+{
+}
+
+
+QNetworkReply* NetworkAccessManager::createRequest(Operation pOperation, const QNetworkRequest& pRequest, QIODevice* pOutgoingData)
+{
+	auto* reply = QNetworkAccessManager::createRequest(pOperation, pRequest, pOutgoingData);
+	if (mPreconnecting)
+	{
+		mPreconnectReply = reply;
+	}
+	return reply;
+}
+
+
+QNetworkReply* NetworkAccessManager::preconnect(const QString& pHost, quint16 pPort, const QSslConfiguration& pConfig)
+{
+	// connectToHostEncrypted creates its request synchronously but does not return the reply
+	mPreconnecting = true;
+	connectToHostEncrypted(pHost, pPort, pConfig);
+	mPreconnecting = false;
+	return std::exchange(mPreconnectReply, nullptr).data();
+}
@@ -0,0 +1,40 @@
+/**
+ * Copyright (c) 2025 Governikus GmbH & Co. KG, Germany
+ */
+
+#pragma once
+
+#include <QNetworkAccessManager>
+#include <QNetworkReply>
+#include <QPointer>
+#include <QSslConfiguration>
+
+namespace governikus
+{
+
+/*!
+ * QNetworkAccessManager that hands out the reply of a pre-connect.
+ */
+class NetworkAccessManager
+	: public QNetworkAccessManager
+{
+	Q_OBJECT
+
+	private:
+		bool mPreconnecting;
+		QPointer<QNetworkReply> mPreconnectReply;
+
+	protected:
+		QNetworkReply* createRequest(Operation pOperation, const QNetworkRequest& pRequest, QIODevice* pOutgoingData) override;
+
+	public:
+		NetworkAccessManager();
+
+		/*!
+		 * Calls connectToHostEncrypted and returns its reply. The reply deletes
+		 * itself once the connection is established or has failed.
+		 */
+		[[nodiscard]] QNetworkReply* preconnect(const QString& pHost, quint16 pPort, const QSslConfiguration& pConfig);
+};
+
+} // namespace governikus
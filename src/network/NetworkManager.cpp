@@ -6,17 +6,23 @@
 
 #include "AppSettings.h"
 #include "LogHandler.h"
+#include "Metrics.h"
 #include "NetworkReplyError.h"
 #include "SecureStorage.h"
 #include "TlsChecker.h"
+#include "Tracer.h"
 #include "VersionInfo.h"
 
 #include <QCoreApplication>
+#include <QElapsedTimer>
 #include <QLoggingCategory>
 #include <QNetworkProxyFactory>
+#include <QSslPreSharedKeyAuthenticator>
 #include <QStringBuilder>
 #include <http_parser.h>
 
+#include <algorithm>
+
 
 using namespace governikus;
 
@@ -29,10 +35,17 @@ NetworkManager::NetworkManager()
 	, mNetAccessManager()
 	, mApplicationExitInProgress(false)
 	, mOpenConnectionCount(0)
+	, mConnectionStats({0, 0, 0})
 	, mUpdaterSessions()
+	, mPreconnectCredentials()
+	, mPreconnectConfigurations()
+	, mPreconnects()
+	, mPools()
+	, mConnectingReplies()
 {
 	mNetAccessManager.setRedirectPolicy(QNetworkRequest::ManualRedirectPolicy);
 	connect(&mNetAccessManager, &QNetworkAccessManager::proxyAuthenticationRequired, this, &NetworkManager::fireProxyAuthenticationRequired);
+	connect(&mNetAccessManager, &QNetworkAccessManager::preSharedKeyAuthenticationRequired, this, &NetworkManager::onPreSharedKeyAuthenticationRequired);
 
 	connect(&Env::getSingleton<AppSettings>()->getGeneralSettings(), &GeneralSettings::fireProxyChanged, this, &NetworkManager::onProxyChanged);
 }
@@ -44,10 +57,193 @@ int NetworkManager::getOpenConnectionCount() const
 }
 
 
+NetworkManager::ConnectionStats NetworkManager::getConnectionStats() const
+{
+	return mConnectionStats;
+}
+
+
 void NetworkManager::clearConnections()
 {
 	mNetAccessManager.clearConnectionCache();
 	mUpdaterSessions.clear();
+	mPreconnectCredentials.clear();
+	mPreconnectConfigurations.clear();
+	mPools.clear();
+}
+
+
+QString NetworkManager::getPoolKey(const QUrl& pUrl)
+{
+	return pUrl.host().toLower() + QLatin1Char(':') + QString::number(pUrl.port(443));
+}
+
+
+bool NetworkManager::isPsk(const QSslConfiguration& pConfig)
+{
+	const auto& ciphers = pConfig.ciphers();
+	return std::any_of(ciphers.cbegin(), ciphers.cend(), [](const QSslCipher& pCipher){
+				return pCipher.name().contains(QLatin1String("PSK"));
+			});
+}
+
+
+bool NetworkManager::isConnectionError(const QNetworkReply* pReply)
+{
+	const auto error = pReply->error();
+	return error != QNetworkReply::NoError &&
+		   error != QNetworkReply::OperationCanceledError &&
+		   !pReply->attribute(QNetworkRequest::HttpStatusCodeAttribute).isValid();
+}
+
+
+void NetworkManager::selectPool(const QUrl& pUrl, bool pPsk)
+{
+	if (pUrl.scheme() != QLatin1String("https"))
+	{
+		return;
+	}
+
+	// QNetworkAccessManager caches the connections by host and port only. A PSK
+	// connection must not be reused for a request with certificate based TLS
+	// and vice versa. A new PSK identity always comes with a new TcToken that
+	// clears the connections anyway.
+	const auto& key = getPoolKey(pUrl);
+	if (const auto pool = mPools.constFind(key); pool != mPools.constEnd() && *pool != pPsk)
+	{
+		// Only the cached connections depend on the TLS suite. The pre-connect
+		// state and the updater sessions stay valid.
+		qCDebug(network) << "TLS configuration of" << key << "changed, clear connections";
+		mNetAccessManager.clearConnectionCache();
+		mPools.clear();
+	}
+	mPools.insert(key, pPsk);
+}
+
+
+bool NetworkManager::isPreconnect(const QNetworkReply* pReply) const
+{
+	return std::any_of(mPreconnects.cbegin(), mPreconnects.cend(), [pReply](const QPointer<QNetworkReply>& pPreconnect){
+				return pPreconnect == pReply;
+			});
+}
+
+
+void NetworkManager::preconnect(const QUrl& pUrl, const QByteArray& pIdentity, const QByteArray& pPsk)
+{
+	if (mApplicationExitInProgress || pUrl.scheme() != QLatin1String("https") || pUrl.host().isEmpty())
+	{
+		return;
+	}
+
+	qCDebug(network) << "Pre-connect to" << pUrl.host() << pUrl.port(443);
+	selectPool(pUrl, true);
+	mPreconnectCredentials.insert(getPoolKey(pUrl), qMakePair(pIdentity, pPsk));
+
+	const auto& cfg = Env::getSingleton<SecureStorage>()->getTlsConfig(SecureStorage::TlsSuite::PSK).getConfiguration();
+	if (auto* reply = mNetAccessManager.preconnect(pUrl.host(), static_cast<quint16>(pUrl.port(443)), cfg))
+	{
+		mPreconnects.insert(getPoolKey(pUrl), reply);
+		trackPreconnect(reply);
+	}
+}
+
+
+void NetworkManager::trackPreconnect(QNetworkReply* pReply)
+{
+	++mOpenConnectionCount;
+
+	connect(pReply, &QNetworkReply::sslErrors, this, [](const QList<QSslError>& pErrors){
+				// The errors are not ignored, so the handshake fails and the request opens a new connection.
+				for (const auto& error : pErrors)
+				{
+					qCCritical(network) << "Fatal SSL error on pre-connect:" << error;
+				}
+			});
+	connect(pReply, &QNetworkReply::encrypted, this, [this, pReply] {
+				// The request that reuses the connection gets no encrypted signal,
+				// so StateGenericSendReceive checks this configuration instead.
+				mPreconnectConfigurations.insert(getPoolKey(pReply->url()), pReply->sslConfiguration());
+			});
+	connect(pReply, &QNetworkReply::finished, this, [this, pReply] {
+				--mOpenConnectionCount;
+
+				const auto& key = getPoolKey(pReply->url());
+				if (mPreconnects.value(key) == pReply)
+				{
+					mPreconnects.remove(key);
+				}
+
+				if (pReply->error() == QNetworkReply::NoError)
+				{
+					qCDebug(network) << "Pre-connect established:" << pReply->url().host();
+				}
+				else
+				{
+					qCDebug(network) << "Pre-connect failed:" << pReply->url().host() << pReply->errorString();
+					mPreconnectConfigurations.remove(key);
+				}
+
+				if (mOpenConnectionCount == 0)
+				{
+					Q_EMIT fireConnectionsClosed();
+				}
+			});
+	connect(this, &NetworkManager::fireShutdown, pReply, &QNetworkReply::abort, Qt::QueuedConnection);
+}
+
+
+QSslConfiguration NetworkManager::takePreconnectConfiguration(const QUrl& pUrl)
+{
+	const auto& key = getPoolKey(pUrl);
+	if (const auto reply = mPreconnects.take(key); reply && !reply->isFinished())
+	{
+		// A request would be queued on the pending channel and never see its handshake
+		qCDebug(network) << "Pre-connect to" << key << "is still in progress, abort it";
+		reply->abort();
+		mNetAccessManager.clearConnectionCache();
+		mPreconnectCredentials.remove(key);
+		mPreconnectConfigurations.remove(key);
+		return QSslConfiguration();
+	}
+
+	return mPreconnectConfigurations.take(key);
+}
+
+
+void NetworkManager::trackSocket(const QAbstractSocket* pSocket)
+{
+	Q_ASSERT(pSocket);
+
+	++mOpenConnectionCount;
+	connect(pSocket, &QObject::destroyed, this, [this] {
+				--mOpenConnectionCount;
+
+				if (mOpenConnectionCount == 0)
+				{
+					Q_EMIT fireConnectionsClosed();
+				}
+			});
+}
+
+
+void NetworkManager::onPreSharedKeyAuthenticationRequired(QNetworkReply* pReply, QSslPreSharedKeyAuthenticator* pAuthenticator)
+{
+	// Requests provide the credentials by themselves, see StateGenericSendReceive
+	if (!isPreconnect(pReply))
+	{
+		return;
+	}
+
+	const auto& credentials = mPreconnectCredentials.take(getPoolKey(pReply->url()));
+	if (credentials.first.isEmpty())
+	{
+		qCWarning(network) << "No pre-shared key for pre-connect to" << pReply->url().host();
+		return;
+	}
+
+	pAuthenticator->setIdentity(credentials.first);
+	pAuthenticator->setPreSharedKey(credentials.second);
 }
 
 
@@ -57,18 +253,18 @@ QSharedPointer<QNetworkReply> NetworkManager::paos(QNetworkRequest& pRequest,
 		bool pUsePsk,
 		const QByteArray& pSslSession)
 {
-	return processRequest(pRequest, [pData, pNamespace, pUsePsk, pSslSession, this] (QNetworkRequest& request){
-				request.setHeader(QNetworkRequest::ContentTypeHeader, QLatin1String("application/vnd.paos+xml; charset=UTF-8"));
-				request.setRawHeader("Connection", "keep-alive");
-				request.setRawHeader("Accept", "text/html; application/vnd.paos+xml");
-				request.setRawHeader("PAOS", QByteArray("ver=\"%1\"").replace(QByteArray("%1"), pNamespace));
+	pRequest.setHeader(QNetworkRequest::ContentTypeHeader, QLatin1String("application/vnd.paos+xml; charset=UTF-8"));
+	pRequest.setRawHeader("Connection", "keep-alive");
+	pRequest.setRawHeader("Accept", "text/html; application/vnd.paos+xml");
+	pRequest.setRawHeader("PAOS", QByteArray("ver=\"%1\"").replace(QByteArray("%1"), pNamespace));
 
-				SecureStorage::TlsSuite tlsSuite = pUsePsk ? SecureStorage::TlsSuite::PSK : SecureStorage::TlsSuite::DEFAULT;
-				auto cfg = Env::getSingleton<SecureStorage>()->getTlsConfig(tlsSuite).getConfiguration();
-				cfg.setSessionTicket(pSslSession);
-				request.setSslConfiguration(cfg);
-				return post(request, pData);
-			});
+	SecureStorage::TlsSuite tlsSuite = pUsePsk ? SecureStorage::TlsSuite::PSK : SecureStorage::TlsSuite::DEFAULT;
+	auto cfg = Env::getSingleton<SecureStorage>()->getTlsConfig(tlsSuite).getConfiguration();
+	cfg.setSessionTicket(pSslSession);
+	pRequest.setSslConfiguration(cfg);
+
+	// The TLS configuration must be set before post selects the connection pool.
+	return post(pRequest, pData);
 }
 
 
@@ -139,6 +335,7 @@ QSharedPointer<QNetworkReply> NetworkManager::processRequest(QNetworkRequest& pR
 		return QSharedPointer<QNetworkReply>(new NetworkReplyError(pRequest), &QObject::deleteLater);
 	}
 
+	selectPool(pRequest.url(), isPsk(pRequest.sslConfiguration()));
 	return pInvoke(pRequest);
 }
 
@@ -230,6 +427,7 @@ QString NetworkManager::getUserAgentServerHeader()
 void NetworkManager::onShutdown()
 {
 	mApplicationExitInProgress = true;
+	qCDebug(network) << "Connections opened:" << mConnectionStats.mOpened << "| reused:" << mConnectionStats.mReused << "| failed:" << mConnectionStats.mFailed;
 	mNetAccessManager.clearAccessCache();
 	clearConnections();
 	Q_EMIT fireShutdown();
@@ -372,6 +570,8 @@ bool NetworkManager::prepareConnection(QNetworkRequest& pRequest) const
 		pRequest.setSslConfiguration(cfg);
 	}
 
+	// A request multiplexed on an HTTP/2 connection gets no encrypted signal, so the
+	// workflows could not collect and check the certificates of every channel.
 	pRequest.setAttribute(QNetworkRequest::Http2AllowedAttribute, false);
 
 	return true;
@@ -386,10 +586,63 @@ QSharedPointer<QNetworkReply> NetworkManager::trackConnection(QNetworkReply* pRe
 	{
 		++mOpenConnectionCount;
 
-		connect(pResponse, &QNetworkReply::finished, this, [this] {
+		// A reused connection does not emit socketStartedConnecting, so the handshake is not recorded.
+		const auto connectTimer = QSharedPointer<QElapsedTimer>::create();
+		connect(pResponse, &QNetworkReply::socketStartedConnecting, this, [this, pResponse, connectTimer] {
+					++mConnectionStats.mOpened;
+					mConnectingReplies << pResponse;
+					connectTimer->start();
+				});
+		connect(pResponse, &QNetworkReply::finished, this, [this, pResponse] {
 					--mOpenConnectionCount;
+
+					const bool opened = mConnectingReplies.remove(pResponse);
+					if (isConnectionError(pResponse))
+					{
+						++mConnectionStats.mFailed;
+					}
+					else if (!opened)
+					{
+						++mConnectionStats.mReused;
+					}
+
+					if (mOpenConnectionCount == 0)
+					{
+						Q_EMIT fireConnectionsClosed();
+					}
 				});
 		connect(this, &NetworkManager::fireShutdown, pResponse, &QNetworkReply::abort, Qt::QueuedConnection);
+
+		connect(pResponse, &QNetworkReply::encrypted, this, [connectTimer] {
+					if (connectTimer->isValid())
+					{
+						Env::getSingleton<Metrics>()->record(Metric::TLS_HANDSHAKE, connectTimer->nsecsElapsed() / 1000);
+					}
+				});
+
+		if (const auto start = Env::getSingleton<Tracer>()->now(); start >= 0)
+		{
+			const auto& host = pResponse->url().host();
+			connect(pResponse, &QNetworkReply::encrypted, this, [connectTimer, host] {
+						auto* tracer = Env::getSingleton<Tracer>();
+						if (connectTimer->isValid() && tracer->isTracing())
+						{
+							const auto connectStart = tracer->now() - connectTimer->nsecsElapsed() / 1000;
+							tracer->addSpan(QLatin1String("network"), QStringLiteral("TLS handshake"), connectStart, {{QLatin1String("host"), host}});
+						}
+					});
+			connect(pResponse, &QNetworkReply::finished, this, [start, host, pResponse] {
+						if (!Env::getSingleton<Tracer>()->isTracing())
+						{
+							return;
+						}
+
+						Env::getSingleton<Tracer>()->addSpan(QLatin1String("network"), QStringLiteral("HTTP"), start, {
+							{QLatin1String("host"), host},
+							{QLatin1String("status"), pResponse->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt()}
+						});
+					});
+		}
 	}
 
 	return QSharedPointer<QNetworkReply>(pResponse, &QObject::deleteLater);
@@ -7,14 +7,19 @@
 #include "Env.h"
 #include "GlobalStatus.h"
 #include "LogHandler.h"
+#include "NetworkAccessManager.h"
 
+#include <QAbstractSocket>
 #include <QAtomicInt>
 #include <QAuthenticator>
 #include <QDebug>
+#include <QHash>
 #include <QNetworkAccessManager>
 #include <QNetworkProxy>
 #include <QNetworkReply>
+#include <QPointer>
 #include <QSsl>
+#include <QSslConfiguration>
 
 class test_NetworkManager;
 
@@ -28,13 +33,27 @@ class NetworkManager
 	friend class Env;
 	friend class ::test_NetworkManager;
 
+	public:
+		struct ConnectionStats
+		{
+			int mOpened;
+			int mReused;
+			int mFailed;
+		};
+
 	private:
 		static bool mLockProxy;
 
-		QNetworkAccessManager mNetAccessManager;
+		NetworkAccessManager mNetAccessManager;
 		bool mApplicationExitInProgress;
 		QAtomicInt mOpenConnectionCount;
+		ConnectionStats mConnectionStats;
 		QSet<QByteArray> mUpdaterSessions;
+		QHash<QString, QPair<QByteArray, QByteArray>> mPreconnectCredentials;
+		QHash<QString, QSslConfiguration> mPreconnectConfigurations;
+		QHash<QString, QPointer<QNetworkReply>> mPreconnects;
+		QHash<QString, bool> mPools;
+		QSet<const QNetworkReply*> mConnectingReplies;
 
 		bool prepareConnection(QNetworkRequest& pRequest) const;
 		[[nodiscard]] QSharedPointer<QNetworkReply> trackConnection(QNetworkReply* pResponse);
@@ -44,6 +63,13 @@ class NetworkManager
 				const std::function<QSharedPointer<QNetworkReply>(QNetworkRequest&)>& pInvoke);
 		void onSslErrors(QSharedPointer<QNetworkReply> response, const QList<QSslError>& pErrors) const;
 		void onEncryptedResponse(QSharedPointer<QNetworkReply> response);
+		[[nodiscard]] static QString getPoolKey(const QUrl& pUrl);
+		[[nodiscard]] static bool isPsk(const QSslConfiguration& pConfig);
+		[[nodiscard]] static bool isConnectionError(const QNetworkReply* pReply);
+		void selectPool(const QUrl& pUrl, bool pPsk);
+		[[nodiscard]] bool isPreconnect(const QNetworkReply* pReply) const;
+		void onPreSharedKeyAuthenticationRequired(QNetworkReply* pReply, QSslPreSharedKeyAuthenticator* pAuthenticator);
+		void trackPreconnect(QNetworkReply* pReply);
 
 	public Q_SLOTS:
 		void onShutdown();
@@ -84,6 +110,26 @@ class NetworkManager
 		[[nodiscard]] static QString getFormattedStatusMessage(int pStatus);
 
 		virtual void clearConnections();
+
+		/*!
+		 * Establishes the TLS-PSK channel to \a pUrl in the background. A later
+		 * request to the same host reuses the connection if it is still open.
+		 */
+		virtual void preconnect(const QUrl& pUrl, const QByteArray& pIdentity, const QByteArray& pPsk);
+
+		/*!
+		 * Returns the TLS configuration of an established pre-connect to the host of \a pUrl
+		 * once. The caller must check it as the reusing request emits no encrypted signal.
+		 * A pre-connect that is still in progress is aborted, so the next request opens
+		 * a connection of its own.
+		 */
+		[[nodiscard]] virtual QSslConfiguration takePreconnectConfiguration(const QUrl& pUrl);
+
+		/*!
+		 * Counts \a pSocket as an open connection until it is destroyed, e.g.
+		 * a socket that writes the last response in the background.
+		 */
+		void trackSocket(const QAbstractSocket* pSocket);
 		[[nodiscard]] virtual QSharedPointer<QNetworkReply> paos(QNetworkRequest& pRequest,
 				const QByteArray& pNamespace,
 				const QByteArray& pData,
@@ -101,10 +147,12 @@ class NetworkManager
 				const QByteArray& pData);
 
 		[[nodiscard]] int getOpenConnectionCount() const;
+		[[nodiscard]] ConnectionStats getConnectionStats() const;
 
 	Q_SIGNALS:
 		void fireProxyAuthenticationRequired(const QNetworkProxy& pProxy, QAuthenticator* pAuthenticator);
 		void fireShutdown();
+		void fireConnectionsClosed();
 };
 
 } // namespace governikus
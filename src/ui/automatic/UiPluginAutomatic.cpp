@@ -70,7 +70,7 @@ void UiPluginAutomatic::onWorkflowStarted(const QSharedPointer<WorkflowRequest>&
 		qCDebug(automatic) << "Fallback to full automatic UI";
 
 		mContext = context;
-		mContext->setReaderPluginTypes({ReaderManagerPluginType::SIMULATOR, ReaderManagerPluginType::PCSC});
+		mContext->setReaderPluginTypes({ReaderManagerPluginType::SIMULATOR, ReaderManagerPluginType::REPLAY, ReaderManagerPluginType::PCSC});
 		connect(mContext.data(), &WorkflowContext::fireStateChanged, this, &UiPluginAutomatic::onStateChanged);
 		mPrevUsedAsSDK = Env::getSingleton<VolatileSettings>()->isUsedAsSDK();
 		mPrevUsedDeveloperMode = Env::getSingleton<VolatileSettings>()->isDeveloperMode();
@@ -288,7 +288,8 @@ void UiPluginAutomatic::handlePassword()
 				break;
 		}
 	}
-	else if (currentReaderInfo.getPluginType() == ReaderManagerPluginType::SIMULATOR)
+	else if (currentReaderInfo.getPluginType() == ReaderManagerPluginType::SIMULATOR
+			|| currentReaderInfo.getPluginType() == ReaderManagerPluginType::REPLAY)
 	{
 		mContext->setStateApproved();
 		return;
@@ -5,6 +5,7 @@
 #include "UiLoader.h"
 
 #include "BuildHelper.h"
+#include "StartupProfile.h"
 
 #include <QLoggingCategory>
 #include <QPluginLoader>
@@ -56,6 +57,7 @@ QStringList UiLoader::getInitialDefault()
 bool UiLoader::initialize() const
 {
 	return std::all_of(mLoadedPlugins.begin(), mLoadedPlugins.end(), [](UiPlugin* pUi){
+				const StartupProfile::ScopedStep step(QStringLiteral("Initialize UI plugin %1").arg(getName(pUi->metaObject())));
 				return pUi->initialize();
 			});
 }
@@ -120,6 +122,7 @@ bool UiLoader::load(const QString& pUi)
 				continue;
 			}
 
+			const StartupProfile::ScopedStep step(QStringLiteral("Load UI plugin %1").arg(requestedName));
 			setEnvironment(metaData);
 			qCDebug(gui) << "Load plugin:" << metaData;
 			auto instance = qobject_cast<UiPlugin*>(plugin.instance());
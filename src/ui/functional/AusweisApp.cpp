@@ -8,10 +8,13 @@
 #include "UiLoader.h"
 #include "UiPluginFunctional.h"
 
+#include <QByteArrayList>
 #include <QMetaObject>
 #include <QObject>
 
 #include <chrono>
+#include <cstring>
+#include <deque>
 #include <future>
 #include <iostream>
 #include <mutex>
@@ -26,6 +29,9 @@ static std::thread cThread; // clazy:exclude=non-pod-global-static
 static std::future<void> cStartedFuture; // clazy:exclude=non-pod-global-static
 static std::promise<void> cStartedPromise; // clazy:exclude=non-pod-global-static
 static std::mutex cMutex;
+static bool cPollMode = false;
+static std::deque<QByteArray> cMessages; // clazy:exclude=non-pod-global-static
+static std::mutex cMessagesMutex;
 } // namespace
 
 namespace governikus
@@ -63,6 +69,31 @@ Q_DECL_EXPORT AusweisAppCallback ausweisapp_get_callback_internal()
 }
 
 
+Q_DECL_EXPORT bool ausweisapp_is_poll_mode_internal()
+{
+	return cPollMode;
+}
+
+
+Q_DECL_EXPORT void ausweisapp_push_message_internal(const QByteArray& pMsg)
+{
+	const std::lock_guard<std::mutex> lock(cMessagesMutex);
+	if (cMessages.size() >= cMaxPollMessages)
+	{
+		return;
+	}
+
+	if (cMessages.size() == cMaxPollMessages - 1)
+	{
+		std::cout << "Message queue is full, messages are dropped until the application polls" << std::endl;
+		cMessages.push_back(QByteArrayLiteral(R"({"error":"Message queue overflow","msg":"INTERNAL_ERROR"})"));
+		return;
+	}
+
+	cMessages.push_back(pMsg);
+}
+
+
 Q_DECL_EXPORT void ausweisapp_join_thread_internal()
 {
 	if (cThread.joinable())
@@ -90,14 +121,10 @@ Q_DECL_EXPORT void ausweisapp_join_thread_internal()
 using namespace governikus;
 
 
-Q_DECL_EXPORT bool ausweisapp_init(AusweisAppCallback pCallback, const char* pCmdline)
+namespace
+{
+bool start(AusweisAppCallback pCallback, const char* pCmdline)
 {
-	if (pCallback == nullptr)
-	{
-		std::cout << "Initialization failed: callback cannot be nullptr" << std::endl;
-		return false;
-	}
-
 	const std::lock_guard<std::mutex> lock(cMutex);
 	if (ausweisapp_is_running_internal())
 	{
@@ -106,8 +133,14 @@ Q_DECL_EXPORT bool ausweisapp_init(AusweisAppCallback pCallback, const char* pCm
 	}
 
 	cCallback = pCallback;
+	cPollMode = pCallback == nullptr;
 	cShutdownCalled = false;
 
+	{
+		const std::lock_guard<std::mutex> messagesLock(cMessagesMutex);
+		cMessages.clear();
+	}
+
 	cStartedPromise = std::promise<void>();
 	cStartedFuture = cStartedPromise.get_future();
 	cThread = std::thread(&ausweisapp_init_internal, QByteArray(pCmdline));
@@ -116,6 +149,45 @@ Q_DECL_EXPORT bool ausweisapp_init(AusweisAppCallback pCallback, const char* pCm
 }
 
 
+void post(const QByteArrayList& pCmds)
+{
+	const std::lock_guard<std::mutex> lock(cMutex);
+
+	using namespace std::chrono_literals;
+	const bool initialized = cStartedFuture.valid() && cStartedFuture.wait_for(0s) == std::future_status::ready;
+	if (cShutdownCalled || !initialized || pCmds.isEmpty())
+	{
+		return;
+	}
+
+	QMetaObject::invokeMethod(QCoreApplication::instance(), [pCmds] {
+				auto* j = Env::getSingleton<UiLoader>()->getLoaded<UiPluginFunctional>();
+				if (j)
+				{
+					for (const auto& cmd : pCmds)
+					{
+						j->doMessageProcessing(cmd);
+					}
+				}
+			}, Qt::QueuedConnection);
+}
+
+
+} // namespace
+
+
+Q_DECL_EXPORT bool ausweisapp_init(AusweisAppCallback pCallback, const char* pCmdline)
+{
+	if (pCallback == nullptr)
+	{
+		std::cout << "Initialization failed: callback cannot be nullptr" << std::endl;
+		return false;
+	}
+
+	return start(pCallback, pCmdline);
+}
+
+
 Q_DECL_EXPORT void ausweisapp_shutdown(void)
 {
 	const std::lock_guard<std::mutex> lock(cMutex);
@@ -153,23 +225,78 @@ Q_DECL_EXPORT bool ausweisapp_is_running(void)
 
 Q_DECL_EXPORT void ausweisapp_send(const char* pCmd)
 {
-	const std::lock_guard<std::mutex> lock(cMutex);
+	if (pCmd == nullptr)
+	{
+		return;
+	}
 
-	using namespace std::chrono_literals;
-	const bool initialized = cStartedFuture.wait_for(0s) == std::future_status::ready;
-	if (cShutdownCalled || !initialized || pCmd == nullptr)
+	post({QByteArray(pCmd)});
+}
+
+
+Q_DECL_EXPORT bool ausweisapp_init_poll(const char* pCmdline)
+{
+	return start(nullptr, pCmdline);
+}
+
+
+Q_DECL_EXPORT size_t ausweisapp_poll(char* pBuffer, size_t pBufferSize)
+{
+	const std::lock_guard<std::mutex> lock(cMessagesMutex);
+	if (cMessages.empty())
+	{
+		return 0;
+	}
+
+	const auto& msg = cMessages.front();
+	const auto required = static_cast<size_t>(msg.size()) + 1;
+	if (pBuffer == nullptr || pBufferSize < required)
+	{
+		return required;
+	}
+
+	// QByteArray is always terminated by \0
+	std::memcpy(pBuffer, msg.constData(), required);
+	cMessages.pop_front();
+	return required;
+}
+
+
+Q_DECL_EXPORT void ausweisapp_send_buffer(const char* pCmd, size_t pLength)
+{
+	if (pCmd == nullptr || pLength == 0)
 	{
 		return;
 	}
 
-	const auto cmd = QByteArray(pCmd);
-	QMetaObject::invokeMethod(QCoreApplication::instance(), [cmd] {
-				auto* j = Env::getSingleton<UiLoader>()->getLoaded<UiPluginFunctional>();
-				if (j)
-				{
-					j->doMessageProcessing(cmd);
-				}
-			}, Qt::QueuedConnection);
+	post({QByteArray(pCmd, static_cast<qsizetype>(pLength))});
+}
+
+
+Q_DECL_EXPORT void ausweisapp_send_batch(const char* const* pCmds, const size_t* pLengths, size_t pCount)
+{
+	if (pCmds == nullptr)
+	{
+		return;
+	}
+
+	QByteArrayList cmds;
+	cmds.reserve(static_cast<qsizetype>(pCount));
+	for (size_t i = 0; i < pCount; ++i)
+	{
+		if (pCmds[i] == nullptr)
+		{
+			continue;
+		}
+
+		const auto cmd = pLengths ? QByteArray(pCmds[i], static_cast<qsizetype>(pLengths[i])) : QByteArray(pCmds[i]);
+		if (!cmd.isEmpty())
+		{
+			cmds << cmd;
+		}
+	}
+
+	post(cmds);
 }
 
 
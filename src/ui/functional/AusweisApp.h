@@ -10,6 +10,7 @@ extern "C" {
 #endif
 
 #include <stdbool.h>
+#include <stddef.h>
 
 typedef void (* AusweisAppCallback)(const char* pMsg);
 
@@ -18,6 +19,11 @@ void ausweisapp_shutdown(void);
 bool ausweisapp_is_running(void);
 void ausweisapp_send(const char* pCmd);
 
+bool ausweisapp_init_poll(const char* pCmdline);
+size_t ausweisapp_poll(char* pBuffer, size_t pBufferSize);
+void ausweisapp_send_buffer(const char* pCmd, size_t pLength);
+void ausweisapp_send_batch(const char* const* pCmds, const size_t* pLengths, size_t pCount);
+
 
 #if (defined(__STDC_VERSION__) && __STDC_VERSION__ >= 202311L) || (defined(__cplusplus) && __cplusplus >= 201402L) || defined(__clang__) || defined(__GNUC__)
 	#define DEPRECATED [[deprecated]]
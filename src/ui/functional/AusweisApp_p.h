@@ -8,13 +8,20 @@
 
 #include <QByteArray>
 
+#include <cstddef>
+
 namespace governikus
 {
 
+// The last slot of the poll queue is reserved for an INTERNAL_ERROR that marks the overflow.
+constexpr size_t cMaxPollMessages = 1000;
+
 void ausweisapp_init_internal(const QByteArray& pCmdline);
 bool ausweisapp_is_running_internal();
 void ausweisapp_started_internal();
 AusweisAppCallback ausweisapp_get_callback_internal();
+bool ausweisapp_is_poll_mode_internal();
+void ausweisapp_push_message_internal(const QByteArray& pMsg);
 void ausweisapp_join_thread_internal();
 
 } // namespace governikus
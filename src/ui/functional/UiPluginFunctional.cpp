@@ -48,14 +48,23 @@ void UiPluginFunctional::onApplicationStarted()
 {
 	ausweisapp_started_internal();
 	auto callback = ausweisapp_get_callback_internal();
-	if (callback == nullptr)
+	const bool pollMode = ausweisapp_is_poll_mode_internal();
+	if (callback == nullptr && !pollMode)
 	{
 		qDebug() << "No callback registered";
 		return;
 	}
 
 	mJson->setEnabled();
-	callback(nullptr);
+	if (pollMode)
+	{
+		// An empty message indicates that the SDK is ready like callback(nullptr)
+		ausweisapp_push_message_internal(QByteArray());
+	}
+	else
+	{
+		callback(nullptr);
+	}
 
 	Env::getSingleton<ReaderManager>()->startScan(ReaderManagerPluginType::SIMULATOR);
 }
@@ -69,7 +78,7 @@ void UiPluginFunctional::onWorkflowStarted(const QSharedPointer<WorkflowRequest>
 #if defined(Q_OS_IOS) || defined(Q_OS_ANDROID)
 	mContext->setReaderPluginTypes({ReaderManagerPluginType::NFC, ReaderManagerPluginType::SIMULATOR});
 #else
-	mContext->setReaderPluginTypes({ReaderManagerPluginType::PCSC, ReaderManagerPluginType::SIMULATOR});
+	mContext->setReaderPluginTypes({ReaderManagerPluginType::PCSC, ReaderManagerPluginType::SIMULATOR, ReaderManagerPluginType::REPLAY});
 #endif
 
 #if !defined(Q_OS_IOS)
@@ -92,6 +101,12 @@ void UiPluginFunctional::onWorkflowFinished(const QSharedPointer<WorkflowRequest
 
 void UiPluginFunctional::onJsonMessage(const QByteArray& pMessage)
 {
+	if (ausweisapp_is_poll_mode_internal())
+	{
+		ausweisapp_push_message_internal(pMessage);
+		return;
+	}
+
 	auto callback = ausweisapp_get_callback_internal();
 	if (callback == nullptr)
 	{
@@ -20,10 +20,12 @@
 #include "messages/MsgHandlerInternalError.h"
 #include "messages/MsgHandlerInvalid.h"
 #include "messages/MsgHandlerLog.h"
+#include "messages/MsgHandlerMetrics.h"
 #include "messages/MsgHandlerPause.h"
 #include "messages/MsgHandlerReader.h"
 #include "messages/MsgHandlerReaderList.h"
 #include "messages/MsgHandlerStatus.h"
+#include "messages/MsgHandlerTrace.h"
 #include "messages/MsgHandlerUnknownCommand.h"
 
 #ifdef Q_OS_IOS
@@ -168,7 +170,7 @@ Msg MessageDispatcher::processProgressChange() const
 
 QList<Msg> MessageDispatcher::processReaderChange(const ReaderInfo& pInfo)
 {
-	QList<Msg> messages({MsgHandlerReader(pInfo, mContext)});
+	QList<Msg> messages({MsgHandlerReader::createMessage(pInfo, mContext)});
 
 	const auto& lastStateMsg = mContext.getLastStateMsg();
 	if (lastStateMsg == MsgType::INSERT_CARD && !lastStateMsg)
@@ -240,9 +242,14 @@ Msg MessageDispatcher::processCommand(const QByteArray& pMsg)
 		return MsgHandlerInvalid(jsonError);
 	}
 
-	const auto& obj = json.object();
-	auto msg = createForCommand(obj);
-	msg.setRequest(obj);
+	return processCommand(json.object());
+}
+
+
+Msg MessageDispatcher::processCommand(const QJsonObject& pObj)
+{
+	auto msg = createForCommand(pObj);
+	msg.setRequest(pObj);
 	return msg;
 }
 
@@ -255,7 +262,7 @@ MsgHandler MessageDispatcher::createForCommand(const QJsonObject& pObj)
 		return MsgHandlerInvalid(QLatin1String("Command cannot be undefined"));
 	}
 
-	const auto requestType = Enum<MsgCmdType>::fromString(cmd, MsgCmdType::UNDEFINED);
+	const auto requestType = getMsgCmdType(cmd);
 	qCDebug(json) << "Process type:" << requestType;
 	switch (requestType)
 	{
@@ -296,6 +303,12 @@ MsgHandler MessageDispatcher::createForCommand(const QJsonObject& pObj)
 		case MsgCmdType::GET_INFO:
 			return MsgHandlerInfo();
 
+		case MsgCmdType::GET_TRACE:
+			return MsgHandlerTrace(pObj);
+
+		case MsgCmdType::GET_METRICS:
+			return MsgHandlerMetrics();
+
 		case MsgCmdType::RUN_AUTH:
 			return mContext.isActiveWorkflow() ? MsgHandler(MsgHandlerBadState(requestType)) : MsgHandler(MsgHandlerAuth(pObj, mContext));
 
@@ -53,6 +53,7 @@ class MessageDispatcher
 		void reset();
 		[[nodiscard]] MsgLevel getApiLevel() const;
 		[[nodiscard]] Msg processCommand(const QByteArray& pMsg);
+		[[nodiscard]] Msg processCommand(const QJsonObject& pObj);
 		[[nodiscard]] Msg processStateChange(const QString& pState);
 		[[nodiscard]] Msg processProgressChange() const;
 		[[nodiscard]] QList<Msg> processReaderChange(const ReaderInfo& pInfo);
@@ -43,7 +43,7 @@ void MsgHandlerAccessRights::handleSetChatData(const QJsonArray& pChat, const QS
 {
 	Q_ASSERT(pContext);
 
-	QSet<AccessRight> effectiveChat;
+	AccessRights effectiveChat;
 
 	if (!pContext->getAccessRightManager()->getOptionalAccessRights().isEmpty())
 	{
@@ -85,14 +85,14 @@ void MsgHandlerAccessRights::handleSetChatData(const QJsonArray& pChat, const QS
 }
 
 
-QJsonArray MsgHandlerAccessRights::getAccessRights(const QSet<AccessRight>& pRights) const
+QJsonArray MsgHandlerAccessRights::getAccessRights(const AccessRights& pRights) const
 {
 	QJsonArray array;
 
-	QList<AccessRight> accessRights = pRights.values();
-	std::sort(accessRights.rbegin(), accessRights.rend());
-	for (const auto& entry : std::as_const(accessRights))
+	const auto accessRights = pRights.values();
+	for (auto iter = accessRights.crbegin(); iter != accessRights.crend(); ++iter)
 	{
+		const auto entry = *iter;
 		const QLatin1String name = AccessRoleAndRightsUtil::toTechnicalName(entry);
 		if (name.size())
 		{
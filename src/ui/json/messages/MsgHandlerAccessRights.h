@@ -20,7 +20,7 @@ class MsgHandlerAccessRights
 		void setError(const QLatin1String pError);
 
 		void handleSetChatData(const QJsonArray& pChat, const QSharedPointer<AuthContext>& pContext);
-		[[nodiscard]] QJsonArray getAccessRights(const QSet<AccessRight>& pRights) const;
+		[[nodiscard]] QJsonArray getAccessRights(const AccessRights& pRights) const;
 		[[nodiscard]] QJsonArray getAcceptedEidTypes(const QSharedPointer<const AuthContext>& pContext) const;
 		void fillAccessRights(const QSharedPointer<const AuthContext>& pContext);
 		[[nodiscard]] QJsonObject getAuxiliaryData(const QSharedPointer<const AuthContext>& pContext) const;
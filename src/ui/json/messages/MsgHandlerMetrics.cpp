@@ -0,0 +1,18 @@
+/**
+ * Copyright (c) 2025 Governikus GmbH & Co. KG, Germany
+ */
+
+#include "MsgHandlerMetrics.h"
+
+#include "Env.h"
+#include "Metrics.h"
+
+
+using namespace governikus;
+
+
+MsgHandlerMetrics::MsgHandlerMetrics()
+	: MsgHandler(MsgType::METRICS)
+{
+	setValue(QLatin1String("metrics"), Env::getSingleton<Metrics>()->toJson());
+}
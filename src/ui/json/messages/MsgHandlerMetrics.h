@@ -0,0 +1,20 @@
+/**
+ * Copyright (c) 2025 Governikus GmbH & Co. KG, Germany
+ */
+
+#pragma once
+
+#include "MsgHandler.h"
+
+namespace governikus
+{
+
+class MsgHandlerMetrics
+	: public MsgHandler
+{
+	public:
+		MsgHandlerMetrics();
+};
+
+
+} // namespace governikus
@@ -6,8 +6,154 @@
 
 #include "ReaderManager.h"
 
+#include <QHash>
+#include <QPointer>
+
 using namespace governikus;
 
+
+namespace
+{
+struct ReaderState
+{
+	bool mKnown = false;
+	bool mInsertable = false;
+	bool mBasicReader = false;
+	bool mHasEid = false;
+	bool mHasCard = false;
+	bool mPinDeactivated = false;
+	bool mPukInoperative = false;
+	int mRetryCounter = -1;
+	int mMobileEidType = 0;
+
+	ReaderState() = default;
+
+
+	explicit ReaderState(const ReaderInfo& pInfo)
+		: mKnown(pInfo.isValid())
+		, mInsertable(pInfo.isInsertable())
+		, mBasicReader(pInfo.isBasicReader())
+		, mHasEid(pInfo.hasEid())
+		, mHasCard(pInfo.hasCard())
+		, mPinDeactivated(pInfo.isPinDeactivated())
+		, mPukInoperative(pInfo.isPukInoperative())
+		, mRetryCounter(pInfo.getRetryCounter())
+		, mMobileEidType(static_cast<int>(pInfo.getCardInfo().getMobileEidType()))
+	{
+	}
+
+
+	[[nodiscard]] bool operator==(const ReaderState& pOther) const
+	{
+		return mKnown == pOther.mKnown
+			   && mInsertable == pOther.mInsertable
+			   && mBasicReader == pOther.mBasicReader
+			   && mHasEid == pOther.mHasEid
+			   && mHasCard == pOther.mHasCard
+			   && mPinDeactivated == pOther.mPinDeactivated
+			   && mPukInoperative == pOther.mPukInoperative
+			   && mRetryCounter == pOther.mRetryCounter
+			   && mMobileEidType == pOther.mMobileEidType;
+	}
+
+
+};
+
+
+QJsonObject buildReaderInfo(const ReaderInfo& pInfo, bool pShowAnyCard)
+{
+	QJsonObject obj;
+
+	const bool known = pInfo.isValid();
+	obj[QLatin1String("name")] = pInfo.getName();
+	obj[QLatin1String("attached")] = known;
+	if (known)
+	{
+		obj[QLatin1String("insertable")] = pInfo.isInsertable();
+		obj[QLatin1String("keypad")] = !pInfo.isBasicReader();
+
+		if (pInfo.hasEid() || (pInfo.hasCard() && pShowAnyCard))
+		{
+			QJsonObject card;
+			if (pInfo.hasEid())
+			{
+#if __has_include("SmartManager.h")
+				card[QLatin1String("eidType")] = Enum<AcceptedEidType>::getName(static_cast<AcceptedEidType>(pInfo.getCardInfo().getMobileEidType()));
+#endif
+				card[QLatin1String("deactivated")] = pInfo.isPinDeactivated();
+				card[QLatin1String("inoperative")] = pInfo.isPukInoperative();
+				card[QLatin1String("retryCounter")] = pInfo.getRetryCounter();
+			}
+			obj[QLatin1String("card")] = card;
+		}
+		else
+		{
+			obj[QLatin1String("card")] = QJsonValue::Null;
+		}
+	}
+
+	return obj;
+}
+
+
+struct CachedReader
+{
+	ReaderState mState;
+	QJsonObject mReaderInfo;
+	Msg mMessage;
+};
+
+
+using ReaderCache = QHash<QPair<QString, bool>, CachedReader>;
+
+
+// Entries of removed readers are dropped. The cache of a previous
+// ReaderManager instance is discarded completely.
+ReaderCache& getReaderCache()
+{
+	static ReaderCache cache;
+	static QPointer<ReaderManager> connectedReaderManager;
+
+	if (auto* readerManager = Env::getSingleton<ReaderManager>(); connectedReaderManager != readerManager)
+	{
+		cache.clear();
+		connectedReaderManager = readerManager;
+		QObject::connect(readerManager, &ReaderManager::fireReaderRemoved, readerManager, [](const ReaderInfo& pInfo){
+					cache.remove(qMakePair(pInfo.getName(), false));
+					cache.remove(qMakePair(pInfo.getName(), true));
+				});
+	}
+
+	return cache;
+}
+
+
+// The output only depends on the ReaderState and whether the api level shows
+// cards without eID. Any change of the ReaderInfo replaces the cached entry.
+// Unknown or removed readers are never cached.
+CachedReader& getCachedReader(const ReaderInfo& pInfo, bool pShowAnyCard)
+{
+	Q_ASSERT(pInfo.isValid());
+	auto& cache = getReaderCache();
+
+	const ReaderState state(pInfo);
+	auto entry = cache.find(qMakePair(pInfo.getName(), pShowAnyCard));
+	if (entry == cache.end())
+	{
+		entry = cache.insert(qMakePair(pInfo.getName(), pShowAnyCard), {state, buildReaderInfo(pInfo, pShowAnyCard), Msg()});
+	}
+	else if (!(entry->mState == state))
+	{
+		*entry = {state, buildReaderInfo(pInfo, pShowAnyCard), Msg()};
+	}
+
+	return *entry;
+}
+
+
+} // namespace
+
+
 MsgHandlerReader::MsgHandlerReader(const QJsonObject& pObj, const MsgContext& pContext)
 	: MsgHandler(MsgType::READER)
 {
@@ -27,6 +173,12 @@ MsgHandlerReader::MsgHandlerReader(const QJsonObject& pObj, const MsgContext& pC
 }
 
 
+MsgHandlerReader::MsgHandlerReader()
+	: MsgHandler(MsgType::READER)
+{
+}
+
+
 MsgHandlerReader::MsgHandlerReader(const ReaderInfo& pInfo, const MsgContext& pContext)
 	: MsgHandler(MsgType::READER)
 {
@@ -50,35 +202,35 @@ void MsgHandlerReader::setReaderInfo(const ReaderInfo& pInfo, const MsgContext&
 QJsonObject MsgHandlerReader::createReaderInfo(const ReaderInfo& pInfo, const MsgContext& pContext)
 {
 	Q_ASSERT(!pInfo.getName().isEmpty());
-	QJsonObject obj;
 
-	const bool known = pInfo.isValid();
-	obj[QLatin1String("name")] = pInfo.getName();
-	obj[QLatin1String("attached")] = known;
-	if (known)
+	const bool showAnyCard = pContext.getApiLevel() > MsgLevel::v2;
+	if (!pInfo.isValid())
 	{
-		obj[QLatin1String("insertable")] = pInfo.isInsertable();
-		obj[QLatin1String("keypad")] = !pInfo.isBasicReader();
+		return buildReaderInfo(pInfo, showAnyCard);
+	}
 
-		if (pInfo.hasEid() || (pInfo.hasCard() && pContext.getApiLevel() > MsgLevel::v2))
-		{
-			QJsonObject card;
-			if (pInfo.hasEid())
-			{
-#if __has_include("SmartManager.h")
-				card[QLatin1String("eidType")] = Enum<AcceptedEidType>::getName(static_cast<AcceptedEidType>(pInfo.getCardInfo().getMobileEidType()));
-#endif
-				card[QLatin1String("deactivated")] = pInfo.isPinDeactivated();
-				card[QLatin1String("inoperative")] = pInfo.isPukInoperative();
-				card[QLatin1String("retryCounter")] = pInfo.getRetryCounter();
-			}
-			obj[QLatin1String("card")] = card;
-		}
-		else
-		{
-			obj[QLatin1String("card")] = QJsonValue::Null;
-		}
+	return getCachedReader(pInfo, showAnyCard).mReaderInfo;
+}
+
+
+Msg MsgHandlerReader::createMessage(const ReaderInfo& pInfo, const MsgContext& pContext)
+{
+	Q_ASSERT(!pInfo.getName().isEmpty());
+
+	if (!pInfo.isValid())
+	{
+		MsgHandlerReader msg;
+		msg.insertJsonObject(createReaderInfo(pInfo, pContext));
+		return msg;
 	}
 
-	return obj;
+	auto& entry = getCachedReader(pInfo, pContext.getApiLevel() > MsgLevel::v2);
+	if (!entry.mMessage)
+	{
+		MsgHandlerReader msg;
+		msg.insertJsonObject(entry.mReaderInfo);
+		entry.mMessage = msg;
+	}
+
+	return entry.mMessage;
 }
@@ -15,11 +15,14 @@ class MsgHandlerReader
 	: public MsgHandler
 {
 	private:
+		MsgHandlerReader();
+
 		void setError(const QLatin1String pError);
 		void setReaderInfo(const ReaderInfo& pInfo, const MsgContext& pContext);
 
 	public:
 		static QJsonObject createReaderInfo(const ReaderInfo& pInfo, const MsgContext& pContext);
+		static Msg createMessage(const ReaderInfo& pInfo, const MsgContext& pContext);
 
 		explicit MsgHandlerReader(const QJsonObject& pObj, const MsgContext& pContext);
 		explicit MsgHandlerReader(const ReaderInfo& pInfo, const MsgContext& pContext);
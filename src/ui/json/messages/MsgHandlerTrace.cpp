@@ -0,0 +1,55 @@
+/**
+ * Copyright (c) 2025 Governikus GmbH & Co. KG, Germany
+ */
+
+#include "MsgHandlerTrace.h"
+
+#include "Env.h"
+#include "Tracer.h"
+
+#include <QJsonArray>
+
+using namespace governikus;
+
+MsgHandlerTrace::MsgHandlerTrace(const QJsonObject& pObj)
+	: MsgHandler(MsgType::TRACE)
+{
+	int count = 1;
+	if (const auto& jsonCount = pObj[QLatin1String("count")]; !jsonCount.isUndefined())
+	{
+		if (!jsonCount.isDouble() || jsonCount.toInt() < 1)
+		{
+			setError(QLatin1String("Invalid count"));
+			return;
+		}
+		count = jsonCount.toInt();
+	}
+
+	auto format = TraceFormat::CHROME;
+	if (const auto& jsonFormat = pObj[QLatin1String("format")]; !jsonFormat.isUndefined())
+	{
+		if (jsonFormat == QLatin1String("otlp"))
+		{
+			format = TraceFormat::OTLP;
+		}
+		else if (jsonFormat != QLatin1String("chrome"))
+		{
+			setError(QLatin1String("Invalid format"));
+			return;
+		}
+	}
+
+	QJsonArray traces;
+	const auto& list = Env::getSingleton<Tracer>()->getTraces(count);
+	for (const auto& trace : list)
+	{
+		traces += format == TraceFormat::OTLP ? Tracer::toOtlp(trace) : Tracer::toChromeTrace(trace);
+	}
+	setValue(QLatin1String("traces"), traces);
+}
+
+
+void MsgHandlerTrace::setError(const QLatin1String pError)
+{
+	setValue(QLatin1String("error"), pError);
+}
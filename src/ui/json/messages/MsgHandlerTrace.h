@@ -0,0 +1,23 @@
+/**
+ * Copyright (c) 2025 Governikus GmbH & Co. KG, Germany
+ */
+
+#pragma once
+
+#include "MsgHandler.h"
+
+namespace governikus
+{
+
+class MsgHandlerTrace
+	: public MsgHandler
+{
+	private:
+		void setError(const QLatin1String pError);
+
+	public:
+		explicit MsgHandlerTrace(const QJsonObject& pObj);
+};
+
+
+} // namespace governikus
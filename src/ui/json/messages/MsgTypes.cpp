@@ -4,6 +4,94 @@
 
 #include "MsgTypes.h"
 
+#include <array>
+#include <utility>
+
 using namespace governikus;
 
+
+namespace
+{
+constexpr std::array<std::pair<QLatin1StringView, MsgCmdType>, 24> cCommands = {{
+			{QLatin1StringView("ACCEPT"), MsgCmdType::ACCEPT},
+			{QLatin1StringView("CANCEL"), MsgCmdType::CANCEL},
+			{QLatin1StringView("CONTINUE"), MsgCmdType::CONTINUE},
+			{QLatin1StringView("INTERRUPT"), MsgCmdType::INTERRUPT},
+			{QLatin1StringView("GET_STATUS"), MsgCmdType::GET_STATUS},
+			{QLatin1StringView("GET_LOG"), MsgCmdType::GET_LOG},
+			{QLatin1StringView("GET_INFO"), MsgCmdType::GET_INFO},
+			{QLatin1StringView("GET_API_LEVEL"), MsgCmdType::GET_API_LEVEL},
+			{QLatin1StringView("SET_API_LEVEL"), MsgCmdType::SET_API_LEVEL},
+			{QLatin1StringView("GET_READER"), MsgCmdType::GET_READER},
+			{QLatin1StringView("GET_READER_LIST"), MsgCmdType::GET_READER_LIST},
+			{QLatin1StringView("RUN_AUTH"), MsgCmdType::RUN_AUTH},
+			{QLatin1StringView("RUN_PERSONALIZATION"), MsgCmdType::RUN_PERSONALIZATION},
+			{QLatin1StringView("RUN_CHANGE_PIN"), MsgCmdType::RUN_CHANGE_PIN},
+			{QLatin1StringView("GET_CERTIFICATE"), MsgCmdType::GET_CERTIFICATE},
+			{QLatin1StringView("GET_ACCESS_RIGHTS"), MsgCmdType::GET_ACCESS_RIGHTS},
+			{QLatin1StringView("SET_ACCESS_RIGHTS"), MsgCmdType::SET_ACCESS_RIGHTS},
+			{QLatin1StringView("SET_CARD"), MsgCmdType::SET_CARD},
+			{QLatin1StringView("SET_PIN"), MsgCmdType::SET_PIN},
+			{QLatin1StringView("SET_NEW_PIN"), MsgCmdType::SET_NEW_PIN},
+			{QLatin1StringView("SET_CAN"), MsgCmdType::SET_CAN},
+			{QLatin1StringView("SET_PUK"), MsgCmdType::SET_PUK},
+			{QLatin1StringView("GET_TRACE"), MsgCmdType::GET_TRACE},
+			{QLatin1StringView("GET_METRICS"), MsgCmdType::GET_METRICS}
+		}};
+
+constexpr size_t cSlotCount = 64;
+static_assert(cCommands.size() < cSlotCount / 2, "Hash table is too small");
+
+
+template<typename T>
+constexpr quint32 hashCommand(const T& pCmd)
+{
+	// FNV-1a
+	quint32 hash = 2166136261U;
+	for (qsizetype i = 0; i < pCmd.size(); ++i)
+	{
+		hash ^= static_cast<quint8>(pCmd[i].unicode());
+		hash *= 16777619U;
+	}
+	return hash;
+}
+
+
+constexpr auto cSlots = [] {
+			std::array<int, cSlotCount> slots {};
+			for (auto& slot : slots)
+			{
+				slot = -1;
+			}
+
+			for (size_t i = 0; i < cCommands.size(); ++i)
+			{
+				auto index = hashCommand(cCommands[i].first) % cSlotCount;
+				while (slots[index] != -1)
+				{
+					index = (index + 1) % cSlotCount;
+				}
+				slots[index] = static_cast<int>(i);
+			}
+			return slots;
+		}();
+
+} // namespace
+
+
+MsgCmdType governikus::getMsgCmdType(QStringView pCmd)
+{
+	for (auto index = hashCommand(pCmd) % cSlotCount; cSlots[index] != -1; index = (index + 1) % cSlotCount)
+	{
+		const auto& [name, type] = cCommands[static_cast<size_t>(cSlots[index])];
+		if (name == pCmd)
+		{
+			return type;
+		}
+	}
+
+	return MsgCmdType::UNDEFINED;
+}
+
+
 #include "moc_MsgTypes.cpp"
@@ -6,6 +6,8 @@
 
 #include "EnumHelper.h"
 
+#include <QStringView>
+
 namespace governikus
 {
 defineEnumType(MsgLevel // See MsgHandler::DEFAULT_MSG_LEVEL
@@ -36,7 +38,9 @@ defineEnumType(MsgType,
 		ENTER_NEW_PIN,
 		ENTER_CAN,
 		ENTER_PUK,
-		PAUSE)
+		PAUSE,
+		TRACE,
+		METRICS)
 
 defineEnumType(MsgCmdType,
 		UNDEFINED,
@@ -61,6 +65,14 @@ defineEnumType(MsgCmdType,
 		SET_PIN,
 		SET_NEW_PIN,
 		SET_CAN,
-		SET_PUK)
+		SET_PUK,
+		GET_TRACE,
+		GET_METRICS)
+
+/*!
+ * Resolves the command name of a request without the meta object system.
+ * Unknown names will be mapped to MsgCmdType::UNDEFINED.
+ */
+[[nodiscard]] MsgCmdType getMsgCmdType(QStringView pCmd);
 
 } // namespace governikus
@@ -0,0 +1,176 @@
+/**
+ * Copyright (c) 2025 Governikus GmbH & Co. KG, Germany
+ */
+
+#include "PortRegistry.h"
+
+#include "PortFile.h"
+
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QHash>
+#include <QLoggingCategory>
+
+#include <algorithm>
+
+
+using namespace governikus;
+
+
+Q_DECLARE_LOGGING_CATEGORY(rproxy)
+
+
+bool PortRegistry::Backend::isHealthy() const
+{
+	return mFailures == 0 || mRetry.hasExpired();
+}
+
+
+PortRegistry::PortRegistry()
+	: QObject()
+	, mWatcher()
+	, mRefreshTimer()
+	, mBackends()
+	, mDirectoryModified()
+	, mDirty(true)
+{
+	mRefreshTimer.setSingleShot(true);
+	mRefreshTimer.setInterval(cRefreshDelay);
+	connect(&mRefreshTimer, &QTimer::timeout, this, &PortRegistry::refresh);
+
+	if (mWatcher.addPath(QDir::tempPath()))
+	{
+		connect(&mWatcher, &QFileSystemWatcher::directoryChanged, this, &PortRegistry::onDirectoryChanged);
+	}
+	else
+	{
+		qCWarning(rproxy) << "Cannot watch port files, check them on every request";
+	}
+}
+
+
+void PortRegistry::onDirectoryChanged()
+{
+	mDirty = true;
+	if (!mRefreshTimer.isActive())
+	{
+		mRefreshTimer.start();
+	}
+}
+
+
+QDateTime PortRegistry::getDirectoryModified()
+{
+	return QFileInfo(QDir::tempPath()).lastModified();
+}
+
+
+bool PortRegistry::isOutdated() const
+{
+	// A notification of the watcher may still be pending, so a single stat
+	// of the directory guards against a missed instance.
+	return mDirty || mWatcher.directories().isEmpty() || getDirectoryModified() != mDirectoryModified;
+}
+
+
+quint16 PortRegistry::readPortFile(const QString& pFile)
+{
+	QFile portfile(pFile);
+	if (portfile.exists() && portfile.open(QIODevice::ReadOnly | QIODevice::Unbuffered))
+	{
+		return static_cast<quint16>(portfile.readAll().toInt());
+	}
+
+	return 0;
+}
+
+
+void PortRegistry::refresh()
+{
+	mRefreshTimer.stop();
+	mDirty = false;
+	mDirectoryModified = getDirectoryModified();
+
+	QHash<QString, Backend> known;
+	for (const auto& backend : std::as_const(mBackends))
+	{
+		known.insert(backend.mFile, backend);
+	}
+
+	QList<Backend> backends;
+	const auto& portFiles = PortFile::getAllPortFiles();
+	for (const auto& portFile : portFiles)
+	{
+		const auto& filename = portFile.absoluteFilePath();
+		const auto& modified = portFile.lastModified();
+
+		const auto entry = known.constFind(filename);
+		if (entry != known.constEnd() && entry->mModified == modified && entry->mPort > 0)
+		{
+			backends << *entry;
+			continue;
+		}
+
+		const auto port = readPortFile(filename);
+		if (port == 0)
+		{
+			qCWarning(rproxy) << "Ignore invalid port file:" << filename;
+		}
+		backends << Backend {filename, modified, port, 0, QDeadlineTimer()};
+	}
+
+	mBackends = backends;
+}
+
+
+QList<quint16> PortRegistry::getPorts(quint16 pLocalPort)
+{
+	if (isOutdated())
+	{
+		refresh();
+	}
+
+	QList<quint16> healthy;
+	QList<quint16> unhealthy;
+	for (auto& backend : mBackends)
+	{
+		if (backend.mPort == 0)
+		{
+			// The port file may have been empty while the instance was writing it.
+			backend.mPort = readPortFile(backend.mFile);
+		}
+
+		if (backend.mPort == 0 || backend.mPort == pLocalPort)
+		{
+			continue;
+		}
+
+		(backend.isHealthy() ? healthy : unhealthy) << backend.mPort;
+	}
+
+	return healthy + unhealthy;
+}
+
+
+void PortRegistry::reportHealth(quint16 pPort, bool pHealthy)
+{
+	for (auto& backend : mBackends)
+	{
+		if (backend.mPort != pPort)
+		{
+			continue;
+		}
+
+		if (pHealthy)
+		{
+			backend.mFailures = 0;
+			continue;
+		}
+
+		++backend.mFailures;
+		const auto retry = std::min(cRetryMax, cRetryMin << std::min(backend.mFailures - 1, 5));
+		backend.mRetry.setRemainingTime(retry);
+		qCDebug(rproxy) << "Instance on port" << pPort << "failed" << backend.mFailures << "times, deprioritize it for" << retry << "ms";
+	}
+}
@@ -0,0 +1,77 @@
+/**
+ * Copyright (c) 2025 Governikus GmbH & Co. KG, Germany
+ */
+
+#pragma once
+
+#include <QDateTime>
+#include <QDeadlineTimer>
+#include <QFileSystemWatcher>
+#include <QList>
+#include <QObject>
+#include <QString>
+#include <QTimer>
+
+
+class test_PortRegistry;
+
+
+namespace governikus
+{
+
+/*!
+ * Routing table of the running instances, based on their port files.
+ * The table is refreshed if the temp directory changes. Port files are
+ * only read again if they were modified.
+ */
+class PortRegistry
+	: public QObject
+{
+	Q_OBJECT
+	friend class Env;
+	friend class ::test_PortRegistry;
+
+	private:
+		struct Backend
+		{
+			QString mFile;
+			QDateTime mModified;
+			quint16 mPort;
+			int mFailures;
+			QDeadlineTimer mRetry;
+
+			[[nodiscard]] bool isHealthy() const;
+		};
+
+		QFileSystemWatcher mWatcher;
+		QTimer mRefreshTimer;
+		QList<Backend> mBackends;
+		QDateTime mDirectoryModified;
+		bool mDirty;
+
+		void refresh();
+		[[nodiscard]] bool isOutdated() const;
+		[[nodiscard]] static quint16 readPortFile(const QString& pFile);
+		[[nodiscard]] static QDateTime getDirectoryModified();
+
+	private Q_SLOTS:
+		void onDirectoryChanged();
+
+	protected:
+		PortRegistry();
+		~PortRegistry() override = default;
+
+	public:
+		static constexpr int cRefreshDelay = 100;
+		static constexpr qint64 cRetryMin = 1000;
+		static constexpr qint64 cRetryMax = 30000;
+
+		/*!
+		 * Returns the ports of all instances except \a pLocalPort. Healthy
+		 * instances are returned first, newest port file first.
+		 */
+		[[nodiscard]] QList<quint16> getPorts(quint16 pLocalPort);
+		void reportHealth(quint16 pPort, bool pHealthy);
+};
+
+} // namespace governikus
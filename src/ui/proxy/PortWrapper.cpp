@@ -14,11 +14,20 @@ bool PortWrapper::isEmpty() const
 }
 
 
+void PortWrapper::confirm() const
+{
+	if (!isEmpty())
+	{
+		reportHealth(mPorts.constFirst(), true);
+	}
+}
+
+
 void PortWrapper::invalidate()
 {
 	if (!isEmpty())
 	{
-		mPorts.removeFirst();
+		reportHealth(mPorts.takeFirst(), false);
 	}
 }
 
@@ -32,3 +41,9 @@ quint16 PortWrapper::fetchPort() const
 
 	return mPorts.constFirst();
 }
+
+
+const QList<quint16>& PortWrapper::getPorts() const
+{
+	return mPorts;
+}
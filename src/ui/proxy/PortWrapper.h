@@ -28,15 +28,17 @@ class PortWrapper
 		static QString getUserOfConnection(const QList<MIB_TCPROW_OWNER_PID>& pConnections, quint16 pLocalPort, quint16 pPeerPort);
 		static QList<MIB_TCPROW_OWNER_PID> getConnections();
 		static quint16 getProcessPort(quint16 pLocalPort, quint16 pPeerPort);
-#else
-		static quint16 readPortFile(const QString& pFile);
 #endif
 
+		static void reportHealth(quint16 pPort, bool pHealthy);
+
 	public:
 		explicit PortWrapper(quint16 pLocalPort, quint16 pPeerPort = 0);
 
 		[[nodiscard]] bool isEmpty() const;
 		[[nodiscard]] quint16 fetchPort() const;
+		[[nodiscard]] const QList<quint16>& getPorts() const;
+		void confirm() const;
 		void invalidate();
 };
 
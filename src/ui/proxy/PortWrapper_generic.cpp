@@ -4,9 +4,9 @@
 
 #include "PortWrapper.h"
 
-#include "PortFile.h"
+#include "Env.h"
+#include "PortRegistry.h"
 
-#include <QFile>
 #include <QLoggingCategory>
 
 
@@ -17,34 +17,15 @@ Q_DECLARE_LOGGING_CATEGORY(rproxy)
 
 
 PortWrapper::PortWrapper(quint16 pLocalPort, quint16 pPeerPort)
-	: mPorts()
+	: mPorts(Env::getSingleton<PortRegistry>()->getPorts(pLocalPort))
 {
 	Q_UNUSED(pPeerPort)
 
-	const auto& portFiles = PortFile::getAllPortFiles();
-	for (const auto& portFile : portFiles)
-	{
-		const auto& filename = portFile.absoluteFilePath();
-		const auto port = readPortFile(filename);
-		if (port > 0 && port != pLocalPort)
-		{
-			mPorts << port;
-		}
-
-		qCWarning(rproxy) << "Ignore invalid port file:" << filename;
-	}
-
 	qCDebug(rproxy) << "Found instances on Ports:" << mPorts;
 }
 
 
-quint16 PortWrapper::readPortFile(const QString& pFile)
+void PortWrapper::reportHealth(quint16 pPort, bool pHealthy)
 {
-	QFile portfile(pFile);
-	if (portfile.exists() && portfile.open(QIODevice::ReadOnly | QIODevice::Unbuffered))
-	{
-		return static_cast<quint16>(portfile.readAll().toInt());
-	}
-
-	return 0;
+	Env::getSingleton<PortRegistry>()->reportHealth(pPort, pHealthy);
 }
@@ -262,3 +262,11 @@ quint16 PortWrapper::getProcessPort(quint16 pLocalPort, quint16 pPeerPort)
 	}
 	return 0;
 }
+
+
+void PortWrapper::reportHealth(quint16 pPort, bool pHealthy)
+{
+	// The ports are resolved from the current connections, there is no routing table to update.
+	Q_UNUSED(pPort)
+	Q_UNUSED(pHealthy)
+}
@@ -39,8 +39,8 @@ void RedirectBroadcast::redirect(const QNetworkDatagram& pDatagram)
 	QUdpSocket socket;
 	socket.setProxy(QNetworkProxy::NoProxy);
 
-	quint16 port = 0;
-	while ((port = mPortWrapper.fetchPort()) > 0)
+	const auto& ports = mPortWrapper.getPorts();
+	for (const auto port : ports)
 	{
 		if (socket.writeDatagram(pDatagram.data(), QHostAddress::LocalHost, port))
 		{
@@ -50,8 +50,6 @@ void RedirectBroadcast::redirect(const QNetworkDatagram& pDatagram)
 		{
 			qCDebug(rproxy) << "Cannot redirect to port:" << port;
 		}
-
-		mPortWrapper.invalidate();
 	}
 
 	deleteLater();
@@ -19,10 +19,20 @@ RedirectRequest::RedirectRequest(const QSharedPointer<HttpRequest>& pRequest, QO
 	: QTcpSocket(pParent)
 	, mRequest(pRequest)
 	, mPortWrapper(pRequest->getLocalPort(), pRequest->getPeerPort())
+	, mConnectTimer()
 	, mAnswerReceived(false)
 {
 	Q_ASSERT(mRequest);
 
+	mConnectTimer.setSingleShot(true);
+	mConnectTimer.setInterval(cConnectTimeout);
+	connect(&mConnectTimer, &QTimer::timeout, this, [this] {
+				qCWarning(rproxy) << "Cannot redirect: connection timed out";
+				abort();
+				mPortWrapper.invalidate();
+				redirect();
+			});
+
 	connect(mRequest.data(), &HttpRequest::fireSocketStateChanged, this, [this](QAbstractSocket::SocketState pSocketState)
 			{
 				if (pSocketState == QAbstractSocket::UnconnectedState)
@@ -34,6 +44,7 @@ RedirectRequest::RedirectRequest(const QSharedPointer<HttpRequest>& pRequest, QO
 	connect(this, &QAbstractSocket::disconnected, this, &QObject::deleteLater);
 
 	connect(this, &QAbstractSocket::errorOccurred, this, [this] {
+				mConnectTimer.stop();
 				if (!isAnswerReceived())
 				{
 					qCWarning(rproxy) << "Cannot redirect:" << error();
@@ -50,6 +61,8 @@ RedirectRequest::RedirectRequest(const QSharedPointer<HttpRequest>& pRequest, QO
 			});
 
 	connect(this, &QAbstractSocket::connected, this, [this] {
+				mConnectTimer.stop();
+				mPortWrapper.confirm();
 				if (qEnvironmentVariableIsSet("AUSWEISAPP2_PROXY_USE_REDIRECT"))
 				{
 					sendHttpRedirect();
@@ -124,6 +137,7 @@ void RedirectRequest::redirect()
 	{
 		qCDebug(rproxy) << "Redirect to port:" << port;
 		connectToHost(QHostAddress::LocalHost, port);
+		mConnectTimer.start();
 	}
 	else
 	{
@@ -9,6 +9,7 @@
 
 #include <QSharedPointer>
 #include <QTcpSocket>
+#include <QTimer>
 
 class test_RedirectRequest;
 
@@ -23,6 +24,7 @@ class RedirectRequest
 	private:
 		QSharedPointer<HttpRequest> mRequest;
 		PortWrapper mPortWrapper;
+		QTimer mConnectTimer;
 		bool mAnswerReceived;
 
 		void sendHttpRedirect();
@@ -31,6 +33,8 @@ class RedirectRequest
 		[[nodiscard]] bool isAnswerReceived() const;
 
 	public:
+		static constexpr int cConnectTimeout = 3000;
+
 		explicit RedirectRequest(const QSharedPointer<HttpRequest>& pRequest, QObject* pParent = nullptr);
 		~RedirectRequest() override;
 };
@@ -5,6 +5,7 @@
 #include "UiPluginProxy.h"
 
 #include "Env.h"
+#include "PortRegistry.h"
 #include "RedirectBroadcast.h"
 #include "RedirectRequest.h"
 
@@ -49,6 +50,11 @@ bool UiPluginProxy::listen()
 			qCWarning(rproxy) << "UDP proxy port failed:" << mServer->getServerPort();
 		}
 
+#ifndef Q_OS_WIN
+		// Build the routing table before the first request arrives.
+		Q_UNUSED(Env::getSingleton<PortRegistry>()->getPorts(mServer->getServerPort()))
+#endif
+
 		Q_EMIT fireUiDominationRequest(this, tr("Reverse proxy plugin is enabled"));
 		return true;
 	}
@@ -79,7 +79,12 @@ ApplicationModel::ApplicationModel()
 #endif
 {
 	const auto* readerManager = Env::getSingleton<ReaderManager>();
-	connect(readerManager, &ReaderManager::fireReaderPropertiesUpdated, this, &ApplicationModel::fireReaderPropertiesUpdated);
+	connect(readerManager, &ReaderManager::fireReaderInfoChanged, this, [this](const ReaderInfo&, ReaderInfo::Changes pChanges){
+				if (pChanges.testFlag(ReaderInfo::MaxApduLengthChanged))
+				{
+					Q_EMIT fireReaderPropertiesUpdated();
+				}
+			});
 	connect(readerManager, &ReaderManager::fireStatusChanged, this, &ApplicationModel::onStatusChanged);
 	connect(readerManager, &ReaderManager::firePluginAdded, this, &ApplicationModel::onStatusChanged);
 	connect(readerManager, &ReaderManager::fireReaderAdded, this, &ApplicationModel::fireAvailableReaderChanged);
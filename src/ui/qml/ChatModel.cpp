@@ -93,7 +93,7 @@ void ChatModel::onAuthenticationDataChanged(QSharedPointer<AccessRightManager> p
 }
 
 
-void ChatModel::setOrderedAllRights(const QSet<AccessRight>& pAllRights)
+void ChatModel::setOrderedAllRights(const AccessRights& pAllRights)
 {
 	for (auto right : AccessRoleAndRightsUtil::allDisplayedOrderedRights())
 	{
@@ -11,7 +11,6 @@
 
 #include <QAbstractListModel>
 #include <QList>
-#include <QSet>
 #include <QSharedPointer>
 #include <QSortFilterProxyModel>
 #include <QtQml/qqmlregistration.h>
@@ -45,8 +44,8 @@ class ChatModel
 	private:
 		QSharedPointer<WorkflowContext> mContext;
 		QList<AccessRight> mAllRights;
-		QSet<AccessRight> mOptionalRights;
-		QSet<AccessRight> mSelectedRights;
+		AccessRights mOptionalRights;
+		AccessRights mSelectedRights;
 		QSortFilterProxyModel mFilterOptionalModel;
 		QSortFilterProxyModel mFilterRequiredModel;
 		QSortFilterProxyModel mFilterReadModel;
@@ -64,7 +63,7 @@ class ChatModel
 		~ChatModel() override = default;
 
 		void initFilterModel(QSortFilterProxyModel& pModel, QAbstractItemModel* pSourceModel, int pFilterRole, const QString& pFilter) const;
-		void setOrderedAllRights(const QSet<AccessRight>& pAllRights);
+		void setOrderedAllRights(const AccessRights& pAllRights);
 
 	private Q_SLOTS:
 		void onAuthenticationDataChanged(QSharedPointer<AccessRightManager> pAccessRightManager);
@@ -43,24 +43,19 @@ void LogFilterModel::onCategoriesChanged()
 
 bool LogFilterModel::filterAcceptsRow(int pSourceRow, const QModelIndex& pSourceParent) const
 {
-	bool levelAccepted = true;
-	bool categoryAccepted = true;
+	Q_UNUSED(pSourceParent)
 
-	if (!mSelectedLevels.isEmpty())
+	if (!mSourceModel)
 	{
-		QModelIndex index = sourceModel()->index(pSourceRow, 0, pSourceParent);
-		QString level = sourceModel()->data(index, LogModel::LogModelRoles::LevelRole).toString();
-		levelAccepted = mSelectedLevels.contains(level);
+		return true;
 	}
 
-	if (!mSelectedCategories.isEmpty())
+	if (!mSelectedLevels.isEmpty() && !mSelectedLevels.contains(mSourceModel->getLevel(pSourceRow)))
 	{
-		QModelIndex index = sourceModel()->index(pSourceRow, 0, pSourceParent);
-		QString category = sourceModel()->data(index, LogModel::LogModelRoles::CategoryRole).toString();
-		categoryAccepted = mSelectedCategories.contains(category);
+		return false;
 	}
 
-	return levelAccepted && categoryAccepted;
+	return mSelectedCategories.isEmpty() || mSelectedCategories.contains(mSourceModel->getCategory(pSourceRow));
 }
 
 
@@ -0,0 +1,260 @@
+/**
+ * Copyright (c) 2025 Governikus GmbH & Co. KG, Germany
+ */
+
+#include "LogIndex.h"
+
+#include "LogHandler.h"
+
+#include <array>
+
+
+using namespace governikus;
+
+
+namespace
+{
+[[nodiscard]] bool isDigit(char pChar)
+{
+	return pChar >= '0' && pChar <= '9';
+}
+
+
+[[nodiscard]] std::array<QString, 26> createLevelNames()
+{
+	std::array<QString, 26> names;
+	for (char c = 'A'; c <= 'Z'; ++c)
+	{
+		names.at(static_cast<size_t>(c - 'A')) = QString(QLatin1Char(c));
+	}
+	return names;
+}
+
+
+[[nodiscard]] const QString& levelName(char pLevel)
+{
+	static const auto names = createLevelNames();
+	return names.at(static_cast<size_t>(pLevel - 'A'));
+}
+
+
+} // namespace
+
+
+LogIndex::LogIndex()
+	: mEntries()
+	, mIndexed(0)
+	, mCategoryNames()
+	, mCategoryIds()
+	, mLevels()
+	, mCategories()
+{
+}
+
+
+bool LogIndex::isHeader(QByteArrayView pLine)
+{
+	// Same as ^[a-z\._ ]{13} \d{4}\.\d{2}\.\d{2} \d{2}:\d{2}:\d{2}\.\d{3} \d{3,} without a QRegularExpression
+	static const QByteArrayView timestamp("dddd.dd.dd dd:dd:dd.ddd ");
+	constexpr qsizetype categoryLength = LogHandler::MAX_CATEGORY_LENGTH;
+
+	if (pLine.size() < categoryLength + 1 + timestamp.size() + 4)
+	{
+		return false;
+	}
+
+	for (qsizetype i = 0; i < categoryLength; ++i)
+	{
+		const char c = pLine.at(i);
+		if ((c < 'a' || c > 'z') && c != '.' && c != '_' && c != ' ')
+		{
+			return false;
+		}
+	}
+
+	if (pLine.at(categoryLength) != ' ')
+	{
+		return false;
+	}
+
+	qsizetype pos = categoryLength + 1;
+	for (const char expected : timestamp)
+	{
+		const char c = pLine.at(pos++);
+		if (expected == 'd' ? !isDigit(c) : c != expected)
+		{
+			return false;
+		}
+	}
+
+	const auto pidStart = pos;
+	while (pos < pLine.size() && isDigit(pLine.at(pos)))
+	{
+		++pos;
+	}
+
+	return pos - pidStart >= 3 && pos < pLine.size() && pLine.at(pos) == ' ';
+}
+
+
+char LogIndex::parseLevel(QByteArrayView pEntry)
+{
+	// Same as the first match of [0-9]{3,} ([A-Z])
+	qsizetype digits = 0;
+	for (qsizetype i = 0; i < pEntry.size(); ++i)
+	{
+		const char c = pEntry.at(i);
+		if (isDigit(c))
+		{
+			++digits;
+			continue;
+		}
+
+		if (digits >= 3 && c == ' ' && i + 2 < pEntry.size())
+		{
+			const char level = pEntry.at(i + 1);
+			if (level >= 'A' && level <= 'Z' && pEntry.at(i + 2) == ' ')
+			{
+				return level;
+			}
+		}
+		digits = 0;
+	}
+
+	return 'D';
+}
+
+
+void LogIndex::classify(Entry& pEntry, QByteArrayView pData)
+{
+	const auto text = pData.sliced(pEntry.mOffset, pEntry.mLength);
+
+	pEntry.mLevel = parseLevel(text);
+	mLevels.insert(levelName(pEntry.mLevel));
+
+	const auto space = text.indexOf(' ');
+	const auto category = space == -1 ? text : text.first(space);
+	auto id = mCategoryIds.value(QByteArray::fromRawData(category.data(), category.size()), -1);
+	if (id == -1)
+	{
+		id = static_cast<int>(mCategoryNames.size());
+		const auto name = QString::fromUtf8(category);
+		mCategoryNames << name;
+		mCategoryIds.insert(category.toByteArray(), id);
+		mCategories.insert(name);
+	}
+	pEntry.mCategory = id;
+}
+
+
+LogIndex::Chunk LogIndex::scan(QByteArrayView pData, bool pFinal) const
+{
+	Chunk chunk;
+	qsizetype pos = mIndexed;
+
+	while (pos < pData.size())
+	{
+		auto end = pData.indexOf('\n', pos);
+		if (end == -1 && !pFinal)
+		{
+			break;
+		}
+
+		const auto next = end == -1 ? pData.size() : end + 1;
+		if (end == -1)
+		{
+			end = pData.size();
+		}
+		if (end > pos && pData.at(end - 1) == '\r')
+		{
+			--end;
+		}
+
+		if (isHeader(pData.sliced(pos, end - pos)) || (chunk.mEntries.isEmpty() && mEntries.isEmpty()))
+		{
+			chunk.mEntries << Entry {pos, end - pos, -1, 'D'};
+		}
+		else if (chunk.mEntries.isEmpty())
+		{
+			chunk.mContinuation = end;
+		}
+		else
+		{
+			auto& entry = chunk.mEntries.last();
+			entry.mLength = end - entry.mOffset;
+		}
+
+		pos = next;
+	}
+
+	chunk.mEnd = pos;
+	return chunk;
+}
+
+
+void LogIndex::commit(const Chunk& pChunk, QByteArrayView pData)
+{
+	if (pChunk.mContinuation != -1 && !mEntries.isEmpty())
+	{
+		auto& last = mEntries.last();
+		last.mLength = pChunk.mContinuation - last.mOffset;
+		classify(last, pData);
+	}
+
+	mEntries.reserve(mEntries.size() + pChunk.mEntries.size());
+	for (auto entry : pChunk.mEntries)
+	{
+		classify(entry, pData);
+		mEntries << entry;
+	}
+
+	mIndexed = pChunk.mEnd;
+}
+
+
+void LogIndex::update(QByteArrayView pData, bool pFinal)
+{
+	commit(scan(pData, pFinal), pData);
+}
+
+
+qsizetype LogIndex::size() const
+{
+	return mEntries.size();
+}
+
+
+QString LogIndex::getText(qsizetype pRow, QByteArrayView pData) const
+{
+	const auto& entry = mEntries.at(pRow);
+	auto text = QString::fromUtf8(pData.sliced(entry.mOffset, entry.mLength));
+	if (text.contains(QLatin1Char('\r')))
+	{
+		text.remove(QLatin1Char('\r'));
+	}
+	return text;
+}
+
+
+const QString& LogIndex::getLevel(qsizetype pRow) const
+{
+	return levelName(mEntries.at(pRow).mLevel);
+}
+
+
+const QString& LogIndex::getCategory(qsizetype pRow) const
+{
+	return mCategoryNames.at(mEntries.at(pRow).mCategory);
+}
+
+
+const QSet<QString>& LogIndex::getLevels() const
+{
+	return mLevels;
+}
+
+
+const QSet<QString>& LogIndex::getCategories() const
+{
+	return mCategories;
+}
@@ -0,0 +1,81 @@
+/**
+ * Copyright (c) 2025 Governikus GmbH & Co. KG, Germany
+ */
+
+#pragma once
+
+#include <QByteArray>
+#include <QByteArrayView>
+#include <QHash>
+#include <QList>
+#include <QSet>
+#include <QString>
+#include <QStringList>
+
+
+class test_LogIndex;
+
+
+namespace governikus
+{
+
+/*!
+ * Index of the entries of a raw log. An entry starts with a line that matches the
+ * message pattern of the LogHandler and includes all following continuation lines.
+ * Only offsets, the level and the category of an entry are stored, the text is
+ * materialised on demand from the raw data.
+ */
+class LogIndex
+{
+	friend class ::test_LogIndex;
+
+	public:
+		struct Entry
+		{
+			qsizetype mOffset;
+			qsizetype mLength;
+			int mCategory;
+			char mLevel;
+		};
+
+		struct Chunk
+		{
+			qsizetype mEnd = 0;
+			qsizetype mContinuation = -1;
+			QList<Entry> mEntries;
+		};
+
+	private:
+		QList<Entry> mEntries;
+		qsizetype mIndexed;
+		QStringList mCategoryNames;
+		QHash<QByteArray, int> mCategoryIds;
+		QSet<QString> mLevels;
+		QSet<QString> mCategories;
+
+		void classify(Entry& pEntry, QByteArrayView pData);
+
+		[[nodiscard]] static bool isHeader(QByteArrayView pLine);
+		[[nodiscard]] static char parseLevel(QByteArrayView pEntry);
+
+	public:
+		LogIndex();
+
+		/*!
+		 * Scans the lines of \a pData that are not indexed yet without modifying
+		 * the index. Apply the result with commit(). A trailing line without a
+		 * line break is left for the next scan unless \a pFinal is set.
+		 */
+		[[nodiscard]] Chunk scan(QByteArrayView pData, bool pFinal = false) const;
+		void commit(const Chunk& pChunk, QByteArrayView pData);
+		void update(QByteArrayView pData, bool pFinal = false);
+
+		[[nodiscard]] qsizetype size() const;
+		[[nodiscard]] QString getText(qsizetype pRow, QByteArrayView pData) const;
+		[[nodiscard]] const QString& getLevel(qsizetype pRow) const;
+		[[nodiscard]] const QString& getCategory(qsizetype pRow) const;
+		[[nodiscard]] const QSet<QString>& getLevels() const;
+		[[nodiscard]] const QSet<QString>& getCategories() const;
+};
+
+} // namespace governikus
@@ -8,11 +8,10 @@
 #include "LogHandler.h"
 
 #include <QDir>
-#include <QFile>
 #include <QFileInfo>
-#include <QRegularExpression>
-#include <QSignalBlocker>
-#include <QtMath>
+#include <QtConcurrent>
+
+#include <utility>
 
 
 Q_DECLARE_LOGGING_CATEGORY(qml)
@@ -23,11 +22,16 @@ using namespace governikus;
 
 LogModel::LogModel()
 	: QAbstractListModel()
-	, mLogEntries()
-	, mLevels()
-	, mCategories()
+	, mLogData()
+	, mMappedFile()
+	, mLogIndex()
+	, mIndexWatcher()
+	, mFileWatcher()
+	, mPendingLogMsgs()
 	, mLogFilePath(QStringLiteral("uninitialized"))
 {
+	connect(&mFileWatcher, &QFileSystemWatcher::fileChanged, this, &LogModel::onMappedFileChanged);
+
 	// initial current log is used
 	setSource(QString());
 }
@@ -35,56 +39,170 @@ LogModel::LogModel()
 
 void LogModel::addLogEntry(const QString& pEntry)
 {
-	const QString re = QStringLiteral(R"(^[a-z\._ ]{%1} \d{4}\.\d{2}\.\d{2} \d{2}:\d{2}:\d{2}\.\d{3} \d{3,} )").arg(LogHandler::MAX_CATEGORY_LENGTH);
-	if (!QRegularExpression(re).match(pEntry).hasMatch() && !mLogEntries.isEmpty())
+	const auto levels = mLogIndex.getLevels().size();
+	const auto categories = mLogIndex.getCategories().size();
+
+	mLogData.append(pEntry.toUtf8());
+	if (!pEntry.endsWith(QLatin1Char('\n')))
 	{
-		mLogEntries.last().append(QLatin1String("\n")).append(pEntry); // clazy:exclude=detaching-member
-		return;
+		mLogData.append('\n');
 	}
 
-	mLogEntries.append(pEntry);
+	const auto chunk = mLogIndex.scan(mLogData);
+	const auto rows = static_cast<int>(mLogIndex.size());
+	const auto newRows = static_cast<int>(chunk.mEntries.size());
+
+	if (newRows > 0)
+	{
+		beginInsertRows(QModelIndex(), rows, rows + newRows - 1);
+	}
+	mLogIndex.commit(chunk, mLogData);
+	if (newRows > 0)
+	{
+		endInsertRows();
+	}
 
-	QModelIndex idx = QAbstractListModel::index(static_cast<int>(mLogEntries.size()) - 1, 0);
+	if (chunk.mContinuation != -1 && rows > 0)
+	{
+		const auto idx = index(rows - 1);
+		Q_EMIT dataChanged(idx, idx);
+	}
 
-	const auto& level = LogModel::data(idx, LogModel::LogModelRoles::LevelRole).toString();
-	if (!mLevels.contains(level))
+	if (mLogIndex.getLevels().size() != levels)
 	{
-		mLevels.insert(level);
 		Q_EMIT fireLevelsChanged();
 	}
 
-	const auto& category = LogModel::data(idx, LogModel::LogModelRoles::CategoryRole).toString();
-	if (!mCategories.contains(category))
+	if (mLogIndex.getCategories().size() != categories)
 	{
-		mCategories.insert(category);
 		Q_EMIT fireCategoriesChanged();
 	}
 }
 
 
-void LogModel::setLogEntries(QTextStream& pTextStream)
+void LogModel::setLogEntries(const QByteArray& pData)
 {
-	beginResetModel();
+	cancelLoading();
+
+	LogIndex logIndex;
+	logIndex.update(pData, true);
+	setLogIndex(pData, QSharedPointer<QFile>(), logIndex);
+}
 
-	mLevels.clear();
-	mCategories.clear();
-	mLogEntries.clear();
 
+void LogModel::loadLogEntries(const QByteArray& pData, const QSharedPointer<QFile>& pFile)
+{
+	cancelLoading();
+
+	if (pData.size() < cAsyncIndexThreshold)
 	{
-		const QSignalBlocker blocker(this);
-		while (!pTextStream.atEnd())
-		{
-			addLogEntry(pTextStream.readLine());
-		}
+		LogIndex logIndex;
+		logIndex.update(pData, true);
+		setLogIndex(pData, pFile, logIndex);
+		return;
 	}
 
+	qCDebug(qml) << "Index log in background:" << pData.size() << "bytes";
+	setLogIndex(QByteArray(), QSharedPointer<QFile>(), LogIndex());
+
+	auto* watcher = new QFutureWatcher<LogIndex>(this);
+	connect(watcher, &QFutureWatcherBase::finished, this, [this, watcher, pData, pFile] {
+				watcher->deleteLater();
+				mIndexWatcher.clear();
+				setLogIndex(pData, pFile, watcher->result());
+
+				const auto pendingLogMsgs = std::exchange(mPendingLogMsgs, QStringList());
+				for (const auto& msg : pendingLogMsgs)
+				{
+					onNewLogMsg(msg);
+				}
+			});
+
+	mIndexWatcher = watcher;
+	// The file is captured as well to keep the mapping alive if the loading is cancelled.
+	watcher->setFuture(QtConcurrent::run([pData, pFile] {
+				Q_UNUSED(pFile)
+				LogIndex logIndex;
+				logIndex.update(pData, true);
+				return logIndex;
+			}));
+}
+
+
+void LogModel::setLogIndex(const QByteArray& pData, const QSharedPointer<QFile>& pFile, const LogIndex& pLogIndex)
+{
+	beginResetModel();
+	mLogData = pData;
+	mMappedFile = pFile;
+	mLogIndex = pLogIndex;
 	endResetModel();
 
+	if (const auto& files = mFileWatcher.files(); !files.isEmpty())
+	{
+		mFileWatcher.removePaths(files);
+	}
+	if (mMappedFile)
+	{
+		mFileWatcher.addPath(mMappedFile->fileName());
+	}
+
 	Q_EMIT fireLevelsChanged();
 	Q_EMIT fireCategoriesChanged();
 }
 
 
+void LogModel::cancelLoading()
+{
+	if (mIndexWatcher)
+	{
+		mIndexWatcher->disconnect(this);
+		mIndexWatcher->deleteLater();
+		mIndexWatcher.clear();
+	}
+
+	mPendingLogMsgs.clear();
+}
+
+
+QByteArray LogModel::mapLogFile(QFile& pFile)
+{
+	const auto size = pFile.size();
+	if (size == 0)
+	{
+		pFile.close();
+		return QByteArray();
+	}
+
+#ifndef Q_OS_WIN
+	// An open or mapped file cannot be deleted or rotated on Windows, so it is read there.
+	if (const auto* data = pFile.map(0, size); data)
+	{
+		return QByteArray::fromRawData(reinterpret_cast<const char*>(data), size);
+	}
+
+	qCDebug(qml) << "Cannot map log, read it instead:" << pFile.errorString();
+#endif
+
+	const auto data = pFile.readAll();
+	pFile.close();
+	return data;
+}
+
+
+void LogModel::onMappedFileChanged()
+{
+	// Accessing a mapping beyond the end of a truncated file raises SIGBUS.
+	if (!mMappedFile || mMappedFile->size() >= mLogData.size())
+	{
+		return;
+	}
+
+	qCWarning(qml) << "Mapped log was truncated, read it instead:" << mMappedFile->fileName();
+	mMappedFile->seek(0);
+	loadLogEntries(mMappedFile->readAll());
+}
+
+
 bool LogModel::isCurrentLog() const
 {
 	return mLogFilePath.isEmpty();
@@ -93,26 +211,49 @@ bool LogModel::isCurrentLog() const
 
 void LogModel::onNewLogMsg(const QString& pMsg)
 {
-	if (isCurrentLog())
+	if (!isCurrentLog())
 	{
-		const auto size = static_cast<int>(mLogEntries.size());
-		beginInsertRows(QModelIndex(), size, size);
-		addLogEntry(pMsg);
-		endInsertRows();
-		Q_EMIT fireNewLogMsg();
+		return;
+	}
+
+	if (isLoading())
+	{
+		mPendingLogMsgs << pMsg;
+		return;
 	}
+
+	addLogEntry(pMsg);
+	Q_EMIT fireNewLogMsg();
 }
 
 
 const QSet<QString>& LogModel::getLevels() const
 {
-	return mLevels;
+	return mLogIndex.getLevels();
 }
 
 
 const QSet<QString>& LogModel::getCategories() const
 {
-	return mCategories;
+	return mLogIndex.getCategories();
+}
+
+
+const QString& LogModel::getLevel(int pRow) const
+{
+	return mLogIndex.getLevel(pRow);
+}
+
+
+const QString& LogModel::getCategory(int pRow) const
+{
+	return mLogIndex.getCategory(pRow);
+}
+
+
+bool LogModel::isLoading() const
+{
+	return !mIndexWatcher.isNull();
 }
 
 
@@ -129,27 +270,23 @@ void LogModel::setSource(const QString& pLogFilePath)
 
 	if (isCurrentLog())
 	{
-		QTextStream in(logHandler->useLogFile() ? logHandler->getBacklog() : tr("The logfile is disabled.").toUtf8());
-		setLogEntries(in);
-		connect(logHandler->getEventHandler(), &LogEventHandler::fireLog, this, &LogModel::onNewLogMsg);
+		loadLogEntries(logHandler->useLogFile() ? logHandler->getBacklog() : tr("The logfile is disabled.").toUtf8());
+		connect(logHandler->getEventHandler(), &LogEventHandler::fireLog, this, &LogModel::onNewLogMsg, Qt::UniqueConnection);
 	}
 	else
 	{
 		disconnect(logHandler->getEventHandler(), &LogEventHandler::fireLog, this, &LogModel::onNewLogMsg);
-		QFile inputFile(mLogFilePath);
-		if (inputFile.open(QIODevice::ReadOnly))
+		const auto inputFile = QSharedPointer<QFile>::create(mLogFilePath);
+		if (inputFile->open(QIODevice::ReadOnly))
 		{
 			qCDebug(qml) << "Loaded log:" << pLogFilePath;
-			QTextStream in(&inputFile);
-			setLogEntries(in);
-			inputFile.close();
+			const auto& logData = mapLogFile(*inputFile);
+			loadLogEntries(logData, inputFile->isOpen() ? inputFile : QSharedPointer<QFile>());
 		}
 		else
 		{
 			qCWarning(qml) << "Load file failed:" << pLogFilePath;
-			QString emptyString;
-			QTextStream stream(&emptyString);
-			setLogEntries(stream);
+			loadLogEntries(QByteArray());
 		}
 	}
 
@@ -200,7 +337,7 @@ QString LogModel::createLogFileName() const
 int LogModel::rowCount(const QModelIndex& pIndex) const
 {
 	Q_UNUSED(pIndex)
-	return static_cast<int>(mLogEntries.size());
+	return static_cast<int>(mLogIndex.size());
 }
 
 
@@ -225,35 +362,24 @@ QVariant LogModel::data(const QModelIndex& pIndex, int pRole) const
 		return QVariant();
 	}
 
-	const auto& logMessage = mLogEntries.at(pIndex.row());
+	const auto row = pIndex.row();
 
 	switch (pRole)
 	{
 		case Qt::DisplayRole:
-			return logMessage;
+			return mLogIndex.getText(row, mLogData);
 
 		case OriginRole:
-			return logMessage.section(splitToken, 0, 0).trimmed();
+			return mLogIndex.getText(row, mLogData).section(splitToken, 0, 0).trimmed();
 
 		case LevelRole:
-		{
-			const QRegularExpression re(QStringLiteral("[0-9]{3,} ([A-Z]) "));
-			const auto& match = re.match(logMessage);
-			if (match.hasMatch())
-			{
-				return match.captured(1);
-			}
-
-			return QStringLiteral("D");
-		}
+			return mLogIndex.getLevel(row);
 
 		case CategoryRole:
-		{
-			return logMessage.left(logMessage.indexOf(QLatin1Char(' ')));
-		}
+			return mLogIndex.getCategory(row);
 
 		case MessageRole:
-			return logMessage.section(splitToken, 1, -1).trimmed();
+			return mLogIndex.getText(row, mLogData).section(splitToken, 1, -1).trimmed();
 
 		default:
 			return QVariant();
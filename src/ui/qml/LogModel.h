@@ -4,14 +4,21 @@
 
 #pragma once
 
+#include "LogIndex.h"
+
 #include <QAbstractListModel>
+#include <QByteArray>
 #include <QDateTime>
+#include <QFile>
+#include <QFileSystemWatcher>
+#include <QFutureWatcher>
 #include <QObject>
 #include <QPoint>
+#include <QPointer>
 #include <QSet>
+#include <QSharedPointer>
 #include <QString>
 #include <QStringList>
-#include <QTextStream>
 #include <QUrl>
 #include <QtQml/qqmlregistration.h>
 
@@ -32,17 +39,25 @@ class LogModel
 	Q_PROPERTY(QString source READ getSource WRITE setSource NOTIFY fireSourceChanged)
 
 	private:
-		QStringList mLogEntries;
-		QSet<QString> mLevels;
-		QSet<QString> mCategories;
+		QByteArray mLogData;
+		QSharedPointer<QFile> mMappedFile;
+		LogIndex mLogIndex;
+		QPointer<QFutureWatcher<LogIndex>> mIndexWatcher;
+		QFileSystemWatcher mFileWatcher;
+		QStringList mPendingLogMsgs;
 		QString mLogFilePath;
 
 		void addLogEntry(const QString& pEntry);
-		void setLogEntries(QTextStream& pTextStream);
+		void setLogEntries(const QByteArray& pData);
+		void loadLogEntries(const QByteArray& pData, const QSharedPointer<QFile>& pFile = QSharedPointer<QFile>());
+		void setLogIndex(const QByteArray& pData, const QSharedPointer<QFile>& pFile, const LogIndex& pLogIndex);
+		void cancelLoading();
+		[[nodiscard]] static QByteArray mapLogFile(QFile& pFile);
 		[[nodiscard]] bool isCurrentLog() const;
 
 	private Q_SLOTS:
 		void onNewLogMsg(const QString& pMsg);
+		void onMappedFileChanged();
 
 	public:
 		enum LogModelRoles
@@ -53,11 +68,16 @@ class LogModel
 			MessageRole
 		};
 
+		static constexpr qsizetype cAsyncIndexThreshold = 1024 * 1024;
+
 		LogModel();
 		~LogModel() override = default;
 
 		[[nodiscard]] const QSet<QString>& getLevels() const;
 		[[nodiscard]] const QSet<QString>& getCategories() const;
+		[[nodiscard]] const QString& getLevel(int pRow) const;
+		[[nodiscard]] const QString& getCategory(int pRow) const;
+		[[nodiscard]] bool isLoading() const;
 		void setSource(const QString& pLogFilePath);
 		[[nodiscard]] QString getSource() const;
 		[[nodiscard]] Q_INVOKABLE bool saveLogFile(const QUrl& pFilename, bool pShowFeedback) const;
@@ -163,6 +163,41 @@ bool ReaderModel::isPcscScanRunning() const
 }
 
 
+bool ReaderModel::isListedPluginType(ReaderManagerPluginType pType)
+{
+	return pType == ReaderManagerPluginType::PCSC || pType == ReaderManagerPluginType::NFC;
+}
+
+
+void ReaderModel::onReaderInfoChanged(const ReaderInfo& pInfo, ReaderInfo::Changes pChanges)
+{
+	// The model only shows the configuration of a reader. It depends on the name
+	// that is fixed per cache entry, so card and PIN updates are irrelevant.
+	if (isListedPluginType(pInfo.getPluginType()) && pChanges.testFlag(ReaderInfo::PluginTypeChanged))
+	{
+		onUpdateContent();
+	}
+}
+
+
+void ReaderModel::onReaderRemoved(const ReaderInfo& pInfo)
+{
+	if (isListedPluginType(pInfo.getPluginType()))
+	{
+		onUpdateContent();
+	}
+}
+
+
+void ReaderModel::onStatusChanged(const ReaderManagerPluginInfo& pInfo)
+{
+	if (pInfo.getPluginType() == ReaderManagerPluginType::PCSC)
+	{
+		onUpdateContent();
+	}
+}
+
+
 void ReaderModel::onUpdateContent()
 {
 	beginResetModel();
@@ -184,9 +219,9 @@ ReaderModel::ReaderModel()
 	, mSortedModel()
 {
 	const ReaderManager* const readerManager = Env::getSingleton<ReaderManager>();
-	connect(readerManager, &ReaderManager::fireReaderAdded, this, &ReaderModel::onUpdateContent);
-	connect(readerManager, &ReaderManager::fireReaderRemoved, this, &ReaderModel::onUpdateContent);
-	connect(readerManager, &ReaderManager::fireStatusChanged, this, &ReaderModel::onUpdateContent);
+	connect(readerManager, &ReaderManager::fireReaderInfoChanged, this, &ReaderModel::onReaderInfoChanged);
+	connect(readerManager, &ReaderManager::fireReaderRemoved, this, &ReaderModel::onReaderRemoved);
+	connect(readerManager, &ReaderManager::fireStatusChanged, this, &ReaderModel::onStatusChanged);
 	connect(Env::getSingleton<ReaderConfiguration>(), &ReaderConfiguration::fireUpdated, this, &ReaderModel::onUpdateContent);
 #if !defined(Q_OS_ANDROID) && !defined(Q_OS_IOS)
 	connect(Env::getSingleton<ReaderDetector>(), &ReaderDetector::fireReaderChangeDetected, this, &ReaderModel::onUpdateContent);
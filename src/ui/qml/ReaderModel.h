@@ -6,6 +6,8 @@
 
 #include "Env.h"
 #include "ReaderConfigurationInfo.h"
+#include "ReaderInfo.h"
+#include "ReaderManagerPluginInfo.h"
 #include "SingletonCreator.h"
 #include "SortedReaderModel.h"
 
@@ -53,9 +55,13 @@ class ReaderModel
 		[[nodiscard]] bool isSupportedReader(const QModelIndex& pIndex) const;
 		[[nodiscard]] bool isInstalledReader(const QModelIndex& pIndex) const;
 		[[nodiscard]] bool isPcscScanRunning() const;
+		[[nodiscard]] static bool isListedPluginType(ReaderManagerPluginType pType);
 
 	private Q_SLOTS:
 		void onUpdateContent();
+		void onReaderInfoChanged(const ReaderInfo& pInfo, ReaderInfo::Changes pChanges);
+		void onReaderRemoved(const ReaderInfo& pInfo);
+		void onStatusChanged(const ReaderManagerPluginInfo& pInfo);
 
 	public:
 		enum UserRoles
@@ -4,6 +4,7 @@
 
 #include "WorkflowModel.h"
 
+#include "ApduTracer.h"
 #include "AppSettings.h"
 #include "ApplicationModel.h"
 #include "Email.h"
@@ -251,6 +252,11 @@ QList<ReaderManagerPluginType> WorkflowModel::getSupportedReaderPluginTypes() co
 		supported.removeOne(ReaderManagerPluginType::SIMULATOR);
 	}
 
+	if (Env::getSingleton<ApduTracer>()->getReplayFiles().isEmpty())
+	{
+		supported.removeOne(ReaderManagerPluginType::REPLAY);
+	}
+
 #if !__has_include("SmartManager.h")
 	supported.removeOne(ReaderManagerPluginType::SMART);
 #endif
@@ -437,7 +443,7 @@ void WorkflowModel::setInitialPluginType()
 	{
 		return;
 	}
-	mContext->setReaderPluginTypes({ReaderManagerPluginType::PCSC, ReaderManagerPluginType::REMOTE_IFD, ReaderManagerPluginType::SIMULATOR});
+	mContext->setReaderPluginTypes({ReaderManagerPluginType::PCSC, ReaderManagerPluginType::REMOTE_IFD, ReaderManagerPluginType::SIMULATOR, ReaderManagerPluginType::REPLAY});
 #endif
 }
 
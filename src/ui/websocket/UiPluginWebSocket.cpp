@@ -9,6 +9,9 @@
 #include "UiLoader.h"
 #include "VolatileSettings.h"
 #include "WorkflowRequest.h"
+#include "context/AuthContext.h"
+#include "context/ChangePinContext.h"
+#include "messages/MsgHandlerBadState.h"
 
 #include <QCoreApplication>
 #include <QFile>
@@ -16,7 +19,8 @@
 #include <QLoggingCategory>
 #include <QPluginLoader>
 #include <QRegularExpression>
-#include <QSignalBlocker>
+
+#include <algorithm>
 
 
 Q_DECLARE_LOGGING_CATEGORY(websocket)
@@ -27,7 +31,10 @@ using namespace governikus;
 UiPluginWebSocket::UiPluginWebSocket()
 	: UiPlugin()
 	, mServer(QCoreApplication::applicationName() + QLatin1Char('/') + QCoreApplication::applicationVersion(), QWebSocketServer::NonSecureMode)
-	, mConnection(nullptr)
+	, mSessions()
+	, mPendingCommands()
+	, mProcessingSession()
+	, mWorkflowOwner()
 	, mRequest()
 	, mJson(nullptr)
 	, mContext()
@@ -69,18 +76,55 @@ bool UiPluginWebSocket::initialize()
 				}
 			});
 	connect(&mServer, &QWebSocketServer::newConnection, this, &UiPluginWebSocket::onNewConnection);
+	connect(mJson.data(), &UiPlugin::fireWorkflowRequested, this, &UiPluginWebSocket::onWorkflowRequested);
 	return true;
 }
 
 
+void UiPluginWebSocket::setReaderEventsEnabled(bool pEnabled)
+{
+	const auto* readerManager = Env::getSingleton<ReaderManager>();
+
+	if (pEnabled)
+	{
+		connect(readerManager, &ReaderManager::fireReaderAdded, this, &UiPluginWebSocket::onReaderEvent, Qt::UniqueConnection);
+		connect(readerManager, &ReaderManager::fireReaderRemoved, this, &UiPluginWebSocket::onReaderEvent, Qt::UniqueConnection);
+		connect(readerManager, &ReaderManager::fireReaderPropertiesUpdated, this, &UiPluginWebSocket::onReaderEvent, Qt::UniqueConnection);
+		connect(readerManager, &ReaderManager::fireCardInserted, this, &UiPluginWebSocket::onCardInserted, Qt::UniqueConnection);
+		connect(readerManager, &ReaderManager::fireCardRemoved, this, &UiPluginWebSocket::onReaderEvent, Qt::UniqueConnection);
+		connect(readerManager, &ReaderManager::fireCardInfoChanged, this, &UiPluginWebSocket::onCardInfoChanged, Qt::UniqueConnection);
+	}
+	else
+	{
+		readerManager->disconnect(this);
+	}
+}
+
+
 void UiPluginWebSocket::onWorkflowStarted(const QSharedPointer<WorkflowRequest>& pRequest)
 {
-	if (mUiDomination)
+	if (!mUiDomination)
+	{
+		return;
+	}
+
+	mContext = pRequest->getContext();
+	mContext->claim(this);
+	mContext->setReaderPluginTypes({ReaderManagerPluginType::PCSC, ReaderManagerPluginType::REMOTE_IFD, ReaderManagerPluginType::SIMULATOR, ReaderManagerPluginType::REPLAY});
+
+	if (!mWorkflowOwner)
+	{
+		qCWarning(websocket) << "Workflow started without an owning session";
+		return;
+	}
+
+	if (mContext.objectCast<AuthContext>() || mContext.objectCast<ChangePinContext>())
 	{
-		mContext = pRequest->getContext();
-		mContext->claim(this);
-		mContext->setReaderPluginTypes({ReaderManagerPluginType::PCSC, ReaderManagerPluginType::REMOTE_IFD, ReaderManagerPluginType::SIMULATOR});
+		connect(mContext.data(), &WorkflowContext::fireStateChanged, this, &UiPluginWebSocket::onStateChanged);
+		connect(mContext.data(), &WorkflowContext::fireProgressChanged, this, &UiPluginWebSocket::onProgressChanged);
 	}
+
+	mWorkflowOwner->send(mWorkflowOwner->getDispatcher().init(mContext));
 }
 
 
@@ -88,7 +132,27 @@ void UiPluginWebSocket::onWorkflowFinished(const QSharedPointer<WorkflowRequest>
 {
 	Q_UNUSED(pRequest)
 
+	if (mWorkflowOwner && mContext)
+	{
+		mWorkflowOwner->send(mWorkflowOwner->getDispatcher().finish());
+	}
+
+	mWorkflowOwner.clear();
 	mContext.clear();
+	processPendingCommands();
+}
+
+
+void UiPluginWebSocket::onWorkflowUnhandled(const QSharedPointer<WorkflowRequest>& pRequest)
+{
+	Q_UNUSED(pRequest)
+
+	if (mWorkflowOwner && !mContext)
+	{
+		qCDebug(websocket) << "Workflow of session" << mWorkflowOwner.data() << "was not started";
+		mWorkflowOwner.clear();
+		processPendingCommands();
+	}
 }
 
 
@@ -101,19 +165,22 @@ void UiPluginWebSocket::onUiDomination(const UiPlugin* pUi, const QString& pInfo
 		return;
 	}
 
+	const auto request = mRequest;
+	mRequest.reset();
+
 	if (pAccepted)
 	{
-		Q_ASSERT(!mConnection);
+		Q_ASSERT(mSessions.isEmpty());
 		mUiDomination = true;
 		mUiDominationPrevUsedAsSDK = Env::getSingleton<VolatileSettings>()->isUsedAsSDK();
 		Env::getSingleton<VolatileSettings>()->setUsedAsSDK(true);
 		Env::getSingleton<ReaderManager>()->startScanAll();
-		mServer.handleConnection(mRequest->take());
+		setReaderEventsEnabled(true);
+		mServer.handleConnection(request->take());
 	}
 	else
 	{
-		mRequest->send(HTTP_STATUS_CONFLICT);
-		mRequest.reset();
+		request->send(HTTP_STATUS_CONFLICT);
 	}
 }
 
@@ -123,7 +190,7 @@ void UiPluginWebSocket::onUiDominationReleased()
 	if (mUiDomination)
 	{
 		mUiDomination = false;
-		mJson->setEnabled(false);
+		setReaderEventsEnabled(false);
 		Env::getSingleton<ReaderManager>()->stopScanAll();
 		Env::getSingleton<VolatileSettings>()->setUsedAsSDK(mUiDominationPrevUsedAsSDK);
 	}
@@ -135,87 +202,218 @@ void UiPluginWebSocket::onNewWebSocketRequest(const QSharedPointer<HttpRequest>&
 	const auto& url = pRequest->getUrl();
 
 	const QRegularExpression path(QStringLiteral("^/eID-Kernel(/)?$"));
-	if (!path.match(url.path()).hasMatch())
+	if (!path.match(url.path()).hasMatch() && !WebSocketSession::isReadOnlyPath(url.path()))
 	{
-		qCDebug(websocket) << "Request path not supported! Use /eID-Kernel";
+		qCDebug(websocket) << "Request path not supported! Use /eID-Kernel or /eID-Kernel/observe";
 		pRequest->send(HTTP_STATUS_NOT_FOUND);
 		return;
 	}
 
-	if (mRequest)
+	if (mRequest || mSessions.size() >= cMaxSessions)
 	{
-		qCDebug(websocket) << "Client is already connected...";
+		qCDebug(websocket) << "Too many clients are connected...";
 		pRequest->send(HTTP_STATUS_TOO_MANY_REQUESTS);
 		return;
 	}
 
+	if (mUiDomination)
+	{
+		mServer.handleConnection(pRequest->take());
+		return;
+	}
+
 	mRequest = pRequest;
-	Q_EMIT fireUiDominationRequest(this, QString::fromLatin1(pRequest->getHeader().value(QByteArrayLiteral("user-agent"))).toHtmlEscaped());
+	Q_EMIT fireUiDominationRequest(this, QString::fromLatin1(pRequest->getHeader(QByteArrayLiteral("user-agent"))).toHtmlEscaped());
 }
 
 
 void UiPluginWebSocket::onNewConnection()
 {
-	if (mServer.hasPendingConnections())
+	while (mServer.hasPendingConnections())
 	{
-		mConnection.reset(mServer.nextPendingConnection());
-		connect(mJson, &UiPluginJson::fireMessage, this, &UiPluginWebSocket::onJsonMessage);
-		connect(mConnection.data(), &QWebSocket::textMessageReceived, this, &UiPluginWebSocket::onTextMessageReceived);
-		connect(mConnection.data(), &QWebSocket::disconnected, this, &UiPluginWebSocket::onClientDisconnected);
-		mJson->setEnabled();
+		auto* session = new WebSocketSession(mServer.nextPendingConnection(), this);
+		connect(session, &WebSocketSession::fireCommand, this, &UiPluginWebSocket::onSessionCommand);
+		connect(session, &WebSocketSession::fireDisconnected, this, &UiPluginWebSocket::onSessionDisconnected);
+		mSessions << session;
 	}
-	else
+
+	if (mSessions.isEmpty())
 	{
-		mConnection.reset();
-		mRequest.reset();
 		Q_EMIT fireUiDominationRelease();
 	}
 }
 
 
-void UiPluginWebSocket::onClientDisconnected()
+void UiPluginWebSocket::onSessionCommand(WebSocketSession* pSession, const QJsonObject& pObj, MsgCmdType pType)
 {
-	qCDebug(websocket) << "Client disconnected...";
+	const bool busy = mContext || mWorkflowOwner;
+	if (!WebSocketSession::isWorkflowCommand(pType) || !busy || pSession == mWorkflowOwner)
+	{
+		processCommand(pSession, pObj, pType);
+		return;
+	}
 
-	if (mContext && mUiDomination)
+	if (isPending(pSession))
 	{
-		const QSignalBlocker blocker(mJson);
-		mContext->killWorkflow();
+		qCDebug(websocket) << "Session" << pSession << "has already enqueued a workflow";
+		MsgHandlerBadState msg(pType);
+		msg.setRequest(pObj);
+		pSession->send(Msg(msg));
+		return;
 	}
 
-	mConnection.reset();
-	mRequest.reset();
-	disconnect(mJson, &UiPluginJson::fireMessage, this, &UiPluginWebSocket::onJsonMessage);
-	Q_EMIT fireUiDominationRelease();
+	qCDebug(websocket) << "Enqueue" << pType << "of session" << pSession << "| Waiting:" << mPendingCommands.size();
+	mPendingCommands << PendingCommand {pSession, pObj, pType};
+}
+
+
+void UiPluginWebSocket::processCommand(WebSocketSession* pSession, const QJsonObject& pObj, MsgCmdType pType)
+{
+	if (WebSocketSession::isWorkflowCommand(pType))
+	{
+		mProcessingSession = pSession;
+		pSession->process(pObj);
+		mProcessingSession.clear();
+		return;
+	}
+
+	pSession->process(pObj);
+}
+
+
+void UiPluginWebSocket::processPendingCommands()
+{
+	while (!mWorkflowOwner && !mContext && !mPendingCommands.isEmpty())
+	{
+		const auto pending = mPendingCommands.takeFirst();
+		if (pending.mSession)
+		{
+			processCommand(pending.mSession, pending.mCommand, pending.mType);
+		}
+	}
+}
+
+
+bool UiPluginWebSocket::isPending(const WebSocketSession* pSession) const
+{
+	return std::any_of(mPendingCommands.cbegin(), mPendingCommands.cend(), [pSession](const auto& pPending){
+				return pPending.mSession == pSession;
+			});
+}
+
+
+void UiPluginWebSocket::onWorkflowRequested()
+{
+	if (mProcessingSession)
+	{
+		mWorkflowOwner = mProcessingSession;
+	}
+}
+
+
+void UiPluginWebSocket::onSessionDisconnected(WebSocketSession* pSession)
+{
+	qCDebug(websocket) << "Client disconnected..." << pSession;
+
+	mSessions.removeAll(pSession);
+	mPendingCommands.removeIf([pSession](const auto& pPending){
+				return pPending.mSession == pSession;
+			});
+
+	if (pSession == mWorkflowOwner)
+	{
+		mWorkflowOwner.clear();
+		if (mContext && mUiDomination)
+		{
+			mContext->killWorkflow();
+		}
+	}
+
+	pSession->deleteLater();
+
+	if (mSessions.isEmpty())
+	{
+		Q_EMIT fireUiDominationRelease();
+	}
+}
+
+
+void UiPluginWebSocket::onStateChanged(const QString& pNewState)
+{
+	if (mWorkflowOwner)
+	{
+		mWorkflowOwner->send(mWorkflowOwner->getDispatcher().processStateChange(pNewState));
+	}
+}
+
+
+void UiPluginWebSocket::onProgressChanged()
+{
+	if (!mWorkflowOwner)
+	{
+		return;
+	}
+
+	const QByteArray msg = mWorkflowOwner->getDispatcher().processProgressChange();
+	mWorkflowOwner->send(msg);
+
+	for (auto* session : std::as_const(mSessions))
+	{
+		if (session->isReadOnly() && session->getDispatcher().getApiLevel() > MsgLevel::v1)
+		{
+			session->send(msg);
+		}
+	}
+}
+
+
+void UiPluginWebSocket::onReaderEvent(const ReaderInfo& pInfo)
+{
+	for (auto* session : std::as_const(mSessions))
+	{
+		const auto& messages = session->getDispatcher().processReaderChange(pInfo);
+		for (const auto& msg : messages)
+		{
+			session->send(msg);
+		}
+	}
 }
 
 
-void UiPluginWebSocket::onTextMessageReceived(const QString& pMessage)
+void UiPluginWebSocket::onCardInserted(const ReaderInfo& pInfo)
 {
-	if (mConnection)
+	for (auto* session : std::as_const(mSessions))
 	{
-		mJson->doMessageProcessing(pMessage.toUtf8());
+		if (pInfo.hasEid() || (pInfo.hasCard() && session->getDispatcher().getApiLevel() > MsgLevel::v2))
+		{
+			const auto& messages = session->getDispatcher().processReaderChange(pInfo);
+			for (const auto& msg : messages)
+			{
+				session->send(msg);
+			}
+		}
 	}
 }
 
 
-void UiPluginWebSocket::onJsonMessage(const QByteArray& pMessage)
+void UiPluginWebSocket::onCardInfoChanged(const ReaderInfo& pInfo)
 {
-	if (mConnection)
+	if (pInfo.hasEid())
 	{
-		mConnection->sendTextMessage(QString::fromUtf8(pMessage));
+		onReaderEvent(pInfo);
 	}
 }
 
 
 void UiPluginWebSocket::doShutdown()
 {
-	if (mConnection)
+	mPendingCommands.clear();
+	for (auto* session : std::as_const(mSessions))
 	{
-		mConnection->close(QWebSocketProtocol::CloseCodeGoingAway);
-		mConnection->disconnect(this);
-		mConnection.reset();
+		session->close(QWebSocketProtocol::CloseCodeGoingAway);
+		session->deleteLater();
 	}
+	mSessions.clear();
 
 	if (mHttpServer)
 	{
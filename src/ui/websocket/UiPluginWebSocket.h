@@ -8,13 +8,18 @@
 #include "HttpServer.h"
 #include "UiPlugin.h"
 #include "UiPluginJson.h"
+#include "WebSocketSession.h"
 
 #include <QDir>
-#include <QMap>
-#include <QScopedPointer>
-#include <QWebSocket>
+#include <QJsonObject>
+#include <QList>
+#include <QPointer>
 #include <QWebSocketServer>
 
+
+class test_UiPluginWebSocket;
+
+
 namespace governikus
 {
 
@@ -24,30 +29,54 @@ class UiPluginWebSocket
 	Q_OBJECT
 	Q_PLUGIN_METADATA(IID "governikus.UiPlugin" FILE "metadata.json")
 	Q_INTERFACES(governikus::UiPlugin)
+	friend class ::test_UiPluginWebSocket;
 
 	private:
+		struct PendingCommand
+		{
+			QPointer<WebSocketSession> mSession;
+			QJsonObject mCommand;
+			MsgCmdType mType;
+		};
+
 		QSharedPointer<HttpServer> mHttpServer;
 		QWebSocketServer mServer;
-		QScopedPointer<QWebSocket, QScopedPointerDeleteLater> mConnection;
+		QList<WebSocketSession*> mSessions;
+		QList<PendingCommand> mPendingCommands;
+		QPointer<WebSocketSession> mProcessingSession;
+		QPointer<WebSocketSession> mWorkflowOwner;
 		QSharedPointer<HttpRequest> mRequest;
 		QPointer<UiPluginJson> mJson;
 		QSharedPointer<WorkflowContext> mContext;
 		bool mUiDomination;
 		bool mUiDominationPrevUsedAsSDK;
 
+		void setReaderEventsEnabled(bool pEnabled);
+		void processCommand(WebSocketSession* pSession, const QJsonObject& pObj, MsgCmdType pType);
+		void processPendingCommands();
+		[[nodiscard]] bool isPending(const WebSocketSession* pSession) const;
+
 	private Q_SLOTS:
 		void doShutdown() override;
 		void onWorkflowStarted(const QSharedPointer<WorkflowRequest>& pRequest) override;
 		void onWorkflowFinished(const QSharedPointer<WorkflowRequest>& pRequest) override;
+		void onWorkflowUnhandled(const QSharedPointer<WorkflowRequest>& pRequest) override;
 		void onUiDomination(const UiPlugin* pUi, const QString& pInformation, bool pAccepted) override;
 		void onUiDominationReleased() override;
 		void onNewWebSocketRequest(const QSharedPointer<HttpRequest>& pRequest);
 		void onNewConnection();
-		void onClientDisconnected();
-		void onTextMessageReceived(const QString& pMessage);
-		void onJsonMessage(const QByteArray& pMessage);
+		void onSessionCommand(WebSocketSession* pSession, const QJsonObject& pObj, MsgCmdType pType);
+		void onSessionDisconnected(WebSocketSession* pSession);
+		void onWorkflowRequested();
+		void onStateChanged(const QString& pNewState);
+		void onProgressChanged();
+		void onReaderEvent(const ReaderInfo& pInfo);
+		void onCardInserted(const ReaderInfo& pInfo);
+		void onCardInfoChanged(const ReaderInfo& pInfo);
 
 	public:
+		static constexpr int cMaxSessions = 16;
+
 		UiPluginWebSocket();
 		~UiPluginWebSocket() override = default;
 
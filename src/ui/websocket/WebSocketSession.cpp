@@ -0,0 +1,168 @@
+/**
+ * Copyright (c) 2025 Governikus GmbH & Co. KG, Germany
+ */
+
+#include "WebSocketSession.h"
+
+#include "messages/MsgHandlerBadState.h"
+
+#include <QJsonDocument>
+#include <QLoggingCategory>
+#include <QRegularExpression>
+
+
+Q_DECLARE_LOGGING_CATEGORY(websocket)
+
+using namespace governikus;
+
+
+bool WebSocketSession::isReadOnlyPath(const QString& pPath)
+{
+	static const QRegularExpression path(QStringLiteral("^/eID-Kernel/observe(/)?$"));
+	return path.match(pPath).hasMatch();
+}
+
+
+bool WebSocketSession::isWorkflowCommand(MsgCmdType pType)
+{
+	switch (pType)
+	{
+		case MsgCmdType::RUN_AUTH:
+		case MsgCmdType::RUN_PERSONALIZATION:
+		case MsgCmdType::RUN_CHANGE_PIN:
+			return true;
+
+		default:
+			return false;
+	}
+}
+
+
+bool WebSocketSession::isReadOnlyCommand(MsgCmdType pType)
+{
+	switch (pType)
+	{
+		case MsgCmdType::UNDEFINED:
+		case MsgCmdType::GET_INFO:
+		case MsgCmdType::GET_API_LEVEL:
+		case MsgCmdType::SET_API_LEVEL:
+		case MsgCmdType::GET_READER:
+		case MsgCmdType::GET_READER_LIST:
+		case MsgCmdType::GET_STATUS:
+		// Metrics only contain counts and durations of readers, states and workflows.
+		case MsgCmdType::GET_METRICS:
+			return true;
+
+		default:
+			return false;
+	}
+}
+
+
+WebSocketSession::WebSocketSession(QWebSocket* pConnection, QObject* pParent)
+	: QObject(pParent)
+	, mConnection(pConnection)
+	, mMessageDispatcher()
+	, mReadOnly(isReadOnlyPath(pConnection->requestUrl().path()))
+	, mPendingBytes(0)
+	, mSlowConsumer(false)
+{
+	connect(mConnection.data(), &QWebSocket::textMessageReceived, this, &WebSocketSession::onTextMessageReceived);
+	connect(mConnection.data(), &QWebSocket::bytesWritten, this, &WebSocketSession::onBytesWritten);
+	connect(mConnection.data(), &QWebSocket::disconnected, this, [this] {
+				Q_EMIT fireDisconnected(this);
+			});
+
+	qCDebug(websocket) << "New session" << this << "| Read-only:" << mReadOnly;
+}
+
+
+bool WebSocketSession::isReadOnly() const
+{
+	return mReadOnly;
+}
+
+
+qint64 WebSocketSession::getPendingBytes() const
+{
+	return mPendingBytes;
+}
+
+
+MessageDispatcher& WebSocketSession::getDispatcher()
+{
+	return mMessageDispatcher;
+}
+
+
+void WebSocketSession::onTextMessageReceived(const QString& pMessage)
+{
+	const auto& data = pMessage.toUtf8();
+
+	QJsonParseError jsonError {};
+	const auto& json = QJsonDocument::fromJson(data, &jsonError);
+	if (jsonError.error != QJsonParseError::NoError)
+	{
+		send(mMessageDispatcher.processCommand(data));
+		return;
+	}
+
+	const auto& obj = json.object();
+	const auto type = getMsgCmdType(obj.value(QLatin1String("cmd")).toString());
+	if (mReadOnly && !isReadOnlyCommand(type))
+	{
+		qCDebug(websocket) << "Command not allowed on read-only session:" << type;
+		MsgHandlerBadState msg(type);
+		msg.setRequest(obj);
+		send(Msg(msg));
+		return;
+	}
+
+	Q_EMIT fireCommand(this, obj, type);
+}
+
+
+void WebSocketSession::onBytesWritten(qint64 pBytes)
+{
+	mPendingBytes = qMax<qint64>(0, mPendingBytes - pBytes);
+}
+
+
+void WebSocketSession::process(const QJsonObject& pObj)
+{
+	const auto& msg = mMessageDispatcher.processCommand(pObj);
+	send(msg, msg != MsgType::LOG);
+}
+
+
+void WebSocketSession::send(const QByteArray& pMessage, bool pLogging)
+{
+	if (pMessage.isEmpty() || !mConnection || mSlowConsumer)
+	{
+		return;
+	}
+
+	if (mPendingBytes + pMessage.size() > cMaxPendingBytes)
+	{
+		qCWarning(websocket) << "Client does not consume messages, disconnecting session" << this << "| Pending bytes:" << mPendingBytes;
+		mSlowConsumer = true;
+		QMetaObject::invokeMethod(mConnection.data(), &QWebSocket::abort, Qt::QueuedConnection);
+		return;
+	}
+
+	if (Q_LIKELY(pLogging))
+	{
+		qCDebug(websocket).noquote() << "Fire message:" << pMessage;
+	}
+	mPendingBytes += mConnection->sendTextMessage(QString::fromUtf8(pMessage));
+}
+
+
+void WebSocketSession::close(QWebSocketProtocol::CloseCode pCode)
+{
+	if (mConnection)
+	{
+		mConnection->close(pCode);
+		mConnection->disconnect(this);
+	}
+}
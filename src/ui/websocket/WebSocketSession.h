@@ -0,0 +1,60 @@
+/**
+ * Copyright (c) 2025 Governikus GmbH & Co. KG, Germany
+ */
+
+#pragma once
+
+#include "MessageDispatcher.h"
+
+#include <QJsonObject>
+#include <QScopedPointer>
+#include <QWebSocket>
+
+
+class test_WebSocketSession;
+
+
+namespace governikus
+{
+
+class WebSocketSession
+	: public QObject
+{
+	Q_OBJECT
+	friend class ::test_WebSocketSession;
+
+	private:
+		QScopedPointer<QWebSocket, QScopedPointerDeleteLater> mConnection;
+		MessageDispatcher mMessageDispatcher;
+		const bool mReadOnly;
+		qint64 mPendingBytes;
+		bool mSlowConsumer;
+
+	private Q_SLOTS:
+		void onTextMessageReceived(const QString& pMessage);
+		void onBytesWritten(qint64 pBytes);
+
+	public:
+		static constexpr qint64 cMaxPendingBytes = 4 * 1024 * 1024;
+
+		static bool isReadOnlyPath(const QString& pPath);
+		static bool isWorkflowCommand(MsgCmdType pType);
+		static bool isReadOnlyCommand(MsgCmdType pType);
+
+		explicit WebSocketSession(QWebSocket* pConnection, QObject* pParent = nullptr);
+		~WebSocketSession() override = default;
+
+		[[nodiscard]] bool isReadOnly() const;
+		[[nodiscard]] qint64 getPendingBytes() const;
+		[[nodiscard]] MessageDispatcher& getDispatcher();
+
+		void process(const QJsonObject& pObj);
+		void send(const QByteArray& pMessage, bool pLogging = true);
+		void close(QWebSocketProtocol::CloseCode pCode = QWebSocketProtocol::CloseCodeGoingAway);
+
+	Q_SIGNALS:
+		void fireCommand(WebSocketSession* pSession, const QJsonObject& pObj, MsgCmdType pType);
+		void fireDisconnected(WebSocketSession* pSession);
+};
+
+} // namespace governikus
@@ -83,21 +83,21 @@ AccessRightManager::AccessRightManager(QSharedPointer<CHAT> pRequiredChat)
 }
 
 
-void AccessRightManager::removeForbiddenAccessRights(QSet<AccessRight>& pAccessRights)
+void AccessRightManager::removeForbiddenAccessRights(AccessRights& pAccessRights)
 {
 	if (!mTerminalCvc)
 	{
 		return;
 	}
 
-	const auto& allowedCvcAccessRights = mTerminalCvc->getBody().getCHAT().getAccessRights();
+	const auto allowedCvcAccessRights = mTerminalCvc->getBody().getCHAT().getAccessRights();
 
 	const auto& rights = AccessRoleAndRightsUtil::allDisplayedOrderedRights();
-	const auto& allDisplayedOrderedRights = QSet<AccessRight>(rights.constBegin(), rights.constEnd());
-	const auto& allowedAccessRights = allowedCvcAccessRights & allDisplayedOrderedRights;
+	const AccessRights allDisplayedOrderedRights(rights.constBegin(), rights.constEnd());
+	const auto allowedAccessRights = allowedCvcAccessRights & allDisplayedOrderedRights;
 
 	const auto rightsToCheck = pAccessRights;
-	for (const AccessRight& accessRight : rightsToCheck)
+	for (const auto accessRight : rightsToCheck)
 	{
 		if (allowedAccessRights.contains(accessRight))
 		{
@@ -160,10 +160,10 @@ void AccessRightManager::operator-=(AccessRight pAccessRight)
 }
 
 
-void AccessRightManager::operator=(const QSet<AccessRight>& pAccessRights)
+void AccessRightManager::operator=(const AccessRights& pAccessRights)
 {
 	mEffectiveAccessRights = mRequiredAccessRights;
-	for (const auto& effectiveRight : pAccessRights)
+	for (const auto effectiveRight : pAccessRights)
 	{
 		const QSignalBlocker blocker(this);
 		*this += effectiveRight;
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include "asn1/AccessRights.h"
 #include "asn1/CVCertificate.h"
 #include "paos/retrieve/DidAuthenticateEac1.h"
 
@@ -34,19 +35,19 @@ class AccessRightManager
 		}
 
 
-		[[nodiscard]] const QSet<AccessRight>& getOptionalAccessRights() const
+		[[nodiscard]] const AccessRights& getOptionalAccessRights() const
 		{
 			return mOptionalAccessRights;
 		}
 
 
-		[[nodiscard]] const QSet<AccessRight>& getRequiredAccessRights() const
+		[[nodiscard]] const AccessRights& getRequiredAccessRights() const
 		{
 			return mRequiredAccessRights;
 		}
 
 
-		[[nodiscard]] const QSet<AccessRight>& getEffectiveAccessRights() const
+		[[nodiscard]] const AccessRights& getEffectiveAccessRights() const
 		{
 			return mEffectiveAccessRights;
 		}
@@ -54,7 +55,7 @@ class AccessRightManager
 
 		void operator+=(AccessRight pAccessRight);
 		void operator-=(AccessRight pAccessRight);
-		void operator=(const QSet<AccessRight>& pAccessRights);
+		void operator=(const AccessRights& pAccessRights);
 		operator QByteArray() const;
 
 	Q_SIGNALS:
@@ -63,11 +64,11 @@ class AccessRightManager
 	private:
 		QSharedPointer<const CVCertificate> mTerminalCvc;
 		QSharedPointer<DIDAuthenticateEAC1> mDIDAuthenticateEAC1;
-		QSet<AccessRight> mOptionalAccessRights;
-		QSet<AccessRight> mEffectiveAccessRights;
-		QSet<AccessRight> mRequiredAccessRights;
+		AccessRights mOptionalAccessRights;
+		AccessRights mEffectiveAccessRights;
+		AccessRights mRequiredAccessRights;
 
-		void removeForbiddenAccessRights(QSet<AccessRight>& pAccessRights);
+		void removeForbiddenAccessRights(AccessRights& pAccessRights);
 };
 
 } // namespace governikus
@@ -4,6 +4,10 @@
 
 #include "controller/WorkflowController.h"
 
+#include "Env.h"
+#include "Metrics.h"
+#include "Tracer.h"
+
 
 using namespace governikus;
 
@@ -13,10 +17,18 @@ WorkflowController::WorkflowController(const QSharedPointer<WorkflowContext>& pC
 	, mContext(pContext)
 {
 	connect(&mStateMachine, &QStateMachine::finished, this, &WorkflowController::fireComplete, Qt::QueuedConnection);
+	connect(&mStateMachine, &QStateMachine::finished, this, [this] {
+				Env::getSingleton<Tracer>()->finishTrace();
+				Env::getSingleton<Metrics>()->increment(Metric::WORKFLOWS, {
+							{QLatin1StringView("workflow"), Enum<Action>::getName(mContext->getAction())},
+							{QLatin1StringView("status"), Enum<GlobalStatus::Code>::getName(mContext->getStatus().getStatusCode())}
+						});
+			});
 }
 
 
 void WorkflowController::run()
 {
+	Env::getSingleton<Tracer>()->startTrace(Enum<Action>::getName(mContext->getAction()));
 	mStateMachine.start();
 }
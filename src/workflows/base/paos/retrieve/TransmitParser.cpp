@@ -4,6 +4,8 @@
 
 #include "TransmitParser.h"
 
+#include "HexCodec.h"
+
 #include <QDebug>
 #include <QLoggingCategory>
 
@@ -90,7 +92,15 @@ void TransmitParser::parseInputApduInfo()
 		return;
 	}
 
-	inputApduInfo.setInputApdu(QByteArray::fromHex(inputApdu.toUtf8()));
+	const auto& apdu = hex::decode(QStringView(inputApdu).trimmed());
+	if (!apdu.has_value())
+	{
+		qCWarning(paos) << "InputAPDU is no valid hex string";
+		setParserFailed();
+		return;
+	}
+
+	inputApduInfo.setInputApdu(*apdu);
 
 	mTransmit->appendInputApduInfo(inputApduInfo);
 }
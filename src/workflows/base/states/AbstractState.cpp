@@ -5,6 +5,7 @@
 #include "AbstractState.h"
 
 #include "ReaderManager.h"
+#include "Tracer.h"
 #if defined(Q_OS_IOS)
 	#include "VolatileSettings.h"
 #endif
@@ -25,6 +26,7 @@ AbstractState::AbstractState(const QSharedPointer<WorkflowContext>& pContext)
 	, mAbortOnCardRemoved(false)
 	, mHandleNfcStop(false)
 	, mKeepCardConnectionAlive(false)
+	, mEnteredTime(-1)
 {
 	Q_ASSERT(mContext);
 	connect(this, &AbstractState::fireAbort, this, &AbstractState::onAbort);
@@ -70,6 +72,11 @@ void AbstractState::onStateApprovedChanged(bool pApproved)
 {
 	if (pApproved)
 	{
+		// The state waits for the approval of the UI, i.e. for user input.
+		if (mEnteredTime >= 0 && Env::getSingleton<Tracer>()->isTracing())
+		{
+			Env::getSingleton<Tracer>()->addSpan(QLatin1String("user"), getStateName(), mEnteredTime);
+		}
 		qCDebug(statemachine) << "Running state" << getStateName();
 		run();
 	}
@@ -104,6 +111,7 @@ void AbstractState::onEntry(QEvent* pEvent)
 
 	qCDebug(statemachine) << "Next state is" << getStateName();
 	mContext->setCurrentState(getStateName());
+	mEnteredTime = Env::getSingleton<Tracer>()->now();
 
 	if (mContext->isWorkflowCancelled() && !mContext->isWorkflowCancelledInState())
 	{
@@ -124,6 +132,12 @@ void AbstractState::onExit(QEvent* pEvent)
 	mContext->setStateApproved(false);
 	qCDebug(statemachine) << "Leaving state" << getStateName()
 						  << "with status: [" << mContext->getLastPaceResult() << "+" << mContext->getStatus() << "]";
+	if (mEnteredTime >= 0 && Env::getSingleton<Tracer>()->isTracing())
+	{
+		Env::getSingleton<Tracer>()->addSpan(QLatin1String("state"), getStateName(), mEnteredTime, {
+					{QLatin1String("status"), Enum<GlobalStatus::Code>::getName(mContext->getStatus().getStatusCode())}
+				});
+	}
 
 	QState::onExit(pEvent);
 }
@@ -49,6 +49,7 @@ class AbstractState
 		bool mAbortOnCardRemoved;
 		bool mHandleNfcStop;
 		bool mKeepCardConnectionAlive;
+		qint64 mEnteredTime;
 
 		virtual void run() = 0;
 
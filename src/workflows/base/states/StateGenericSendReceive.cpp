@@ -8,8 +8,10 @@
 #include "CertificateChecker.h"
 #include "Env.h"
 #include "LogHandler.h"
+#include "Metrics.h"
 #include "NetworkManager.h"
 #include "TlsChecker.h"
+#include "Tracer.h"
 #include "paos/PaosHandler.h"
 
 
@@ -32,6 +34,10 @@ StateGenericSendReceive::StateGenericSendReceive(
 	, mOtherResponseTypes(pOtherResponseTypes)
 	, mPersonalization(pPersonalization)
 	, mReply()
+	, mSendTime(-1)
+	, mSendSize(0)
+	, mRoundTrip()
+	, mRoundTripSeries(nullptr)
 {
 }
 
@@ -132,13 +138,18 @@ void StateGenericSendReceive::onSslErrors(const QList<QSslError>& pErrors)
 
 void StateGenericSendReceive::onSslHandshakeDone()
 {
-	const auto& cfg = mReply->sslConfiguration();
-	TlsChecker::logSslConfig(cfg, spawnMessageLogger(network));
+	checkSslHandshake(mReply->sslConfiguration());
+}
+
 
-	auto failure = checkSslConnectionAndSaveCertificate(cfg);
+void StateGenericSendReceive::checkSslHandshake(const QSslConfiguration& pSslConfiguration)
+{
+	TlsChecker::logSslConfig(pSslConfiguration, spawnMessageLogger(network));
+
+	auto failure = checkSslConnectionAndSaveCertificate(pSslConfiguration);
 	if (!failure.has_value())
 	{
-		failure = checkAndSaveSessionResumption(cfg);
+		failure = checkAndSaveSessionResumption(pSslConfiguration);
 	}
 
 	if (failure.has_value())
@@ -292,17 +303,39 @@ void StateGenericSendReceive::run()
 	qCDebug(network).noquote() << "Try to send raw data:\n" << data;
 	const QByteArray& paosNamespace = PaosCreator::getNamespace(PaosCreator::Namespace::PAOS).toUtf8();
 	const auto& session = token->usePsk() ? getContext()->getSslSessionPsk() : getContext()->getSslSession();
+
+	// The request reuses the channel of NetworkManager::preconnect without an encrypted signal.
+	// A pre-connect that is still in progress is aborted, so the request gets a checked channel.
+	const auto& preconnectConfiguration = token->usePsk()
+			? Env::getSingleton<NetworkManager>()->takePreconnectConfiguration(serverAddress)
+			: QSslConfiguration();
+
+	mSendTime = Env::getSingleton<Tracer>()->now();
+	mSendSize = data.size();
+	mRoundTrip.start();
 	mReply = Env::getSingleton<NetworkManager>()->paos(request, paosNamespace, data, token->usePsk(), session);
 	*this << connect(mReply.data(), &QNetworkReply::sslErrors, this, &StateGenericSendReceive::onSslErrors);
 	*this << connect(mReply.data(), &QNetworkReply::encrypted, this, &StateGenericSendReceive::onSslHandshakeDone);
 	*this << connect(mReply.data(), &QNetworkReply::finished, this, &StateGenericSendReceive::onReplyFinished);
 	*this << connect(mReply.data(), &QNetworkReply::preSharedKeyAuthenticationRequired, this, &StateGenericSendReceive::onPreSharedKeyAuthenticationRequired);
+
+	// The request is sent by the event loop, so an abort here stops it before any data is written.
+	if (!preconnectConfiguration.isNull())
+	{
+		qCDebug(network) << "Check TLS configuration of pre-connect";
+		checkSslHandshake(preconnectConfiguration);
+	}
 }
 
 
 void StateGenericSendReceive::onReplyFinished()
 {
 	qCDebug(network) << "Received message from eID-Server";
+	if (!mRoundTripSeries)
+	{
+		mRoundTripSeries = Env::getSingleton<Metrics>()->getSeries(Metric::PAOS_ROUND_TRIP, {{QLatin1StringView("state"), getStateName()}});
+	}
+	Metrics::record(mRoundTripSeries, mRoundTrip.nsecsElapsed() / 1000);
 	const auto statusCode = NetworkManager::getLoggedStatusCode(mReply, spawnMessageLogger(network));
 
 	if (mReply->error() != QNetworkReply::NoError)
@@ -337,6 +370,13 @@ void StateGenericSendReceive::onReplyFinished()
 				reason = FailureCode::Reason::Generic_Send_Receive_Network_Error;
 		}
 
+		if (mSendTime >= 0 && Env::getSingleton<Tracer>()->isTracing())
+		{
+			Env::getSingleton<Tracer>()->addSpan(QLatin1String("paos"), getStateName(), mSendTime, {
+						{QLatin1String("request"), mSendSize},
+						{QLatin1String("error"), mReply->errorString()}
+					});
+		}
 		Q_EMIT fireAbort({reason, infoMap});
 		return;
 	}
@@ -347,6 +387,14 @@ void StateGenericSendReceive::onReplyFinished()
 	PaosHandler paosHandler(message);
 	const auto receivedType = paosHandler.getDetectedPaosType();
 	qCDebug(network) << "Received PAOS message of type:" << receivedType;
+	if (mSendTime >= 0 && Env::getSingleton<Tracer>()->isTracing())
+	{
+		Env::getSingleton<Tracer>()->addSpan(QLatin1String("paos"), getStateName(), mSendTime, {
+					{QLatin1String("request"), mSendSize},
+					{QLatin1String("response"), message.size()},
+					{QLatin1String("type"), Enum<PaosType>::getName(receivedType)}
+				});
+	}
 
 	if (mExpectedResponseType == receivedType)
 	{
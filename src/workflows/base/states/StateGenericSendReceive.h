@@ -6,11 +6,13 @@
 
 #include "AbstractState.h"
 #include "GenericContextContainer.h"
+#include "Metrics.h"
 #include "context/AuthContext.h"
 #include "paos/PaosMessage.h"
 #include "paos/PaosType.h"
 #include "paos/invoke/PaosCreator.h"
 
+#include <QElapsedTimer>
 #include <QList>
 #include <QSharedPointer>
 #include <QSslPreSharedKeyAuthenticator>
@@ -33,12 +35,17 @@ class StateGenericSendReceive
 		const QList<PaosType> mOtherResponseTypes;
 		const bool mPersonalization;
 		QSharedPointer<QNetworkReply> mReply;
+		qint64 mSendTime;
+		qsizetype mSendSize;
+		QElapsedTimer mRoundTrip;
+		Metrics::Series* mRoundTripSeries;
 
 		void logRawData(const QByteArray& pMessage);
 		void setReceivedMessage(const QSharedPointer<PaosMessage>& pMessage) const;
 		std::optional<FailureCode> checkSslConnectionAndSaveCertificate(const QSslConfiguration& pSslConfiguration) const;
 		void onSslErrors(const QList<QSslError>& pErrors);
 		void onSslHandshakeDone();
+		void checkSslHandshake(const QSslConfiguration& pSslConfiguration);
 		std::optional<FailureCode> checkAndSaveSessionResumption(const QSslConfiguration& pSslConfiguration) const;
 		void run() override;
 
@@ -246,7 +246,11 @@ void StateGetTcToken::parseTcToken()
 		{
 			// When the tcToken provides a psk, it is necessary to clear
 			// all connections to force new connections with psk settings.
-			Env::getSingleton<NetworkManager>()->clearConnections();
+			auto* networkManager = Env::getSingleton<NetworkManager>();
+			networkManager->clearConnections();
+
+			// Establish the channel to the eID-Server while the user selects the card and enters the PIN.
+			networkManager->preconnect(tcToken->getServerAddress(), tcToken->getSessionIdentifier(), QByteArray::fromHex(tcToken->getPsk()));
 		}
 		Q_EMIT fireContinue();
 		return;
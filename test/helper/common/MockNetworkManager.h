@@ -21,6 +21,7 @@ class MockNetworkManager
 		QSharedPointer<MockNetworkReply> mLastReply;
 		QNetworkRequest mLastRequest;
 		QByteArray mLastData;
+		QUrl mLastPreconnect;
 
 		[[nodiscard]] QSharedPointer<MockNetworkReply> getReply(const QNetworkRequest& pRequest);
 
@@ -35,6 +36,14 @@ class MockNetworkManager
 		[[nodiscard]] QSharedPointer<QNetworkReply> get(QNetworkRequest& pRequest) override;
 		[[nodiscard]] QSharedPointer<QNetworkReply> post(QNetworkRequest& pRequest, const QByteArray& pData) override;
 
+		void preconnect(const QUrl& pUrl, const QByteArray& pIdentity, const QByteArray& pPsk) override
+		{
+			Q_UNUSED(pIdentity)
+			Q_UNUSED(pPsk)
+			mLastPreconnect = pUrl;
+		}
+
+
 		void setFilename(const QString& pFilename)
 		{
 			mFilename = pFilename;
@@ -66,6 +75,12 @@ class MockNetworkManager
 			return mLastData;
 		}
 
+
+		[[nodiscard]] QUrl getLastPreconnect() const
+		{
+			return mLastPreconnect;
+		}
+
 	Q_SIGNALS:
 		void fireReply();
 };
@@ -39,7 +39,7 @@ TestAuthContext::~TestAuthContext()
 }
 
 
-void TestAuthContext::setRequiredAccessRights(const QSet<AccessRight>& pAccessRights)
+void TestAuthContext::setRequiredAccessRights(const AccessRights& pAccessRights)
 {
 	if (!mDIDAuthenticateEAC1->getRequiredChat())
 	{
@@ -54,7 +54,7 @@ void TestAuthContext::setRequiredAccessRights(const QSet<AccessRight>& pAccessRi
 }
 
 
-void TestAuthContext::setOptionalAccessRights(const QSet<AccessRight>& pAccessRights)
+void TestAuthContext::setOptionalAccessRights(const AccessRights& pAccessRights)
 {
 	if (!mDIDAuthenticateEAC1->getOptionalChat())
 	{
@@ -23,8 +23,8 @@ class TestAuthContext
 		explicit TestAuthContext(const QString& pFileName = QString());
 		~TestAuthContext() override;
 
-		void setRequiredAccessRights(const QSet<AccessRight>& pAccessRights);
-		void setOptionalAccessRights(const QSet<AccessRight>& pAccessRights);
+		void setRequiredAccessRights(const AccessRights& pAccessRights);
+		void setOptionalAccessRights(const AccessRights& pAccessRights);
 		void addCvCertificate(const QSharedPointer<const CVCertificate>& pCvCertificate);
 		void clearCvCertificates();
 		void removeCvCertAt(int pPosition);
@@ -0,0 +1,226 @@
+/**
+ * Copyright (c) 2025 Governikus GmbH & Co. KG, Germany
+ */
+
+#include "EidServerCertificates.h"
+
+#include "asn1/ASN1Struct.h"
+#include "asn1/ASN1Util.h"
+#include "asn1/Oid.h"
+#include "pace/ec/EcUtil.h"
+
+#include <QCryptographicHash>
+#include <QDebug>
+#include <openssl/ecdsa.h>
+
+
+using namespace governikus;
+
+
+namespace
+{
+constexpr int cCurve = NID_brainpoolP256r1;
+
+
+QByteArray toBytes(const BIGNUM* pNumber, int pSize)
+{
+	QByteArray result(pSize, '\0');
+	BN_bn2binpad(pNumber, reinterpret_cast<uchar*>(result.data()), pSize);
+	return result;
+}
+
+
+QByteArray application(int pTag, const QByteArray& pData, bool pConstructed = false)
+{
+	return Asn1Util::encode(V_ASN1_APPLICATION, pTag, pData, pConstructed);
+}
+
+
+QByteArray objectIdentifier(KnownOid pOid)
+{
+	return Asn1Util::encode(V_ASN1_UNIVERSAL, ASN1Struct::UNI_OBJECT_IDENTIFIER, QByteArray(Oid(pOid)));
+}
+
+
+QByteArray explicitString(int pTag, int pType, const QString& pValue)
+{
+	return Asn1Util::encode(V_ASN1_CONTEXT_SPECIFIC, pTag, Asn1Util::encode(V_ASN1_UNIVERSAL, pType, pValue.toUtf8()), true);
+}
+
+
+} // namespace
+
+
+EidServerCertificates::EidServerCertificates(const QUrl& pSubjectUrl, const QByteArrayList& pCommCertificates)
+	: mCvcaKey(EcUtil::generateKey(EcUtil::createCurve(cCurve)))
+	, mDvKey(EcUtil::generateKey(EcUtil::createCurve(cCurve)))
+	, mTerminalKey(EcUtil::generateKey(EcUtil::createCurve(cCurve)))
+	, mDescription(createDescription(pSubjectUrl, pCommCertificates))
+	, mCvca()
+	, mDv()
+	, mTerminal()
+{
+	const QByteArray cvcaChr("DELOCALCA00001");
+	const QByteArray dvChr("DELOCALDV00001");
+	const QByteArray terminalChr("DELOCALAT00001");
+
+	const auto& descriptionHash = Asn1Util::encode(V_ASN1_CONTEXT_SPECIFIC, ASN1Struct::CERTIFICATE_EXTENSION_CONTENT_0,
+			QCryptographicHash::hash(mDescription, QCryptographicHash::Sha256));
+	const auto& extensions = application(5, application(19, objectIdentifier(KnownOid::ID_DESCRIPTION) + descriptionHash, true), true);
+
+	mCvca = createCertificate(cvcaChr, cvcaChr, QByteArray::fromHex("FC0F13FFFF"), createPublicKey(mCvcaKey, true), QByteArray(), mCvcaKey);
+	mDv = createCertificate(cvcaChr, dvChr, QByteArray::fromHex("BC0F13FFFF"), createPublicKey(mDvKey, false), QByteArray(), mCvcaKey);
+	mTerminal = createCertificate(dvChr, terminalChr, QByteArray::fromHex("3C0F13FFFF"), createPublicKey(mTerminalKey, false), extensions, mDvKey);
+}
+
+
+QByteArray EidServerCertificates::createPublicKey(const QSharedPointer<EVP_PKEY>& pKey, bool pDomainParameters)
+{
+	QByteArray data = objectIdentifier(KnownOid::ID_TA_ECDSA_SHA_256);
+	const auto& publicPoint = Asn1Util::encode(V_ASN1_CONTEXT_SPECIFIC, 6, EcUtil::getEncodedPublicKey(pKey));
+	if (!pDomainParameters)
+	{
+		return application(ASN1Struct::PUBLIC_KEY, data + publicPoint, true);
+	}
+
+	const auto& curve = EcUtil::createCurve(cCurve);
+	const auto& prime = EcUtil::create(BN_new());
+	const auto& a = EcUtil::create(BN_new());
+	const auto& b = EcUtil::create(BN_new());
+	EC_GROUP_get_curve(curve.data(), prime.data(), a.data(), b.data(), nullptr);
+
+	const int size = BN_num_bytes(prime.data());
+	const auto* order = EC_GROUP_get0_order(curve.data());
+	const auto* cofactor = EC_GROUP_get0_cofactor(curve.data());
+
+	data += Asn1Util::encode(V_ASN1_CONTEXT_SPECIFIC, 1, toBytes(prime.data(), size));
+	data += Asn1Util::encode(V_ASN1_CONTEXT_SPECIFIC, 2, toBytes(a.data(), size));
+	data += Asn1Util::encode(V_ASN1_CONTEXT_SPECIFIC, 3, toBytes(b.data(), size));
+	data += Asn1Util::encode(V_ASN1_CONTEXT_SPECIFIC, 4, EcUtil::point2oct(curve, EC_GROUP_get0_generator(curve.data())));
+	data += Asn1Util::encode(V_ASN1_CONTEXT_SPECIFIC, 5, toBytes(order, BN_num_bytes(order)));
+	data += publicPoint;
+	data += Asn1Util::encode(V_ASN1_CONTEXT_SPECIFIC, 7, toBytes(cofactor, BN_num_bytes(cofactor)));
+	return application(ASN1Struct::PUBLIC_KEY, data, true);
+}
+
+
+QByteArray EidServerCertificates::createChat(const QByteArray& pTemplate)
+{
+	return application(ASN1Struct::CERTIFICATE_HOLDER_AUTHORIZATION_TEMPLATE, objectIdentifier(KnownOid::ID_AT) + application(19, pTemplate), true);
+}
+
+
+QByteArray EidServerCertificates::createDescription(const QUrl& pSubjectUrl, const QByteArrayList& pCommCertificates)
+{
+	QByteArray data = objectIdentifier(KnownOid::ID_PLAIN_FORMAT);
+	data += explicitString(1, V_ASN1_UTF8STRING, QStringLiteral("Local eID-Server"));
+	data += explicitString(3, V_ASN1_UTF8STRING, QStringLiteral("Local eID-Server"));
+	data += explicitString(4, V_ASN1_PRINTABLESTRING, pSubjectUrl.toString(QUrl::RemovePath | QUrl::RemoveQuery));
+	data += explicitString(5, V_ASN1_UTF8STRING, QStringLiteral("For testing purposes only."));
+
+	if (!pCommCertificates.isEmpty())
+	{
+		QByteArray hashes;
+		for (const auto& certificate : pCommCertificates)
+		{
+			hashes += Asn1Util::encode(V_ASN1_UNIVERSAL, ASN1Struct::UNI_OCTETSTRING, QCryptographicHash::hash(certificate, QCryptographicHash::Sha256));
+		}
+		data += Asn1Util::encode(V_ASN1_CONTEXT_SPECIFIC, 7, Asn1Util::encode(V_ASN1_UNIVERSAL, ASN1Struct::UNI_SET, hashes, true), true);
+	}
+
+	return Asn1Util::encode(V_ASN1_UNIVERSAL, ASN1Struct::UNI_SEQUENCE, data, true);
+}
+
+
+QByteArray EidServerCertificates::createCertificate(const QByteArray& pCar,
+		const QByteArray& pChr,
+		const QByteArray& pChatTemplate,
+		const QByteArray& pPublicKey,
+		const QByteArray& pExtensions,
+		const QSharedPointer<EVP_PKEY>& pSigningKey)
+{
+	const auto& today = QDate::currentDate();
+
+	QByteArray data = application(41, QByteArray(1, '\0'));
+	data += application(2, pCar);
+	data += pPublicKey;
+	data += application(32, pChr);
+	data += createChat(pChatTemplate);
+	data += application(37, Asn1BCDDateUtil::convertFromQDateToUnpackedBCD(today.addDays(-1)));
+	data += application(36, Asn1BCDDateUtil::convertFromQDateToUnpackedBCD(today.addYears(1)));
+	data += pExtensions;
+
+	const auto& body = application(ASN1Struct::CERTIFICATE_BODY, data, true);
+	const auto& signature = application(ASN1Struct::CERTIFICATE_SIGNATURE, sign(pSigningKey, body));
+	return application(ASN1Struct::CV_CERTIFICATE, body + signature, true);
+}
+
+
+const QByteArray& EidServerCertificates::getCvca() const
+{
+	return mCvca;
+}
+
+
+const QByteArray& EidServerCertificates::getDv() const
+{
+	return mDv;
+}
+
+
+const QByteArray& EidServerCertificates::getTerminal() const
+{
+	return mTerminal;
+}
+
+
+const QByteArray& EidServerCertificates::getDescription() const
+{
+	return mDescription;
+}
+
+
+QByteArray EidServerCertificates::getRequiredChat()
+{
+	// Given names (DG04) and family name (DG05)
+	return createChat(QByteArray::fromHex("0000001800"));
+}
+
+
+QByteArray EidServerCertificates::sign(const QByteArray& pData) const
+{
+	return sign(mTerminalKey, pData);
+}
+
+
+QByteArray EidServerCertificates::sign(const QSharedPointer<EVP_PKEY>& pKey, const QByteArray& pData)
+{
+	const auto& hash = QCryptographicHash::hash(pData, QCryptographicHash::Sha256);
+	const auto& ctx = EcUtil::create(EVP_PKEY_CTX_new(pKey.data(), nullptr));
+
+	size_t length = 0;
+	if (EVP_PKEY_sign_init(ctx.data()) <= 0
+			|| EVP_PKEY_sign(ctx.data(), nullptr, &length, reinterpret_cast<const uchar*>(hash.data()), static_cast<size_t>(hash.size())) <= 0)
+	{
+		qCritical() << "Cannot init sign ctx";
+		return QByteArray();
+	}
+
+	QByteArray der(static_cast<qsizetype>(length), '\0');
+	if (EVP_PKEY_sign(ctx.data(), reinterpret_cast<uchar*>(der.data()), &length, reinterpret_cast<const uchar*>(hash.data()), static_cast<size_t>(hash.size())) <= 0)
+	{
+		qCritical() << "Cannot sign data";
+		return QByteArray();
+	}
+
+	const auto* dataPointer = reinterpret_cast<const uchar*>(der.constData());
+	const QSharedPointer<ECDSA_SIG> signature(d2i_ECDSA_SIG(nullptr, &dataPointer, static_cast<long>(length)), [](ECDSA_SIG* pSig){ECDSA_SIG_free(pSig);});
+	if (signature.isNull())
+	{
+		qCritical() << "Cannot decode signature";
+		return QByteArray();
+	}
+
+	const int size = (EVP_PKEY_get_bits(pKey.data()) + 7) / 8;
+	return toBytes(ECDSA_SIG_get0_r(signature.data()), size) + toBytes(ECDSA_SIG_get0_s(signature.data()), size);
+}
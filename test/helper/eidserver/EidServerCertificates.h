@@ -0,0 +1,62 @@
+/**
+ * Copyright (c) 2025 Governikus GmbH & Co. KG, Germany
+ */
+
+#pragma once
+
+#include <QByteArray>
+#include <QByteArrayList>
+#include <QDate>
+#include <QSharedPointer>
+#include <QUrl>
+#include <openssl/evp.h>
+
+
+namespace governikus
+{
+
+class EidServerCertificates
+{
+	private:
+		QSharedPointer<EVP_PKEY> mCvcaKey;
+		QSharedPointer<EVP_PKEY> mDvKey;
+		QSharedPointer<EVP_PKEY> mTerminalKey;
+		QByteArray mDescription;
+		QByteArray mCvca;
+		QByteArray mDv;
+		QByteArray mTerminal;
+
+		static QByteArray createPublicKey(const QSharedPointer<EVP_PKEY>& pKey, bool pDomainParameters);
+		static QByteArray createChat(const QByteArray& pTemplate);
+		static QByteArray createDescription(const QUrl& pSubjectUrl, const QByteArrayList& pCommCertificates);
+		static QByteArray createCertificate(const QByteArray& pCar,
+				const QByteArray& pChr,
+				const QByteArray& pChatTemplate,
+				const QByteArray& pPublicKey,
+				const QByteArray& pExtensions,
+				const QSharedPointer<EVP_PKEY>& pSigningKey);
+
+	public:
+		/*!
+		 * Creates new keys and certificates. The certificate description
+		 * contains \a pSubjectUrl and the SHA-256 hashes of the DER encoded
+		 * TLS certificates in \a pCommCertificates.
+		 */
+		EidServerCertificates(const QUrl& pSubjectUrl, const QByteArrayList& pCommCertificates);
+
+		[[nodiscard]] const QByteArray& getCvca() const;
+		[[nodiscard]] const QByteArray& getDv() const;
+		[[nodiscard]] const QByteArray& getTerminal() const;
+		[[nodiscard]] const QByteArray& getDescription() const;
+
+		[[nodiscard]] static QByteArray getRequiredChat();
+
+		/*!
+		 * Signs \a pData with the key of the terminal certificate and returns
+		 * the plain signature as used by Terminal Authentication.
+		 */
+		[[nodiscard]] QByteArray sign(const QByteArray& pData) const;
+		[[nodiscard]] static QByteArray sign(const QSharedPointer<EVP_PKEY>& pKey, const QByteArray& pData);
+};
+
+} // namespace governikus
@@ -0,0 +1,555 @@
+/**
+ * Copyright (c) 2025 Governikus GmbH & Co. KG, Germany
+ */
+
+#include "EidServerSession.h"
+
+#include "Randomizer.h"
+#include "SecurityProtocol.h"
+#include "apdu/CommandApdu.h"
+#include "apdu/ResponseApdu.h"
+#include "asn1/EFCardSecurity.h"
+#include "asn1/Oid.h"
+#include "asn1/PaceInfo.h"
+#include "asn1/SecurityInfos.h"
+#include "pace/CipherMac.h"
+#include "pace/KeyDerivationFunction.h"
+#include "pace/ec/EcUtil.h"
+#include "pace/ec/EcdhKeyAgreement.h"
+
+#include <QDebug>
+#include <QXmlStreamReader>
+
+
+using namespace governikus;
+
+
+namespace
+{
+constexpr QLatin1StringView cSoapNamespace("http://schemas.xmlsoap.org/soap/envelope/");
+constexpr QLatin1StringView cAddressingNamespace("http://www.w3.org/2005/03/addressing");
+constexpr QLatin1StringView cEcardNamespace("http://www.bsi.bund.de/ecard/api/1.1");
+constexpr QLatin1StringView cTechNamespace("urn:iso:std:iso-iec:24727:tech:schema");
+constexpr QLatin1StringView cDssNamespace("urn:oasis:names:tc:dss:1.0:core:schema");
+constexpr QLatin1StringView cXsiNamespace("http://www.w3.org/2001/XMLSchema-instance");
+
+constexpr QLatin1StringView cResultMajorOk("http://www.bsi.bund.de/ecard/api/1.1/resultmajor#ok");
+constexpr QLatin1StringView cResultMajorError("http://www.bsi.bund.de/ecard/api/1.1/resultmajor#error");
+constexpr QLatin1StringView cResultMinorError("http://www.bsi.bund.de/ecard/api/1.1/resultminor/al/common#internalError");
+
+const QList<uchar> cDataGroups = {0x04, 0x05};
+
+
+QSharedPointer<ASN1_SEQUENCE_ANY> decodeSequence(const ASN1_TYPE* pType)
+{
+	if (pType == nullptr || pType->type != V_ASN1_SEQUENCE)
+	{
+		return QSharedPointer<ASN1_SEQUENCE_ANY>();
+	}
+
+	const uchar* data = ASN1_STRING_get0_data(pType->value.sequence);
+	return QSharedPointer<ASN1_SEQUENCE_ANY>(d2i_ASN1_SEQUENCE_ANY(nullptr, &data, ASN1_STRING_length(pType->value.sequence)),
+			[](ASN1_SEQUENCE_ANY* pSequence){sk_ASN1_TYPE_pop_free(pSequence, ASN1_TYPE_free);});
+}
+
+
+/*!
+ * The repository does not parse ChipAuthenticationPublicKeyInfo, so
+ * the public key of the chip is picked from the raw SecurityInfos:
+ *
+ * ChipAuthenticationPublicKeyInfo ::= SEQUENCE {
+ *      protocol OBJECT IDENTIFIER(id-PK-ECDH),
+ *      chipAuthenticationPublicKey SubjectPublicKeyInfo,
+ *      keyId INTEGER OPTIONAL
+ * }
+ */
+std::pair<int, QByteArray> findChipAuthenticationPublicKey(const QSharedPointer<const SecurityInfos>& pSecurityInfos, int pKeyId)
+{
+	const auto& securityInfos = decodeObject<securityinfos_st>(pSecurityInfos->getContentBytes());
+	if (securityInfos.isNull())
+	{
+		return {NID_undef, QByteArray()};
+	}
+
+	for (int i = 0; i < sk_securityinfo_st_num(securityInfos.data()); ++i)
+	{
+		const auto* info = sk_securityinfo_st_value(securityInfos.data(), i);
+		if (Oid(info->mProtocol) != KnownOid::ID_PK_ECDH)
+		{
+			continue;
+		}
+
+		if (pKeyId >= 0 && info->mOptionalData && info->mOptionalData->type == V_ASN1_INTEGER && ASN1_INTEGER_get(info->mOptionalData->value.integer) != pKeyId)
+		{
+			continue;
+		}
+
+		const auto& publicKeyInfo = decodeSequence(info->mRequiredData);
+		if (publicKeyInfo.isNull() || sk_ASN1_TYPE_num(publicKeyInfo.data()) != 2)
+		{
+			continue;
+		}
+
+		const auto& algorithm = decodeSequence(sk_ASN1_TYPE_value(publicKeyInfo.data(), 0));
+		const auto* publicKey = sk_ASN1_TYPE_value(publicKeyInfo.data(), 1);
+		if (algorithm.isNull() || sk_ASN1_TYPE_num(algorithm.data()) != 2 || publicKey->type != V_ASN1_BIT_STRING)
+		{
+			continue;
+		}
+
+		const auto* parameterId = sk_ASN1_TYPE_value(algorithm.data(), 1);
+		if (parameterId->type != V_ASN1_INTEGER)
+		{
+			continue;
+		}
+
+		const auto nid = PaceInfo::getMappedNid(static_cast<int>(ASN1_INTEGER_get(parameterId->value.integer)));
+		const auto* point = publicKey->value.bit_string;
+		return {nid, QByteArray(reinterpret_cast<const char*>(ASN1_STRING_get0_data(point)), ASN1_STRING_length(point))};
+	}
+
+	return {NID_undef, QByteArray()};
+}
+
+
+} // namespace
+
+
+EidServerSession::EidServerSession(const QSharedPointer<const EidServerCertificates>& pCertificates, const QByteArray& pSessionId, const QByteArray& pPsk)
+	: mCertificates(pCertificates)
+	, mSessionId(pSessionId)
+	, mPsk(pPsk)
+	, mState(State::START_PAOS)
+	, mEphemeralKey()
+	, mSecureMessaging()
+	, mDataGroups()
+{
+}
+
+
+const QByteArray& EidServerSession::getSessionId() const
+{
+	return mSessionId;
+}
+
+
+const QByteArray& EidServerSession::getPsk() const
+{
+	return mPsk;
+}
+
+
+EidServerSession::State EidServerSession::getState() const
+{
+	return mState;
+}
+
+
+const QByteArrayList& EidServerSession::getDataGroups() const
+{
+	return mDataGroups;
+}
+
+
+EidServerSession::Message EidServerSession::parse(const QByteArray& pData)
+{
+	Message message;
+	QXmlStreamReader reader(pData);
+	bool body = false;
+	QString text;
+
+	while (!reader.atEnd())
+	{
+		switch (reader.readNext())
+		{
+			case QXmlStreamReader::StartElement:
+				if (body && message.mType.isEmpty())
+				{
+					message.mType = reader.name().toString();
+				}
+				body |= reader.name() == QLatin1String("Body");
+				text.clear();
+				break;
+
+			case QXmlStreamReader::Characters:
+				text += reader.text();
+				break;
+
+			case QXmlStreamReader::EndElement:
+				if (const auto& value = text.trimmed(); !value.isEmpty())
+				{
+					const auto& name = reader.name().toString();
+					if (name == QLatin1String("OutputAPDU"))
+					{
+						message.mOutputApdus << value;
+					}
+					else if (name == QLatin1String("MessageID"))
+					{
+						message.mMessageId = value;
+					}
+					else if (!message.mElements.contains(name))
+					{
+						message.mElements.insert(name, value);
+					}
+				}
+				text.clear();
+				break;
+
+			default:
+				break;
+		}
+	}
+
+	if (reader.hasError())
+	{
+		qWarning() << "Cannot parse PAOS message:" << reader.errorString();
+		return Message();
+	}
+
+	return message;
+}
+
+
+QByteArray EidServerSession::createEnvelope(const QString& pRelatesTo, const std::function<void(QXmlStreamWriter&)>& pBody)
+{
+	QByteArray data;
+	QXmlStreamWriter writer(&data);
+	writer.writeStartDocument();
+	writer.writeNamespace(cSoapNamespace, QStringLiteral("soap"));
+	writer.writeNamespace(cAddressingNamespace, QStringLiteral("wsa"));
+	writer.writeNamespace(cXsiNamespace, QStringLiteral("xsi"));
+	writer.writeNamespace(cTechNamespace, QStringLiteral("iso"));
+	writer.writeNamespace(cEcardNamespace, QStringLiteral("ecard"));
+	writer.writeNamespace(cDssNamespace, QStringLiteral("dss"));
+
+	writer.writeStartElement(cSoapNamespace, QStringLiteral("Envelope"));
+	writer.writeStartElement(cSoapNamespace, QStringLiteral("Header"));
+	if (!pRelatesTo.isEmpty())
+	{
+		writer.writeTextElement(cAddressingNamespace, QStringLiteral("RelatesTo"), pRelatesTo);
+	}
+	writer.writeTextElement(cAddressingNamespace, QStringLiteral("MessageID"), QStringLiteral("urn:uuid:") + Randomizer::getInstance().createUuid().toString(QUuid::WithoutBraces));
+	writer.writeEndElement();
+
+	writer.writeStartElement(cSoapNamespace, QStringLiteral("Body"));
+	pBody(writer);
+	writer.writeEndElement();
+
+	writer.writeEndElement();
+	writer.writeEndDocument();
+	return data;
+}
+
+
+void EidServerSession::writeConnectionHandle(QXmlStreamWriter& pWriter)
+{
+	pWriter.writeStartElement(cTechNamespace, QStringLiteral("ConnectionHandle"));
+	pWriter.writeAttribute(cXsiNamespace, QStringLiteral("type"), QStringLiteral("iso:ConnectionHandleType"));
+	pWriter.writeTextElement(cTechNamespace, QStringLiteral("CardApplication"), QStringLiteral("e80704007f00070302"));
+	pWriter.writeTextElement(cTechNamespace, QStringLiteral("SlotHandle"), QStringLiteral("00"));
+	pWriter.writeEndElement();
+}
+
+
+void EidServerSession::writeResult(QXmlStreamWriter& pWriter, const QString& pError)
+{
+	pWriter.writeStartElement(cDssNamespace, QStringLiteral("Result"));
+	if (pError.isEmpty())
+	{
+		pWriter.writeTextElement(cDssNamespace, QStringLiteral("ResultMajor"), cResultMajorOk);
+	}
+	else
+	{
+		pWriter.writeTextElement(cDssNamespace, QStringLiteral("ResultMajor"), cResultMajorError);
+		pWriter.writeTextElement(cDssNamespace, QStringLiteral("ResultMinor"), cResultMinorError);
+		pWriter.writeStartElement(cDssNamespace, QStringLiteral("ResultMessage"));
+		pWriter.writeAttribute(QStringLiteral("xml:lang"), QStringLiteral("en"));
+		pWriter.writeCharacters(pError);
+		pWriter.writeEndElement();
+	}
+	pWriter.writeEndElement();
+}
+
+
+QByteArray EidServerSession::fail(const Message& pMessage, const QString& pError)
+{
+	qWarning() << "eID-Server session" << mSessionId << "failed:" << pError;
+	mState = State::FAILED;
+	return createStartPaosResponse(pMessage, pError);
+}
+
+
+QByteArray EidServerSession::createInitializeFramework(const Message& pMessage)
+{
+	mState = State::INITIALIZE_FRAMEWORK;
+	return createEnvelope(pMessage.mMessageId, [](QXmlStreamWriter& pWriter){
+			pWriter.writeEmptyElement(cEcardNamespace, QStringLiteral("InitializeFramework"));
+		});
+}
+
+
+QByteArray EidServerSession::createEac1(const Message& pMessage)
+{
+	mState = State::EAC1;
+	return createEnvelope(pMessage.mMessageId, [this](QXmlStreamWriter& pWriter){
+			pWriter.writeStartElement(cTechNamespace, QStringLiteral("DIDAuthenticate"));
+			writeConnectionHandle(pWriter);
+			pWriter.writeTextElement(cTechNamespace, QStringLiteral("DIDName"), QStringLiteral("PIN"));
+
+			pWriter.writeStartElement(cTechNamespace, QStringLiteral("AuthenticationProtocolData"));
+			pWriter.writeAttribute(QStringLiteral("Protocol"), QStringLiteral("urn:oid:1.3.162.15480.3.0.14.2"));
+			pWriter.writeAttribute(cXsiNamespace, QStringLiteral("type"), QStringLiteral("iso:EAC1InputType"));
+			pWriter.writeTextElement(cTechNamespace, QStringLiteral("Certificate"), QString::fromLatin1(mCertificates->getDv().toHex()));
+			pWriter.writeTextElement(cTechNamespace, QStringLiteral("Certificate"), QString::fromLatin1(mCertificates->getTerminal().toHex()));
+			pWriter.writeTextElement(cTechNamespace, QStringLiteral("CertificateDescription"), QString::fromLatin1(mCertificates->getDescription().toHex()));
+			pWriter.writeTextElement(cTechNamespace, QStringLiteral("RequiredCHAT"), QString::fromLatin1(EidServerCertificates::getRequiredChat().toHex()));
+			pWriter.writeEndElement();
+
+			pWriter.writeEndElement();
+		});
+}
+
+
+QByteArray EidServerSession::createEac2(const Message& pMessage)
+{
+	const auto& efCardAccess = EFCardAccess::decode(QByteArray::fromHex(pMessage.mElements.value(QStringLiteral("EFCardAccess")).toLatin1()));
+	if (efCardAccess.isNull() || efCardAccess->getPaceInfos().isEmpty())
+	{
+		return fail(pMessage, QStringLiteral("Missing or invalid EF.CardAccess"));
+	}
+
+	const auto& idPicc = QByteArray::fromHex(pMessage.mElements.value(QStringLiteral("IDPICC")).toLatin1());
+	const auto& challenge = QByteArray::fromHex(pMessage.mElements.value(QStringLiteral("Challenge")).toLatin1());
+	if (idPicc.isEmpty() || challenge.isEmpty())
+	{
+		return fail(pMessage, QStringLiteral("Missing IDPICC or Challenge"));
+	}
+
+	// The chip uses the same domain parameters for PACE and CA.
+	mEphemeralKey = EcUtil::generateKey(EcUtil::createCurve(efCardAccess->getPaceInfos().at(0)->getParameterIdAsNid()));
+	if (mEphemeralKey.isNull())
+	{
+		return fail(pMessage, QStringLiteral("Cannot create ephemeral key"));
+	}
+
+	const auto& ephemeralPublicKey = EcUtil::getEncodedPublicKey(mEphemeralKey);
+	const auto& signature = mCertificates->sign(idPicc + challenge + EcUtil::compressPoint(ephemeralPublicKey));
+	if (signature.isEmpty())
+	{
+		return fail(pMessage, QStringLiteral("Cannot sign terminal authentication data"));
+	}
+
+	mState = State::EAC2;
+	return createEnvelope(pMessage.mMessageId, [&ephemeralPublicKey, &signature](QXmlStreamWriter& pWriter){
+			pWriter.writeStartElement(cTechNamespace, QStringLiteral("DIDAuthenticate"));
+			writeConnectionHandle(pWriter);
+			pWriter.writeTextElement(cTechNamespace, QStringLiteral("DIDName"), QStringLiteral("PIN"));
+
+			pWriter.writeStartElement(cTechNamespace, QStringLiteral("AuthenticationProtocolData"));
+			pWriter.writeAttribute(QStringLiteral("Protocol"), QStringLiteral("urn:oid:1.3.162.15480.3.0.14.2"));
+			pWriter.writeAttribute(cXsiNamespace, QStringLiteral("type"), QStringLiteral("iso:EAC2InputType"));
+			pWriter.writeTextElement(cTechNamespace, QStringLiteral("EphemeralPublicKey"), QString::fromLatin1(ephemeralPublicKey.toHex()));
+			pWriter.writeTextElement(cTechNamespace, QStringLiteral("Signature"), QString::fromLatin1(signature.toHex()));
+			pWriter.writeEndElement();
+
+			pWriter.writeEndElement();
+		});
+}
+
+
+bool EidServerSession::establishSecureMessaging(const Message& pMessage)
+{
+	const auto& efCardSecurity = EFCardSecurity::decode(QByteArray::fromHex(pMessage.mElements.value(QStringLiteral("EFCardSecurity")).toLatin1()));
+	const auto& token = QByteArray::fromHex(pMessage.mElements.value(QStringLiteral("AuthenticationToken")).toLatin1());
+	const auto& nonce = QByteArray::fromHex(pMessage.mElements.value(QStringLiteral("Nonce")).toLatin1());
+	if (efCardSecurity.isNull() || token.isEmpty() || nonce.isEmpty())
+	{
+		qWarning() << "Missing EF.CardSecurity, AuthenticationToken or Nonce";
+		return false;
+	}
+
+	QSharedPointer<const ChipAuthenticationInfo> chipAuthenticationInfo;
+	for (const auto& info : efCardSecurity->getSecurityInfos()->getChipAuthenticationInfos())
+	{
+		if (info->getVersion() == 2)
+		{
+			chipAuthenticationInfo = info;
+			break;
+		}
+	}
+	if (chipAuthenticationInfo.isNull())
+	{
+		qWarning() << "No ChipAuthenticationInfo with version 2 found";
+		return false;
+	}
+
+	const int keyId = chipAuthenticationInfo->hasKeyId() ? chipAuthenticationInfo->getKeyId() : -1;
+	const auto& [nid, chipPublicKey] = findChipAuthenticationPublicKey(efCardSecurity->getSecurityInfos(), keyId);
+	if (nid == NID_undef || chipPublicKey.isEmpty())
+	{
+		qWarning() << "No ChipAuthenticationPublicKeyInfo found for key" << keyId;
+		return false;
+	}
+
+	const auto& peerKey = EcUtil::create(EVP_PKEY_new());
+	if (peerKey.isNull()
+			|| EVP_PKEY_copy_parameters(peerKey.data(), mEphemeralKey.data()) == 0
+			|| !EVP_PKEY_set1_encoded_public_key(peerKey.data(), reinterpret_cast<const uchar*>(chipPublicKey.data()), static_cast<size_t>(chipPublicKey.size())))
+	{
+		qWarning() << "Chip public key does not match the domain parameters of the ephemeral key";
+		return false;
+	}
+
+	const auto& ctx = EcUtil::create(EVP_PKEY_CTX_new_from_pkey(nullptr, mEphemeralKey.data(), nullptr));
+	size_t length = 0;
+	if (EVP_PKEY_derive_init(ctx.data()) <= 0
+			|| EVP_PKEY_derive_set_peer(ctx.data(), peerKey.data()) <= 0
+			|| EVP_PKEY_derive(ctx.data(), nullptr, &length) <= 0)
+	{
+		qWarning() << "Cannot initialize key agreement";
+		return false;
+	}
+
+	QByteArray secret(static_cast<qsizetype>(length), '\0');
+	if (EVP_PKEY_derive(ctx.data(), reinterpret_cast<uchar*>(secret.data()), &length) <= 0)
+	{
+		qWarning() << "Cannot calculate shared secret";
+		return false;
+	}
+
+	const auto& oid = chipAuthenticationInfo->getOid();
+	const SecurityProtocol protocol(oid);
+	const KeyDerivationFunction kdf(protocol);
+	const auto& macKey = kdf.mac(secret, nonce);
+	const auto& encKey = kdf.enc(secret, nonce);
+
+	const auto& ephemeralPublicKey = EcdhKeyAgreement::encodeUncompressedPublicKey(oid, EcUtil::getEncodedPublicKey(mEphemeralKey));
+	if (CipherMac(protocol, macKey).generate(ephemeralPublicKey) != token)
+	{
+		qWarning() << "Authentication token of the chip is invalid";
+		return false;
+	}
+
+	mSecureMessaging.reset(new SecureMessaging(protocol, encKey, macKey));
+	return true;
+}
+
+
+QByteArray EidServerSession::createTransmit(const Message& pMessage)
+{
+	if (!establishSecureMessaging(pMessage))
+	{
+		return fail(pMessage, QStringLiteral("Chip Authentication failed"));
+	}
+
+	QStringList apdus;
+	for (const auto sfi : cDataGroups)
+	{
+		const CommandApdu command(Ins::READ_BINARY, static_cast<uchar>(0x80 | sfi), 0, QByteArray(), CommandApdu::SHORT_MAX_LE);
+		apdus << QString::fromLatin1(QByteArray(mSecureMessaging->encrypt(command)).toHex());
+	}
+
+	mState = State::TRANSMIT;
+	return createEnvelope(pMessage.mMessageId, [&apdus](QXmlStreamWriter& pWriter){
+			pWriter.writeStartElement(cTechNamespace, QStringLiteral("Transmit"));
+			pWriter.writeTextElement(cTechNamespace, QStringLiteral("SlotHandle"), QStringLiteral("00"));
+			for (const auto& apdu : std::as_const(apdus))
+			{
+				pWriter.writeStartElement(cTechNamespace, QStringLiteral("InputAPDUInfo"));
+				pWriter.writeTextElement(cTechNamespace, QStringLiteral("InputAPDU"), apdu);
+				pWriter.writeEndElement();
+			}
+			pWriter.writeEndElement();
+		});
+}
+
+
+QByteArray EidServerSession::createStartPaosResponse(const Message& pMessage, const QString& pError)
+{
+	return createEnvelope(pMessage.mMessageId, [&pError](QXmlStreamWriter& pWriter){
+			pWriter.writeStartElement(cTechNamespace, QStringLiteral("StartPAOSResponse"));
+			writeResult(pWriter, pError);
+			pWriter.writeEndElement();
+		});
+}
+
+
+QByteArray EidServerSession::process(const QByteArray& pMessage)
+{
+	const auto& message = parse(pMessage);
+	if (message.mType.isEmpty())
+	{
+		return fail(message, QStringLiteral("Invalid message"));
+	}
+
+	const auto& resultMajor = message.mElements.value(QStringLiteral("ResultMajor"));
+	if (!resultMajor.isEmpty() && resultMajor != cResultMajorOk)
+	{
+		return fail(message, QStringLiteral("eID-Client reported an error: %1").arg(message.mElements.value(QStringLiteral("ResultMinor"))));
+	}
+
+	switch (mState)
+	{
+		case State::START_PAOS:
+			if (message.mType != QLatin1String("StartPAOS"))
+			{
+				break;
+			}
+			if (message.mElements.value(QStringLiteral("SessionIdentifier")).toLatin1() != mSessionId)
+			{
+				return fail(message, QStringLiteral("Unknown SessionIdentifier"));
+			}
+			return createInitializeFramework(message);
+
+		case State::INITIALIZE_FRAMEWORK:
+			if (message.mType != QLatin1String("InitializeFrameworkResponse"))
+			{
+				break;
+			}
+			return createEac1(message);
+
+		case State::EAC1:
+			if (message.mType != QLatin1String("DIDAuthenticateResponse"))
+			{
+				break;
+			}
+			return createEac2(message);
+
+		case State::EAC2:
+			if (message.mType != QLatin1String("DIDAuthenticateResponse"))
+			{
+				break;
+			}
+			return createTransmit(message);
+
+		case State::TRANSMIT:
+			if (message.mType != QLatin1String("TransmitResponse"))
+			{
+				break;
+			}
+
+			if (message.mOutputApdus.size() != cDataGroups.size())
+			{
+				return fail(message, QStringLiteral("Unexpected number of OutputAPDU"));
+			}
+
+			for (const auto& apdu : message.mOutputApdus)
+			{
+				const auto& response = mSecureMessaging->decrypt(ResponseApdu(QByteArray::fromHex(apdu.toLatin1())));
+				if (response.getStatusCode() != StatusCode::SUCCESS)
+				{
+					return fail(message, QStringLiteral("Cannot read data group"));
+				}
+				mDataGroups << response.getData();
+			}
+
+			mState = State::FINISHED;
+			return createStartPaosResponse(message);
+
+		case State::FINISHED:
+		case State::FAILED:
+			break;
+	}
+
+	return fail(message, QStringLiteral("Unexpected message: %1").arg(message.mType));
+}
@@ -0,0 +1,92 @@
+/**
+ * Copyright (c) 2025 Governikus GmbH & Co. KG, Germany
+ */
+
+#pragma once
+
+#include "EidServerCertificates.h"
+#include "pace/SecureMessaging.h"
+
+#include <QByteArray>
+#include <QByteArrayList>
+#include <QHash>
+#include <QScopedPointer>
+#include <QSharedPointer>
+#include <QString>
+#include <QStringList>
+#include <QXmlStreamWriter>
+
+#include <functional>
+
+
+namespace governikus
+{
+
+/*!
+ * Server side of a single PAOS conversation:
+ * StartPAOS, InitializeFramework, DIDAuthenticate EAC1 and EAC2,
+ * Transmit of DG04 and DG05 and the final StartPAOSResponse.
+ */
+class EidServerSession
+{
+	Q_DISABLE_COPY(EidServerSession)
+
+	public:
+		enum class State
+		{
+			START_PAOS,
+			INITIALIZE_FRAMEWORK,
+			EAC1,
+			EAC2,
+			TRANSMIT,
+			FINISHED,
+			FAILED
+		};
+
+	private:
+		struct Message
+		{
+			QString mType;
+			QString mMessageId;
+			QHash<QString, QString> mElements;
+			QStringList mOutputApdus;
+		};
+
+		const QSharedPointer<const EidServerCertificates> mCertificates;
+		const QByteArray mSessionId;
+		const QByteArray mPsk;
+		State mState;
+		QSharedPointer<EVP_PKEY> mEphemeralKey;
+		QScopedPointer<SecureMessaging> mSecureMessaging;
+		QByteArrayList mDataGroups;
+
+		static Message parse(const QByteArray& pData);
+		static QByteArray createEnvelope(const QString& pRelatesTo, const std::function<void(QXmlStreamWriter&)>& pBody);
+		static void writeConnectionHandle(QXmlStreamWriter& pWriter);
+		static void writeResult(QXmlStreamWriter& pWriter, const QString& pError = QString());
+
+		QByteArray fail(const Message& pMessage, const QString& pError);
+		QByteArray createInitializeFramework(const Message& pMessage);
+		QByteArray createEac1(const Message& pMessage);
+		QByteArray createEac2(const Message& pMessage);
+		QByteArray createTransmit(const Message& pMessage);
+		QByteArray createStartPaosResponse(const Message& pMessage, const QString& pError = QString());
+
+		[[nodiscard]] bool establishSecureMessaging(const Message& pMessage);
+
+	public:
+		EidServerSession(const QSharedPointer<const EidServerCertificates>& pCertificates, const QByteArray& pSessionId, const QByteArray& pPsk);
+
+		[[nodiscard]] const QByteArray& getSessionId() const;
+		[[nodiscard]] const QByteArray& getPsk() const;
+		[[nodiscard]] State getState() const;
+		[[nodiscard]] const QByteArrayList& getDataGroups() const;
+
+		/*!
+		 * Processes a message of the eID-Client and returns the next
+		 * message of the eID-Server.
+		 */
+		[[nodiscard]] QByteArray process(const QByteArray& pMessage);
+};
+
+} // namespace governikus
@@ -0,0 +1,319 @@
+/**
+ * Copyright (c) 2025 Governikus GmbH & Co. KG, Germany
+ */
+
+#include "LocalEidServer.h"
+
+#include "Env.h"
+#include "HttpResponse.h"
+#include "KeyPair.h"
+#include "Randomizer.h"
+#include "SecureStorage.h"
+
+#include <QDebug>
+#include <QHostAddress>
+#include <QJsonArray>
+#include <QNetworkProxy>
+#include <QSslSocket>
+#include <QXmlStreamWriter>
+
+
+using namespace governikus;
+
+
+namespace
+{
+constexpr const char* cSessionProperty = "eidServerSession";
+} // namespace
+
+
+LocalEidServer::LocalEidServer()
+	: QObject()
+	, mHttpServer()
+	, mPaosServer()
+	, mCertificates()
+	, mSessions()
+{
+	mHttpServer.setProxy(QNetworkProxy(QNetworkProxy::NoProxy));
+	mPaosServer.setProxy(QNetworkProxy(QNetworkProxy::NoProxy));
+
+	connect(&mHttpServer, &QTcpServer::pendingConnectionAvailable, this, &LocalEidServer::onNewHttpConnection);
+	connect(&mPaosServer, &QTcpServer::pendingConnectionAvailable, this, &LocalEidServer::onNewPaosConnection);
+	connect(&mPaosServer, &QSslServer::preSharedKeyAuthenticationRequired, this, &LocalEidServer::onPreSharedKeyAuthenticationRequired);
+	connect(&mPaosServer, &QSslServer::errorOccurred, this, [](QSslSocket* pSocket, QAbstractSocket::SocketError pError){
+			qWarning() << "TLS error:" << pError << pSocket->errorString();
+		});
+}
+
+
+bool LocalEidServer::listen()
+{
+	if (mHttpServer.isListening())
+	{
+		return true;
+	}
+
+	const auto& pair = KeyPair::generate(3072);
+	if (!pair.isValid())
+	{
+		qCritical() << "Cannot create TLS key pair";
+		return false;
+	}
+
+	auto config = Env::getSingleton<SecureStorage>()->getTlsConfig(SecureStorage::TlsSuite::PSK).getConfiguration();
+	config.setPrivateKey(pair.getKey());
+	config.setLocalCertificate(pair.getCertificate());
+	config.setPeerVerifyMode(QSslSocket::VerifyNone);
+	mPaosServer.setSslConfiguration(config);
+
+	if (!mHttpServer.listen(QHostAddress::LocalHost) || !mPaosServer.listen(QHostAddress::LocalHost))
+	{
+		qCritical() << "Cannot listen on localhost:" << mHttpServer.errorString() << mPaosServer.errorString();
+		mHttpServer.close();
+		mPaosServer.close();
+		return false;
+	}
+
+	mCertificates.reset(new EidServerCertificates(getUrl(false, QString()), {pair.getCertificate().toDer()}));
+	return true;
+}
+
+
+QUrl LocalEidServer::getUrl(bool pTls, const QString& pPath) const
+{
+	QUrl url;
+	url.setScheme(pTls ? QStringLiteral("https") : QStringLiteral("http"));
+	url.setHost(QHostAddress(QHostAddress::LocalHost).toString());
+	url.setPort(pTls ? mPaosServer.serverPort() : mHttpServer.serverPort());
+	url.setPath(pPath);
+	return url;
+}
+
+
+QUrl LocalEidServer::getTcTokenUrl() const
+{
+	return getUrl(false, QStringLiteral("/tcToken"));
+}
+
+
+QJsonObject LocalEidServer::getSimulatorData() const
+{
+	if (mCertificates.isNull())
+	{
+		return QJsonObject();
+	}
+
+	return QJsonObject {
+		{QStringLiteral("files"), QJsonArray {
+			 QJsonObject {
+				 {QStringLiteral("fileId"), QStringLiteral("0104")},
+				 {QStringLiteral("shortFileId"), QStringLiteral("04")},
+				 {QStringLiteral("content"), QStringLiteral("64070c054552494b41")}
+			 },
+			 QJsonObject {
+				 {QStringLiteral("fileId"), QStringLiteral("0105")},
+				 {QStringLiteral("shortFileId"), QStringLiteral("05")},
+				 {QStringLiteral("content"), QStringLiteral("650c0c0a4d55535445524d414e4e")}
+			 }
+		 }},
+		{QStringLiteral("trustPoint"), QString::fromLatin1(mCertificates->getCvca().toHex())}
+	};
+}
+
+
+qsizetype LocalEidServer::getSessionCount() const
+{
+	return mSessions.size();
+}
+
+
+QByteArray LocalEidServer::createTcToken()
+{
+	auto& randomizer = Randomizer::getInstance();
+	const auto& sessionId = randomizer.createBytes(16).toHex();
+	const auto& psk = randomizer.createBytes(32);
+	mSessions.insert(sessionId, QSharedPointer<EidServerSession>::create(mCertificates, sessionId, psk));
+
+	QUrl refreshAddress = getUrl(false, QStringLiteral("/refresh"));
+	refreshAddress.setQuery(QStringLiteral("session=") + QString::fromLatin1(sessionId));
+
+	QByteArray data;
+	QXmlStreamWriter writer(&data);
+	writer.writeStartDocument();
+	writer.writeStartElement(QStringLiteral("TCTokenType"));
+	writer.writeTextElement(QStringLiteral("ServerAddress"), getUrl(true, QStringLiteral("/paos")).toString());
+	writer.writeTextElement(QStringLiteral("SessionIdentifier"), QString::fromLatin1(sessionId));
+	writer.writeTextElement(QStringLiteral("RefreshAddress"), refreshAddress.toString());
+	writer.writeTextElement(QStringLiteral("CommunicationErrorAddress"), getUrl(false, QStringLiteral("/result")).toString());
+	writer.writeTextElement(QStringLiteral("Binding"), QStringLiteral("urn:liberty:paos:2006-08"));
+	writer.writeTextElement(QStringLiteral("PathSecurity-Protocol"), QStringLiteral("urn:ietf:rfc:4279"));
+	writer.writeStartElement(QStringLiteral("PathSecurity-Parameters"));
+	writer.writeTextElement(QStringLiteral("PSK"), QString::fromLatin1(psk.toHex()));
+	writer.writeEndElement();
+	writer.writeEndElement();
+	writer.writeEndDocument();
+	return data;
+}
+
+
+void LocalEidServer::acceptHttpRequest(QTcpSocket* pSocket)
+{
+	auto* request = new HttpRequest(pSocket, this);
+	connect(request, &HttpRequest::fireSocketStateChanged, request, [request](QAbstractSocket::SocketState pState){
+			if (pState == QAbstractSocket::UnconnectedState)
+			{
+				request->deleteLater();
+			}
+		});
+	connect(request, &HttpRequest::fireMessageComplete, this, &LocalEidServer::handleHttpRequest);
+	request->triggerSocketBuffer();
+}
+
+
+void LocalEidServer::acceptPaosRequest(QTcpSocket* pSocket)
+{
+	const auto& sessionId = pSocket->property(cSessionProperty).toByteArray();
+
+	auto* request = new HttpRequest(pSocket, this);
+	connect(request, &HttpRequest::fireSocketStateChanged, request, [request](QAbstractSocket::SocketState pState){
+			if (pState == QAbstractSocket::UnconnectedState)
+			{
+				request->deleteLater();
+			}
+		});
+	connect(request, &HttpRequest::fireMessageComplete, this, [this, sessionId](HttpRequest* pRequest){
+			handlePaosRequest(sessionId, pRequest);
+		});
+	request->triggerSocketBuffer();
+}
+
+
+QTcpSocket* LocalEidServer::takeConnection(HttpRequest* pRequest)
+{
+	pRequest->deleteLater();
+	if (!pRequest->isConnected())
+	{
+		return nullptr;
+	}
+
+	const bool close = pRequest->getHeader("Connection").compare("close", Qt::CaseInsensitive) == 0;
+	auto* socket = pRequest->take();
+	if (close)
+	{
+		connect(socket, &QAbstractSocket::disconnected, socket, &QObject::deleteLater);
+		socket->disconnectFromHost();
+		return nullptr;
+	}
+
+	// HttpRequest handles a single message and rolls back the read data. The
+	// eID-Client does not pipeline requests, so the socket only holds this one.
+	socket->readAll();
+	return socket;
+}
+
+
+void LocalEidServer::onNewHttpConnection()
+{
+	while (mHttpServer.hasPendingConnections())
+	{
+		acceptHttpRequest(mHttpServer.nextPendingConnection());
+	}
+}
+
+
+void LocalEidServer::handleHttpRequest(HttpRequest* pRequest)
+{
+	const auto& path = pRequest->getUrl().path();
+	if (pRequest->getHttpMethod() != HTTP_GET || mCertificates.isNull())
+	{
+		pRequest->send(HTTP_STATUS_METHOD_NOT_ALLOWED);
+	}
+	else if (path == QLatin1String("/tcToken"))
+	{
+		pRequest->send(HttpResponse(HTTP_STATUS_OK, createTcToken(), QByteArrayLiteral("text/xml; charset=utf-8")));
+	}
+	else if (path == QLatin1String("/refresh"))
+	{
+		const auto& sessionId = pRequest->getQuery().queryItemValue(QStringLiteral("session")).toLatin1();
+		const auto& session = mSessions.take(sessionId);
+		const bool success = session && session->getState() == EidServerSession::State::FINISHED;
+
+		QUrl result = getUrl(false, QStringLiteral("/result"));
+		result.setQuery(QStringLiteral("ResultMajor=") + (success ? QStringLiteral("ok") : QStringLiteral("error")));
+
+		HttpResponse response(HTTP_STATUS_SEE_OTHER);
+		response.setHeader(QByteArrayLiteral("Location"), result.toEncoded());
+		pRequest->send(response);
+	}
+	else if (path == QLatin1String("/result"))
+	{
+		pRequest->send(HttpResponse(HTTP_STATUS_OK, pRequest->getQuery().toString().toUtf8(), QByteArrayLiteral("text/plain")));
+	}
+	else
+	{
+		pRequest->send(HTTP_STATUS_NOT_FOUND);
+	}
+
+	if (auto* socket = takeConnection(pRequest))
+	{
+		acceptHttpRequest(socket);
+	}
+}
+
+
+void LocalEidServer::onPreSharedKeyAuthenticationRequired(QSslSocket* pSocket, QSslPreSharedKeyAuthenticator* pAuthenticator) const
+{
+	const auto& session = mSessions.value(pAuthenticator->identity());
+	if (session.isNull())
+	{
+		qWarning() << "Unknown PSK identity:" << pAuthenticator->identity();
+		return;
+	}
+
+	pSocket->setProperty(cSessionProperty, session->getSessionId());
+	pAuthenticator->setPreSharedKey(session->getPsk());
+}
+
+
+void LocalEidServer::onNewPaosConnection()
+{
+	while (mPaosServer.hasPendingConnections())
+	{
+		acceptPaosRequest(mPaosServer.nextPendingConnection());
+	}
+}
+
+
+void LocalEidServer::handlePaosRequest(const QByteArray& pSessionId, HttpRequest* pRequest)
+{
+	const auto& session = mSessions.value(pSessionId);
+	if (session.isNull() || pRequest->getHttpMethod() != HTTP_POST)
+	{
+		pRequest->send(HTTP_STATUS_FORBIDDEN);
+		if (auto* socket = takeConnection(pRequest))
+		{
+			acceptPaosRequest(socket);
+		}
+		return;
+	}
+
+	const auto& state = session->getState();
+	const auto& response = session->process(pRequest->getBody());
+	pRequest->send(HttpResponse(HTTP_STATUS_OK, response, QByteArrayLiteral("application/vnd.paos+xml")));
+	if (auto* socket = takeConnection(pRequest))
+	{
+		acceptPaosRequest(socket);
+	}
+
+	if (state != session->getState())
+	{
+		if (session->getState() == EidServerSession::State::FINISHED)
+		{
+			Q_EMIT fireSessionFinished(pSessionId, true, session->getDataGroups());
+		}
+		else if (session->getState() == EidServerSession::State::FAILED)
+		{
+			Q_EMIT fireSessionFinished(pSessionId, false, QByteArrayList());
+		}
+	}
+}
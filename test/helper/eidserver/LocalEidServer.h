@@ -0,0 +1,69 @@
+/**
+ * Copyright (c) 2025 Governikus GmbH & Co. KG, Germany
+ */
+
+#pragma once
+
+#include "EidServerCertificates.h"
+#include "EidServerSession.h"
+#include "HttpRequest.h"
+
+#include <QByteArray>
+#include <QByteArrayList>
+#include <QHash>
+#include <QJsonObject>
+#include <QSharedPointer>
+#include <QSslPreSharedKeyAuthenticator>
+#include <QSslServer>
+#include <QTcpServer>
+#include <QUrl>
+
+
+namespace governikus
+{
+
+/*!
+ * Stand-in for an eID-Server that runs on localhost without any
+ * infrastructure. Every request of getTcTokenUrl() starts a new session
+ * that reads the given names and the family name.
+ *
+ * The eID-Client needs the developer mode with disabled pre-verification
+ * and the card simulator needs the data of getSimulatorData().
+ */
+class LocalEidServer
+	: public QObject
+{
+	Q_OBJECT
+
+	private:
+		QTcpServer mHttpServer;
+		QSslServer mPaosServer;
+		QSharedPointer<const EidServerCertificates> mCertificates;
+		QHash<QByteArray, QSharedPointer<EidServerSession>> mSessions;
+
+		[[nodiscard]] QUrl getUrl(bool pTls, const QString& pPath) const;
+		[[nodiscard]] QByteArray createTcToken();
+		void acceptHttpRequest(QTcpSocket* pSocket);
+		void acceptPaosRequest(QTcpSocket* pSocket);
+		[[nodiscard]] QTcpSocket* takeConnection(HttpRequest* pRequest);
+		void handleHttpRequest(HttpRequest* pRequest);
+		void handlePaosRequest(const QByteArray& pSessionId, HttpRequest* pRequest);
+
+	private Q_SLOTS:
+		void onNewHttpConnection();
+		void onNewPaosConnection();
+		void onPreSharedKeyAuthenticationRequired(QSslSocket* pSocket, QSslPreSharedKeyAuthenticator* pAuthenticator) const;
+
+	public:
+		LocalEidServer();
+
+		[[nodiscard]] bool listen();
+		[[nodiscard]] QUrl getTcTokenUrl() const;
+		[[nodiscard]] QJsonObject getSimulatorData() const;
+		[[nodiscard]] qsizetype getSessionCount() const;
+
+	Q_SIGNALS:
+		void fireSessionFinished(const QByteArray& pSessionId, bool pSuccess, const QByteArrayList& pDataGroups);
+};
+
+} // namespace governikus
@@ -0,0 +1,154 @@
+/**
+ * Copyright (c) 2025 Governikus GmbH & Co. KG, Germany
+ */
+
+#include "AusweisApp_p.h"
+
+#include "QtHooks.h"
+
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#define CHECK(condition)\
+		if (!(condition))\
+		{\
+			std::cout << "**** Check failed in line " << __LINE__ << ": " << #condition << std::endl;\
+			return false;\
+		}
+
+
+namespace
+{
+bool pollMessage(std::string& pMessage)
+{
+	const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+	while (std::chrono::steady_clock::now() < deadline)
+	{
+		const size_t required = ausweisapp_poll(nullptr, 0);
+		if (required == 0)
+		{
+			std::this_thread::sleep_for(std::chrono::milliseconds(10));
+			continue;
+		}
+
+		std::vector<char> buffer(required);
+		CHECK(ausweisapp_poll(buffer.data(), required - 1) == required)
+		CHECK(ausweisapp_poll(buffer.data(), required) == required)
+		CHECK(buffer[required - 1] == '\0')
+
+		pMessage = std::string(buffer.data());
+		std::cout << "**** Polled msg: " << pMessage << std::endl;
+		return true;
+	}
+
+	std::cout << "**** Timeout while polling" << std::endl;
+	return false;
+}
+
+
+bool expectMessage(const char* pMsg)
+{
+	const std::string expected = std::string(R"("msg":")") + pMsg + '"';
+
+	std::string message;
+	do
+	{
+		CHECK(pollMessage(message))
+	}
+	while (message.find(R"("msg":"READER")") != std::string::npos);
+
+	CHECK(message.find(expected) != std::string::npos)
+	return true;
+}
+
+
+bool checkPolling()
+{
+	std::string message;
+	CHECK(pollMessage(message))
+	CHECK(message.empty())
+
+	const std::string buffer = std::string(R"({"cmd": "GET_API_LEVEL"})") + "trailing garbage";
+	ausweisapp_send_buffer(buffer.data(), std::strlen(R"({"cmd": "GET_API_LEVEL"})"));
+	ausweisapp_send_buffer(buffer.data(), 0);
+	CHECK(expectMessage("API_LEVEL"))
+
+	const char* const cmds[] = {R"({"cmd": "GET_INFO"})", R"({"cmd": "GET_INFO"})", R"({"cmd": "GET_API_LEVEL"})", nullptr};
+	const size_t lengths[] = {std::strlen(cmds[0]), 0, std::strlen(cmds[2]), 0};
+	ausweisapp_send_batch(cmds, lengths, 4);
+	ausweisapp_send(R"({"cmd": "GET_INFO"})");
+	CHECK(expectMessage("INFO"))
+	CHECK(expectMessage("API_LEVEL"))
+	CHECK(expectMessage("INFO"))
+
+	return true;
+}
+
+
+bool checkOverflow()
+{
+	while (ausweisapp_poll(nullptr, 0) > 0)
+	{
+		std::vector<char> buffer(ausweisapp_poll(nullptr, 0));
+		ausweisapp_poll(buffer.data(), buffer.size());
+	}
+
+	for (size_t i = 0; i < governikus::cMaxPollMessages + 10; ++i)
+	{
+		governikus::ausweisapp_push_message_internal(QByteArray::number(static_cast<qulonglong>(i)));
+	}
+
+	size_t count = 0;
+	std::string message;
+	while (ausweisapp_poll(nullptr, 0) > 0)
+	{
+		std::vector<char> buffer(ausweisapp_poll(nullptr, 0));
+		ausweisapp_poll(buffer.data(), buffer.size());
+		message = std::string(buffer.data());
+		++count;
+	}
+
+	CHECK(count == governikus::cMaxPollMessages)
+	CHECK(message.find(R"("msg":"INTERNAL_ERROR")") != std::string::npos)
+	return true;
+}
+
+
+} // namespace
+
+
+int main()
+{
+	if (!governikus::QtHooks::init())
+	{
+		std::cout << "Cannot initialize QtHooks" << std::endl;
+		return -2;
+	}
+
+#if defined(LIBS_GOVERNIKUS)
+	const char* parameter = nullptr;
+#else
+	const char* parameter = "--no-proxy";
+#endif
+
+	if (!ausweisapp_init_poll(parameter))
+	{
+		std::cout << "Cannot initialize AusweisApp" << std::endl;
+		return -1;
+	}
+
+	const bool polling = checkPolling();
+	ausweisapp_shutdown();
+
+	if (!polling || !checkOverflow())
+	{
+		return -1;
+	}
+
+	std::cout << "**** Finished" << std::endl;
+	return 0;
+}
@@ -0,0 +1,293 @@
+/**
+ * Copyright (c) 2025 Governikus GmbH & Co. KG, Germany
+ */
+
+#include "LoadConfiguration.h"
+
+#include <utility>
+
+
+using namespace governikus;
+
+
+LoadConfiguration::LoadConfiguration(bool pWebSocket)
+	: mParser()
+	, mOptions()
+	, mWebSocket(pWebSocket)
+	, mOptionHelp(QStringLiteral("help"), QStringLiteral("Displays this help."))
+	, mOptionSessions(QStringLiteral("sessions"), QStringLiteral("Number of concurrent sessions."), QStringLiteral("count"), QStringLiteral("4"))
+	, mOptionIterations(QStringLiteral("iterations"), QStringLiteral("Number of scenarios per session."), QStringLiteral("count"), QStringLiteral("100"))
+	, mOptionDuration(QStringLiteral("duration"), QStringLiteral("Stop all sessions after the given seconds. 0 is unlimited."), QStringLiteral("seconds"), QStringLiteral("0"))
+	, mOptionTimeout(QStringLiteral("timeout"), QStringLiteral("Abort a scenario after the given seconds."), QStringLiteral("seconds"), QStringLiteral("60"))
+	, mOptionMix(QStringLiteral("mix"), QStringLiteral("Weighted scenarios of GET_INFO, GET_READER_LIST, RUN_AUTH, RUN_CHANGE_PIN and CANCEL."), QStringLiteral("mix"),
+			QStringLiteral("GET_INFO=40,GET_READER_LIST=30,RUN_AUTH=10,RUN_CHANGE_PIN=10,CANCEL=10"))
+	, mOptionTcTokenUrl(QStringLiteral("tc-token-url"), QStringLiteral("TcToken URL of RUN_AUTH. Uses a local eID-Server stand-in if omitted."), QStringLiteral("url"))
+	, mOptionReport(QStringLiteral("report"), QStringLiteral("Write the report as JSON to the given file."), QStringLiteral("file"))
+	, mOptionSeed(QStringLiteral("seed"), QStringLiteral("Seed of the scenario selection."), QStringLiteral("seed"), QStringLiteral("0"))
+	, mOptionPort(QStringLiteral("port"), QStringLiteral("Connect to a running instance instead of spawning one."), QStringLiteral("port"))
+	, mOptionBinary(QStringLiteral("binary"), QStringLiteral("Path of the spawned AusweisApp."), QStringLiteral("file"))
+	, mSessions(1)
+	, mIterations(0)
+	, mDuration(0)
+	, mTimeout(0)
+	, mMix()
+	, mTcTokenUrl()
+	, mReport()
+	, mPort(0)
+	, mBinary()
+	, mSeed(0)
+{
+	if (mWebSocket)
+	{
+		mOptions << mOptionSessions;
+	}
+	mOptions << mOptionIterations << mOptionDuration << mOptionTimeout << mOptionMix << mOptionTcTokenUrl << mOptionReport << mOptionSeed;
+	if (mWebSocket)
+	{
+		mOptions << mOptionPort << mOptionBinary;
+	}
+	mOptions << mOptionHelp;
+	mParser.addOptions(mOptions);
+}
+
+
+bool LoadConfiguration::parseNumber(const QString& pValue, int pMin, int& pTarget)
+{
+	bool ok = false;
+	const int value = pValue.toInt(&ok);
+	if (!ok || value < pMin)
+	{
+		return false;
+	}
+
+	pTarget = value;
+	return true;
+}
+
+
+bool LoadConfiguration::parseMix(const QString& pMix)
+{
+	mMix.clear();
+	const auto& entries = pMix.split(QLatin1Char(','), Qt::SkipEmptyParts);
+	for (const auto& entry : entries)
+	{
+		const auto& pair = entry.split(QLatin1Char('='));
+		const auto& name = pair.constFirst().trimmed().toUpper();
+
+		bool valid = false;
+		for (const auto scenario : Enum<LoadScenario>::getList())
+		{
+			if (getEnumName(scenario) == name)
+			{
+				int weight = 1;
+				if (pair.size() > 2 || (pair.size() == 2 && !parseNumber(pair.at(1), 0, weight)))
+				{
+					return false;
+				}
+
+				if (weight > 0)
+				{
+					mMix.insert(scenario, weight);
+				}
+				valid = true;
+				break;
+			}
+		}
+
+		if (!valid)
+		{
+			return false;
+		}
+	}
+
+	return !mMix.isEmpty();
+}
+
+
+QString LoadConfiguration::parse(const QStringList& pArguments)
+{
+	if (!mParser.parse(pArguments))
+	{
+		return mParser.errorText();
+	}
+
+	if (isHelpSet())
+	{
+		return QString();
+	}
+
+	if (mWebSocket && !parseNumber(mParser.value(mOptionSessions), 1, mSessions))
+	{
+		return QStringLiteral("Invalid number of sessions: %1").arg(mParser.value(mOptionSessions));
+	}
+
+	if (!parseNumber(mParser.value(mOptionIterations), 1, mIterations))
+	{
+		return QStringLiteral("Invalid number of iterations: %1").arg(mParser.value(mOptionIterations));
+	}
+
+	if (!parseNumber(mParser.value(mOptionDuration), 0, mDuration))
+	{
+		return QStringLiteral("Invalid duration: %1").arg(mParser.value(mOptionDuration));
+	}
+
+	if (!parseNumber(mParser.value(mOptionTimeout), 1, mTimeout))
+	{
+		return QStringLiteral("Invalid timeout: %1").arg(mParser.value(mOptionTimeout));
+	}
+
+	if (!parseMix(mParser.value(mOptionMix)))
+	{
+		return QStringLiteral("Invalid scenario mix: %1").arg(mParser.value(mOptionMix));
+	}
+
+	if (mParser.isSet(mOptionTcTokenUrl))
+	{
+		mTcTokenUrl = QUrl(mParser.value(mOptionTcTokenUrl));
+		if (!mTcTokenUrl.isValid())
+		{
+			return QStringLiteral("Invalid TcToken URL: %1").arg(mParser.value(mOptionTcTokenUrl));
+		}
+	}
+
+	bool ok = false;
+	mSeed = mParser.value(mOptionSeed).toUInt(&ok);
+	if (!ok)
+	{
+		return QStringLiteral("Invalid seed: %1").arg(mParser.value(mOptionSeed));
+	}
+
+	if (mWebSocket && mParser.isSet(mOptionPort))
+	{
+		mPort = mParser.value(mOptionPort).toUShort(&ok);
+		if (!ok || mPort == 0)
+		{
+			return QStringLiteral("Invalid port: %1").arg(mParser.value(mOptionPort));
+		}
+	}
+
+	mReport = mParser.value(mOptionReport);
+	if (mWebSocket)
+	{
+		mBinary = mParser.value(mOptionBinary);
+	}
+	return QString();
+}
+
+
+bool LoadConfiguration::isHelpSet() const
+{
+	return mParser.isSet(mOptionHelp);
+}
+
+
+QString LoadConfiguration::getHelpText() const
+{
+	// QCommandLineParser::helpText() requires a QCoreApplication that does not exist with the C API.
+	QString help = QStringLiteral("Options:\n");
+	for (const auto& option : std::as_const(mOptions))
+	{
+		auto name = QStringLiteral("--") + option.names().constFirst();
+		if (!option.valueName().isEmpty())
+		{
+			name += QStringLiteral(" <%1>").arg(option.valueName());
+		}
+
+		help += QStringLiteral("  %1 %2").arg(name, -28).arg(option.description());
+		if (!option.defaultValues().isEmpty())
+		{
+			help += QStringLiteral(" Default: %1").arg(option.defaultValues().constFirst());
+		}
+		help += QLatin1Char('\n');
+	}
+
+	return help;
+}
+
+
+int LoadConfiguration::getSessions() const
+{
+	return mSessions;
+}
+
+
+int LoadConfiguration::getIterations() const
+{
+	return mIterations;
+}
+
+
+int LoadConfiguration::getDuration() const
+{
+	return mDuration;
+}
+
+
+int LoadConfiguration::getTimeout() const
+{
+	return mTimeout;
+}
+
+
+const QMap<LoadScenario, int>& LoadConfiguration::getMix() const
+{
+	return mMix;
+}
+
+
+bool LoadConfiguration::contains(LoadScenario pScenario) const
+{
+	return mMix.contains(pScenario);
+}
+
+
+QUrl LoadConfiguration::getTcTokenUrl() const
+{
+	return mTcTokenUrl;
+}
+
+
+QString LoadConfiguration::getReport() const
+{
+	return mReport;
+}
+
+
+quint16 LoadConfiguration::getPort() const
+{
+	return mPort;
+}
+
+
+QString LoadConfiguration::getBinary() const
+{
+	return mBinary;
+}
+
+
+quint32 LoadConfiguration::getSeed() const
+{
+	return mSeed;
+}
+
+
+LoadScenario LoadConfiguration::pickScenario(QRandomGenerator& pRandom) const
+{
+	int total = 0;
+	for (const auto weight : mMix)
+	{
+		total += weight;
+	}
+
+	auto value = static_cast<int>(pRandom.bounded(total));
+	for (auto iter = mMix.cbegin(); iter != mMix.cend(); ++iter)
+	{
+		if (value < iter.value())
+		{
+			return iter.key();
+		}
+		value -= iter.value();
+	}
+
+	return mMix.lastKey();
+}
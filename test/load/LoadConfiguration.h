@@ -0,0 +1,87 @@
+/**
+ * Copyright (c) 2025 Governikus GmbH & Co. KG, Germany
+ */
+
+#pragma once
+
+#include "EnumHelper.h"
+
+#include <QCommandLineParser>
+#include <QList>
+#include <QMap>
+#include <QRandomGenerator>
+#include <QString>
+#include <QStringList>
+#include <QUrl>
+
+
+namespace governikus
+{
+
+defineEnumType(LoadScenario,
+		GET_INFO,
+		GET_READER_LIST,
+		RUN_AUTH,
+		RUN_CHANGE_PIN,
+		CANCEL
+		)
+
+class LoadConfiguration
+{
+	Q_DISABLE_COPY(LoadConfiguration)
+
+	private:
+		QCommandLineParser mParser;
+		QList<QCommandLineOption> mOptions;
+		const bool mWebSocket;
+		const QCommandLineOption mOptionHelp;
+		const QCommandLineOption mOptionSessions;
+		const QCommandLineOption mOptionIterations;
+		const QCommandLineOption mOptionDuration;
+		const QCommandLineOption mOptionTimeout;
+		const QCommandLineOption mOptionMix;
+		const QCommandLineOption mOptionTcTokenUrl;
+		const QCommandLineOption mOptionReport;
+		const QCommandLineOption mOptionSeed;
+		const QCommandLineOption mOptionPort;
+		const QCommandLineOption mOptionBinary;
+		int mSessions;
+		int mIterations;
+		int mDuration;
+		int mTimeout;
+		QMap<LoadScenario, int> mMix;
+		QUrl mTcTokenUrl;
+		QString mReport;
+		quint16 mPort;
+		QString mBinary;
+		quint32 mSeed;
+
+		[[nodiscard]] bool parseMix(const QString& pMix);
+		[[nodiscard]] static bool parseNumber(const QString& pValue, int pMin, int& pTarget);
+
+	public:
+		explicit LoadConfiguration(bool pWebSocket);
+
+		/*!
+		 * Returns an error message if the arguments are invalid.
+		 */
+		[[nodiscard]] QString parse(const QStringList& pArguments);
+		[[nodiscard]] bool isHelpSet() const;
+		[[nodiscard]] QString getHelpText() const;
+
+		[[nodiscard]] int getSessions() const;
+		[[nodiscard]] int getIterations() const;
+		[[nodiscard]] int getDuration() const;
+		[[nodiscard]] int getTimeout() const;
+		[[nodiscard]] const QMap<LoadScenario, int>& getMix() const;
+		[[nodiscard]] bool contains(LoadScenario pScenario) const;
+		[[nodiscard]] QUrl getTcTokenUrl() const;
+		[[nodiscard]] QString getReport() const;
+		[[nodiscard]] quint16 getPort() const;
+		[[nodiscard]] QString getBinary() const;
+		[[nodiscard]] quint32 getSeed() const;
+
+		[[nodiscard]] LoadScenario pickScenario(QRandomGenerator& pRandom) const;
+};
+
+} // namespace governikus
@@ -0,0 +1,166 @@
+/**
+ * Copyright (c) 2025 Governikus GmbH & Co. KG, Germany
+ */
+
+#include "AusweisApp_p.h"
+
+#include "LoadConfiguration.h"
+#include "LoadSession.h"
+#include "LoadStatistics.h"
+#include "QtHooks.h"
+
+#include <QCoreApplication>
+#include <QJsonDocument>
+#include <QSaveFile>
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+
+using namespace governikus;
+
+
+namespace
+{
+// The C API has a single channel, so there is only one session.
+std::unique_ptr<LoadConfiguration> cConfiguration; // clazy:exclude=non-pod-global-static
+std::unique_ptr<LoadStatistics> cStatistics; // clazy:exclude=non-pod-global-static
+std::unique_ptr<LoadSession> cSession; // clazy:exclude=non-pod-global-static
+std::unique_ptr<QRandomGenerator> cRandom; // clazy:exclude=non-pod-global-static
+std::recursive_mutex cMutex;
+std::atomic_bool cFinished = false;
+int cIterations = 0;
+
+
+void startNext()
+{
+	const auto duration = cConfiguration->getDuration();
+	const bool expired = duration > 0 && cStatistics->getDuration() >= qint64(duration) * 1000;
+	if (cIterations >= cConfiguration->getIterations() || expired)
+	{
+		cStatistics->stop();
+		cFinished = true;
+		ausweisapp_shutdown();
+		return;
+	}
+
+	++cIterations;
+	cSession->start(cConfiguration->pickScenario(*cRandom));
+}
+
+
+void callback(const char* pMessage)
+{
+	const std::lock_guard<std::recursive_mutex> lock(cMutex);
+	if (cFinished)
+	{
+		return;
+	}
+
+	if (pMessage == nullptr)
+	{
+		cStatistics->start();
+		startNext();
+		return;
+	}
+
+	const bool running = cSession->isRunning();
+	cSession->handleMessage(QByteArray(pMessage));
+	if (running && !cSession->isRunning())
+	{
+		startNext();
+	}
+}
+
+
+} // namespace
+
+
+int main(int argc, char** argv)
+{
+	if (!QtHooks::init())
+	{
+		std::cout << "Cannot initialize QtHooks" << std::endl;
+		return 2;
+	}
+
+	QStringList arguments;
+	for (int i = 0; i < argc; ++i)
+	{
+		arguments << QString::fromLocal8Bit(argv[i]);
+	}
+
+	cConfiguration = std::make_unique<LoadConfiguration>(false);
+	if (const auto& error = cConfiguration->parse(arguments); !error.isEmpty())
+	{
+		std::cerr << qPrintable(error) << std::endl << std::endl << qPrintable(cConfiguration->getHelpText());
+		return 2;
+	}
+
+	if (cConfiguration->isHelpSet())
+	{
+		std::cout << qPrintable(cConfiguration->getHelpText());
+		return 0;
+	}
+
+	const bool auth = cConfiguration->contains(LoadScenario::RUN_AUTH) || cConfiguration->contains(LoadScenario::CANCEL);
+	if (auth && cConfiguration->getTcTokenUrl().isEmpty())
+	{
+		std::cerr << "RUN_AUTH and CANCEL require --tc-token-url" << std::endl;
+		return 2;
+	}
+
+	cStatistics = std::make_unique<LoadStatistics>();
+	cRandom = std::make_unique<QRandomGenerator>(cConfiguration->getSeed());
+	cSession = std::make_unique<LoadSession>([](const QByteArray& pMessage){
+				ausweisapp_send(pMessage.constData());
+			}, *cStatistics, cConfiguration->getTcTokenUrl(), QJsonObject());
+
+	cStatistics->addMemorySample(LoadStatistics::getResidentMemory(QCoreApplication::applicationPid()));
+	if (!ausweisapp_init(&callback, "--no-loghandler"))
+	{
+		return 2;
+	}
+
+	using namespace std::chrono_literals;
+	while (!cFinished)
+	{
+		std::this_thread::sleep_for(1s);
+
+		const std::lock_guard<std::recursive_mutex> lock(cMutex);
+		if (cFinished)
+		{
+			break;
+		}
+
+		cStatistics->addMemorySample(LoadStatistics::getResidentMemory(QCoreApplication::applicationPid()));
+		if (cSession->checkTimeout(cConfiguration->getTimeout()))
+		{
+			std::cerr << "Session timed out" << std::endl;
+			startNext();
+		}
+	}
+
+	ausweisapp_join_thread_internal();
+
+	cStatistics->addMemorySample(LoadStatistics::getResidentMemory(QCoreApplication::applicationPid()));
+	cStatistics->setLeakedObjects(static_cast<qint64>(QtHooks::getQObjects().size()));
+	std::cout << qPrintable(cStatistics->toText()) << std::flush;
+
+	if (const auto& path = cConfiguration->getReport(); !path.isEmpty())
+	{
+		QSaveFile file(path);
+		if (!file.open(QIODevice::WriteOnly)
+				|| file.write(QJsonDocument(cStatistics->toJson()).toJson()) < 0
+				|| !file.commit())
+		{
+			std::cerr << "Cannot write report: " << qPrintable(path) << std::endl;
+		}
+	}
+
+	return cStatistics->getErrors() == 0 ? 0 : 1;
+}
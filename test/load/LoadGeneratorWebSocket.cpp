@@ -0,0 +1,389 @@
+/**
+ * Copyright (c) 2025 Governikus GmbH & Co. KG, Germany
+ */
+
+#include "LoadConfiguration.h"
+#include "LoadSession.h"
+#include "LoadStatistics.h"
+#include "PortFile.h"
+
+#ifdef LOCAL_EID_SERVER
+	#include "LocalEidServer.h"
+#endif
+
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QJsonDocument>
+#include <QNetworkRequest>
+#include <QProcess>
+#include <QProcessEnvironment>
+#include <QSaveFile>
+#include <QSettings>
+#include <QSharedPointer>
+#include <QTemporaryDir>
+#include <QTextStream>
+#include <QTimer>
+#include <QWebSocket>
+
+#include <iostream>
+
+
+using namespace governikus;
+
+
+namespace
+{
+constexpr int cProcessTimeout = 30000;
+} // namespace
+
+
+class WebSocketLoadGenerator
+	: public QObject
+{
+	Q_OBJECT
+
+	private:
+		struct Connection
+		{
+			QSharedPointer<QWebSocket> mSocket;
+			QSharedPointer<LoadSession> mSession;
+			int mIterations = 0;
+			bool mFinished = false;
+		};
+
+		const LoadConfiguration& mConfiguration;
+		LoadStatistics mStatistics;
+		QRandomGenerator mRandom;
+		QProcess mProcess;
+		QTemporaryDir mSettingsDir;
+		bool mLocalEidServer;
+		QList<Connection> mConnections;
+		QTimer mTimer;
+		QElapsedTimer mStartup;
+		QUrl mTcTokenUrl;
+#ifdef LOCAL_EID_SERVER
+		LocalEidServer mEidServer;
+#endif
+
+		void prepareSettings()
+		{
+#if defined(Q_OS_LINUX) || defined(Q_OS_FREEBSD)
+			// The spawned instance gets throwaway settings and never touches the ones of the user.
+			auto environment = QProcessEnvironment::systemEnvironment();
+			environment.insert(QStringLiteral("XDG_CONFIG_HOME"), mSettingsDir.filePath(QStringLiteral("config")));
+			environment.insert(QStringLiteral("XDG_DATA_HOME"), mSettingsDir.filePath(QStringLiteral("data")));
+			environment.insert(QStringLiteral("XDG_CACHE_HOME"), mSettingsDir.filePath(QStringLiteral("cache")));
+			mProcess.setProcessEnvironment(environment);
+
+			if (mLocalEidServer)
+			{
+				// The CVCA of the local eID-Server is not a trusted root
+				const auto& organization = QString::fromUtf8(SETTINGS_ORGANIZATION);
+				QSettings settings(mSettingsDir.filePath(QStringLiteral("config/%1/AusweisApp2.conf").arg(organization)), QSettings::IniFormat);
+				settings.setValue(QStringLiteral("preverification/enabled"), false);
+				settings.sync();
+			}
+#else
+			if (mLocalEidServer)
+			{
+				std::cerr << "The local eID-Server needs AusweisApp with disabled pre-verification" << std::endl;
+			}
+#endif
+		}
+
+
+		void startProcess()
+		{
+			auto binary = mConfiguration.getBinary();
+			if (binary.isEmpty())
+			{
+				binary = QStringLiteral(AUSWEISAPP_BINARY_DIR "AusweisApp");
+#ifdef Q_OS_WIN
+				binary += QStringLiteral(".exe");
+#endif
+			}
+
+			prepareSettings();
+			mProcess.setProgram(binary);
+			mProcess.setArguments({QStringLiteral("--ui"), QStringLiteral("websocket"), QStringLiteral("--port"), QStringLiteral("0")
+#ifndef Q_OS_WIN
+						, QStringLiteral("-platform"), QStringLiteral("offscreen")
+#endif
+					});
+			mProcess.setProcessChannelMode(QProcess::ForwardedErrorChannel);
+			mProcess.start();
+			if (!mProcess.waitForStarted(cProcessTimeout))
+			{
+				std::cerr << "Cannot start " << qPrintable(binary) << ": " << qPrintable(mProcess.errorString()) << std::endl;
+				QCoreApplication::exit(2);
+				return;
+			}
+
+			mStartup.start();
+			QTimer::singleShot(100, this, &WebSocketLoadGenerator::onWaitForPort);
+		}
+
+
+		void connectSessions(quint16 pPort)
+		{
+			const QUrl url(QStringLiteral("ws://127.0.0.1:%1/eID-Kernel").arg(pPort));
+			QJsonObject simulator;
+#ifdef LOCAL_EID_SERVER
+			simulator = mEidServer.getSimulatorData();
+#endif
+
+			for (int i = 0; i < mConfiguration.getSessions(); ++i)
+			{
+				Connection connection;
+				connection.mSocket.reset(new QWebSocket());
+				auto* socket = connection.mSocket.data();
+				connection.mSession.reset(new LoadSession([socket](const QByteArray& pMessage){
+							socket->sendTextMessage(QString::fromUtf8(pMessage));
+						}, mStatistics, mTcTokenUrl, simulator));
+
+				connect(socket, &QWebSocket::connected, this, [this, i] {
+							startNext(i);
+						});
+				connect(socket, &QWebSocket::textMessageReceived, this, [this, i](const QString& pMessage) {
+							onMessage(i, pMessage);
+						});
+				connect(socket, &QWebSocket::disconnected, this, [this, i] {
+							onDisconnected(i);
+						});
+				mConnections << connection;
+
+				QNetworkRequest request(url);
+				request.setHeader(QNetworkRequest::UserAgentHeader, QStringLiteral("AusweisAppLoadGenerator"));
+				connection.mSocket->open(request);
+			}
+
+			mStatistics.start();
+			mTimer.start();
+		}
+
+
+		void startNext(int pIndex)
+		{
+			auto& connection = mConnections[pIndex];
+			const bool expired = mConfiguration.getDuration() > 0 && mStatistics.getDuration() >= qint64(mConfiguration.getDuration()) * 1000;
+			if (connection.mIterations >= mConfiguration.getIterations() || expired)
+			{
+				connection.mFinished = true;
+				connection.mSocket->close();
+				checkFinished();
+				return;
+			}
+
+			++connection.mIterations;
+			connection.mSession->start(mConfiguration.pickScenario(mRandom));
+		}
+
+
+		void onMessage(int pIndex, const QString& pMessage)
+		{
+			auto& session = *mConnections[pIndex].mSession;
+			const bool running = session.isRunning();
+			session.handleMessage(pMessage.toUtf8());
+			if (running && !session.isRunning())
+			{
+				startNext(pIndex);
+			}
+		}
+
+
+		void onDisconnected(int pIndex)
+		{
+			auto& connection = mConnections[pIndex];
+			if (connection.mFinished)
+			{
+				return;
+			}
+
+			std::cerr << "Session " << pIndex << " disconnected: " << qPrintable(connection.mSocket->closeReason()) << std::endl;
+			if (connection.mSession->isRunning())
+			{
+				connection.mSession->checkTimeout(0);
+			}
+			connection.mFinished = true;
+			checkFinished();
+		}
+
+
+		void checkFinished()
+		{
+			for (const auto& connection : std::as_const(mConnections))
+			{
+				if (!connection.mFinished)
+				{
+					return;
+				}
+			}
+
+			mTimer.stop();
+			mStatistics.stop();
+			sampleMemory();
+			report();
+
+			if (mProcess.state() != QProcess::NotRunning)
+			{
+				mProcess.terminate();
+				if (!mProcess.waitForFinished(cProcessTimeout))
+				{
+					mProcess.kill();
+				}
+			}
+
+			QCoreApplication::exit(mStatistics.getErrors() == 0 ? 0 : 1);
+		}
+
+
+		void sampleMemory()
+		{
+			if (mProcess.state() == QProcess::Running)
+			{
+				mStatistics.addMemorySample(LoadStatistics::getResidentMemory(mProcess.processId()));
+			}
+		}
+
+
+		void report() const
+		{
+			std::cout << qPrintable(mStatistics.toText()) << std::flush;
+
+			if (const auto& path = mConfiguration.getReport(); !path.isEmpty())
+			{
+				QSaveFile file(path);
+				if (!file.open(QIODevice::WriteOnly)
+						|| file.write(QJsonDocument(mStatistics.toJson()).toJson()) < 0
+						|| !file.commit())
+				{
+					std::cerr << "Cannot write report: " << qPrintable(path) << std::endl;
+				}
+			}
+		}
+
+	private Q_SLOTS:
+		void onWaitForPort()
+		{
+			QFile portFile(PortFile::getPortFilename(QString(), mProcess.processId(), QStringLiteral("AusweisApp")));
+			if (portFile.open(QIODevice::ReadOnly))
+			{
+				quint16 port = 0;
+				QTextStream(&portFile) >> port;
+				if (port > 0)
+				{
+					sampleMemory();
+					connectSessions(port);
+					return;
+				}
+			}
+
+			if (mProcess.state() != QProcess::Running || mStartup.hasExpired(cProcessTimeout))
+			{
+				std::cerr << "AusweisApp did not provide a port" << std::endl;
+				mProcess.kill();
+				QCoreApplication::exit(2);
+				return;
+			}
+
+			QTimer::singleShot(100, this, &WebSocketLoadGenerator::onWaitForPort);
+		}
+
+
+		void onTimer()
+		{
+			sampleMemory();
+			for (int i = 0; i < mConnections.size(); ++i)
+			{
+				if (!mConnections.at(i).mFinished && mConnections.at(i).mSession->checkTimeout(mConfiguration.getTimeout()))
+				{
+					std::cerr << "Session " << i << " timed out" << std::endl;
+					startNext(i);
+				}
+			}
+		}
+
+	public:
+		explicit WebSocketLoadGenerator(const LoadConfiguration& pConfiguration)
+			: QObject()
+			, mConfiguration(pConfiguration)
+			, mStatistics()
+			, mRandom(pConfiguration.getSeed())
+			, mProcess()
+			, mSettingsDir()
+			, mLocalEidServer(false)
+			, mConnections()
+			, mTimer()
+			, mStartup()
+			, mTcTokenUrl(pConfiguration.getTcTokenUrl())
+		{
+			mTimer.setInterval(1000);
+			connect(&mTimer, &QTimer::timeout, this, &WebSocketLoadGenerator::onTimer);
+		}
+
+
+		[[nodiscard]] bool run()
+		{
+			const bool auth = mConfiguration.contains(LoadScenario::RUN_AUTH) || mConfiguration.contains(LoadScenario::CANCEL);
+			if (auth && mTcTokenUrl.isEmpty())
+			{
+#ifdef LOCAL_EID_SERVER
+				if (!mEidServer.listen())
+				{
+					std::cerr << "Cannot start the local eID-Server" << std::endl;
+					return false;
+				}
+				mTcTokenUrl = mEidServer.getTcTokenUrl();
+				mLocalEidServer = true;
+				std::cout << "Using local eID-Server: " << qPrintable(mTcTokenUrl.toString()) << std::endl;
+#else
+				std::cerr << "RUN_AUTH and CANCEL require --tc-token-url" << std::endl;
+				return false;
+#endif
+			}
+
+			if (mConfiguration.getPort() == 0)
+			{
+				startProcess();
+			}
+			else
+			{
+				connectSessions(mConfiguration.getPort());
+			}
+			return true;
+		}
+
+
+};
+
+
+int main(int argc, char** argv)
+{
+	QCoreApplication app(argc, argv);
+	QCoreApplication::setApplicationName(QStringLiteral("AusweisAppLoadGenerator"));
+
+	LoadConfiguration configuration(true);
+	if (const auto& error = configuration.parse(QCoreApplication::arguments()); !error.isEmpty())
+	{
+		std::cerr << qPrintable(error) << std::endl << std::endl << qPrintable(configuration.getHelpText());
+		return 2;
+	}
+
+	if (configuration.isHelpSet())
+	{
+		std::cout << qPrintable(configuration.getHelpText());
+		return 0;
+	}
+
+	WebSocketLoadGenerator generator(configuration);
+	if (!generator.run())
+	{
+		return 2;
+	}
+
+	return QCoreApplication::exec();
+}
+
+
+#include "LoadGeneratorWebSocket.moc"
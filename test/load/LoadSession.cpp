@@ -0,0 +1,230 @@
+/**
+ * Copyright (c) 2025 Governikus GmbH & Co. KG, Germany
+ */
+
+#include "LoadSession.h"
+
+#include <QJsonDocument>
+
+
+using namespace governikus;
+
+
+LoadSession::LoadSession(const Sender& pSender, LoadStatistics& pStatistics, const QUrl& pTcTokenUrl, const QJsonObject& pSimulator)
+	: mSender(pSender)
+	, mStatistics(pStatistics)
+	, mTcTokenUrl(pTcTokenUrl)
+	, mSimulator(pSimulator)
+	, mScenario(LoadScenario::GET_INFO)
+	, mRunning(false)
+	, mFailed(false)
+	, mScenarioTimer()
+	, mPendingCommand()
+	, mPendingTimer()
+{
+}
+
+
+void LoadSession::send(const QJsonObject& pCommand)
+{
+	mPendingCommand = pCommand[QLatin1String("cmd")].toString();
+	mPendingTimer.start();
+	mStatistics.addSent();
+	mSender(QJsonDocument(pCommand).toJson(QJsonDocument::Compact));
+}
+
+
+void LoadSession::finish(bool pSuccess)
+{
+	mRunning = false;
+	mPendingCommand.clear();
+	mStatistics.addScenario(getEnumName(mScenario), mScenarioTimer.nsecsElapsed() / 1000, pSuccess);
+}
+
+
+void LoadSession::start(LoadScenario pScenario)
+{
+	mScenario = pScenario;
+	mRunning = true;
+	mFailed = false;
+	mScenarioTimer.start();
+
+	switch (pScenario)
+	{
+		case LoadScenario::GET_INFO:
+			send({{QLatin1String("cmd"), QLatin1String("GET_INFO")}});
+			break;
+
+		case LoadScenario::GET_READER_LIST:
+			send({{QLatin1String("cmd"), QLatin1String("GET_READER_LIST")}});
+			break;
+
+		case LoadScenario::RUN_AUTH:
+		case LoadScenario::CANCEL:
+			send({
+				{QLatin1String("cmd"), QLatin1String("RUN_AUTH")},
+				{QLatin1String("tcTokenURL"), mTcTokenUrl.toString()},
+				{QLatin1String("developerMode"), true}
+			});
+			if (pScenario == LoadScenario::CANCEL)
+			{
+				send({{QLatin1String("cmd"), QLatin1String("CANCEL")}});
+			}
+			break;
+
+		case LoadScenario::RUN_CHANGE_PIN:
+			send({{QLatin1String("cmd"), QLatin1String("RUN_CHANGE_PIN")}});
+			break;
+	}
+}
+
+
+void LoadSession::handleMessage(const QByteArray& pMessage)
+{
+	mStatistics.addReceived();
+
+	const auto& message = QJsonDocument::fromJson(pMessage).object();
+	const auto& msg = message[QLatin1String("msg")].toString();
+
+	// Events are not an answer to a command
+	if (msg == QLatin1String("READER") || msg == QLatin1String("STATUS"))
+	{
+		return;
+	}
+
+	if (!mPendingCommand.isEmpty())
+	{
+		mStatistics.addLatency(mPendingCommand, mPendingTimer.nsecsElapsed() / 1000);
+		mPendingCommand.clear();
+	}
+
+	if (!mRunning)
+	{
+		return;
+	}
+
+	if (msg == QLatin1String("INVALID") || msg == QLatin1String("UNKNOWN_COMMAND") || msg == QLatin1String("INTERNAL_ERROR"))
+	{
+		finish(false);
+		return;
+	}
+
+	switch (mScenario)
+	{
+		case LoadScenario::GET_INFO:
+			if (msg == QLatin1String("INFO"))
+			{
+				finish(true);
+			}
+			break;
+
+		case LoadScenario::GET_READER_LIST:
+			if (msg == QLatin1String("READER_LIST"))
+			{
+				finish(true);
+			}
+			break;
+
+		case LoadScenario::RUN_AUTH:
+		case LoadScenario::RUN_CHANGE_PIN:
+		case LoadScenario::CANCEL:
+			handleWorkflowMessage(msg, message);
+			break;
+	}
+}
+
+
+void LoadSession::handleWorkflowMessage(const QString& pMsg, const QJsonObject& pMessage)
+{
+	const bool cancel = mScenario == LoadScenario::CANCEL;
+
+	if (pMsg == QLatin1String("AUTH") || pMsg == QLatin1String("CHANGE_PIN"))
+	{
+		if (pMessage.contains(QLatin1String("result")))
+		{
+			const auto& major = pMessage[QLatin1String("result")].toObject()[QLatin1String("major")].toString();
+			finish(cancel || (!mFailed && major.endsWith(QLatin1String("#ok"))));
+		}
+		else if (pMessage.contains(QLatin1String("success")))
+		{
+			finish(!mFailed && pMessage[QLatin1String("success")].toBool());
+		}
+		else if (cancel)
+		{
+			// The CANCEL right after RUN_AUTH may arrive before the workflow is started
+			send({{QLatin1String("cmd"), QLatin1String("CANCEL")}});
+		}
+		return;
+	}
+
+	if (pMsg == QLatin1String("BAD_STATE"))
+	{
+		if (!cancel)
+		{
+			finish(false);
+		}
+		return;
+	}
+
+	if (pMsg == QLatin1String("INSERT_CARD") && pMessage.contains(QLatin1String("error")))
+	{
+		// SET_CARD failed, so the workflow can only be canceled
+		mFailed = true;
+	}
+
+	if (cancel || mFailed || pMsg == QLatin1String("ENTER_PUK"))
+	{
+		if (pMsg.startsWith(QLatin1String("ENTER_")) || pMsg == QLatin1String("ACCESS_RIGHTS") || pMsg == QLatin1String("INSERT_CARD"))
+		{
+			send({{QLatin1String("cmd"), QLatin1String("CANCEL")}});
+		}
+		return;
+	}
+
+	if (pMsg == QLatin1String("ACCESS_RIGHTS"))
+	{
+		send({{QLatin1String("cmd"), QLatin1String("ACCEPT")}});
+	}
+	else if (pMsg == QLatin1String("INSERT_CARD"))
+	{
+		QJsonObject command {
+			{QLatin1String("cmd"), QLatin1String("SET_CARD")},
+			{QLatin1String("name"), QLatin1String("Simulator")}
+		};
+		if (!mSimulator.isEmpty())
+		{
+			command[QLatin1String("simulator")] = mSimulator;
+		}
+		send(command);
+	}
+	else if (pMsg == QLatin1String("ENTER_PIN"))
+	{
+		send({{QLatin1String("cmd"), QLatin1String("SET_PIN")}, {QLatin1String("value"), QLatin1String("123456")}});
+	}
+	else if (pMsg == QLatin1String("ENTER_NEW_PIN"))
+	{
+		send({{QLatin1String("cmd"), QLatin1String("SET_NEW_PIN")}, {QLatin1String("value"), QLatin1String("123456")}});
+	}
+	else if (pMsg == QLatin1String("ENTER_CAN"))
+	{
+		send({{QLatin1String("cmd"), QLatin1String("SET_CAN")}, {QLatin1String("value"), QLatin1String("500540")}});
+	}
+}
+
+
+bool LoadSession::isRunning() const
+{
+	return mRunning;
+}
+
+
+bool LoadSession::checkTimeout(int pSeconds)
+{
+	if (!mRunning || !mScenarioTimer.hasExpired(qint64(pSeconds) * 1000))
+	{
+		return false;
+	}
+
+	finish(false);
+	return true;
+}
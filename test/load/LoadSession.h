@@ -0,0 +1,64 @@
+/**
+ * Copyright (c) 2025 Governikus GmbH & Co. KG, Germany
+ */
+
+#pragma once
+
+#include "LoadConfiguration.h"
+#include "LoadStatistics.h"
+
+#include <QByteArray>
+#include <QElapsedTimer>
+#include <QJsonObject>
+#include <QString>
+#include <QUrl>
+
+#include <functional>
+
+
+namespace governikus
+{
+
+/*!
+ * Scripted client of the SDK that runs one LoadScenario after another.
+ * It is independent of the transport, so the owner passes every received
+ * message to handleMessage() and starts the next scenario once isRunning()
+ * returns false.
+ */
+class LoadSession
+{
+	Q_DISABLE_COPY(LoadSession)
+
+	public:
+		using Sender = std::function<void (const QByteArray&)>;
+
+	private:
+		const Sender mSender;
+		LoadStatistics& mStatistics;
+		const QUrl mTcTokenUrl;
+		const QJsonObject mSimulator;
+		LoadScenario mScenario;
+		bool mRunning;
+		bool mFailed;
+		QElapsedTimer mScenarioTimer;
+		QString mPendingCommand;
+		QElapsedTimer mPendingTimer;
+
+		void send(const QJsonObject& pCommand);
+		void finish(bool pSuccess);
+		void handleWorkflowMessage(const QString& pMsg, const QJsonObject& pMessage);
+
+	public:
+		LoadSession(const Sender& pSender, LoadStatistics& pStatistics, const QUrl& pTcTokenUrl, const QJsonObject& pSimulator);
+
+		void start(LoadScenario pScenario);
+		void handleMessage(const QByteArray& pMessage);
+		[[nodiscard]] bool isRunning() const;
+
+		/*!
+		 * Counts the running scenario as failed if it exceeds \a pSeconds.
+		 */
+		bool checkTimeout(int pSeconds);
+};
+
+} // namespace governikus
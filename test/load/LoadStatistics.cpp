@@ -0,0 +1,285 @@
+/**
+ * Copyright (c) 2025 Governikus GmbH & Co. KG, Germany
+ */
+
+#include "LoadStatistics.h"
+
+#include <QFile>
+#include <QMutexLocker>
+
+#include <algorithm>
+
+
+using namespace governikus;
+
+
+LoadStatistics::LoadStatistics()
+	: mLatencies()
+	, mScenarios()
+	, mSent(0)
+	, mReceived(0)
+	, mMemory()
+	, mLeakedObjects(-1)
+	, mTimer()
+	, mElapsed(-1)
+	, mMutex()
+{
+}
+
+
+LoadStatistics::Series& LoadStatistics::getSeries(QMap<QString, QSharedPointer<Series>>& pMap, const QString& pName)
+{
+	auto& series = pMap[pName];
+	if (series.isNull())
+	{
+		series = QSharedPointer<Series>::create();
+	}
+	return *series;
+}
+
+
+qint64 LoadStatistics::getElapsed() const
+{
+	if (mElapsed >= 0)
+	{
+		return mElapsed;
+	}
+
+	return mTimer.isValid() ? mTimer.elapsed() : 0;
+}
+
+
+void LoadStatistics::start()
+{
+	const QMutexLocker locker(&mMutex);
+	mTimer.start();
+	mElapsed = -1;
+}
+
+
+void LoadStatistics::stop()
+{
+	const QMutexLocker locker(&mMutex);
+	mElapsed = mTimer.elapsed();
+}
+
+
+void LoadStatistics::addSent()
+{
+	const QMutexLocker locker(&mMutex);
+	++mSent;
+}
+
+
+void LoadStatistics::addReceived()
+{
+	const QMutexLocker locker(&mMutex);
+	++mReceived;
+}
+
+
+void LoadStatistics::addLatency(const QString& pCommand, qint64 pMicroseconds)
+{
+	const QMutexLocker locker(&mMutex);
+	getSeries(mLatencies, pCommand).mHistogram.record(pMicroseconds);
+}
+
+
+void LoadStatistics::addScenario(const QString& pScenario, qint64 pMicroseconds, bool pSuccess)
+{
+	const QMutexLocker locker(&mMutex);
+	auto& series = getSeries(mScenarios, pScenario);
+	series.mHistogram.record(pMicroseconds);
+	if (!pSuccess)
+	{
+		++series.mErrors;
+	}
+}
+
+
+void LoadStatistics::addMemorySample(qint64 pKiB)
+{
+	if (pKiB < 0)
+	{
+		return;
+	}
+
+	const QMutexLocker locker(&mMutex);
+	mMemory << pKiB;
+}
+
+
+void LoadStatistics::setLeakedObjects(qint64 pCount)
+{
+	const QMutexLocker locker(&mMutex);
+	mLeakedObjects = pCount;
+}
+
+
+qint64 LoadStatistics::getDuration() const
+{
+	const QMutexLocker locker(&mMutex);
+	return getElapsed();
+}
+
+
+quint64 LoadStatistics::getErrors() const
+{
+	const QMutexLocker locker(&mMutex);
+	quint64 errors = 0;
+	for (const auto& series : mScenarios)
+	{
+		errors += series->mErrors;
+	}
+	return errors;
+}
+
+
+QJsonObject LoadStatistics::toJson(const QMap<QString, QSharedPointer<Series>>& pMap)
+{
+	QJsonObject json;
+	for (auto iter = pMap.cbegin(); iter != pMap.cend(); ++iter)
+	{
+		const auto& histogram = iter.value()->mHistogram;
+		const auto count = histogram.getCount();
+		json[iter.key()] = QJsonObject {
+			{QStringLiteral("count"), static_cast<qint64>(count)},
+			{QStringLiteral("errors"), static_cast<qint64>(iter.value()->mErrors)},
+			{QStringLiteral("mean"), count == 0 ? 0.0 : static_cast<double>(histogram.getSum()) / static_cast<double>(count) / 1000000},
+			{QStringLiteral("p50"), static_cast<double>(histogram.getQuantile(0.5)) / 1000000},
+			{QStringLiteral("p99"), static_cast<double>(histogram.getQuantile(0.99)) / 1000000}
+		};
+	}
+	return json;
+}
+
+
+QJsonObject LoadStatistics::toJson() const
+{
+	const QMutexLocker locker(&mMutex);
+
+	const auto elapsed = getElapsed();
+	quint64 scenarios = 0;
+	for (const auto& series : mScenarios)
+	{
+		scenarios += series->mHistogram.getCount();
+	}
+
+	QJsonObject json {
+		{QStringLiteral("duration"), static_cast<double>(elapsed) / 1000},
+		{QStringLiteral("scenarios"), static_cast<qint64>(scenarios)},
+		{QStringLiteral("sent"), static_cast<qint64>(mSent)},
+		{QStringLiteral("received"), static_cast<qint64>(mReceived)},
+		{QStringLiteral("throughput"), elapsed == 0 ? 0.0 : static_cast<double>(scenarios) * 1000 / static_cast<double>(elapsed)},
+		{QStringLiteral("latencies"), toJson(mLatencies)},
+		{QStringLiteral("workflows"), toJson(mScenarios)}
+	};
+
+	if (!mMemory.isEmpty())
+	{
+		json[QStringLiteral("memory")] = QJsonObject {
+			{QStringLiteral("start"), mMemory.constFirst()},
+			{QStringLiteral("peak"), *std::max_element(mMemory.cbegin(), mMemory.cend())},
+			{QStringLiteral("end"), mMemory.constLast()},
+			{QStringLiteral("growth"), mMemory.constLast() - mMemory.constFirst()}
+		};
+	}
+
+	if (mLeakedObjects >= 0)
+	{
+		json[QStringLiteral("leakedObjects")] = mLeakedObjects;
+	}
+
+	return json;
+}
+
+
+QString LoadStatistics::toText(const QMap<QString, QSharedPointer<Series>>& pMap)
+{
+	QString text = QStringLiteral("  %1 %2 %3 %4 %5 %6\n")
+			.arg(QStringLiteral("Type"), -24)
+			.arg(QStringLiteral("Count"), 8)
+			.arg(QStringLiteral("Errors"), 8)
+			.arg(QStringLiteral("Mean ms"), 10)
+			.arg(QStringLiteral("p50 ms"), 10)
+			.arg(QStringLiteral("p99 ms"), 10);
+
+	for (auto iter = pMap.cbegin(); iter != pMap.cend(); ++iter)
+	{
+		const auto& histogram = iter.value()->mHistogram;
+		const auto count = histogram.getCount();
+		const auto mean = count == 0 ? 0.0 : static_cast<double>(histogram.getSum()) / static_cast<double>(count) / 1000;
+		text += QStringLiteral("  %1 %2 %3 %4 %5 %6\n")
+				.arg(iter.key(), -24)
+				.arg(count, 8)
+				.arg(iter.value()->mErrors, 8)
+				.arg(mean, 10, 'f', 2)
+				.arg(static_cast<double>(histogram.getQuantile(0.5)) / 1000, 10, 'f', 2)
+				.arg(static_cast<double>(histogram.getQuantile(0.99)) / 1000, 10, 'f', 2);
+	}
+
+	return text;
+}
+
+
+QString LoadStatistics::toText() const
+{
+	const auto& json = toJson();
+
+	const QMutexLocker locker(&mMutex);
+	QString text = QStringLiteral("Duration: %1 s, workflows: %2 (%3/s), messages: %4 sent, %5 received\n\n")
+			.arg(json[QStringLiteral("duration")].toDouble(), 0, 'f', 1)
+			.arg(json[QStringLiteral("scenarios")].toInteger())
+			.arg(json[QStringLiteral("throughput")].toDouble(), 0, 'f', 2)
+			.arg(mSent)
+			.arg(mReceived);
+
+	text += QStringLiteral("Workflows:\n") + toText(mScenarios) + QLatin1Char('\n');
+	text += QStringLiteral("Latency of the first answer per command:\n") + toText(mLatencies) + QLatin1Char('\n');
+
+	if (const auto& memory = json[QStringLiteral("memory")].toObject(); !memory.isEmpty())
+	{
+		text += QStringLiteral("Memory: %1 KiB at start, %2 KiB peak, %3 KiB at end, growth %4 KiB\n")
+				.arg(memory[QStringLiteral("start")].toInteger())
+				.arg(memory[QStringLiteral("peak")].toInteger())
+				.arg(memory[QStringLiteral("end")].toInteger())
+				.arg(memory[QStringLiteral("growth")].toInteger());
+	}
+	else
+	{
+		text += QStringLiteral("Memory: not available\n");
+	}
+
+	text += mLeakedObjects >= 0
+			? QStringLiteral("Leaked QObjects: %1\n").arg(mLeakedObjects)
+			: QStringLiteral("Leaked QObjects: not available\n");
+
+	return text;
+}
+
+
+qint64 LoadStatistics::getResidentMemory(qint64 pPid)
+{
+#ifdef Q_OS_LINUX
+	QFile file(QStringLiteral("/proc/%1/status").arg(pPid));
+	if (!file.open(QIODevice::ReadOnly | QIODevice::Text))
+	{
+		return -1;
+	}
+
+	while (!file.atEnd())
+	{
+		const auto& line = file.readLine();
+		if (line.startsWith("VmRSS:"))
+		{
+			bool ok = false;
+			const auto value = line.mid(6).trimmed().split(' ').constFirst().toLongLong(&ok);
+			return ok ? value : -1;
+		}
+	}
+#else
+	Q_UNUSED(pPid)
+#endif
+
+	return -1;
+}
@@ -0,0 +1,82 @@
+/**
+ * Copyright (c) 2025 Governikus GmbH & Co. KG, Germany
+ */
+
+#pragma once
+
+#include "Metrics.h"
+
+#include <QElapsedTimer>
+#include <QJsonObject>
+#include <QList>
+#include <QMap>
+#include <QMutex>
+#include <QSharedPointer>
+#include <QString>
+
+
+namespace governikus
+{
+
+/*!
+ * Thread safe collection of the results of a load run. Latencies are kept
+ * in the histograms of Metrics, so p50 and p99 are accurate to 25 percent.
+ */
+class LoadStatistics
+{
+	Q_DISABLE_COPY(LoadStatistics)
+
+	private:
+		struct Series
+		{
+			Metrics::Histogram mHistogram;
+			quint64 mErrors = 0;
+		};
+
+		QMap<QString, QSharedPointer<Series>> mLatencies;
+		QMap<QString, QSharedPointer<Series>> mScenarios;
+		quint64 mSent;
+		quint64 mReceived;
+		QList<qint64> mMemory;
+		qint64 mLeakedObjects;
+		QElapsedTimer mTimer;
+		qint64 mElapsed;
+		mutable QMutex mMutex;
+
+		static Series& getSeries(QMap<QString, QSharedPointer<Series>>& pMap, const QString& pName);
+		[[nodiscard]] static QJsonObject toJson(const QMap<QString, QSharedPointer<Series>>& pMap);
+		[[nodiscard]] static QString toText(const QMap<QString, QSharedPointer<Series>>& pMap);
+		[[nodiscard]] qint64 getElapsed() const;
+
+	public:
+		LoadStatistics();
+
+		void start();
+		void stop();
+
+		void addSent();
+		void addReceived();
+		void addLatency(const QString& pCommand, qint64 pMicroseconds);
+		void addScenario(const QString& pScenario, qint64 pMicroseconds, bool pSuccess);
+
+		/*!
+		 * Adds the resident memory in KiB. Negative values are ignored.
+		 */
+		void addMemorySample(qint64 pKiB);
+		void setLeakedObjects(qint64 pCount);
+
+		/*!
+		 * Returns the milliseconds since start() until stop() or now.
+		 */
+		[[nodiscard]] qint64 getDuration() const;
+		[[nodiscard]] quint64 getErrors() const;
+		[[nodiscard]] QJsonObject toJson() const;
+		[[nodiscard]] QString toText() const;
+
+		/*!
+		 * Returns the resident memory of a process in KiB or -1 if it is unknown.
+		 */
+		[[nodiscard]] static qint64 getResidentMemory(qint64 pPid);
+};
+
+} // namespace governikus
@@ -0,0 +1,109 @@
+/**
+ * Copyright (c) 2025 Governikus GmbH & Co. KG, Germany
+ */
+
+#include "asn1/AccessRights.h"
+
+#include <QtTest>
+
+
+using namespace governikus;
+
+
+class test_AccessRights
+	: public QObject
+{
+	Q_OBJECT
+
+	private Q_SLOTS:
+		void constexprSet()
+		{
+			constexpr AccessRights rights = {AccessRight::READ_DG01, AccessRight::AGE_VERIFICATION};
+			static_assert(rights.size() == 2);
+			static_assert(rights.contains(AccessRight::READ_DG01));
+			static_assert(!rights.contains(AccessRight::READ_DG02));
+			static_assert(rights.toBits() == 0x101);
+		}
+
+
+		void fromBits()
+		{
+			const auto rights = AccessRights::fromBits(Q_UINT64_C(0xFFFFFFFFFF));
+			QCOMPARE(rights.size(), static_cast<qsizetype>(AccessRoleAndRightsUtil::allRights().size()));
+			QCOMPARE(rights.toBits(), AccessRights::cMask);
+
+			for (const auto right : AccessRoleAndRightsUtil::allRights())
+			{
+				QVERIFY(rights.contains(right));
+			}
+		}
+
+
+		void insertAndRemove()
+		{
+			AccessRights rights;
+			QVERIFY(rights.isEmpty());
+
+			rights += AccessRight::WRITE_DG17;
+			rights.insert(AccessRight::CAN_ALLOWED);
+			QCOMPARE(rights.size(), 2);
+			QVERIFY(rights.contains(AccessRight::WRITE_DG17));
+
+			QVERIFY(rights.remove(AccessRight::WRITE_DG17));
+			QVERIFY(!rights.remove(AccessRight::WRITE_DG17));
+			rights -= AccessRight::CAN_ALLOWED;
+			QVERIFY(rights.isEmpty());
+
+			rights.insert(static_cast<AccessRight>(38));
+			QVERIFY(rights.isEmpty());
+		}
+
+
+		void setAlgebra()
+		{
+			const AccessRights left = {AccessRight::READ_DG01, AccessRight::READ_DG02, AccessRight::CAN_ALLOWED};
+			const AccessRights right = {AccessRight::READ_DG02, AccessRight::READ_DG03};
+
+			QCOMPARE(left + right, AccessRights({AccessRight::READ_DG01, AccessRight::READ_DG02, AccessRight::READ_DG03, AccessRight::CAN_ALLOWED}));
+			QCOMPARE(left & right, AccessRights({AccessRight::READ_DG02}));
+			QCOMPARE(left - right, AccessRights({AccessRight::READ_DG01, AccessRight::CAN_ALLOWED}));
+			QVERIFY((left + right).contains(left));
+			QVERIFY(!left.contains(right));
+
+			auto rights = left;
+			rights.intersect(right).unite({AccessRight::PSA});
+			QCOMPARE(rights, AccessRights({AccessRight::READ_DG02, AccessRight::PSA}));
+		}
+
+
+		void orderedIteration()
+		{
+			const AccessRights rights = {AccessRight::WRITE_DG17, AccessRight::AGE_VERIFICATION, AccessRight::READ_DG05, AccessRight::PSA};
+
+			const QList<AccessRight> expected = {AccessRight::AGE_VERIFICATION, AccessRight::READ_DG05, AccessRight::PSA, AccessRight::WRITE_DG17};
+			QCOMPARE(rights.values(), expected);
+
+			QList<AccessRight> iterated;
+			for (const auto right : rights)
+			{
+				iterated << right;
+			}
+			QCOMPARE(iterated, expected);
+
+			const AccessRights fromRange(expected.constBegin(), expected.constEnd());
+			QCOMPARE(fromRange, rights);
+		}
+
+
+		void debug()
+		{
+			QString output;
+			QDebug(&output) << AccessRights({AccessRight::READ_DG01, AccessRight::AGE_VERIFICATION});
+			QCOMPARE(output.trimmed(), QStringLiteral("AccessRights(AGE_VERIFICATION, READ_DG01)"));
+		}
+
+
+};
+
+QTEST_GUILESS_MAIN(test_AccessRights)
+#include "test_AccessRights.moc"
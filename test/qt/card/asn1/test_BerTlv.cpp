@@ -0,0 +1,197 @@
+/**
+ * Copyright (c) 2025 Governikus GmbH & Co. KG, Germany
+ */
+
+#include "asn1/BerTlv.h"
+
+#include <QRandomGenerator>
+#include <QtTest>
+
+
+using namespace governikus;
+
+
+class test_BerTlv
+	: public QObject
+{
+	Q_OBJECT
+
+	private Q_SLOTS:
+		void parse_data()
+		{
+			QTest::addColumn<QByteArray>("data");
+			QTest::addColumn<quint32>("tag");
+			QTest::addColumn<bool>("constructed");
+			QTest::addColumn<QByteArray>("value");
+
+			QTest::newRow("short") << QByteArray::fromHex("8E080102030405060708") << 0x8Eu << false << QByteArray::fromHex("0102030405060708");
+			QTest::newRow("empty value") << QByteArray::fromHex("9700") << 0x97u << false << QByteArray();
+			QTest::newRow("trailing data") << QByteArray::fromHex("99029000FFFF") << 0x99u << false << QByteArray::fromHex("9000");
+			QTest::newRow("two byte tag") << QByteArray::fromHex("5F200101") << 0x5F20u << false << QByteArray::fromHex("01");
+			QTest::newRow("three byte tag") << QByteArray::fromHex("7F810101AA") << 0x7F8101u << true << QByteArray::fromHex("AA");
+			QTest::newRow("long length") << QByteArray::fromHex("7C8102AABB") << 0x7Cu << true << QByteArray::fromHex("AABB");
+			QTest::newRow("non minimal length") << QByteArray::fromHex("8782000101") << 0x87u << false << QByteArray::fromHex("01");
+		}
+
+
+		void parse()
+		{
+			QFETCH(QByteArray, data);
+			QFETCH(quint32, tag);
+			QFETCH(bool, constructed);
+			QFETCH(QByteArray, value);
+
+			const auto tlv = BerTlv::parse(data);
+			QVERIFY(tlv.isValid());
+			QCOMPARE(tlv.getTag(), tag);
+			QCOMPARE(tlv.isConstructed(), constructed);
+			QCOMPARE(tlv.getValue().toByteArray(), value);
+			QVERIFY(data.startsWith(tlv.getEncoded()));
+		}
+
+
+		void parseInvalid_data()
+		{
+			QTest::addColumn<QByteArray>("data");
+
+			QTest::newRow("empty") << QByteArray();
+			QTest::newRow("tag only") << QByteArray::fromHex("87");
+			QTest::newRow("truncated tag") << QByteArray::fromHex("7F");
+			QTest::newRow("unterminated tag") << QByteArray::fromHex("7F818181810100");
+			QTest::newRow("leading zero tag") << QByteArray::fromHex("1F800100");
+			QTest::newRow("truncated value") << QByteArray::fromHex("8E0801020304050607");
+			QTest::newRow("indefinite length") << QByteArray::fromHex("7C80000000");
+			QTest::newRow("truncated length") << QByteArray::fromHex("878201");
+			QTest::newRow("overlong length") << QByteArray::fromHex("8784000000010101");
+			QTest::newRow("huge length") << QByteArray::fromHex("8783FFFFFF01");
+		}
+
+
+		void parseInvalid()
+		{
+			QFETCH(QByteArray, data);
+
+			const auto tlv = BerTlv::parse(data);
+			QVERIFY(!tlv.isValid());
+			QVERIFY(tlv.getValue().isEmpty());
+			QCOMPARE(tlv.toByteArray(), QByteArray());
+		}
+
+
+		void find()
+		{
+			const auto data = QByteArray::fromHex("7C1A860871204FF538EEC464870E4445435643416549443030313033");
+			const auto dynamicAuthenticationData = BerTlv::parse(data);
+			QCOMPARE(dynamicAuthenticationData.getTag(), 0x7Cu);
+
+			const auto carCurr = BerTlv::find(dynamicAuthenticationData.getValue(), 0x87);
+			QVERIFY(carCurr.isValid());
+			QCOMPARE(carCurr.toByteArray(), QByteArray("DECVCAeID00103"));
+			QVERIFY(!BerTlv::find(dynamicAuthenticationData.getValue(), 0x88).isValid());
+			QVERIFY(!BerTlv::find(QByteArray::fromHex("8608FF"), 0x87).isValid());
+		}
+
+
+		void encode_data()
+		{
+			QTest::addColumn<quint32>("tag");
+			QTest::addColumn<int>("length");
+			QTest::addColumn<QByteArray>("header");
+
+			QTest::newRow("empty") << 0x97u << 0 << QByteArray::fromHex("9700");
+			QTest::newRow("short") << 0x8Eu << 8 << QByteArray::fromHex("8E08");
+			QTest::newRow("0x7F") << 0x87u << 0x7F << QByteArray::fromHex("877F");
+			QTest::newRow("0x80") << 0x87u << 0x80 << QByteArray::fromHex("878180");
+			QTest::newRow("0x100") << 0x7F49u << 0x100 << QByteArray::fromHex("7F49820100");
+			QTest::newRow("0x10000") << 0x87u << 0x10000 << QByteArray::fromHex("8783010000");
+		}
+
+
+		void encode()
+		{
+			QFETCH(quint32, tag);
+			QFETCH(int, length);
+			QFETCH(QByteArray, header);
+
+			const QByteArray value(length, 0x42);
+			const auto encoded = BerTlv::encode(tag, value);
+			QCOMPARE(encoded, header + value);
+
+			const auto tlv = BerTlv::parse(encoded);
+			QCOMPARE(tlv.getTag(), tag);
+			QCOMPARE(tlv.getValue().toByteArray(), value);
+			QCOMPARE(tlv.getEncoded().size(), encoded.size());
+		}
+
+
+		void reader()
+		{
+			const auto data = QByteArray::fromHex("87020102990290008E080102030405060708");
+
+			BerTlvReader reader(data);
+			QVERIFY(!reader.take(0x97).isValid());
+			QCOMPARE(reader.take(0x87).toByteArray(), QByteArray::fromHex("0102"));
+			QVERIFY(!reader.take(0x97).isValid());
+			QCOMPARE(reader.next().getTag(), 0x99u);
+			QCOMPARE(reader.take(0x8E).getValue().size(), 8);
+			QVERIFY(reader.atEnd());
+			QVERIFY(!reader.hasError());
+			QVERIFY(!reader.next().isValid());
+		}
+
+
+		void readerError()
+		{
+			const auto data = QByteArray::fromHex("990290008E0801");
+
+			BerTlvReader reader(data);
+			QVERIFY(reader.take(0x99).isValid());
+			QVERIFY(!reader.take(0x8E).isValid());
+			QVERIFY(reader.hasError());
+			QVERIFY(reader.atEnd());
+			QVERIFY(reader.getRemaining().isEmpty());
+		}
+
+
+		void fuzz()
+		{
+			QRandomGenerator random(0x5EED);
+
+			for (int i = 0; i < 100000; ++i)
+			{
+				QByteArray data(random.bounded(16), '\0');
+				for (auto& byte : data)
+				{
+					byte = static_cast<char>(random.bounded(256));
+				}
+
+				qsizetype consumed = 0;
+				BerTlvReader reader(data);
+				while (!reader.atEnd())
+				{
+					const auto tlv = reader.next();
+					if (!tlv.isValid())
+					{
+						QVERIFY(reader.hasError());
+						break;
+					}
+
+					QVERIFY(tlv.getEncoded().size() <= data.size() - consumed);
+					QVERIFY(tlv.getEncoded().endsWith(tlv.getValue()));
+					consumed += tlv.getEncoded().size();
+
+					const auto encoded = BerTlv::encode(tlv.getTag(), tlv.getValue());
+					const auto reparsed = BerTlv::parse(encoded);
+					QCOMPARE(reparsed.getTag(), tlv.getTag());
+					QCOMPARE(reparsed.getValue().toByteArray(), tlv.getValue().toByteArray());
+				}
+
+				QVERIFY(consumed <= data.size());
+			}
+		}
+
+
+};
+
+QTEST_GUILESS_MAIN(test_BerTlv)
+#include "test_BerTlv.moc"
@@ -60,7 +60,7 @@ class test_CHAT
 
 			Asn1OctetStringUtil::setValue(QByteArray::fromHex("0000000000"), chat->mTemplate);
 
-			QSet<AccessRight> rights;
+			AccessRights rights;
 			rights += AccessRight::PRIVILEGED_TERMINAL;
 			rights += AccessRight::RESTRICTED_IDENTIFICATION;
 			rights += AccessRight::COMMUNITY_ID_VERIFICATION;
@@ -80,7 +80,7 @@ class test_CHAT
 		{
 			auto chat = CHAT::fromHex("7F4C12060904007F00070301020253050000000F0F");
 
-			QSet<AccessRight> rights;
+			AccessRights rights;
 			rights += AccessRight::PRIVILEGED_TERMINAL;
 			rights += AccessRight::RESTRICTED_IDENTIFICATION;
 			rights += AccessRight::COMMUNITY_ID_VERIFICATION;
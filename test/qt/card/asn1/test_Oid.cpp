@@ -31,9 +31,14 @@ class test_Oid
 			QVERIFY(getOpenSslError().isEmpty());
 
 			// Check if all known OIDs are added
-			QCOMPARE(Oid::cKnownOids.size(), Enum<KnownOid>::getList().size());
+			QCOMPARE(Oid::cKnownNids.size(), Enum<KnownOid>::getList().size());
 			mTestAllKnownOids = false;
-			mOidsToTest = Oid::cKnownOids;
+			for (const auto knownOid : Enum<KnownOid>::getList())
+			{
+				const auto nid = Oid::cKnownNids.at(static_cast<qsizetype>(knownOid));
+				QVERIFY(nid != NID_undef);
+				mOidsToTest.insert(knownOid, nid);
+			}
 
 			Env::getSingleton<LogHandler>()->init();
 		}
@@ -375,6 +380,10 @@ class test_Oid
 			QVERIFY(oidfromObject == oidFromBin);
 
 			QCOMPARE(QByteArray(oidFromEnum), bin);
+			QCOMPARE(Oid::getRawOid(knownOid).toByteArray(), bin);
+			QVERIFY(Oid::toKnownOid(bin) == knownOid);
+			QVERIFY(oidfromObject.getKnownOid() == knownOid);
+			QCOMPARE(OBJ_obj2nid(objectFromOid), Oid::cKnownNids.at(static_cast<qsizetype>(knownOid)));
 
 			QVERIFY(logSpy.count() == 0);
 
@@ -382,6 +391,35 @@ class test_Oid
 		}
 
 
+		void toKnownOid_data()
+		{
+			QTest::addColumn<QByteArray>("bin");
+
+			QTest::newRow("empty") << QByteArray();
+			QTest::newRow("openssl") << QByteArray::fromHex("2A864886F70D01");
+			QTest::newRow("prefix") << QByteArray::fromHex("04007F0007");
+			QTest::newRow("unknown") << QByteArray::fromHex("04007F00070200");
+			QTest::newRow("trailing") << QByteArray::fromHex("04007F0007020204020200");
+			QTest::newRow("before first") << QByteArray::fromHex("00");
+			QTest::newRow("after last") << QByteArray::fromHex("FFFFFFFF");
+		}
+
+
+		void toKnownOid()
+		{
+			QFETCH(QByteArray, bin);
+
+			QVERIFY(!Oid::toKnownOid(bin).has_value());
+		}
+
+
+		void undefinedKnownOid()
+		{
+			QVERIFY(!Oid().getKnownOid().has_value());
+			QVERIFY(Oid::getRawOid(static_cast<KnownOid>(9999999)).isEmpty());
+		}
+
+
 		void logging()
 		{
 			QTest::ignoreMessage(QtCriticalMsg, QRegularExpression("Invalid NID, was not able to create a valid OID for: 9999999$"_L1));
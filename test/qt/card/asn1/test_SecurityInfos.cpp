@@ -50,6 +50,36 @@ class test_SecurityInfos
 		}
 
 
+		void setWithTruncatedElement()
+		{
+			QByteArray hexString("31 05"
+								 "        30 12"
+								 "            06 0A 04");
+
+			auto securityInfos = SecurityInfos::fromHex(hexString);
+
+			QVERIFY(securityInfos == nullptr);
+		}
+
+
+		void setWithPaceDomainParameterInfo()
+		{
+			QByteArray hexString("31 1B"
+								 "        30 19"
+								 "            06 09 04007F000702020402"
+								 "            30 09"
+								 "                06 07 04007F00070102"
+								 "            02 01 0D");
+
+			auto securityInfos = SecurityInfos::fromHex(hexString);
+
+			QVERIFY(securityInfos != nullptr);
+			QCOMPARE(securityInfos->getSecurityInfos().size(), 1);
+			QCOMPARE(securityInfos->getPaceInfos().size(), 0);
+			QCOMPARE(securityInfos->getChipAuthenticationInfos().size(), 0);
+		}
+
+
 		void setWithPaceInfo()
 		{
 			QByteArray hexString("31 14"
@@ -382,7 +382,7 @@ class test_SecureMessaging
 			const CommandApdu encryptedApdu = mSecureMessagingTerminal->encrypt(apdu);
 
 			SecureMessagingCommand smCmd(encryptedApdu);
-			QCOMPARE(Asn1OctetStringUtil::getValue(smCmd.mExpectedLength.data()).size(), le > 0 ? CommandApdu::isExtendedLength(data, le) ? 2 : 1 : 0);
+			QCOMPARE(smCmd.mExpectedLength.getValue().size(), le > 0 ? CommandApdu::isExtendedLength(data, le) ? 2 : 1 : 0);
 
 			QCOMPARE(mSecureMessagingCard->decrypt(encryptedApdu), apdu);
 
@@ -0,0 +1,165 @@
+/**
+ * Copyright (c) 2025 Governikus GmbH & Co. KG, Germany
+ */
+
+#include "ApduTrace.h"
+
+#include "ApduTracer.h"
+#include "CardConnectionWorker.h"
+#include "Env.h"
+
+#include "MockReader.h"
+
+#include <QDir>
+#include <QTemporaryDir>
+#include <QtTest>
+
+
+using namespace Qt::Literals::StringLiterals;
+using namespace governikus;
+
+
+class test_ApduTrace
+	: public QObject
+{
+	Q_OBJECT
+
+	private Q_SLOTS:
+		void cleanup()
+		{
+			Env::getSingleton<ApduTracer>()->setDirectory(QString());
+			Env::getSingleton<ApduTracer>()->setReplay(QStringList());
+		}
+
+
+		void binary()
+		{
+			ApduTrace trace(QStringLiteral("Reader"), false);
+			trace.addTransmit(CommandApdu(QByteArray::fromHex("00B0000000")), {CardReturnCode::OK, ResponseApdu(QByteArray::fromHex("01029000"))}, 1500);
+			trace.addTransmit(CommandApdu(QByteArray::fromHex("0CB0000000")), {CardReturnCode::OK, ResponseApdu(QByteArray::fromHex("9000"))}, 2000,
+					QByteArray::fromHex("0CB000000A"), QByteArray::fromHex("99029000"));
+			trace.addDestroyPaceChannel(CardReturnCode::OK, 100);
+
+			ApduTrace loaded;
+			QVERIFY(loaded.fromBinary(trace.toBinary()));
+			QCOMPARE(loaded.getReaderName(), "Reader"_L1);
+			QVERIFY(!loaded.isBasicReader());
+			QCOMPARE(loaded.getEntries().size(), 3);
+
+			const auto& entry = loaded.getEntries().at(1);
+			QCOMPARE(entry.mType, ApduTraceEntryType::TRANSMIT);
+			QCOMPARE(entry.mDuration, qint64(2000));
+			QCOMPARE(entry.mReturnCode, CardReturnCode::OK);
+			QCOMPARE(entry.mCommand, QByteArray::fromHex("0CB0000000"));
+			QCOMPARE(entry.mResponse, QByteArray::fromHex("9000"));
+			QCOMPARE(entry.mSecuredCommand, QByteArray::fromHex("0CB000000A"));
+			QCOMPARE(entry.mSecuredResponse, QByteArray::fromHex("99029000"));
+			QCOMPARE(loaded.getEntries().at(2).mType, ApduTraceEntryType::DESTROY_PACE_CHANNEL);
+		}
+
+
+		void invalidBinary_data()
+		{
+			QTest::addColumn<QByteArray>("data");
+
+			QTest::newRow("empty") << QByteArray();
+			QTest::newRow("magic") << QByteArray::fromHex("4141545301");
+			QTest::newRow("version") << QByteArray::fromHex("4141545202");
+			QTest::newRow("truncated") << ApduTrace().toBinary().chopped(1);
+		}
+
+
+		void invalidBinary()
+		{
+			QFETCH(QByteArray, data);
+
+			ApduTrace trace;
+			QTest::ignoreMessage(QtWarningMsg, QRegularExpression("Unsupported APDU trace version|APDU trace is truncated"_L1));
+			QVERIFY(!trace.fromBinary(data));
+		}
+
+
+		void redact()
+		{
+			const CommandApdu resetRetryCounter(Ins::RESET_RETRY_COUNTER, CommandApdu::CHANGE, CommandApdu::PIN, "123456"_ba);
+			QCOMPARE(ApduTrace::redact(resetRetryCounter), QByteArray::fromHex("002C020306000000000000"));
+
+			const CommandApdu readBinary(QByteArray::fromHex("00B0000000"));
+			QCOMPARE(ApduTrace::redact(readBinary), QByteArray::fromHex("00B0000000"));
+		}
+
+
+		void paceTransmit()
+		{
+			ApduTrace trace;
+			trace.setPaceRunning(true);
+			trace.addTransmit(CommandApdu(QByteArray::fromHex("10860000")), {CardReturnCode::OK, ResponseApdu(QByteArray::fromHex("9000"))}, 10);
+			trace.setPaceRunning(false);
+
+			EstablishPaceChannelOutput output(CardReturnCode::OK);
+			output.setStatusMseSetAt(QByteArray::fromHex("9000"));
+			trace.addEstablishPaceChannel(PacePasswordId::PACE_PIN, QByteArray::fromHex("7F4C"), output, 100);
+
+			QCOMPARE(trace.getEntries().size(), 2);
+			QCOMPARE(trace.getEntries().at(0).mType, ApduTraceEntryType::PACE_TRANSMIT);
+			QCOMPARE(trace.getEntries().at(1).mType, ApduTraceEntryType::ESTABLISH_PACE_CHANNEL);
+			QCOMPARE(trace.getEntries().at(1).mCommand, QByteArray::fromHex("037F4C"));
+
+			EstablishPaceChannelOutput parsed;
+			QVERIFY(parsed.parseFromCcid(trace.getEntries().at(1).mResponse));
+			QCOMPARE(parsed.getPaceReturnCode(), CardReturnCode::OK);
+		}
+
+
+		void append()
+		{
+			ApduTrace first;
+			first.addDestroyPaceChannel(CardReturnCode::OK, 100);
+			ApduTrace second;
+			second.addDestroyPaceChannel(CardReturnCode::COMMAND_FAILED, 50);
+
+			ApduTrace trace;
+			trace.append(first);
+			trace.append(second);
+			QCOMPARE(trace.getEntries().size(), 2);
+			QVERIFY(trace.getEntries().at(1).mOffset >= trace.getEntries().at(0).mOffset + 100);
+			QCOMPARE(trace.getEntries().at(1).mReturnCode, CardReturnCode::COMMAND_FAILED);
+		}
+
+
+		void recordWorker()
+		{
+			QTemporaryDir dir;
+			QVERIFY(dir.isValid());
+			Env::getSingleton<ApduTracer>()->setDirectory(dir.path());
+
+			MockReader reader(QStringLiteral("Reader"), ReaderManagerPluginType::PCSC);
+			reader.setCard(MockCardConfig({TransmitConfig(CardReturnCode::OK, QByteArray::fromHex("01029000"))}));
+
+			auto worker = CardConnectionWorker::create(&reader);
+			QCOMPARE(worker->transmit(CommandApdu(QByteArray::fromHex("00B0000000"))).mReturnCode, CardReturnCode::OK);
+			worker.reset();
+
+			const auto& files = QDir(dir.path()).entryList({QStringLiteral("*.trace")}, QDir::Files);
+			QCOMPARE(files.size(), 1);
+
+			Env::getSingleton<ApduTracer>()->setReplay({QDir(dir.path()).filePath(files.at(0))});
+			const auto& trace = Env::getSingleton<ApduTracer>()->loadReplay();
+			QCOMPARE(trace.getReaderName(), "Reader"_L1);
+			QCOMPARE(trace.getEntries().size(), 1);
+			QCOMPARE(trace.getEntries().at(0).mCommand, QByteArray::fromHex("00B0000000"));
+			QCOMPARE(trace.getEntries().at(0).mResponse, QByteArray::fromHex("01029000"));
+			QVERIFY(trace.getEntries().at(0).mSecuredCommand.isEmpty());
+		}
+
+
+		void noRecording()
+		{
+			QVERIFY(Env::getSingleton<ApduTracer>()->createTrace(QStringLiteral("Reader"), true).isNull());
+		}
+
+
+};
+
+QTEST_GUILESS_MAIN(test_ApduTrace)
+#include "test_ApduTrace.moc"
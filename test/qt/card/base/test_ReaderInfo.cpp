@@ -81,6 +81,35 @@ class test_ReaderInfo
 		}
 
 
+		void test_Changes()
+		{
+			const ReaderInfo previous(QStringLiteral("Reader"), ReaderManagerPluginType::PCSC, CardInfo(CardType::EID_CARD, FileRef(), nullptr, 3));
+			QCOMPARE(previous.getChanges(previous), ReaderInfo::Changes(ReaderInfo::NoChange));
+			QCOMPARE(previous.getChanges(ReaderInfo(QStringLiteral("Reader"))), ReaderInfo::PluginTypeChanged | ReaderInfo::CardTypeChanged | ReaderInfo::RetryCounterChanged);
+
+			ReaderInfo info = previous;
+			info.setBasicReader(false);
+			info.setMaxApduLength(-1);
+			QCOMPARE(info.getChanges(previous), ReaderInfo::BasicReaderChanged | ReaderInfo::MaxApduLengthChanged);
+
+			info = previous;
+			info.getCardInfo().setRetryCounter(2);
+			QCOMPARE(info.getChanges(previous), ReaderInfo::Changes(ReaderInfo::RetryCounterChanged));
+
+			info = previous;
+			info.setCardInfo(CardInfo(CardType::EID_CARD, FileRef(), nullptr, 3, true));
+			QCOMPARE(info.getChanges(previous), ReaderInfo::Changes(ReaderInfo::PinStateChanged));
+
+			info = previous;
+			info.getCardInfo().setTagType(CardInfo::TagType::NFC_4B);
+			QCOMPARE(info.getChanges(previous), ReaderInfo::Changes(ReaderInfo::CardAccessChanged));
+
+			info = previous;
+			info.shelveCard();
+			QCOMPARE(info.getChanges(previous), ReaderInfo::CardTypeChanged | ReaderInfo::ShelvedCardChanged);
+		}
+
+
 };
 
 QTEST_GUILESS_MAIN(test_ReaderInfo)
@@ -97,6 +97,23 @@ class test_ReaderManager
 		}
 
 
+		void readerInfoVersion()
+		{
+			auto* readerManager = Env::getSingleton<ReaderManager>();
+			const auto initialVersion = readerManager->getReaderInfoVersion();
+
+			fireReaderAdded();
+			const auto addedVersion = readerManager->getReaderInfoVersion();
+			QVERIFY(addedVersion > initialVersion);
+
+			QSignalSpy spy(readerManager, &ReaderManager::fireReaderRemoved);
+			MockReaderManagerPlugin::getInstance().removeReader("MockReader 4711"_L1);
+			QTRY_COMPARE(spy.count(), 1); // clazy:exclude=qstring-allocations
+			QVERIFY(readerManager->getReaderInfoVersion() > addedVersion);
+			QVERIFY(readerManager->getReaderInfos().isEmpty());
+		}
+
+
 		void callExecute()
 		{
 			auto* readerManager = Env::getSingleton<ReaderManager>();
@@ -126,6 +143,28 @@ class test_ReaderManager
 		}
 
 
+		void requestShutdown()
+		{
+			auto* readerManager = Env::getSingleton<ReaderManager>();
+			MockReaderManagerPlugin::getInstance().addReader("MockReader 4711"_L1);
+			QTRY_COMPARE(readerManager->getReaderInfos().size(), 1); // clazy:exclude=qstring-allocations
+
+			QSignalSpy spyFinished(readerManager, &ReaderManager::fireShutdownFinished);
+			readerManager->requestShutdown();
+			QTest::ignoreMessage(QtDebugMsg, "ReaderManager already shutting down");
+			readerManager->requestShutdown();
+			QTRY_COMPARE(spyFinished.count(), 1); // clazy:exclude=qstring-allocations
+			QVERIFY(readerManager->getReaderInfos().isEmpty());
+
+			readerManager->requestShutdown();
+			QTRY_COMPARE(spyFinished.count(), 2); // clazy:exclude=qstring-allocations
+
+			QSignalSpy spy(readerManager, &ReaderManager::fireInitialized);
+			readerManager->init();
+			QTRY_COMPARE(spy.count(), 1); // clazy:exclude=qstring-allocations
+		}
+
+
 		void fireCreateCardConnection_forUnknownReader()
 		{
 			CreateCardConnectionCommandSlot commandSlot;
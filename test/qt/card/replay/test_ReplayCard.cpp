@@ -0,0 +1,127 @@
+/**
+ * Copyright (c) 2025 Governikus GmbH & Co. KG, Germany
+ */
+
+#include "ReplayCard.h"
+
+#include <QElapsedTimer>
+#include <QtTest>
+
+
+using namespace Qt::Literals::StringLiterals;
+using namespace governikus;
+
+
+class test_ReplayCard
+	: public QObject
+{
+	Q_OBJECT
+
+	static ApduTrace createTrace()
+	{
+		ApduTrace trace(QStringLiteral("Reader"), true);
+		trace.addTransmit(CommandApdu(QByteArray::fromHex("00A4020C02011C")), {CardReturnCode::OK, ResponseApdu(QByteArray::fromHex("9000"))}, 1000);
+		trace.addTransmit(CommandApdu(QByteArray::fromHex("00B0000000")), {CardReturnCode::OK, ResponseApdu(QByteArray::fromHex("31009000"))}, 1000);
+
+		trace.setPaceRunning(true);
+		trace.addTransmit(CommandApdu(QByteArray::fromHex("10860000027C0000")), {CardReturnCode::OK, ResponseApdu(QByteArray::fromHex("9000"))}, 1000);
+		trace.setPaceRunning(false);
+
+		EstablishPaceChannelOutput output(CardReturnCode::OK);
+		output.setStatusMseSetAt(QByteArray::fromHex("9000"));
+		output.setIdIcc(QByteArray::fromHex("0102"));
+		trace.addEstablishPaceChannel(PacePasswordId::PACE_PIN, QByteArray(), output, 50000);
+
+		trace.addTransmit(CommandApdu(QByteArray::fromHex("00B0000000")), {CardReturnCode::OK, ResponseApdu(QByteArray::fromHex("31019000"))}, 1000);
+		trace.addTransmit(CommandApdu(QByteArray::fromHex("0CB0000000")), {CardReturnCode::OK, ResponseApdu(QByteArray::fromHex("99029000"))}, 1000);
+		trace.addTransmit(CommandApdu(Ins::RESET_RETRY_COUNTER, CommandApdu::CHANGE, CommandApdu::PIN, "123456"_ba), {CardReturnCode::OK, ResponseApdu(QByteArray::fromHex("9000"))}, 1000);
+		trace.addDestroyPaceChannel(CardReturnCode::OK, 1000);
+		return trace;
+	}
+
+	private Q_SLOTS:
+		void connection()
+		{
+			ReplayCard card(createTrace(), 0);
+			QVERIFY(!card.isConnected());
+			QCOMPARE(card.establishConnection(), CardReturnCode::OK);
+			QVERIFY(card.isConnected());
+			QCOMPARE(card.releaseConnection(), CardReturnCode::OK);
+			QVERIFY(!card.isConnected());
+		}
+
+
+		void transmit()
+		{
+			ReplayCard card(createTrace(), 0);
+
+			auto result = card.transmit(CommandApdu(QByteArray::fromHex("00B0000000")));
+			QCOMPARE(result.mReturnCode, CardReturnCode::OK);
+			QCOMPARE(result.mResponseApdu.getData(), QByteArray::fromHex("3100"));
+			QCOMPARE(card.getPosition(), 2);
+
+			// The second read of the same command is answered by the next entry
+			result = card.transmit(CommandApdu(QByteArray::fromHex("00B0000000")));
+			QCOMPARE(result.mResponseApdu.getData(), QByteArray::fromHex("3101"));
+
+			// Wrap around
+			result = card.transmit(CommandApdu(QByteArray::fromHex("00A4020C02011C")));
+			QCOMPARE(result.mResponseApdu.getStatusCode(), StatusCode::SUCCESS);
+			QCOMPARE(card.getPosition(), 1);
+
+			QTest::ignoreMessage(QtWarningMsg, QRegularExpression("^No recorded response for"_L1));
+			result = card.transmit(CommandApdu(QByteArray::fromHex("00B0010000")));
+			QCOMPARE(result.mReturnCode, CardReturnCode::COMMAND_FAILED);
+		}
+
+
+		void transmitSecureMessaging()
+		{
+			ReplayCard card(createTrace(), 0);
+
+			const auto& result = card.transmit(CommandApdu(QByteArray::fromHex("0CB00000FF")));
+			QCOMPARE(result.mReturnCode, CardReturnCode::OK);
+			QCOMPARE(result.mResponseApdu.getData(), QByteArray::fromHex("9902"));
+		}
+
+
+		void establishPaceChannel()
+		{
+			ReplayCard card(createTrace(), 0);
+
+			const auto& output = card.establishPaceChannel(PacePasswordId::PACE_PIN, 6, QByteArray(), QByteArray());
+			QCOMPARE(output.getPaceReturnCode(), CardReturnCode::OK);
+			QCOMPARE(output.getIdIcc(), QByteArray::fromHex("0102"));
+			QCOMPARE(card.getPosition(), 4);
+
+			QTest::ignoreMessage(QtWarningMsg, QRegularExpression("^No recorded PACE channel for"_L1));
+			QCOMPARE(card.establishPaceChannel(PacePasswordId::PACE_CAN, 6, QByteArray(), QByteArray()).getPaceReturnCode(), CardReturnCode::COMMAND_FAILED);
+		}
+
+
+		void setEidPin()
+		{
+			ReplayCard card(createTrace(), 0);
+
+			const auto& result = card.setEidPin(60);
+			QCOMPARE(result.mReturnCode, CardReturnCode::OK);
+			QCOMPARE(result.mResponseApdu.getStatusCode(), StatusCode::SUCCESS);
+			QCOMPARE(card.destroyPaceChannel(), CardReturnCode::OK);
+		}
+
+
+		void latency()
+		{
+			ReplayCard card(createTrace(), 0.5);
+
+			QElapsedTimer timer;
+			timer.start();
+			QCOMPARE(card.establishPaceChannel(PacePasswordId::PACE_PIN, 6, QByteArray(), QByteArray()).getPaceReturnCode(), CardReturnCode::OK);
+			QVERIFY(timer.nsecsElapsed() / 1000 >= 25000);
+		}
+
+
+};
+
+QTEST_GUILESS_MAIN(test_ReplayCard)
+#include "test_ReplayCard.moc"
@@ -0,0 +1,285 @@
+/**
+ * Copyright (c) 2025 Governikus GmbH & Co. KG, Germany
+ */
+
+#include "EidServerSession.h"
+
+#include "FileRef.h"
+#include "SimulatorCard.h"
+#include "apdu/GeneralAuthenticateResponse.h"
+#include "asn1/ASN1Struct.h"
+#include "asn1/CVCertificate.h"
+#include "asn1/EFCardSecurity.h"
+#include "pace/ec/EcUtil.h"
+
+#include <QCryptographicHash>
+#include <QJsonArray>
+#include <QXmlStreamReader>
+#include <QtTest>
+
+using namespace Qt::Literals::StringLiterals;
+using namespace governikus;
+
+
+class test_EidServerSession
+	: public QObject
+{
+	Q_OBJECT
+
+	private:
+		QSharedPointer<const EidServerCertificates> mCertificates;
+
+		static QByteArray createMessage(const QString& pBody, const QString& pMessageId = u"urn:uuid:client"_s)
+		{
+			return uR"(<?xml version="1.0" encoding="UTF-8"?>)"
+				   uR"(<soap:Envelope xmlns:soap="http://schemas.xmlsoap.org/soap/envelope/" xmlns:wsa="http://www.w3.org/2005/03/addressing">)"
+				   uR"(<soap:Header><wsa:MessageID>%1</wsa:MessageID></soap:Header>)"
+				   uR"(<soap:Body>%2</soap:Body>)"
+				   uR"(</soap:Envelope>)"_s.arg(pMessageId, pBody).toUtf8();
+		}
+
+
+		static QString createResult(const QString& pResultMajor = u"ok"_s)
+		{
+			return uR"(<Result xmlns="urn:oasis:names:tc:dss:1.0:core:schema"><ResultMajor>http://www.bsi.bund.de/ecard/api/1.1/resultmajor#%1</ResultMajor></Result>)"_s.arg(pResultMajor);
+		}
+
+
+		static QByteArray createDidAuthenticateResponse(const QList<std::pair<QString, QByteArray>>& pData)
+		{
+			QString data;
+			for (const auto& [name, value] : pData)
+			{
+				data += u"<%1>%2</%1>"_s.arg(name, QString::fromLatin1(value.toHex()));
+			}
+
+			return createMessage(uR"(<DIDAuthenticateResponse xmlns="urn:iso:std:iso-iec:24727:tech:schema">%1<AuthenticationProtocolData>%2</AuthenticationProtocolData></DIDAuthenticateResponse>)"_s.arg(createResult(), data));
+		}
+
+
+		static QStringList getElements(const QByteArray& pXml, QLatin1StringView pName)
+		{
+			QStringList result;
+			QXmlStreamReader reader(pXml);
+			while (!reader.atEnd())
+			{
+				if (reader.readNext() == QXmlStreamReader::StartElement && reader.name() == pName)
+				{
+					result << reader.readElementText();
+				}
+			}
+			return result;
+		}
+
+
+		static QByteArray getElement(const QByteArray& pXml, QLatin1StringView pName)
+		{
+			const auto& elements = getElements(pXml, pName);
+			return elements.isEmpty() ? QByteArray() : QByteArray::fromHex(elements.first().toLatin1());
+		}
+
+
+		static QString getBodyType(const QByteArray& pXml)
+		{
+			QXmlStreamReader reader(pXml);
+			while (reader.readNextStartElement())
+			{
+				if (reader.name() != "Envelope"_L1 && reader.name() != "Body"_L1)
+				{
+					if (reader.name() == "Header"_L1)
+					{
+						reader.skipCurrentElement();
+						continue;
+					}
+					return reader.name().toString();
+				}
+			}
+			return QString();
+		}
+
+
+		static ResponseApdu transmit(SimulatorCard& pCard, const CommandApdu& pCommand)
+		{
+			return pCard.transmit(pCommand).mResponseApdu;
+		}
+
+	private Q_SLOTS:
+		void initTestCase()
+		{
+			mCertificates.reset(new EidServerCertificates(QUrl(u"https://127.0.0.1:24727/tcToken"_s), {QByteArray("tls")}));
+		}
+
+
+		void certificates()
+		{
+			const auto& cvca = CVCertificate::fromRaw(mCertificates->getCvca());
+			const auto& dv = CVCertificate::fromRaw(mCertificates->getDv());
+			const auto& terminal = CVCertificate::fromRaw(mCertificates->getTerminal());
+			QVERIFY(cvca);
+			QVERIFY(dv);
+			QVERIFY(terminal);
+
+			QCOMPARE(cvca->getBody().getCHAT().getAccessRole(), AccessRole::CVCA);
+			QCOMPARE(dv->getBody().getCHAT().getAccessRole(), AccessRole::DV_od);
+			QCOMPARE(terminal->getBody().getCHAT().getAccessRole(), AccessRole::AT);
+
+			QVERIFY(cvca->isIssuedBy(*cvca));
+			QVERIFY(dv->isIssuedBy(*cvca));
+			QVERIFY(terminal->isIssuedBy(*dv));
+			QVERIFY(terminal->isValidOn(QDateTime::currentDateTime()));
+
+			QCOMPARE(terminal->getBody().getExtension(KnownOid::ID_DESCRIPTION), QCryptographicHash::hash(mCertificates->getDescription(), QCryptographicHash::Sha256));
+		}
+
+
+		void unknownSession()
+		{
+			EidServerSession session(mCertificates, "session"_ba, "psk"_ba);
+
+			const auto& response = session.process(createMessage(u"<StartPAOS><SessionIdentifier>other</SessionIdentifier></StartPAOS>"_s));
+			QCOMPARE(session.getState(), EidServerSession::State::FAILED);
+			QCOMPARE(getBodyType(response), "StartPAOSResponse"_L1);
+			QCOMPARE(getElements(response, "ResultMajor"_L1), QStringList({u"http://www.bsi.bund.de/ecard/api/1.1/resultmajor#error"_s}));
+		}
+
+
+		void unexpectedMessage()
+		{
+			EidServerSession session(mCertificates, "session"_ba, "psk"_ba);
+
+			const auto& response = session.process(createMessage(u"<TransmitResponse><OutputAPDU>9000</OutputAPDU></TransmitResponse>"_s));
+			QCOMPARE(session.getState(), EidServerSession::State::FAILED);
+			QCOMPARE(getElements(response, "ResultMessage"_L1), QStringList({u"Unexpected message: TransmitResponse"_s}));
+		}
+
+
+		void clientError()
+		{
+			EidServerSession session(mCertificates, "session"_ba, "psk"_ba);
+
+			auto response = session.process(createMessage(u"<StartPAOS><SessionIdentifier>session</SessionIdentifier></StartPAOS>"_s));
+			QCOMPARE(session.getState(), EidServerSession::State::INITIALIZE_FRAMEWORK);
+
+			response = session.process(createMessage(u"<InitializeFrameworkResponse>%1</InitializeFrameworkResponse>"_s.arg(createResult(u"error"_s))));
+			QCOMPARE(session.getState(), EidServerSession::State::FAILED);
+			QCOMPARE(getBodyType(response), "StartPAOSResponse"_L1);
+		}
+
+
+		void authentication()
+		{
+			EidServerSession session(mCertificates, "session"_ba, "psk"_ba);
+			SimulatorCard card(SimulatorFileSystem(QJsonObject {
+					{u"files"_s, QJsonArray {
+						 QJsonObject {{u"fileId"_s, u"0104"_s}, {u"shortFileId"_s, u"04"_s}, {u"content"_s, u"64070c054552494b41"_s}},
+						 QJsonObject {{u"fileId"_s, u"0105"_s}, {u"shortFileId"_s, u"05"_s}, {u"content"_s, u"650c0c0a4d55535445524d414e4e"_s}}
+					 }},
+					{u"trustPoint"_s, QString::fromLatin1(mCertificates->getCvca().toHex())}
+				}));
+			QCOMPARE(card.establishConnection(), CardReturnCode::OK);
+
+			// StartPAOS
+			auto response = session.process(createMessage(u"<StartPAOS><SessionIdentifier>session</SessionIdentifier></StartPAOS>"_s, u"urn:uuid:start"_s));
+			QCOMPARE(session.getState(), EidServerSession::State::INITIALIZE_FRAMEWORK);
+			QCOMPARE(getBodyType(response), "InitializeFramework"_L1);
+			QCOMPARE(getElements(response, "RelatesTo"_L1), QStringList({u"urn:uuid:start"_s}));
+
+			// InitializeFramework
+			response = session.process(createMessage(u"<InitializeFrameworkResponse>%1</InitializeFrameworkResponse>"_s.arg(createResult())));
+			QCOMPARE(session.getState(), EidServerSession::State::EAC1);
+			QCOMPARE(getBodyType(response), "DIDAuthenticate"_L1);
+
+			const auto& certificates = getElements(response, "Certificate"_L1);
+			QCOMPARE(certificates.size(), 2);
+			const auto& chat = getElement(response, "RequiredCHAT"_L1);
+			const auto& description = getElement(response, "CertificateDescription"_L1);
+			QCOMPARE(description, mCertificates->getDescription());
+
+			// DIDAuthenticate EAC1
+			const auto& paceOutput = card.establishPaceChannel(PacePasswordId::PACE_PIN, 6, chat, description);
+			QCOMPARE(paceOutput.getPaceReturnCode(), CardReturnCode::OK);
+			const auto& challenge = transmit(card, CommandApdu(Ins::GET_CHALLENGE, 0, 0, QByteArray(), 8)).getData();
+			QCOMPARE(challenge.size(), 8);
+
+			response = session.process(createDidAuthenticateResponse({
+					{u"EFCardAccess"_s, paceOutput.getEfCardAccess()},
+					{u"IDPICC"_s, paceOutput.getIdIcc()},
+					{u"Challenge"_s, challenge}
+				}));
+			QCOMPARE(session.getState(), EidServerSession::State::EAC2);
+			QCOMPARE(getBodyType(response), "DIDAuthenticate"_L1);
+
+			// DIDAuthenticate EAC2: Terminal Authentication
+			for (const auto& hex : certificates)
+			{
+				const auto& certificate = CVCertificate::fromRaw(QByteArray::fromHex(hex.toLatin1()));
+				QVERIFY(certificate);
+
+				ASN1Struct dst;
+				dst.append(ASN1Struct::PUBLIC_KEY_REFERENCE, certificate->getBody().getCertificationAuthorityReference());
+				QCOMPARE(transmit(card, CommandApdu(Ins::MSE_SET, CommandApdu::TERMINAL_AUTHENTICATION, CommandApdu::DIGITAL_SIGNATURE_TEMPLATE, dst)).getStatusCode(), StatusCode::SUCCESS);
+
+				ASN1Struct verify;
+				verify.append(certificate->getRawBody());
+				verify.append(certificate->getRawSignature());
+				QCOMPARE(transmit(card, CommandApdu(Ins::PSO_VERIFY, CommandApdu::IMPLICIT, CommandApdu::SELF_DESCRIPTIVE, verify)).getStatusCode(), StatusCode::SUCCESS);
+			}
+
+			const auto& terminal = CVCertificate::fromRaw(QByteArray::fromHex(certificates.last().toLatin1()));
+			const auto& ephemeralPublicKey = getElement(response, "EphemeralPublicKey"_L1);
+			ASN1Struct at;
+			at.append(ASN1Struct::CRYPTOGRAPHIC_MECHANISM_REFERENCE, terminal->getBody().getPublicKey().getOid());
+			at.append(ASN1Struct::PUBLIC_KEY_REFERENCE, terminal->getBody().getCertificateHolderReference());
+			at.append(ASN1Struct::TA_EPHEMERAL_PUBLIC_KEY, EcUtil::compressPoint(ephemeralPublicKey));
+			QCOMPARE(transmit(card, CommandApdu(Ins::MSE_SET, CommandApdu::TERMINAL_AUTHENTICATION, CommandApdu::AUTHENTICATION_TEMPLATE, at)).getStatusCode(), StatusCode::SUCCESS);
+			QCOMPARE(transmit(card, CommandApdu(Ins::EXTERNAL_AUTHENTICATE, CommandApdu::IMPLICIT, CommandApdu::IMPLICIT, getElement(response, "Signature"_L1))).getStatusCode(), StatusCode::SUCCESS);
+
+			// DIDAuthenticate EAC2: Chip Authentication
+			const auto sfi = static_cast<uchar>(FileRef::efCardSecurity().getShortIdentifier().at(0));
+			const auto& efCardSecurity = transmit(card, CommandApdu(Ins::READ_BINARY, static_cast<uchar>(0x80 | sfi), 0, QByteArray(), CommandApdu::EXTENDED_MAX_LE)).getData();
+			const auto& securityInfos = EFCardSecurity::decode(efCardSecurity);
+			QVERIFY(securityInfos);
+			const auto& chipAuthenticationInfo = securityInfos->getSecurityInfos()->getChipAuthenticationInfos().at(0);
+
+			ASN1Struct ca;
+			ca.append(ASN1Struct::CRYPTOGRAPHIC_MECHANISM_REFERENCE, chipAuthenticationInfo->getOid());
+			ca.append(ASN1Struct::PRIVATE_KEY_REFERENCE, chipAuthenticationInfo->getKeyId());
+			QCOMPARE(transmit(card, CommandApdu(Ins::MSE_SET, CommandApdu::CHIP_AUTHENTICATION, CommandApdu::AUTHENTICATION_TEMPLATE, ca)).getStatusCode(), StatusCode::SUCCESS);
+
+			ASN1Struct ga(V_ASN1_APPLICATION, ASN1Struct::DYNAMIC_AUTHENTICATION_DATA);
+			ga.append(ASN1Struct::CA_EPHEMERAL_PUBLIC_KEY, ephemeralPublicKey);
+			const auto& gaResult = transmit(card, CommandApdu(Ins::GENERAL_AUTHENTICATE, 0, 0, ga, CommandApdu::SHORT_MAX_LE));
+			QCOMPARE(gaResult.getStatusCode(), StatusCode::SUCCESS);
+			const GAChipAuthenticationResponse gaResponse(gaResult);
+
+			response = session.process(createDidAuthenticateResponse({
+					{u"EFCardSecurity"_s, efCardSecurity},
+					{u"AuthenticationToken"_s, gaResponse.getAuthenticationToken()},
+					{u"Nonce"_s, gaResponse.getNonce()}
+				}));
+			QCOMPARE(session.getState(), EidServerSession::State::TRANSMIT);
+			QCOMPARE(getBodyType(response), "Transmit"_L1);
+
+			// Transmit
+			QString outputApdus;
+			for (const auto& inputApdu : getElements(response, "InputAPDU"_L1))
+			{
+				const auto& output = transmit(card, CommandApdu(QByteArray::fromHex(inputApdu.toLatin1())));
+				outputApdus += u"<OutputAPDU>%1</OutputAPDU>"_s.arg(QString::fromLatin1(QByteArray(output).toHex()));
+			}
+
+			response = session.process(createMessage(u"<TransmitResponse>%1%2</TransmitResponse>"_s.arg(createResult(), outputApdus)));
+			QCOMPARE(session.getState(), EidServerSession::State::FINISHED);
+			QCOMPARE(getBodyType(response), "StartPAOSResponse"_L1);
+			QCOMPARE(getElements(response, "ResultMajor"_L1), QStringList({u"http://www.bsi.bund.de/ecard/api/1.1/resultmajor#ok"_s}));
+			QCOMPARE(session.getDataGroups(), QByteArrayList({
+						QByteArray::fromHex("64070c054552494b41"),
+						QByteArray::fromHex("650c0c0a4d55535445524d414e4e")
+					}));
+		}
+
+
+};
+
+QTEST_GUILESS_MAIN(test_EidServerSession)
+#include "test_EidServerSession.moc"
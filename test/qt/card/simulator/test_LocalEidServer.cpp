@@ -0,0 +1,251 @@
+/**
+ * Copyright (c) 2025 Governikus GmbH & Co. KG, Germany
+ */
+
+#include "LocalEidServer.h"
+
+#include "ResourceLoader.h"
+#include "SecureStorage.h"
+
+#include <QSslPreSharedKeyAuthenticator>
+#include <QSslSocket>
+#include <QXmlStreamReader>
+#include <QtTest>
+
+using namespace Qt::Literals::StringLiterals;
+using namespace governikus;
+
+
+class test_LocalEidServer
+	: public QObject
+{
+	Q_OBJECT
+
+	private:
+		static bool isComplete(const QByteArray& pResponse)
+		{
+			const auto headerEnd = pResponse.indexOf("\r\n\r\n");
+			if (headerEnd < 0)
+			{
+				return false;
+			}
+
+			const auto& length = getHeader(pResponse, "Content-Length").toLongLong();
+			return pResponse.size() >= headerEnd + 4 + length;
+		}
+
+
+		static QByteArray getHeader(const QByteArray& pResponse, const QByteArray& pName)
+		{
+			const auto& lines = pResponse.left(pResponse.indexOf("\r\n\r\n")).split('\n');
+			for (const auto& line : lines)
+			{
+				if (line.startsWith(pName + ':'))
+				{
+					return line.mid(pName.size() + 1).trimmed();
+				}
+			}
+			return QByteArray();
+		}
+
+
+		static QByteArray getBody(const QByteArray& pResponse)
+		{
+			return pResponse.mid(pResponse.indexOf("\r\n\r\n") + 4);
+		}
+
+
+		static QString getElement(const QByteArray& pXml, QLatin1StringView pName)
+		{
+			QXmlStreamReader reader(pXml);
+			while (!reader.atEnd())
+			{
+				if (reader.readNext() == QXmlStreamReader::StartElement && reader.name() == pName)
+				{
+					return reader.readElementText();
+				}
+			}
+			return QString();
+		}
+
+
+		static QByteArray request(QTcpSocket& pSocket, const QByteArray& pMethod, const QString& pPath)
+		{
+			QByteArray response;
+			const auto connection = connect(&pSocket, &QIODevice::readyRead, &pSocket, [&pSocket, &response] {
+						response += pSocket.readAll();
+					});
+
+			pSocket.write(pMethod + ' ' + pPath.toUtf8() + " HTTP/1.1\r\nHost: 127.0.0.1\r\nContent-Length: 0\r\n\r\n");
+			QTest::qWaitFor([&pSocket, &response] {
+					return isComplete(response) || pSocket.state() == QAbstractSocket::UnconnectedState;
+				});
+
+			disconnect(connection);
+			return response;
+		}
+
+
+		static QByteArray fetchTcToken(LocalEidServer& pServer)
+		{
+			QTcpSocket socket;
+			socket.connectToHost(pServer.getTcTokenUrl().host(), static_cast<quint16>(pServer.getTcTokenUrl().port()));
+			return getBody(request(socket, "GET"_ba, pServer.getTcTokenUrl().path()));
+		}
+
+	private Q_SLOTS:
+		void initTestCase()
+		{
+			ResourceLoader::getInstance().init();
+		}
+
+
+		void tcToken()
+		{
+			LocalEidServer server;
+			QCOMPARE(server.getSessionCount(), 0);
+			QVERIFY(server.getSimulatorData().isEmpty());
+			QVERIFY(server.listen());
+			QVERIFY(!server.getSimulatorData().value("trustPoint"_L1).toString().isEmpty());
+
+			const auto& tcToken = fetchTcToken(server);
+			QCOMPARE(server.getSessionCount(), 1);
+
+			const QUrl serverAddress(getElement(tcToken, "ServerAddress"_L1));
+			QCOMPARE(serverAddress.scheme(), "https"_L1);
+			QCOMPARE(serverAddress.host(), server.getTcTokenUrl().host());
+			QVERIFY(serverAddress.port() != server.getTcTokenUrl().port());
+			QCOMPARE(getElement(tcToken, "PathSecurity-Protocol"_L1), "urn:ietf:rfc:4279"_L1);
+			QCOMPARE(getElement(tcToken, "PSK"_L1).size(), 64);
+
+			const auto& sessionId = getElement(tcToken, "SessionIdentifier"_L1);
+			QCOMPARE(sessionId.size(), 32);
+			QVERIFY(getElement(tcToken, "RefreshAddress"_L1).endsWith("/refresh?session="_L1 + sessionId));
+			QVERIFY(getElement(tcToken, "CommunicationErrorAddress"_L1).endsWith("/result"_L1));
+
+			QVERIFY(getElement(fetchTcToken(server), "SessionIdentifier"_L1) != sessionId);
+			QCOMPARE(server.getSessionCount(), 2);
+		}
+
+
+		void keepAlive()
+		{
+			LocalEidServer server;
+			QVERIFY(server.listen());
+
+			QTcpSocket socket;
+			socket.connectToHost(server.getTcTokenUrl().host(), static_cast<quint16>(server.getTcTokenUrl().port()));
+
+			const auto& first = request(socket, "GET"_ba, server.getTcTokenUrl().path());
+			QVERIFY(first.startsWith("HTTP/1.1 200"));
+			QVERIFY(getHeader(first, "Connection").isEmpty());
+
+			const auto& second = request(socket, "GET"_ba, u"/unknown"_s);
+			QVERIFY(second.startsWith("HTTP/1.1 404"));
+
+			const auto& third = request(socket, "POST"_ba, server.getTcTokenUrl().path());
+			QVERIFY(third.startsWith("HTTP/1.1 405"));
+
+			QCOMPARE(socket.state(), QAbstractSocket::ConnectedState);
+			QCOMPARE(server.getSessionCount(), 1);
+		}
+
+
+		void connectionClose()
+		{
+			LocalEidServer server;
+			QVERIFY(server.listen());
+
+			QTcpSocket socket;
+			socket.connectToHost(server.getTcTokenUrl().host(), static_cast<quint16>(server.getTcTokenUrl().port()));
+			QByteArray response;
+			connect(&socket, &QIODevice::readyRead, &socket, [&socket, &response] {
+					response += socket.readAll();
+				});
+
+			socket.write("GET /result HTTP/1.1\r\nHost: 127.0.0.1\r\nConnection: close\r\n\r\n");
+			QTRY_COMPARE(socket.state(), QAbstractSocket::UnconnectedState); // clazy:exclude=qstring-allocations
+			QVERIFY(response.startsWith("HTTP/1.1 200"));
+		}
+
+
+		void psk_data()
+		{
+			QTest::addColumn<bool>("knownIdentity");
+
+			QTest::newRow("known") << true;
+			QTest::newRow("unknown") << false;
+		}
+
+
+		void psk()
+		{
+			QFETCH(bool, knownIdentity);
+
+			LocalEidServer server;
+			QVERIFY(server.listen());
+
+			const auto& tcToken = fetchTcToken(server);
+			const QUrl serverAddress(getElement(tcToken, "ServerAddress"_L1));
+			const auto& identity = knownIdentity ? getElement(tcToken, "SessionIdentifier"_L1).toLatin1() : "unknown"_ba;
+			const auto& psk = QByteArray::fromHex(getElement(tcToken, "PSK"_L1).toLatin1());
+
+			QSslSocket socket;
+			auto config = Env::getSingleton<SecureStorage>()->getTlsConfig(SecureStorage::TlsSuite::PSK).getConfiguration();
+			config.setPeerVerifyMode(QSslSocket::VerifyNone);
+			socket.setSslConfiguration(config);
+			connect(&socket, &QSslSocket::preSharedKeyAuthenticationRequired, &socket, [&identity, &psk](QSslPreSharedKeyAuthenticator* pAuthenticator){
+					pAuthenticator->setIdentity(identity);
+					pAuthenticator->setPreSharedKey(psk);
+				});
+			QSignalSpy spyEncrypted(&socket, &QSslSocket::encrypted);
+
+			socket.connectToHostEncrypted(serverAddress.host(), static_cast<quint16>(serverAddress.port()));
+			if (!knownIdentity)
+			{
+				QTRY_COMPARE(socket.state(), QAbstractSocket::UnconnectedState); // clazy:exclude=qstring-allocations
+				QCOMPARE(spyEncrypted.count(), 0);
+				return;
+			}
+
+			QTRY_COMPARE(spyEncrypted.count(), 1); // clazy:exclude=qstring-allocations
+
+			// The session only accepts PAOS messages by POST. The connection stays open to continue.
+			QVERIFY(request(socket, "GET"_ba, serverAddress.path()).startsWith("HTTP/1.1 403"));
+			QVERIFY(request(socket, "GET"_ba, serverAddress.path()).startsWith("HTTP/1.1 403"));
+			QCOMPARE(socket.state(), QAbstractSocket::ConnectedState);
+		}
+
+
+		void refresh()
+		{
+			LocalEidServer server;
+			QVERIFY(server.listen());
+
+			const auto& sessionId = getElement(fetchTcToken(server), "SessionIdentifier"_L1);
+			QCOMPARE(server.getSessionCount(), 1);
+
+			QTcpSocket socket;
+			socket.connectToHost(server.getTcTokenUrl().host(), static_cast<quint16>(server.getTcTokenUrl().port()));
+
+			const auto& redirect = request(socket, "GET"_ba, "/refresh?session="_L1 + sessionId);
+			QVERIFY(redirect.startsWith("HTTP/1.1 303"));
+			QCOMPARE(server.getSessionCount(), 0);
+
+			const QUrl location(QString::fromLatin1(getHeader(redirect, "Location")));
+			QCOMPARE(location.path(), "/result"_L1);
+			QCOMPARE(location.query(), "ResultMajor=error"_L1);
+
+			const auto& result = request(socket, "GET"_ba, location.path() + u'?' + location.query());
+			QVERIFY(result.startsWith("HTTP/1.1 200"));
+			QCOMPARE(getBody(result), "ResultMajor=error"_ba);
+
+			const auto& unknown = request(socket, "GET"_ba, "/refresh?session="_L1 + sessionId);
+			QVERIFY(getHeader(unknown, "Location").endsWith("ResultMajor=error"));
+		}
+
+
+};
+
+QTEST_GUILESS_MAIN(test_LocalEidServer)
+#include "test_LocalEidServer.moc"
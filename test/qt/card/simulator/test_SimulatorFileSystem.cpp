@@ -259,6 +259,34 @@ class test_SimulatorFileSystem
 		}
 
 
+		void trustPointJson()
+		{
+			const auto& cert7 = QStringLiteral(
+					"7F218201B67F4E82016E5F290100420E44455445535465494430303030367F4982011D060A04007F0007020202020381"
+					"20A9FB57DBA1EEA9BC3E660A909D838D726E3BF623D52620282013481D1F6E537782207D5A0975FC2C3057EEF6753041"
+					"7AFFE7FB8055C126DC5C6CE94A4B44F330B5D9832026DC5C6CE94A4B44F330B5D9BBD77CBF958416295CF7E1CE6BCCDC"
+					"18FF8C07B68441048BD2AEB9CB7E57CB2C4B482FFC81B7AFB9DE27E1E3BD23C23A4453BD9ACE3262547EF835C3DAC4FD"
+					"97F8461A14611DC9C27745132DED8E545C1D54C72F0469978520A9FB57DBA1EEA9BC3E660A909D838D718C397AA3B561"
+					"A6F7901E0E82974856A786410431D8F49A3095D324E52833E1354860FCD797F44730AA4B67486E10E6059A04B773E16F"
+					"803A115788D307A7B99296D5AB5CBD658D3EA28D4771ED5A027DB5ADE28701015F200E44455445535465494430303030"
+					"377F4C12060904007F0007030102025305FC0F13FFFF5F25060200010001035F24060203010001035F3740275BAD7EF2"
+					"4614F99ABE983C6643BE5385D2C2B1D146DD481AC422B1605CA5A64F87D4B2B9F56BEEE34B8E6B6AF6F3423A21F00AAB"
+					"F55F29C3771B06B22B3A0A");
+
+			const SimulatorFileSystem fileSystem(QJsonObject {{QStringLiteral("trustPoint"), cert7}});
+			QCOMPARE(fileSystem.getTrustPoint()->getBody().getCertificateHolderReference(), QByteArray("DETESTeID00007"));
+
+			QTest::ignoreMessage(QtWarningMsg, QRegularExpression(QStringLiteral("^Cannot decode ASN.1 object:")));
+			QTest::ignoreMessage(QtWarningMsg, R"(Skipping trust point. Expected hex encoded CV certificate, got QJsonValue(string, "00"))");
+			const SimulatorFileSystem invalid(QJsonObject {{QStringLiteral("trustPoint"), QStringLiteral("00")}});
+			QCOMPARE(invalid.getTrustPoint()->getBody().getCertificateHolderReference(), QByteArray("DETESTeID00005"));
+
+			QTest::ignoreMessage(QtWarningMsg, R"(Skipping trust point. Expected hex encoded CV certificate, got QJsonValue(string, "7F21zz"))");
+			const SimulatorFileSystem invalidHex(QJsonObject {{QStringLiteral("trustPoint"), QStringLiteral("7F21zz")}});
+			QCOMPARE(invalidHex.getTrustPoint()->getBody().getCertificateHolderReference(), QByteArray("DETESTeID00005"));
+		}
+
+
 		void verify_data()
 		{
 			QTest::addColumn<QByteArray>("authenticatedAuxiliaryData");
@@ -0,0 +1,145 @@
+/**
+ * Copyright (c) 2025 Governikus GmbH & Co. KG, Germany
+ */
+
+#include "SimulatorProfile.h"
+
+#include "SimulatorCard.h"
+
+#include <QJsonDocument>
+#include <QtTest>
+
+
+using namespace Qt::Literals::StringLiterals;
+using namespace governikus;
+
+
+class test_SimulatorProfile
+	: public QObject
+{
+	Q_OBJECT
+
+	private:
+		QJsonObject fromJson(const QByteArray& pJson)
+		{
+			return QJsonDocument::fromJson(pJson).object();
+		}
+
+	private Q_SLOTS:
+		void defaultProfile()
+		{
+			SimulatorProfile profile;
+			QCOMPARE(profile.getLatency(), 0.0);
+			QCOMPARE(profile.getJitter(), 0.0);
+			QCOMPARE(profile.getBytesPerSecond(), 0);
+			QCOMPARE(profile.getMaxApduLength(), -1);
+			QVERIFY(profile.isExtendedLength());
+			QCOMPARE(profile.getCardLoss(), 0.0);
+			QCOMPARE(profile.getDuration(100000), qint64(0));
+			QVERIFY(!profile.isCardLost());
+			QVERIFY(profile.isSupported(CommandApdu(QByteArray::fromHex("00B0000000FFFF"))));
+		}
+
+
+		void parse()
+		{
+			SimulatorProfile profile(fromJson(R"({"latency": 40, "jitter": 10, "bytesPerSecond": 1000, "maxApduLength": 1024, "cardLoss": 0.5})"));
+			QCOMPARE(profile.getLatency(), 40.0);
+			QCOMPARE(profile.getJitter(), 10.0);
+			QCOMPARE(profile.getBytesPerSecond(), 1000);
+			QCOMPARE(profile.getMaxApduLength(), 1024);
+			QVERIFY(profile.isExtendedLength());
+			QCOMPARE(profile.getCardLoss(), 0.5);
+		}
+
+
+		void invalid_data()
+		{
+			QTest::addColumn<QByteArray>("json");
+
+			QTest::newRow("latency") << QByteArray(R"({"latency": -1})");
+			QTest::newRow("jitter") << QByteArray(R"({"jitter": "10"})");
+			QTest::newRow("bytesPerSecond") << QByteArray(R"({"bytesPerSecond": null})");
+			QTest::newRow("maxApduLength") << QByteArray(R"({"maxApduLength": 100000})");
+			QTest::newRow("cardLoss") << QByteArray(R"({"cardLoss": 2})");
+			QTest::newRow("extendedLength") << QByteArray(R"({"extendedLength": 0})");
+		}
+
+
+		void invalid()
+		{
+			QFETCH(QByteArray, json);
+
+			QTest::ignoreMessage(QtWarningMsg, QRegularExpression("^Skipping profile parameter"_L1));
+			SimulatorProfile profile(fromJson(json));
+			QCOMPARE(profile.getLatency(), 0.0);
+			QCOMPARE(profile.getJitter(), 0.0);
+			QCOMPARE(profile.getBytesPerSecond(), 0);
+			QCOMPARE(profile.getMaxApduLength(), -1);
+			QVERIFY(profile.isExtendedLength());
+			QCOMPARE(profile.getCardLoss(), 0.0);
+		}
+
+
+		void duration()
+		{
+			SimulatorProfile profile(fromJson(R"({"latency": 2, "bytesPerSecond": 1000})"));
+			QCOMPARE(profile.getDuration(0), qint64(2000));
+			QCOMPARE(profile.getDuration(500), qint64(502000));
+		}
+
+
+		void jitter()
+		{
+			SimulatorProfile profile(fromJson(R"({"latency": 10, "jitter": 5, "seed": 42})"));
+			SimulatorProfile same(fromJson(R"({"latency": 10, "jitter": 5, "seed": 42})"));
+			for (int i = 0; i < 100; ++i)
+			{
+				const auto duration = profile.getDuration(0);
+				QVERIFY(duration >= 5000);
+				QVERIFY(duration <= 15000);
+				QCOMPARE(same.getDuration(0), duration);
+			}
+		}
+
+
+		void shortLength()
+		{
+			SimulatorProfile profile(fromJson(R"({"extendedLength": false})"));
+			QCOMPARE(profile.getMaxApduLength(), 261);
+			QVERIFY(profile.isSupported(CommandApdu(QByteArray::fromHex("00B0000000"))));
+			QVERIFY(!profile.isSupported(CommandApdu(QByteArray::fromHex("00B00000000000"))));
+
+			SimulatorProfile smaller(fromJson(R"({"extendedLength": false, "maxApduLength": 100})"));
+			QCOMPARE(smaller.getMaxApduLength(), 100);
+		}
+
+
+		void transmitTooLong()
+		{
+			SimulatorCard card(SimulatorFileSystem(), SimulatorProfile(fromJson(R"({"maxApduLength": 6})")));
+			QCOMPARE(card.establishConnection(), CardReturnCode::OK);
+
+			const auto& result = card.transmit(CommandApdu(QByteArray::fromHex("00A4020C02011C")));
+			QCOMPARE(result.mReturnCode, CardReturnCode::OK);
+			QCOMPARE(result.mResponseApdu.getStatusCode(), StatusCode::WRONG_LENGTH);
+		}
+
+
+		void transmitCardLost()
+		{
+			SimulatorCard card(SimulatorFileSystem(), SimulatorProfile(fromJson(R"({"cardLoss": 1})")));
+			QSignalSpy spy(&card, &SimulatorCard::fireCardLost);
+			QCOMPARE(card.establishConnection(), CardReturnCode::OK);
+
+			const auto& result = card.transmit(CommandApdu(QByteArray::fromHex("00A4020C02011C")));
+			QCOMPARE(result.mReturnCode, CardReturnCode::CARD_NOT_FOUND);
+			QVERIFY(!card.isConnected());
+			QCOMPARE(spy.count(), 1);
+		}
+
+
+};
+
+QTEST_GUILESS_MAIN(test_SimulatorProfile)
+#include "test_SimulatorProfile.moc"
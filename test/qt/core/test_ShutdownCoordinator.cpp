@@ -0,0 +1,75 @@
+/**
+ * Copyright (c) 2025 Governikus GmbH & Co. KG, Germany
+ */
+
+#include "controller/ShutdownCoordinator.h"
+
+#include <QSignalSpy>
+#include <QtTest>
+
+
+using namespace governikus;
+
+
+class test_ShutdownCoordinator
+	: public QObject
+{
+	Q_OBJECT
+
+	Q_SIGNALS:
+		void fireFirst();
+		void fireSecond();
+
+	private Q_SLOTS:
+		void noComponents()
+		{
+			ShutdownCoordinator coordinator;
+			QSignalSpy spy(&coordinator, &ShutdownCoordinator::fireFinished);
+
+			coordinator.start();
+			QCOMPARE(spy.count(), 0);
+			QTRY_COMPARE(spy.count(), 1); // clazy:exclude=qstring-allocations
+		}
+
+
+		void parallel()
+		{
+			ShutdownCoordinator coordinator;
+			QSignalSpy spy(&coordinator, &ShutdownCoordinator::fireFinished);
+			connect(this, &test_ShutdownCoordinator::fireFirst, &coordinator, coordinator.addComponent(QStringLiteral("First")));
+			connect(this, &test_ShutdownCoordinator::fireSecond, &coordinator, coordinator.addComponent(QStringLiteral("Second")));
+
+			// A component may finish before the coordinator is started.
+			QTest::ignoreMessage(QtDebugMsg, QRegularExpression(QStringLiteral("^Shutdown of \"Second\" finished after \\d+ ms$")));
+			Q_EMIT fireSecond();
+			coordinator.start();
+			QCOMPARE(spy.count(), 0);
+
+			QTest::ignoreMessage(QtDebugMsg, QRegularExpression(QStringLiteral("^Shutdown of \"First\" finished after \\d+ ms$")));
+			Q_EMIT fireFirst();
+			QCOMPARE(spy.count(), 1);
+			QVERIFY(!coordinator.mDeadline.isActive());
+
+			Q_EMIT fireFirst();
+			QCOMPARE(spy.count(), 1);
+		}
+
+
+		void deadline()
+		{
+			ShutdownCoordinator coordinator(10);
+			QSignalSpy spy(&coordinator, &ShutdownCoordinator::fireFinished);
+			connect(this, &test_ShutdownCoordinator::fireFirst, &coordinator, coordinator.addComponent(QStringLiteral("First")));
+			std::ignore = coordinator.addComponent(QStringLiteral("Blocked"));
+
+			Q_EMIT fireFirst();
+			QTest::ignoreMessage(QtWarningMsg, "Shutdown of \"Blocked\" did not finish within 10 ms");
+			coordinator.start();
+			QTRY_COMPARE(spy.count(), 1); // clazy:exclude=qstring-allocations
+		}
+
+
+};
+
+QTEST_GUILESS_MAIN(test_ShutdownCoordinator)
+#include "test_ShutdownCoordinator.moc"
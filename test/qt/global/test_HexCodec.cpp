@@ -0,0 +1,156 @@
+/**
+ * Copyright (c) 2025 Governikus GmbH & Co. KG, Germany
+ */
+
+#include "HexCodec.h"
+
+#include <QRandomGenerator>
+#include <QtTest>
+
+using namespace Qt::Literals::StringLiterals;
+using namespace governikus;
+
+
+class test_HexCodec
+	: public QObject
+{
+	Q_OBJECT
+
+	private:
+		static QByteArray randomData(qsizetype pSize)
+		{
+			QByteArray data(pSize, Qt::Uninitialized);
+			for (auto& byte : data)
+			{
+				byte = static_cast<char>(QRandomGenerator::global()->bounded(256));
+			}
+			return data;
+		}
+
+	private Q_SLOTS:
+		void roundTrip()
+		{
+			// Covers the vectorised blocks as well as the remaining bytes.
+			for (qsizetype size = 0; size <= 70; ++size)
+			{
+				const auto data = randomData(size);
+				const auto encoded = hex::encode(data);
+				QCOMPARE(encoded, data.toHex());
+
+				QCOMPARE(hex::decode(QByteArrayView(encoded)), std::optional<QByteArray>(data));
+				QCOMPARE(hex::decode(QByteArrayView(encoded.toUpper())), std::optional<QByteArray>(data));
+				QCOMPARE(hex::decode(QString::fromLatin1(encoded)), std::optional<QByteArray>(data));
+				QCOMPARE(hex::decode(QString::fromLatin1(encoded.toUpper())), std::optional<QByteArray>(data));
+			}
+		}
+
+
+		void allBytes()
+		{
+			QByteArray data;
+			for (int i = 0; i < 256; ++i)
+			{
+				data += static_cast<char>(i);
+			}
+
+			const auto encoded = hex::encode(data);
+			QCOMPARE(encoded, data.toHex());
+			QCOMPARE(hex::decode(QByteArrayView(encoded)), std::optional<QByteArray>(data));
+		}
+
+
+		void mixedCase()
+		{
+			const auto expected = QByteArray::fromHex("00a0ff3c0b9f0d4f00a0ff3c0b9f0d4f00a0ff3c0b9f0d4fab");
+			QCOMPARE(hex::decode("00A0fF3c0B9f0D4F00a0Ff3C0b9F0d4f00A0fF3c0B9f0D4FaB"_ba), std::optional<QByteArray>(expected));
+			QCOMPARE(hex::decode(u"00A0fF3c0B9f0D4F00a0Ff3C0b9F0d4f00A0fF3c0B9f0D4FaB"_s), std::optional<QByteArray>(expected));
+		}
+
+
+		void invalid_data()
+		{
+			QTest::addColumn<QString>("input");
+
+			QTest::newRow("odd") << u"abc"_s;
+			QTest::newRow("odd block") << u"0011223344556677889900112233445566"_s.chopped(1);
+			QTest::newRow("space") << u"00 1"_s;
+			QTest::newRow("letter g") << u"0g"_s;
+			QTest::newRow("letter G") << u"G0"_s;
+			QTest::newRow("colon") << u"0:"_s;
+			QTest::newRow("at") << u"@0"_s;
+			QTest::newRow("backtick") << u"`0"_s;
+			QTest::newRow("block") << u"00112233445566778899aabbccddeefx"_s;
+			QTest::newRow("block first") << u"x0112233445566778899aabbccddeeff"_s;
+			QTest::newRow("after block") << u"00112233445566778899aabbccddeeff0z"_s;
+			QTest::newRow("latin1") << u"00112233445566778899aabbccddeeäf"_s;
+			QTest::newRow("high byte") << u"00112233445566778899aabbccddeeİf"_s;
+			QTest::newRow("utf16") << u"00112233445566778899aabbccddeešf"_s;
+			QTest::newRow("surrogate") << u"00112233445566778899aabbccdd\U0001F600"_s;
+		}
+
+
+		void invalid()
+		{
+			QFETCH(QString, input);
+
+			QVERIFY(!hex::decode(QStringView(input)).has_value());
+			QVERIFY(!hex::decode(QByteArrayView(input.toUtf8())).has_value());
+		}
+
+
+		void buffer()
+		{
+			const auto data = randomData(21);
+
+			char encoded[hex::getEncodedSize(21)];
+			hex::encode(data, encoded);
+			QCOMPARE(QByteArrayView(encoded, sizeof(encoded)), data.toHex());
+
+			char decoded[21];
+			QVERIFY(hex::decode(QByteArrayView(encoded, sizeof(encoded)), decoded));
+			QCOMPARE(QByteArrayView(decoded, sizeof(decoded)), data);
+
+			QVERIFY(!hex::decode("0x"_ba, decoded));
+		}
+
+
+		void benchmark_data()
+		{
+			QTest::addColumn<bool>("qt");
+			QTest::addColumn<qsizetype>("size");
+
+			for (qsizetype size : {5, 261, 65536})
+			{
+				QTest::addRow("qt %lld", static_cast<qlonglong>(size)) << true << size;
+				QTest::addRow("codec %lld", static_cast<qlonglong>(size)) << false << size;
+			}
+		}
+
+
+		void benchmark()
+		{
+			QFETCH(bool, qt);
+			QFETCH(qsizetype, size);
+
+			const auto data = randomData(size);
+			const auto encoded = QString::fromLatin1(data.toHex());
+
+			if (qt)
+			{
+				QBENCHMARK{
+					QCOMPARE(QByteArray::fromHex(encoded.toLatin1()).toHex().size(), encoded.size());
+				}
+			}
+			else
+			{
+				QBENCHMARK{
+					QCOMPARE(hex::encode(*hex::decode(QStringView(encoded))).size(), encoded.size());
+				}
+			}
+		}
+
+
+};
+
+QTEST_GUILESS_MAIN(test_HexCodec)
+#include "test_HexCodec.moc"
@@ -0,0 +1,220 @@
+/**
+ * Copyright (c) 2025 Governikus GmbH & Co. KG, Germany
+ */
+
+#include "Metrics.h"
+
+#include "Env.h"
+
+#include <QJsonArray>
+#include <QtTest>
+
+
+using namespace governikus;
+
+
+class test_Metrics
+	: public QObject
+{
+	Q_OBJECT
+
+	private Q_SLOTS:
+		void init()
+		{
+			auto* metrics = Env::getSingleton<Metrics>();
+			const QMutexLocker locker(&metrics->mMutex);
+			metrics->mIndex.clear();
+			metrics->mSeries.clear();
+		}
+
+
+		void buckets_data()
+		{
+			QTest::addColumn<quint64>("value");
+			QTest::addColumn<int>("index");
+			QTest::addColumn<quint64>("upperBound");
+
+			QTest::newRow("0") << quint64(0) << 0 << quint64(1);
+			QTest::newRow("1") << quint64(1) << 0 << quint64(1);
+			QTest::newRow("4") << quint64(4) << 3 << quint64(4);
+			QTest::newRow("5") << quint64(5) << 4 << quint64(5);
+			QTest::newRow("8") << quint64(8) << 7 << quint64(8);
+			QTest::newRow("9") << quint64(9) << 8 << quint64(10);
+			QTest::newRow("10") << quint64(10) << 8 << quint64(10);
+			QTest::newRow("11") << quint64(11) << 9 << quint64(12);
+			QTest::newRow("1000") << quint64(1000) << 35 << quint64(1024);
+			QTest::newRow("1024") << quint64(1024) << 35 << quint64(1024);
+			QTest::newRow("1025") << quint64(1025) << 36 << quint64(1280);
+			QTest::newRow("100000") << quint64(100000) << 62 << quint64(114688);
+			QTest::newRow("overflow") << (quint64(1) << 40) << Metrics::Histogram::cBucketCount - 1 << (quint64(1) << 38);
+		}
+
+
+		void buckets()
+		{
+			QFETCH(quint64, value);
+			QFETCH(int, index);
+			QFETCH(quint64, upperBound);
+
+			QCOMPARE(Metrics::Histogram::getIndex(value), index);
+			QCOMPARE(Metrics::Histogram::getUpperBound(index), upperBound);
+			if (index < Metrics::Histogram::cBucketCount - 1)
+			{
+				QVERIFY(value <= upperBound);
+			}
+			if (index > 0)
+			{
+				QVERIFY(value > Metrics::Histogram::getUpperBound(index - 1));
+			}
+		}
+
+
+		void quantile()
+		{
+			Metrics::Histogram histogram;
+			QCOMPARE(histogram.getQuantile(0.5), quint64(0));
+
+			for (int i = 0; i < 9; ++i)
+			{
+				histogram.record(1000);
+			}
+			histogram.record(100000);
+			histogram.record(-5);
+
+			QCOMPARE(histogram.getCount(), quint64(11));
+			QCOMPARE(histogram.getSum(), quint64(109000));
+			QCOMPARE(histogram.getQuantile(0.05), quint64(1));
+			QCOMPARE(histogram.getQuantile(0.5), quint64(1024));
+			QCOMPARE(histogram.getQuantile(0.99), quint64(114688));
+			QCOMPARE(histogram.getCountUpTo(1024), quint64(10));
+			QCOMPARE(histogram.getCountUpTo(1 << 17), quint64(11));
+		}
+
+
+		void countUpToBound()
+		{
+			Metrics::Histogram histogram;
+			histogram.record(1023);
+			histogram.record(1024);
+			histogram.record(1025);
+
+			QCOMPARE(histogram.getCountUpTo(512), quint64(0));
+			QCOMPARE(histogram.getCountUpTo(1024), quint64(2));
+			QCOMPARE(histogram.getCountUpTo(2048), quint64(3));
+		}
+
+
+		void prometheus()
+		{
+			auto* metrics = Env::getSingleton<Metrics>();
+			for (int i = 0; i < 9; ++i)
+			{
+				metrics->record(Metric::APDU_DURATION, 1000, {{QLatin1StringView("reader"), QStringLiteral("PCSC")}});
+			}
+			metrics->record(Metric::APDU_DURATION, 100000, {{QLatin1StringView("reader"), QStringLiteral("PCSC")}});
+			metrics->increment(Metric::WORKFLOWS, {{QLatin1StringView("workflow"), QStringLiteral("AUTH")}, {QLatin1StringView("status"), QStringLiteral("No_Error")}});
+			metrics->increment(Metric::WORKFLOWS, {{QLatin1StringView("workflow"), QStringLiteral("AUTH")}, {QLatin1StringView("status"), QStringLiteral("No_Error")}});
+			metrics->increment(Metric::IFD_RECONNECTS);
+
+			const auto& text = metrics->toPrometheus();
+			QVERIFY(text.contains("# TYPE ausweisapp_apdu_duration_seconds histogram\n"));
+			QVERIFY(text.contains("ausweisapp_apdu_duration_seconds_bucket{reader=\"PCSC\",le=\"0.000512\"} 0\n"));
+			QVERIFY(text.contains("ausweisapp_apdu_duration_seconds_bucket{reader=\"PCSC\",le=\"0.001024\"} 9\n"));
+			QVERIFY(text.contains("ausweisapp_apdu_duration_seconds_bucket{reader=\"PCSC\",le=\"+Inf\"} 10\n"));
+			QVERIFY(text.contains("ausweisapp_apdu_duration_seconds_sum{reader=\"PCSC\"} 0.109\n"));
+			QVERIFY(text.contains("ausweisapp_apdu_duration_seconds_count{reader=\"PCSC\"} 10\n"));
+			QVERIFY(text.contains("# TYPE ausweisapp_workflows_total counter\n"));
+			QVERIFY(text.contains("ausweisapp_workflows_total{workflow=\"AUTH\",status=\"No_Error\"} 2\n"));
+			QVERIFY(text.contains("ausweisapp_ifd_reconnects_total 1\n"));
+			QVERIFY(text.contains("# HELP ausweisapp_reader_events_total "));
+		}
+
+
+		void escapeLabels()
+		{
+			auto* metrics = Env::getSingleton<Metrics>();
+			metrics->increment(Metric::READER_EVENTS, {{QLatin1StringView("reader"), QStringLiteral("a\"b\\c\nd")}});
+
+			const auto& text = metrics->toPrometheus();
+			QVERIFY(text.contains("ausweisapp_reader_events_total{reader=\"a\\\"b\\\\c\\nd\"} 1\n"));
+		}
+
+
+		void json()
+		{
+			auto* metrics = Env::getSingleton<Metrics>();
+			metrics->record(Metric::PAOS_ROUND_TRIP, 1000, {{QLatin1StringView("state"), QStringLiteral("StateTransmit")}});
+			metrics->increment(Metric::IFD_RECONNECTS);
+
+			const auto& json = metrics->toJson();
+			QCOMPARE(json.size(), Enum<Metric>::getCount());
+			QVERIFY(json.value(QLatin1String("ausweisapp_apdu_duration_seconds")).toArray().isEmpty());
+
+			const auto& paos = json.value(QLatin1String("ausweisapp_paos_round_trip_seconds")).toArray();
+			QCOMPARE(paos.size(), 1);
+			const auto& entry = paos.at(0).toObject();
+			QCOMPARE(entry.value(QLatin1String("labels")).toObject().value(QLatin1String("state")).toString(), QLatin1String("StateTransmit"));
+			QCOMPARE(entry.value(QLatin1String("count")).toInteger(), 1);
+			QCOMPARE(entry.value(QLatin1String("sum")).toDouble(), 0.001);
+			QCOMPARE(entry.value(QLatin1String("p50")).toDouble(), 0.001024);
+			QCOMPARE(entry.value(QLatin1String("p99")).toDouble(), 0.001024);
+
+			const auto& reconnects = json.value(QLatin1String("ausweisapp_ifd_reconnects_total")).toArray();
+			QCOMPARE(reconnects.size(), 1);
+			QCOMPARE(reconnects.at(0).toObject().value(QLatin1String("value")).toInteger(), 1);
+		}
+
+
+		void resolvedSeries()
+		{
+			auto* metrics = Env::getSingleton<Metrics>();
+			const Metrics::Labels labels {{QLatin1StringView("reader"), QStringLiteral("PCSC")}};
+			auto* apdu = metrics->getSeries(Metric::APDU_DURATION, labels);
+			QVERIFY(apdu);
+			QCOMPARE(metrics->getSeries(Metric::APDU_DURATION, labels), apdu);
+
+			Metrics::record(apdu, 1000);
+			metrics->record(Metric::APDU_DURATION, 2000, labels);
+			QCOMPARE(apdu->mHistogram.getCount(), quint64(2));
+			QCOMPARE(apdu->mHistogram.getSum(), quint64(3000));
+
+			auto* reconnects = metrics->getSeries(Metric::IFD_RECONNECTS);
+			Metrics::increment(reconnects);
+			QCOMPARE(reconnects->mValue.load(), quint64(1));
+
+			Metrics::increment(nullptr);
+			Metrics::record(nullptr, 1000);
+			QCOMPARE(metrics->getSeriesList().size(), 2);
+		}
+
+
+		void maxSeries()
+		{
+			auto* metrics = Env::getSingleton<Metrics>();
+			for (int i = 0; i <= Metrics::cMaxSeries; ++i)
+			{
+				metrics->increment(Metric::READER_EVENTS, {{QLatin1StringView("reader"), QString::number(i)}});
+			}
+			QCOMPARE(metrics->getSeriesList().size(), Metrics::cMaxSeries);
+
+			metrics->increment(Metric::READER_EVENTS, {{QLatin1StringView("reader"), QStringLiteral("0")}});
+			QVERIFY(metrics->toPrometheus().contains("ausweisapp_reader_events_total{reader=\"0\"} 2\n"));
+			QVERIFY(!metrics->toPrometheus().contains("{reader=\"1024\"}"));
+		}
+
+
+		void exportEnabled()
+		{
+			auto* metrics = Env::getSingleton<Metrics>();
+			QVERIFY(!metrics->isExportEnabled());
+			metrics->setExportEnabled(true);
+			QVERIFY(metrics->isExportEnabled());
+			metrics->setExportEnabled(false);
+			QVERIFY(!metrics->isExportEnabled());
+		}
+
+
+};
+
+QTEST_GUILESS_MAIN(test_Metrics)
+#include "test_Metrics.moc"
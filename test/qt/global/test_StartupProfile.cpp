@@ -0,0 +1,93 @@
+/**
+ * Copyright (c) 2025 Governikus GmbH & Co. KG, Germany
+ */
+
+#include "StartupProfile.h"
+
+#include "Env.h"
+
+#include <QtTest>
+
+
+using namespace governikus;
+
+
+class test_StartupProfile
+	: public QObject
+{
+	Q_OBJECT
+
+	private Q_SLOTS:
+		void init()
+		{
+			auto* profile = Env::getSingleton<StartupProfile>();
+			profile->mSteps.clear();
+			profile->mFinished = false;
+			profile->setEnabled(true);
+		}
+
+
+		void steps()
+		{
+			auto* profile = Env::getSingleton<StartupProfile>();
+			QThread::currentThread()->setObjectName(QStringLiteral("MainThread"));
+
+			const auto start = profile->now();
+			QVERIFY(start >= 0);
+			QTest::qSleep(2);
+			{
+				const StartupProfile::ScopedStep step(QStringLiteral("Inner"));
+			}
+			profile->addStep(QStringLiteral("Outer"), start);
+			QTest::qSleep(2);
+			profile->mark(QStringLiteral("Mark"));
+
+			const auto& steps = profile->getSteps();
+			QCOMPARE(steps.size(), 3);
+			QCOMPARE(steps.at(0).mName, QLatin1String("Outer"));
+			QCOMPARE(steps.at(1).mName, QLatin1String("Inner"));
+			QCOMPARE(steps.at(2).mName, QLatin1String("Mark"));
+			QCOMPARE(steps.at(2).mDuration, qint64(0));
+			QVERIFY(steps.at(0).mDuration >= steps.at(1).mDuration);
+			QCOMPARE(steps.at(0).mThread, QLatin1String("MainThread"));
+
+			const auto& report = profile->toReport();
+			QCOMPARE(report.size(), 4);
+			QVERIFY(report.at(1).endsWith(QLatin1String("| Outer (MainThread)")));
+		}
+
+
+		void finish()
+		{
+			auto* profile = Env::getSingleton<StartupProfile>();
+			profile->mark(QStringLiteral("Mark"));
+
+			QTest::ignoreMessage(QtInfoMsg, "Startup profile (start | duration in ms):");
+			QTest::ignoreMessage(QtInfoMsg, QRegularExpression(QStringLiteral("\\| Mark")));
+			QTest::ignoreMessage(QtInfoMsg, QRegularExpression(QStringLiteral("\\| Started")));
+			profile->finish();
+			QCOMPARE(profile->getSteps().size(), 2);
+
+			QTest::ignoreMessage(QtInfoMsg, QRegularExpression(QStringLiteral("^Startup profile: Workflow requested after \\d+\\.\\d{3} ms$")));
+			profile->mark(QStringLiteral("Workflow requested"));
+			QVERIFY(!profile->isEnabled());
+
+			profile->mark(QStringLiteral("Workflow requested"));
+			QCOMPARE(profile->getSteps().size(), 2);
+		}
+
+
+		void disabled()
+		{
+			auto* profile = Env::getSingleton<StartupProfile>();
+			profile->setEnabled(false);
+			profile->finish();
+			profile->mark(QStringLiteral("Workflow requested"));
+			QCOMPARE(profile->getSteps().size(), 1);
+		}
+
+
+};
+
+QTEST_GUILESS_MAIN(test_StartupProfile)
+#include "test_StartupProfile.moc"
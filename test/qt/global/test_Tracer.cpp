@@ -0,0 +1,206 @@
+/**
+ * Copyright (c) 2025 Governikus GmbH & Co. KG, Germany
+ */
+
+#include "Tracer.h"
+
+#include "Env.h"
+
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QTemporaryDir>
+#include <QtTest>
+
+
+using namespace Qt::Literals::StringLiterals;
+using namespace governikus;
+
+
+class test_Tracer
+	: public QObject
+{
+	Q_OBJECT
+
+	private Q_SLOTS:
+		void init()
+		{
+			auto* tracer = Env::getSingleton<Tracer>();
+			tracer->setEnabled(true);
+			tracer->setExport(QString(), TraceFormat::CHROME);
+			tracer->mTraces.clear();
+		}
+
+
+		void noTrace()
+		{
+			auto* tracer = Env::getSingleton<Tracer>();
+			QVERIFY(!tracer->isTracing());
+			QCOMPARE(tracer->now(), qint64(-1));
+
+			{
+				Tracer::ScopedSpan span("test"_L1, u"span"_s);
+				QVERIFY(!span.isActive());
+			}
+			tracer->finishTrace();
+			QVERIFY(tracer->getTraces().isEmpty());
+		}
+
+
+		void disabled()
+		{
+			auto* tracer = Env::getSingleton<Tracer>();
+			tracer->setEnabled(false);
+			tracer->startTrace(u"AUTH"_s);
+			QVERIFY(!tracer->isTracing());
+			tracer->finishTrace();
+			QVERIFY(tracer->getTraces().isEmpty());
+		}
+
+
+		void spans()
+		{
+			auto* tracer = Env::getSingleton<Tracer>();
+			tracer->startTrace(u"AUTH"_s);
+			QVERIFY(tracer->isTracing());
+
+			const auto start = tracer->now();
+			QVERIFY(start >= 0);
+			{
+				Tracer::ScopedSpan span("card"_L1, u"APDU"_s);
+				QVERIFY(span.isActive());
+				span.setArg(u"sm"_s, true);
+			}
+			tracer->addSpan("state"_L1, u"StateConnectCard"_s, start, {{"status"_L1, "No_Error"_L1}});
+			tracer->addSpan("state"_L1, u"Ignored"_s, -1);
+			tracer->finishTrace();
+
+			const auto& traces = tracer->getTraces();
+			QCOMPARE(traces.size(), 1);
+			const auto& trace = traces.at(0);
+			QCOMPARE(trace.mName, "AUTH"_L1);
+			QCOMPARE(trace.mId.size(), 16);
+			QCOMPARE(trace.mSpans.size(), 2);
+			QCOMPARE(trace.mSpans.at(0).mCategory, "card"_L1);
+			QCOMPARE(trace.mSpans.at(0).mArgs.value("sm"_L1).toBool(), true);
+			QCOMPARE(trace.mSpans.at(1).mName, "StateConnectCard"_L1);
+			QVERIFY(trace.mSpans.at(1).mStart >= trace.mStart);
+			QVERIFY(trace.mSpans.at(1).mDuration >= trace.mSpans.at(0).mDuration);
+			QVERIFY(trace.mDuration >= trace.mSpans.at(1).mDuration);
+		}
+
+
+		void limits()
+		{
+			auto* tracer = Env::getSingleton<Tracer>();
+			for (int i = 0; i < Tracer::cMaxTraces + 2; ++i)
+			{
+				tracer->startTrace(QString::number(i));
+			}
+			tracer->finishTrace();
+
+			const auto& traces = tracer->getTraces();
+			QCOMPARE(traces.size(), Tracer::cMaxTraces);
+			QCOMPARE(traces.constLast().mName, QString::number(Tracer::cMaxTraces + 1));
+			QCOMPARE(tracer->getTraces(2).size(), 2);
+			QCOMPARE(tracer->getTraces(2).constLast().mName, QString::number(Tracer::cMaxTraces + 1));
+
+			tracer->startTrace(u"AUTH"_s);
+			for (int i = 0; i < Tracer::cMaxSpans + 5; ++i)
+			{
+				tracer->addSpan("card"_L1, u"APDU"_s, tracer->now());
+			}
+			tracer->finishTrace();
+			QCOMPARE(tracer->getTraces(1).at(0).mSpans.size(), Tracer::cMaxSpans);
+			QCOMPARE(tracer->getTraces(1).at(0).mDroppedSpans, 5);
+		}
+
+
+		void chromeTrace()
+		{
+			auto* tracer = Env::getSingleton<Tracer>();
+			tracer->startTrace(u"CHANGE_PIN"_s);
+			tracer->addSpan("paos"_L1, u"StateSendStartPaos"_s, tracer->now(), {{"request"_L1, 42}});
+			tracer->finishTrace();
+
+			const auto& json = Tracer::toChromeTrace(tracer->getTraces(1).at(0));
+			const auto& events = json.value("traceEvents"_L1).toArray();
+			QCOMPARE(events.size(), 2);
+			QCOMPARE(events.at(0).toObject().value("name"_L1).toString(), "CHANGE_PIN"_L1);
+			const auto& event = events.at(1).toObject();
+			QCOMPARE(event.value("ph"_L1).toString(), "X"_L1);
+			QCOMPARE(event.value("cat"_L1).toString(), "paos"_L1);
+			QVERIFY(event.value("ts"_L1).toInteger() >= 0);
+			QCOMPARE(event.value("args"_L1).toObject().value("request"_L1).toInt(), 42);
+			QCOMPARE(json.value("otherData"_L1).toObject().value("workflow"_L1).toString(), "CHANGE_PIN"_L1);
+		}
+
+
+		void otlp()
+		{
+			auto* tracer = Env::getSingleton<Tracer>();
+			tracer->startTrace(u"AUTH"_s);
+			tracer->addSpan("card"_L1, u"APDU"_s, tracer->now(), {{"sm"_L1, true}, {"command"_L1, 12}});
+			tracer->finishTrace();
+
+			const auto& trace = tracer->getTraces(1).at(0);
+			const auto& json = Tracer::toOtlp(trace);
+			const auto& scopeSpans = json.value("resourceSpans"_L1).toArray().at(0).toObject().value("scopeSpans"_L1).toArray();
+			const auto& spans = scopeSpans.at(0).toObject().value("spans"_L1).toArray();
+			QCOMPARE(spans.size(), 2);
+
+			const auto& root = spans.at(0).toObject();
+			const auto& span = spans.at(1).toObject();
+			QCOMPARE(root.value("traceId"_L1).toString(), QString::fromLatin1(trace.mId.toHex()));
+			QCOMPARE(root.value("spanId"_L1).toString().size(), 16);
+			QCOMPARE(span.value("parentSpanId"_L1).toString(), root.value("spanId"_L1).toString());
+			QVERIFY(span.value("spanId"_L1) != root.value("spanId"_L1));
+			QVERIFY(span.value("startTimeUnixNano"_L1).toString().toLongLong() >= trace.mStartTime.toMSecsSinceEpoch() * 1000000);
+
+			const auto& attributes = span.value("attributes"_L1).toArray();
+			QVERIFY(attributes.contains(QJsonObject {{"key"_L1, "command"_L1}, {"value"_L1, QJsonObject {{"intValue"_L1, "12"_L1}}}}));
+			QVERIFY(attributes.contains(QJsonObject {{"key"_L1, "sm"_L1}, {"value"_L1, QJsonObject {{"boolValue"_L1, true}}}}));
+			QVERIFY(attributes.contains(QJsonObject {{"key"_L1, "category"_L1}, {"value"_L1, QJsonObject {{"stringValue"_L1, "card"_L1}}}}));
+		}
+
+
+		void exportTrace_data()
+		{
+			QTest::addColumn<TraceFormat>("format");
+			QTest::addColumn<QString>("suffix");
+			QTest::addColumn<QString>("key");
+
+			QTest::newRow("chrome") << TraceFormat::CHROME << u".json"_s << u"traceEvents"_s;
+			QTest::newRow("otlp") << TraceFormat::OTLP << u".otlp.json"_s << u"resourceSpans"_s;
+		}
+
+
+		void exportTrace()
+		{
+			QFETCH(TraceFormat, format);
+			QFETCH(QString, suffix);
+			QFETCH(QString, key);
+
+			QTemporaryDir dir;
+			QVERIFY(dir.isValid());
+
+			auto* tracer = Env::getSingleton<Tracer>();
+			tracer->setExport(dir.path(), format);
+			tracer->startTrace(u"AUTH"_s);
+			tracer->finishTrace();
+			QVERIFY(tracer->mExportPool.waitForDone());
+
+			const auto& files = QDir(dir.path()).entryList(QDir::Files);
+			QCOMPARE(files.size(), 1);
+			QVERIFY(files.at(0).startsWith("trace-"_L1));
+			QVERIFY(files.at(0).endsWith(suffix));
+
+			QFile file(dir.filePath(files.at(0)));
+			QVERIFY(file.open(QIODevice::ReadOnly));
+			QVERIFY(QJsonDocument::fromJson(file.readAll()).object().contains(key));
+		}
+
+
+};
+
+QTEST_GUILESS_MAIN(test_Tracer)
+#include "test_Tracer.moc"
@@ -78,6 +78,23 @@ class test_IfdStatus
 		}
 
 
+		void equalState()
+		{
+			ReaderInfo info(QStringLiteral("SlotName"), ReaderManagerPluginType::PCSC, CardInfo(CardType::EID_CARD, FileRef(), nullptr, 3));
+			const IfdStatus ifdStatus(info);
+
+			info.getCardInfo().setRetryCounter(2);
+			QVERIFY(ifdStatus.hasEqualState(IfdStatus(info)));
+			QVERIFY(!ifdStatus.hasEqualState(IfdStatus(info, false)));
+
+			info.setMaxApduLength(1000);
+			QVERIFY(!ifdStatus.hasEqualState(IfdStatus(info)));
+
+			const IfdStatus parsedStatus(IfdMessage::parseByteArray(ifdStatus.toByteArray(IfdVersion::Version::latest, QStringLiteral("TestContext"))));
+			QVERIFY(ifdStatus.hasEqualState(parsedStatus));
+		}
+
+
 		void toJson_data()
 		{
 			QTest::addColumn<IfdVersion::Version>("version");
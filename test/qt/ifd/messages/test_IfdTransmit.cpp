@@ -307,6 +307,27 @@ class test_IfdTransmit
 		}
 
 
+		void invalidHex()
+		{
+			QSignalSpy logSpy(Env::getSingleton<LogHandler>()->getEventHandler(), &LogEventHandler::fireLog);
+
+			const QByteArray message(R"({
+										"InputAPDU": "00A402022F0",
+										"ContextHandle": "TestContext",
+										"SlotHandle": "SlotHandle",
+										"msg": "IFDTransmit"
+									 })");
+
+			const QJsonObject& obj = QJsonDocument::fromJson(message).object();
+			const IfdTransmit ifdTransmit(obj);
+			QVERIFY(ifdTransmit.isIncomplete());
+			QCOMPARE(ifdTransmit.getInputApdu(), QByteArray());
+
+			QCOMPARE(logSpy.count(), 1);
+			QVERIFY(TestFileHelper::containsLog(logSpy, QLatin1String("The value of \"InputAPDU\" should be of type \"hex string\"")));
+		}
+
+
 		void wrongCommandApdusType()
 		{
 			if (!IfdVersion(IfdVersion::Version::v0).isSupported())
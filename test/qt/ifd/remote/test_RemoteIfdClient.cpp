@@ -13,6 +13,7 @@
 #include "messages/IfdEstablishContext.h"
 
 #include <QPointer>
+#include <QSet>
 #include <QtTest>
 
 
@@ -56,6 +57,39 @@ DatagramHandlerMock::~DatagramHandlerMock()
 }
 
 
+class IfdListMock
+	: public IfdList
+{
+	Q_OBJECT
+
+	public:
+		int mUpdates = 0;
+		int mRefreshes = 0;
+		QSet<QByteArray> mIfdIds;
+
+		void update(const Discovery& pDiscovery) override
+		{
+			++mUpdates;
+			mIfdIds.insert(pDiscovery.getIfdId());
+		}
+
+
+		bool refresh(const QByteArray& pIfdId) override
+		{
+			++mRefreshes;
+			return mIfdIds.contains(pIfdId);
+		}
+
+
+		void clear() override
+		{
+			mIfdIds.clear();
+		}
+
+
+};
+
+
 class RemoteConnectorMock
 	: public IfdConnector
 {
@@ -332,6 +366,72 @@ class test_RemoteIfdClient
 		}
 
 
+		void testSkipRepeatedDatagram()
+		{
+			Env::setCreator<IfdList*>(std::function<IfdList* ()>([this] {
+						mIfdList = new IfdListMock();
+						return mIfdList;
+					}));
+
+			RemoteIfdClient client;
+			client.startDetection();
+			QVERIFY(!mDatagramHandlerMock.isNull());
+			const auto ifdList = qobject_cast<IfdListMock*>(mIfdList.data());
+			QVERIFY(ifdList);
+
+			const QHostAddress sender("192.168.1.88"_L1);
+			Discovery discovery("Sony Xperia Z5 compact"_L1, QByteArray::fromHex("0123456789ABCDEF"), 24728, {IfdVersion::Version::latest});
+			discovery.setAddresses({sender});
+
+			Q_EMIT mDatagramHandlerMock->fireNewMessage(discovery.toByteArray(IfdVersion::Version::latest), sender);
+			QCOMPARE(ifdList->mUpdates, 1);
+			QCOMPARE(ifdList->mRefreshes, 0);
+
+			Q_EMIT mDatagramHandlerMock->fireNewMessage(discovery.toByteArray(IfdVersion::Version::latest), sender);
+			QCOMPARE(ifdList->mUpdates, 1);
+			QCOMPARE(ifdList->mRefreshes, 1);
+
+			Discovery changedDiscovery("Sony Xperia Z5 compact"_L1, QByteArray::fromHex("0123456789ABCDEF"), 24729, {IfdVersion::Version::latest});
+			changedDiscovery.setAddresses({sender});
+			Q_EMIT mDatagramHandlerMock->fireNewMessage(changedDiscovery.toByteArray(IfdVersion::Version::latest), sender);
+			QCOMPARE(ifdList->mUpdates, 2);
+			QCOMPARE(ifdList->mRefreshes, 1);
+
+			ifdList->clear();
+			Q_EMIT mDatagramHandlerMock->fireNewMessage(changedDiscovery.toByteArray(IfdVersion::Version::latest), sender);
+			QCOMPARE(ifdList->mUpdates, 3);
+			QCOMPARE(ifdList->mRefreshes, 2);
+		}
+
+
+		void testLastDatagramsEviction()
+		{
+			RemoteIfdClient client;
+			client.startDetection();
+			QVERIFY(!mDatagramHandlerMock.isNull());
+
+			const auto& sendDiscovery = [this](int pIndex){
+						const QHostAddress sender(QStringLiteral("10.0.%1.%2").arg(pIndex / 256).arg(pIndex % 256));
+						Discovery discovery("Sony Xperia Z5 compact"_L1, QByteArray::number(pIndex).toHex(), 24728, {IfdVersion::Version::latest});
+						discovery.setAddresses({sender});
+						Q_EMIT mDatagramHandlerMock->fireNewMessage(discovery.toByteArray(IfdVersion::Version::latest), sender);
+					};
+
+			for (int i = 0; i < RemoteIfdClient::cMaxLastDatagrams; ++i)
+			{
+				sendDiscovery(i);
+			}
+			QCOMPARE(client.mLastDatagrams.size(), RemoteIfdClient::cMaxLastDatagrams);
+
+			sendDiscovery(0);
+			QCOMPARE(client.mLastDatagrams.size(), RemoteIfdClient::cMaxLastDatagrams);
+
+			sendDiscovery(static_cast<int>(RemoteIfdClient::cMaxLastDatagrams));
+			QCOMPARE(client.mLastDatagrams.size(), 1);
+			QVERIFY(client.mLastDatagrams.contains(QHostAddress(QStringLiteral("10.0.0.%1").arg(RemoteIfdClient::cMaxLastDatagrams))));
+		}
+
+
 		void testRemoteConnectorThread()
 		{
 			QScopedPointer<IfdClient> client(new RemoteIfdClient());
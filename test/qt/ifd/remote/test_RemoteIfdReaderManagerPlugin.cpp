@@ -6,6 +6,7 @@
 
 #include "AppSettings.h"
 #include "Env.h"
+#include "Metrics.h"
 #include "MockIfdDispatcher.h"
 #include "PortFile.h"
 #include "Reader.h"
@@ -697,6 +698,32 @@ class test_RemoteIfdReaderManagerPlugin
 		}
 
 
+		void testReconnectMetric()
+		{
+			const auto* reconnects = Env::getSingleton<Metrics>()->getSeries(Metric::IFD_RECONNECTS);
+			QVERIFY(reconnects);
+			const auto initial = reconnects->mValue.load();
+			mIfdClient->populateRemoteDevices();
+			const auto& device = std::as_const(mIfdClient->mRemoteDevices).first();
+
+			mPlugin->connectToPairedReaders();
+			QTRY_COMPARE(mPlugin->mConnectionAttempts.size(), 1); // clazy:exclude=qstring-allocations
+			QCOMPARE(reconnects->mValue.load(), initial);
+
+			QTest::ignoreMessage(QtInfoMsg, QRegularExpression(QStringLiteral("from connection attempt list as the request finished with Network_Other_Error")));
+			Q_EMIT mIfdClient->fireEstablishConnectionDone(device, GlobalStatus::Code::Network_Other_Error);
+			mPlugin->connectToPairedReaders();
+			QTRY_COMPARE(mPlugin->mConnectionAttempts.size(), 1); // clazy:exclude=qstring-allocations
+			QCOMPARE(reconnects->mValue.load(), initial);
+
+			QTest::ignoreMessage(QtInfoMsg, "Removing \"3ff02e8dc335f7ebb39299fbc12b66bf378445e59a68880e81464c50874e09cd\" from connection attempt list as the request finished with No_Error | \"No error occurred.\"");
+			Q_EMIT mIfdClient->fireEstablishConnectionDone(device, GlobalStatus::Code::No_Error);
+			mPlugin->connectToPairedReaders();
+			QTRY_COMPARE(mPlugin->mConnectionAttempts.size(), 1); // clazy:exclude=qstring-allocations
+			QCOMPARE(reconnects->mValue.load(), initial + 1);
+		}
+
+
 		void testKeepNormalConnection()
 		{
 			QSignalSpy spySend(mDispatcher1.data(), &MockIfdDispatcher::fireSend);
@@ -36,6 +36,7 @@ class DatagramHandlerMock
 
 	public:
 		QByteArrayList mList;
+		QList<QNetworkAddressEntry> mEntries;
 
 		[[nodiscard]] bool isBound() const override
 		{
@@ -45,7 +46,7 @@ class DatagramHandlerMock
 
 		[[nodiscard]] QList<QNetworkAddressEntry> getAllBroadcastEntries() const override
 		{
-			return QList<QNetworkAddressEntry>();
+			return mEntries;
 		}
 
 
@@ -114,6 +115,44 @@ class test_RemoteReaderAdvertiser
 		}
 
 
+		void idleBackOff()
+		{
+			RemoteReaderAdvertiserImpl advertiser(u"ServerName"_s, "0123456789ABCDEF"_ba, 12345, false, 40);
+			QCOMPARE(mMock->mList.size(), 1);
+			QCOMPARE(advertiser.mCurrentInterval, 10);
+
+			QTRY_COMPARE(advertiser.mCurrentInterval, 40 * RemoteReaderAdvertiserImpl::cMaxIdleFactor); // clazy:exclude=qstring-allocations
+
+			QNetworkAddressEntry entry;
+			entry.setIp(QHostAddress(u"192.168.1.2"_s));
+			entry.setBroadcast(QHostAddress(u"192.168.1.255"_s));
+			mMock->mEntries << entry;
+			Q_EMIT mMock->fireNetworkChanged();
+			QCOMPARE(advertiser.mCurrentInterval, 10);
+
+			QTRY_COMPARE(advertiser.mCurrentInterval, 40); // clazy:exclude=qstring-allocations
+			const auto sent = mMock->mList.size();
+			QTest::qWait(200);
+			QCOMPARE(advertiser.mCurrentInterval, 40);
+			QVERIFY(mMock->mList.size() > sent);
+		}
+
+
+		void burstOnPairing()
+		{
+			RemoteReaderAdvertiserImpl advertiser(u"ServerName"_s, "0123456789ABCDEF"_ba, 12345, false, 99999);
+			QCOMPARE(mMock->mList.size(), 1);
+
+			advertiser.setPairing(false);
+			QCOMPARE(mMock->mList.size(), 1);
+
+			advertiser.setPairing(true);
+			QCOMPARE(mMock->mList.size(), 2);
+			QVERIFY(Discovery(QJsonDocument::fromJson(mMock->mList.at(1)).object()).isPairing());
+			QCOMPARE(advertiser.mCurrentInterval, 99999 / RemoteReaderAdvertiserImpl::cBurstDivisor);
+		}
+
+
 };
 
 Q_DECLARE_METATYPE(QHostAddress)
@@ -78,6 +78,48 @@ class test_IfdListImpl
 		}
 
 
+		void testRefresh()
+		{
+			IfdListImpl deviceList(5000, 5000);
+			QSignalSpy spyUpdated(&deviceList, &IfdListImpl::fireDeviceUpdated);
+
+			QVERIFY(!deviceList.refresh(QByteArrayLiteral("0123456789ABCDEF")));
+
+			auto discovery = Discovery("Dev1"_L1, QByteArrayLiteral("0123456789ABCDEF"), 1234, {IfdVersion::Version::latest});
+			discovery.setAddresses({QHostAddress("5.6.7.8"_L1)});
+			deviceList.update(discovery);
+			QCOMPARE(spyUpdated.count(), 0);
+
+			QVERIFY(deviceList.refresh(QByteArrayLiteral("0123456789ABCDEF")));
+			QCOMPARE(spyUpdated.count(), 1);
+			QVERIFY(!deviceList.refresh(QByteArrayLiteral("0123456789ABCDFF")));
+
+			deviceList.clear();
+			QVERIFY(!deviceList.refresh(QByteArrayLiteral("0123456789ABCDEF")));
+		}
+
+
+		void testPercentSeen()
+		{
+			IfdListEntry entry(Discovery("Dev1"_L1, QByteArrayLiteral("0123456789ABCDEF"), 1234, {IfdVersion::Version::latest}));
+			QCOMPARE(entry.getPercentSeen(), 0);
+
+			entry.setLastSeenToNow();
+			QCOMPARE(entry.getPercentSeen(), 20);
+
+			for (int i = 0; i < 100; ++i)
+			{
+				entry.setLastSeenToNow();
+			}
+			QCOMPARE(entry.getPercentSeen(), 100);
+			QVERIFY(!entry.cleanUpSeenTimestamps(5000));
+
+			QTest::qWait(10);
+			QVERIFY(entry.cleanUpSeenTimestamps(1));
+			QCOMPARE(entry.getPercentSeen(), 0);
+		}
+
+
 };
 
 QTEST_GUILESS_MAIN(test_IfdListImpl)
@@ -307,7 +307,8 @@ class test_ServerMessageHandler
 			ReaderInfo info = reader->getReaderInfo();
 			info.setCardInfo(cardInfo);
 			reader->setReaderInfo(info);
-			QTRY_COMPARE(sendSpy.count(), 3); // clazy:exclude=qstring-allocations
+			QTRY_COMPARE(Env::getSingleton<ReaderManager>()->getReaderInfo(QStringLiteral("test-reader")).getRetryCounter(), 3); // clazy:exclude=qstring-allocations
+			QCOMPARE(sendSpy.count(), 2);
 			sendSpy.clear();
 
 			const QByteArray ifdConnectMsg = IfdConnect(QStringLiteral("test-reader"), true).toByteArray(IfdVersion::Version::latest, contextHandle);
@@ -369,7 +370,8 @@ class test_ServerMessageHandler
 			ReaderInfo info = reader->getReaderInfo();
 			info.setCardInfo(cardInfo);
 			reader->setReaderInfo(info);
-			QTRY_COMPARE(sendSpy.count(), 3); // clazy:exclude=qstring-allocations
+			QTRY_COMPARE(Env::getSingleton<ReaderManager>()->getReaderInfo(QStringLiteral("test-reader")).getRetryCounter(), 3); // clazy:exclude=qstring-allocations
+			QCOMPARE(sendSpy.count(), 2);
 			sendSpy.clear();
 
 			const QByteArray ifdConnectMsg = IfdConnect(QStringLiteral("test-reader"), true).toByteArray(IfdVersion::Version::latest, contextHandle);
@@ -434,7 +436,8 @@ class test_ServerMessageHandler
 			ReaderInfo info = reader->getReaderInfo();
 			info.setCardInfo(cardInfo);
 			reader->setReaderInfo(info);
-			QTRY_COMPARE(sendSpy.count(), 3); // clazy:exclude=qstring-allocations
+			QTRY_COMPARE(Env::getSingleton<ReaderManager>()->getReaderInfo(QStringLiteral("test-reader")).getRetryCounter(), 3); // clazy:exclude=qstring-allocations
+			QCOMPARE(sendSpy.count(), 2);
 			sendSpy.clear();
 
 			const QByteArray ifdConnectMsg = IfdConnect(QStringLiteral("test-reader"), true).toByteArray(IfdVersion::Version::latest, contextHandle);
@@ -497,7 +500,8 @@ class test_ServerMessageHandler
 			ReaderInfo info = reader->getReaderInfo();
 			info.setCardInfo(cardInfo);
 			reader->setReaderInfo(info);
-			QTRY_COMPARE(sendSpy.count(), 3); // clazy:exclude=qstring-allocations
+			QTRY_COMPARE(Env::getSingleton<ReaderManager>()->getReaderInfo(QStringLiteral("test-reader")).getRetryCounter(), 3); // clazy:exclude=qstring-allocations
+			QCOMPARE(sendSpy.count(), 2);
 			sendSpy.clear();
 
 			const QByteArray ifdConnectMsg = IfdConnect(QStringLiteral("test-reader"), true).toByteArray(IfdVersion::Version::latest, contextHandle);
@@ -560,7 +564,8 @@ class test_ServerMessageHandler
 			ReaderInfo info = reader->getReaderInfo();
 			info.setCardInfo(cardInfo);
 			reader->setReaderInfo(info);
-			QTRY_COMPARE(sendSpy.count(), 3); // clazy:exclude=qstring-allocations
+			QTRY_COMPARE(Env::getSingleton<ReaderManager>()->getReaderInfo(QStringLiteral("test-reader")).getRetryCounter(), 3); // clazy:exclude=qstring-allocations
+			QCOMPARE(sendSpy.count(), 2);
 			sendSpy.clear();
 
 			const QByteArray ifdConnectMsg = IfdConnect(QStringLiteral("test-reader"), true).toByteArray(IfdVersion::Version::latest, contextHandle);
@@ -637,7 +642,8 @@ class test_ServerMessageHandler
 			ReaderInfo info = reader->getReaderInfo();
 			info.setCardInfo(cardInfo);
 			reader->setReaderInfo(info);
-			QTRY_COMPARE(sendSpy.count(), 3); // clazy:exclude=qstring-allocations
+			QTRY_COMPARE(Env::getSingleton<ReaderManager>()->getReaderInfo(QStringLiteral("test-reader")).getRetryCounter(), 3); // clazy:exclude=qstring-allocations
+			QCOMPARE(sendSpy.count(), 2);
 			sendSpy.clear();
 
 			const QByteArray ifdConnectMsg = IfdConnect(QStringLiteral("test-reader"), true).toByteArray(IfdVersion::Version::latest, contextHandle);
@@ -703,7 +709,8 @@ class test_ServerMessageHandler
 			ReaderInfo info = reader->getReaderInfo();
 			info.setCardInfo(cardInfo);
 			reader->setReaderInfo(info);
-			QTRY_COMPARE(sendSpy.count(), 3); // clazy:exclude=qstring-allocations
+			QTRY_COMPARE(Env::getSingleton<ReaderManager>()->getReaderInfo(QStringLiteral("test-reader")).getRetryCounter(), 3); // clazy:exclude=qstring-allocations
+			QCOMPARE(sendSpy.count(), 2);
 			sendSpy.clear();
 
 			const QByteArray ifdConnectMsg = IfdConnect(QStringLiteral("test-reader"), true).toByteArray(IfdVersion::Version::latest, contextHandle);
@@ -772,7 +779,8 @@ class test_ServerMessageHandler
 			ReaderInfo info = reader->getReaderInfo();
 			info.setCardInfo(cardInfo);
 			reader->setReaderInfo(info);
-			QTRY_COMPARE(sendSpy.count(), 3); // clazy:exclude=qstring-allocations
+			QTRY_COMPARE(Env::getSingleton<ReaderManager>()->getReaderInfo(QStringLiteral("test-reader")).getRetryCounter(), 3); // clazy:exclude=qstring-allocations
+			QCOMPARE(sendSpy.count(), 2);
 			sendSpy.clear();
 
 			mDataChannel->onReceived(IfdDestroyPaceChannel(QStringLiteral("invalidSlotHandle")).toByteArray(IfdVersion::Version::latest, contextHandle));
@@ -846,7 +854,8 @@ class test_ServerMessageHandler
 			ReaderInfo info = reader->getReaderInfo();
 			info.setCardInfo(cardInfo);
 			reader->setReaderInfo(info);
-			QTRY_COMPARE(sendSpy.count(), 3); // clazy:exclude=qstring-allocations
+			QTRY_COMPARE(Env::getSingleton<ReaderManager>()->getReaderInfo(QStringLiteral("test-reader")).getRetryCounter(), 3); // clazy:exclude=qstring-allocations
+			QCOMPARE(sendSpy.count(), 2);
 			sendSpy.clear();
 
 			mDataChannel->onReceived(IfdModifyPin(QStringLiteral("invalidSlotHandle"), QByteArray::fromHex("abcd1234")).toByteArray(IfdVersion::Version::latest, contextHandle));
@@ -894,6 +903,90 @@ class test_ServerMessageHandler
 		}
 
 
+		void ifdStatusIsCoalesced()
+		{
+			ServerMessageHandlerImpl serverMessageHandler(mDataChannel);
+			QString contextHandle;
+			ensureContext(contextHandle);
+
+			// The updates arrive from the ReaderManager thread. Flush them manually
+			// instead of relying on both to arrive within the coalescing interval.
+			auto& statusTimer = serverMessageHandler.mStatusTimer;
+			const auto& pendingStatus = serverMessageHandler.mPendingStatus;
+			statusTimer.setInterval(std::chrono::hours(1));
+
+			QSignalSpy sendSpy(mDataChannel.data(), &MockDataChannel::fireSend);
+
+			const auto& reader = MockReaderManagerPlugin::getInstance().addReader("test-reader"_L1);
+			QTRY_COMPARE(sendSpy.count(), 1); // clazy:exclude=qstring-allocations
+			reader->setCard(MockCardConfig());
+			QTRY_COMPARE(sendSpy.count(), 2); // clazy:exclude=qstring-allocations
+			sendSpy.clear();
+
+			ReaderInfo info = reader->getReaderInfo();
+			info.setMaxApduLength(1000);
+			reader->setReaderInfo(info);
+			info.setMaxApduLength(2000);
+			reader->setReaderInfo(info);
+			QTRY_VERIFY(pendingStatus.contains("test-reader"_L1) && pendingStatus.value("test-reader"_L1)->getMaxApduLength() == 2000); // clazy:exclude=qstring-allocations
+			QVERIFY(statusTimer.isActive());
+			QCOMPARE(sendSpy.count(), 0);
+
+			statusTimer.stop();
+			serverMessageHandler.onStatusTimeout();
+			QCOMPARE(sendSpy.count(), 1);
+			QVERIFY(pendingStatus.isEmpty());
+
+			const IfdStatus status(IfdMessage::parseByteArray(sendSpy.takeFirst().at(0).toByteArray()));
+			QCOMPARE(status.getType(), IfdMessageType::IFDStatus);
+			QCOMPARE(status.getSlotName(), QStringLiteral("test-reader"));
+			QCOMPARE(status.getMaxApduLength(), 2000);
+			QVERIFY(status.getCardAvailable());
+
+			info.setMaxApduLength(3000);
+			reader->setReaderInfo(info);
+			QTRY_VERIFY(pendingStatus.contains("test-reader"_L1)); // clazy:exclude=qstring-allocations
+			info.setMaxApduLength(2000);
+			reader->setReaderInfo(info);
+			QTRY_VERIFY(pendingStatus.isEmpty()); // clazy:exclude=qstring-allocations
+
+			statusTimer.stop();
+			serverMessageHandler.onStatusTimeout();
+			QCOMPARE(sendSpy.count(), 0);
+
+			removeReaderAndConsumeMessages(QStringLiteral("test-reader"));
+		}
+
+
+		void ifdStatusIsFlushedByTimer()
+		{
+			ServerMessageHandlerImpl serverMessageHandler(mDataChannel);
+			QString contextHandle;
+			ensureContext(contextHandle);
+			QCOMPARE(serverMessageHandler.mStatusTimer.interval(), ServerMessageHandlerImpl::cStatusCoalescingInterval);
+
+			QSignalSpy sendSpy(mDataChannel.data(), &MockDataChannel::fireSend);
+
+			const auto& reader = MockReaderManagerPlugin::getInstance().addReader("test-reader"_L1);
+			QTRY_COMPARE(sendSpy.count(), 1); // clazy:exclude=qstring-allocations
+			sendSpy.clear();
+
+			ReaderInfo info = reader->getReaderInfo();
+			info.setMaxApduLength(1000);
+			reader->setReaderInfo(info);
+			QTRY_COMPARE(sendSpy.count(), 1); // clazy:exclude=qstring-allocations
+			QVERIFY(serverMessageHandler.mPendingStatus.isEmpty());
+			QVERIFY(!serverMessageHandler.mStatusTimer.isActive());
+
+			const IfdStatus status(IfdMessage::parseByteArray(sendSpy.takeFirst().at(0).toByteArray()));
+			QCOMPARE(status.getType(), IfdMessageType::IFDStatus);
+			QCOMPARE(status.getSlotName(), QStringLiteral("test-reader"));
+			QCOMPARE(status.getMaxApduLength(), 1000);
+
+			removeReaderAndConsumeMessages(QStringLiteral("test-reader"));
+		}
+
+
 		void test_SendModifyPinResponse_data()
 		{
 			QTest::addColumn<QByteArray>("statusCode");
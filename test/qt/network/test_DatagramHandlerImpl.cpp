@@ -89,6 +89,22 @@ class test_DatagramHandlerImpl
 		}
 
 
+		void cachedBroadcastEntries()
+		{
+			DatagramHandlerImpl socket(false);
+			QSignalSpy spy(&socket, &DatagramHandler::fireNetworkChanged);
+
+			const auto entries = socket.getAllBroadcastEntries();
+			QVERIFY(!socket.mBroadcastEntriesExpiry.hasExpired());
+			QCOMPARE(socket.getAllBroadcastEntries(), entries);
+
+			socket.onNetworkChanged();
+			QCOMPARE(spy.count(), 1);
+			QVERIFY(socket.mBroadcastEntriesExpiry.hasExpired());
+			QCOMPARE(socket.getAllBroadcastEntries(), socket.collectBroadcastEntries());
+		}
+
+
 		void getNonJsonDatagram()
 		{
 			QSharedPointer<DatagramHandler> socket(Env::create<DatagramHandler*>());
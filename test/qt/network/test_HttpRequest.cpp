@@ -31,7 +31,7 @@ class test_HttpRequest
 			QVERIFY(!request.isUpgrade());
 			QCOMPARE(request.getMethod(), QByteArray("GET"));
 			QCOMPARE(request.getHttpMethod(), HTTP_GET);
-			QCOMPARE(request.getHeader().size(), 1);
+			QCOMPARE(request.getHeaderCount(), 1);
 			QCOMPARE(request.getHeader("host"), QByteArray("Dummy.de"));
 			QCOMPARE(request.getUrl(), QUrl("/favicon.ico"_L1));
 			QCOMPARE(request.getBody().size(), 0);
@@ -57,7 +57,7 @@ class test_HttpRequest
 			QVERIFY(request.isUpgrade());
 			QCOMPARE(request.getMethod(), QByteArray("GET"));
 			QCOMPARE(request.getHttpMethod(), HTTP_GET);
-			QCOMPARE(request.getHeader().size(), 7);
+			QCOMPARE(request.getHeaderCount(), 7);
 			QCOMPARE(request.getHeader("host"), QByteArray("server.example.com"));
 			QCOMPARE(request.getHeader("upgrade"), QByteArray("websocket"));
 			QCOMPARE(request.getHeader("connection"), QByteArray("Upgrade"));
@@ -95,7 +95,7 @@ class test_HttpRequest
 			QVERIFY(!request.isUpgrade());
 			QCOMPARE(request.getMethod(), QByteArray("GET"));
 			QCOMPARE(request.getHttpMethod(), HTTP_GET);
-			QCOMPARE(request.getHeader().size(), 9);
+			QCOMPARE(request.getHeaderCount(), 9);
 			QCOMPARE(request.getHeader("host"), QByteArray("127.0.0.1:24727"));
 			QCOMPARE(request.getUrl(), QUrl("/eID-Client?tcTokenURL=https%3A%2F%2Ftest.governikus-eid.de%3A443%2FAutent-DemoApplication%2FRequestServlet%3Fprovider%3Ddemo_epa_20%26redirect%3Dtrue"_L1));
 			QCOMPARE(request.getBody().size(), 0);
@@ -105,6 +105,88 @@ class test_HttpRequest
 		}
 
 
+		void splitBuffer()
+		{
+			auto* socket = new MockSocket();
+			socket->mReaderBufferChunk = 3;
+			socket->mReadBuffer = QByteArray("POST /eID-Client?Status=json HTTP/1.1\r\n"
+											 "Host: 127.0.0.1:24727\r\n"
+											 "Content-Type: text/plain\r\n"
+											 "content-type: application/json\r\n"
+											 "X-Empty:\r\n"
+											 "Content-Length: 11\r\n"
+											 "\r\n"
+											 "hello world");
+
+			HttpRequest request(socket);
+			request.triggerSocketBuffer();
+			QVERIFY(request.mFinished);
+			QCOMPARE(request.getHttpMethod(), HTTP_POST);
+			QCOMPARE(request.getHeaderCount(), 5);
+			QCOMPARE(request.getHeader("HOST"), QByteArray("127.0.0.1:24727"));
+			QCOMPARE(request.getHeader("Content-Type"), QByteArray("application/json"));
+			QCOMPARE(request.getHeader("x-empty"), QByteArray());
+			QCOMPARE(request.getHeader("unknown"), QByteArray());
+			QCOMPARE(request.getUrl(), QUrl("/eID-Client?Status=json"_L1));
+			QCOMPARE(request.getQuery().queryItemValue("Status"_L1), "json"_L1);
+			QCOMPARE(request.getBody(), QByteArray("hello world"));
+		}
+
+
+		void chunkedBody()
+		{
+			auto* socket = new MockSocket();
+			socket->mReadBuffer = QByteArray("POST / HTTP/1.1\r\n"
+											 "Transfer-Encoding: chunked\r\n"
+											 "\r\n"
+											 "5\r\nhello\r\n"
+											 "6\r\n world\r\n"
+											 "0\r\n\r\n");
+
+			HttpRequest request(socket);
+			request.triggerSocketBuffer();
+			QVERIFY(request.mFinished);
+			QCOMPARE(request.getHeader("transfer-encoding"), QByteArray("chunked"));
+			QCOMPARE(request.getBody(), QByteArray("hello world"));
+		}
+
+
+		void benchmark_data()
+		{
+			QTest::addColumn<QByteArray>("data");
+
+			QTest::newRow("status") << QByteArray("GET /eID-Client?Status=json HTTP/1.1\r\n"
+												  "Host: 127.0.0.1:24727\r\n"
+												  "User-Agent: Mozilla/5.0 (X11; Linux x86_64; rv:49.0) Gecko/20100101 Firefox/49.0\r\n"
+												  "Accept: text/html,application/xhtml+xml,application/xml;q=0.9,*/*;q=0.8\r\n"
+												  "Accept-Language: de-DE,de;q=0.8,en-US;q=0.5,en;q=0.3\r\n"
+												  "Accept-Encoding: gzip, deflate\r\n"
+												  "Connection: keep-alive\r\n"
+												  "\r\n");
+			QTest::newRow("body") << QByteArray("POST /eID-Client HTTP/1.1\r\n"
+												"Host: 127.0.0.1:24727\r\n"
+												"Content-Length: 65536\r\n"
+												"\r\n") + QByteArray(65536, 'x');
+		}
+
+
+		void benchmark()
+		{
+			QFETCH(QByteArray, data);
+
+			QBENCHMARK{
+				auto* socket = new MockSocket();
+				socket->mReadBuffer = data;
+
+				HttpRequest request(socket);
+				request.triggerSocketBuffer();
+				QVERIFY(request.mFinished);
+				QVERIFY(!request.getHeader("host").isEmpty());
+				QVERIFY(!request.getUrl().isEmpty());
+			}
+		}
+
+
 };
 
 QTEST_GUILESS_MAIN(test_HttpRequest)
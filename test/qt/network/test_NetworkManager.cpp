@@ -5,6 +5,7 @@
 #include "NetworkManager.h"
 
 #include "Env.h"
+#include "KeyPair.h"
 #include "LogHandler.h"
 #include "ReaderManager.h"
 #include "ResourceLoader.h"
@@ -67,6 +68,7 @@ class test_NetworkManager
 			const auto cipherCount = Env::getSingleton<SecureStorage>()->getTlsConfig().getCiphers().size();
 			QCOMPARE(request.sslConfiguration().ciphers().size(), cipherCount);
 			QVERIFY(request.sslConfiguration().ciphers().contains(QSslCipher("ECDHE-RSA-AES256-GCM-SHA384"_L1)));
+			QVERIFY(!request.attribute(QNetworkRequest::Http2AllowedAttribute).toBool());
 		}
 
 
@@ -84,6 +86,144 @@ class test_NetworkManager
 			QVERIFY(request.sslConfiguration().ciphers().contains(QSslCipher("RSA-PSK-AES128-GCM-SHA256"_L1)));
 			QVERIFY(request.sslConfiguration().ciphers().contains(QSslCipher("RSA-PSK-AES256-CBC-SHA384"_L1)));
 			QVERIFY(request.sslConfiguration().ciphers().contains(QSslCipher("RSA-PSK-AES256-GCM-SHA384"_L1)));
+			QVERIFY(!request.attribute(QNetworkRequest::Http2AllowedAttribute).toBool());
+		}
+
+
+		void selectPool()
+		{
+			auto* networkManager = Env::getSingleton<NetworkManager>();
+			networkManager->clearConnections();
+
+			const QUrl url("https://Dummy/paos"_L1);
+			networkManager->selectPool(url, true);
+			networkManager->mPreconnectCredentials.insert(NetworkManager::getPoolKey(url), qMakePair(QByteArray("identity"), QByteArray("psk")));
+			networkManager->selectPool(QUrl("https://dummy:443/other"_L1), true);
+			QCOMPARE(networkManager->mPools, QHash<QString, bool>({{"dummy:443"_L1, true}}));
+			QCOMPARE(networkManager->mPreconnectCredentials.size(), 1);
+
+			networkManager->selectPool(QUrl("https://dummy:8443"_L1), false);
+			QCOMPARE(networkManager->mPools.size(), 2);
+			QCOMPARE(networkManager->mPreconnectCredentials.size(), 1);
+
+			networkManager->mUpdaterSessions.insert("session");
+			networkManager->mPreconnectConfigurations.insert("other:443"_L1, QSslConfiguration());
+			networkManager->selectPool(url, false);
+			QCOMPARE(networkManager->mPools, QHash<QString, bool>({{"dummy:443"_L1, false}}));
+			QCOMPARE(networkManager->mPreconnectCredentials.size(), 1);
+			QCOMPARE(networkManager->mPreconnectConfigurations.size(), 1);
+			QCOMPARE(networkManager->mUpdaterSessions.size(), 1);
+
+			networkManager->selectPool(QUrl("http://dummy"_L1), true);
+			QCOMPARE(networkManager->mPools.size(), 1);
+			networkManager->clearConnections();
+		}
+
+
+		void connectionStats()
+		{
+			MockNetworkManager networkManager;
+
+			auto opened = networkManager.trackConnection(new MockNetworkReply());
+			Q_EMIT opened->socketStartedConnecting();
+			static_cast<MockNetworkReply*>(opened.get())->fireFinished();
+
+			auto reused = networkManager.trackConnection(new MockNetworkReply());
+			static_cast<MockNetworkReply*>(reused.get())->fireFinished();
+
+			auto* reply = new MockNetworkReply();
+			reply->setAttribute(QNetworkRequest::HttpStatusCodeAttribute, QVariant());
+			reply->setError(QNetworkReply::ConnectionRefusedError, "refused"_L1);
+			auto failed = networkManager.trackConnection(reply);
+			Q_EMIT failed->socketStartedConnecting();
+			reply->fireFinished();
+
+			QTRY_COMPARE(networkManager.getOpenConnectionCount(), 0); // clazy:exclude=qstring-allocations
+			const auto& stats = networkManager.getConnectionStats();
+			QCOMPARE(stats.mOpened, 2);
+			QCOMPARE(stats.mReused, 1);
+			QCOMPARE(stats.mFailed, 1);
+			QVERIFY(networkManager.mConnectingReplies.isEmpty());
+		}
+
+
+		void trackSocket()
+		{
+			MockNetworkManager networkManager;
+			QSignalSpy spy(&networkManager, &NetworkManager::fireConnectionsClosed);
+
+			auto* socket = new QTcpSocket();
+			networkManager.trackSocket(socket);
+			QCOMPARE(networkManager.getOpenConnectionCount(), 1);
+
+			delete socket;
+			QCOMPARE(networkManager.getOpenConnectionCount(), 0);
+			QCOMPARE(spy.count(), 1);
+		}
+
+
+		void preconnectPsk()
+		{
+			const auto& pair = KeyPair::generate();
+			auto cfg = Env::getSingleton<SecureStorage>()->getTlsConfig(SecureStorage::TlsSuite::PSK).getConfiguration();
+			cfg.setLocalCertificate(pair.getCertificate());
+			cfg.setPrivateKey(pair.getKey());
+			cfg.setPeerVerifyMode(QSslSocket::VerifyNone);
+			cfg.setOcspStaplingEnabled(false);
+
+			QByteArray identity;
+			QSslServer server;
+			server.setSslConfiguration(cfg);
+			connect(&server, &QSslServer::preSharedKeyAuthenticationRequired, this, [&identity](QSslSocket*, QSslPreSharedKeyAuthenticator* pAuthenticator){
+						identity = pAuthenticator->identity();
+						pAuthenticator->setPreSharedKey(QByteArray::fromHex("4BC1A0B5"));
+					});
+			QVERIFY(server.listen(QHostAddress::LocalHost));
+
+			auto* networkManager = Env::getSingleton<NetworkManager>();
+			const QUrl url(QStringLiteral("https://localhost:%1/entrypoint").arg(server.serverPort()));
+			networkManager->preconnect(url, "1A2BB129", QByteArray::fromHex("4BC1A0B5"));
+			QCOMPARE(networkManager->mPreconnectCredentials.size(), 1);
+
+			QTRY_COMPARE(identity, QByteArray("1A2BB129")); // clazy:exclude=qstring-allocations
+			QVERIFY(networkManager->mPreconnectCredentials.isEmpty());
+			QTRY_COMPARE(networkManager->getOpenConnectionCount(), 0); // clazy:exclude=qstring-allocations
+
+			const auto& preconnectCfg = networkManager->takePreconnectConfiguration(url);
+			QCOMPARE(preconnectCfg.peerCertificate(), pair.getCertificate());
+			QVERIFY(networkManager->takePreconnectConfiguration(url).isNull());
+			networkManager->clearConnections();
+		}
+
+
+		void preconnectPending()
+		{
+			QTcpServer server;
+			QVERIFY(server.listen(QHostAddress::LocalHost));
+			server.pauseAccepting();
+
+			auto* networkManager = Env::getSingleton<NetworkManager>();
+			const QUrl url(QStringLiteral("https://localhost:%1/entrypoint").arg(server.serverPort()));
+			networkManager->preconnect(url, "1A2BB129", QByteArray::fromHex("4BC1A0B5"));
+			QCOMPARE(networkManager->getOpenConnectionCount(), 1);
+			QCOMPARE(networkManager->mPreconnects.size(), 1);
+			QVERIFY(networkManager->isPreconnect(networkManager->mPreconnects.value(NetworkManager::getPoolKey(url))));
+
+			QVERIFY(networkManager->takePreconnectConfiguration(url).isNull());
+			QVERIFY(networkManager->mPreconnects.isEmpty());
+			QVERIFY(networkManager->mPreconnectCredentials.isEmpty());
+			QTRY_COMPARE(networkManager->getOpenConnectionCount(), 0); // clazy:exclude=qstring-allocations
+			QVERIFY(networkManager->takePreconnectConfiguration(url).isNull());
+			networkManager->clearConnections();
+		}
+
+
+		void preconnectIgnored()
+		{
+			auto* networkManager = Env::getSingleton<NetworkManager>();
+			networkManager->preconnect(QUrl("http://localhost/entrypoint"_L1), "1A2BB129", "psk");
+			networkManager->preconnect(QUrl(), "1A2BB129", "psk");
+			QVERIFY(networkManager->mPreconnectCredentials.isEmpty());
 		}
 
 
@@ -30,7 +30,7 @@ class test_MsgHandlerAccessRights
 	QSharedPointer<CHAT> getChat(const std::initializer_list<AccessRight>& pList)
 	{
 		auto chat = newObject<CHAT>();
-		chat->setAccessRights(QSet<AccessRight>(pList));
+		chat->setAccessRights(AccessRights(pList));
 		return chat;
 	}
 
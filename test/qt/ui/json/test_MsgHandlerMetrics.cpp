@@ -0,0 +1,44 @@
+/**
+ * Copyright (c) 2025 Governikus GmbH & Co. KG, Germany
+ */
+
+#include "messages/MsgHandlerMetrics.h"
+
+#include "Env.h"
+#include "MessageDispatcher.h"
+#include "Metrics.h"
+
+#include <QtTest>
+
+using namespace governikus;
+
+
+class test_MsgHandlerMetrics
+	: public QObject
+{
+	Q_OBJECT
+
+	private Q_SLOTS:
+		void initTestCase()
+		{
+			auto* metrics = Env::getSingleton<Metrics>();
+			metrics->increment(Metric::WORKFLOWS, {{QLatin1StringView("workflow"), QStringLiteral("AUTH")}, {QLatin1StringView("status"), QStringLiteral("No_Error")}});
+			metrics->record(Metric::APDU_DURATION, 1000, {{QLatin1StringView("reader"), QStringLiteral("PCSC")}});
+		}
+
+
+		void metrics()
+		{
+			MessageDispatcher dispatcher;
+			const QByteArray msg = dispatcher.processCommand(QByteArray(R"({"cmd": "GET_METRICS"})"));
+			QVERIFY(msg.contains(R"("msg":"METRICS")"));
+			QVERIFY(msg.contains(R"("ausweisapp_workflows_total":[{"labels":{"status":"No_Error","workflow":"AUTH"},"value":1}])"));
+			QVERIFY(msg.contains(R"("ausweisapp_apdu_duration_seconds":[{"count":1,)"));
+			QVERIFY(msg.contains(R"("ausweisapp_tls_handshake_seconds":[])"));
+		}
+
+
+};
+
+QTEST_GUILESS_MAIN(test_MsgHandlerMetrics)
+#include "test_MsgHandlerMetrics.moc"
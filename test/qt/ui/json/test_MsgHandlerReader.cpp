@@ -159,6 +159,27 @@ class test_MsgHandlerReader
 		}
 
 
+		void cachedMessage()
+		{
+			const auto& reader = MockReaderManagerPlugin::getInstance().addReader("CachedMock"_L1);
+			reader->setCard(MockCardConfig());
+			ReaderInfo info = reader->getReaderInfo();
+			info.setCardInfo(CardInfo(CardType::EID_CARD, FileRef(), QSharedPointer<const EFCardAccess>(), 3, false));
+
+			const MsgContext context;
+			const QByteArray first = MsgHandlerReader::createMessage(info, context);
+			QCOMPARE(first, MsgHandlerReader(info, context).toJson());
+			QVERIFY(QByteArray(MsgHandlerReader::createMessage(info, context)).isSharedWith(first));
+
+			info.setCardInfo(CardInfo(CardType::EID_CARD, FileRef(), QSharedPointer<const EFCardAccess>(), 2, false));
+			const QByteArray second = MsgHandlerReader::createMessage(info, context);
+			QVERIFY(!second.isSharedWith(first));
+			QVERIFY(second.contains(R"("retryCounter":2)"));
+			QCOMPARE(second, MsgHandlerReader(info, context).toJson());
+			QVERIFY(QByteArray(MsgHandlerReader::createMessage(info, context)).isSharedWith(second));
+		}
+
+
 #if __has_include("SmartManager.h")
 		void eidType_data()
 		{
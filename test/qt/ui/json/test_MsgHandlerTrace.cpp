@@ -0,0 +1,79 @@
+/**
+ * Copyright (c) 2025 Governikus GmbH & Co. KG, Germany
+ */
+
+#include "messages/MsgHandlerTrace.h"
+
+#include "Env.h"
+#include "MessageDispatcher.h"
+#include "Tracer.h"
+
+#include <QtTest>
+
+using namespace governikus;
+
+
+class test_MsgHandlerTrace
+	: public QObject
+{
+	Q_OBJECT
+
+	private Q_SLOTS:
+		void initTestCase()
+		{
+			auto* tracer = Env::getSingleton<Tracer>();
+			tracer->startTrace(QStringLiteral("AUTH"));
+			tracer->finishTrace();
+			tracer->startTrace(QStringLiteral("CHANGE_PIN"));
+			tracer->finishTrace();
+		}
+
+
+		void lastTrace()
+		{
+			MessageDispatcher dispatcher;
+			const QByteArray msg = dispatcher.processCommand(QByteArray(R"({"cmd": "GET_TRACE"})"));
+			QVERIFY(msg.contains(R"("msg":"TRACE")"));
+			QVERIFY(msg.contains(R"("workflow":"CHANGE_PIN")"));
+			QVERIFY(!msg.contains(R"("workflow":"AUTH")"));
+			QVERIFY(msg.contains(R"("traceEvents":[)"));
+		}
+
+
+		void count()
+		{
+			MessageDispatcher dispatcher;
+			const QByteArray msg = dispatcher.processCommand(QByteArray(R"({"cmd": "GET_TRACE", "count": 2, "format": "otlp"})"));
+			QVERIFY(msg.contains(R"("msg":"TRACE")"));
+			QCOMPARE(msg.count(R"("resourceSpans":[)"), 2);
+		}
+
+
+		void invalid_data()
+		{
+			QTest::addColumn<QByteArray>("request");
+			QTest::addColumn<QByteArray>("error");
+
+			QTest::newRow("count string") << QByteArray(R"({"cmd": "GET_TRACE", "count": "2"})") << QByteArray("Invalid count");
+			QTest::newRow("count zero") << QByteArray(R"({"cmd": "GET_TRACE", "count": 0})") << QByteArray("Invalid count");
+			QTest::newRow("format") << QByteArray(R"({"cmd": "GET_TRACE", "format": "xml"})") << QByteArray("Invalid format");
+		}
+
+
+		void invalid()
+		{
+			QFETCH(QByteArray, request);
+			QFETCH(QByteArray, error);
+
+			MessageDispatcher dispatcher;
+			const QByteArray msg = dispatcher.processCommand(request);
+			QVERIFY(msg.contains(R"("msg":"TRACE")"));
+			QVERIFY(msg.contains(error));
+			QVERIFY(!msg.contains(R"("traces")"));
+		}
+
+
+};
+
+QTEST_GUILESS_MAIN(test_MsgHandlerTrace)
+#include "test_MsgHandlerTrace.moc"
@@ -0,0 +1,54 @@
+/**
+ * Copyright (c) 2025 Governikus GmbH & Co. KG, Germany
+ */
+
+#include "messages/MsgTypes.h"
+
+#include <QtTest>
+
+using namespace Qt::Literals::StringLiterals;
+using namespace governikus;
+
+
+class test_MsgTypes
+	: public QObject
+{
+	Q_OBJECT
+
+	private Q_SLOTS:
+		void knownCommands()
+		{
+			const auto& list = Enum<MsgCmdType>::getList();
+			for (const auto type : list)
+			{
+				const QString name = Enum<MsgCmdType>::getName(type);
+				QCOMPARE(getMsgCmdType(name), type);
+			}
+		}
+
+
+		void unknownCommands_data()
+		{
+			QTest::addColumn<QString>("cmd");
+
+			QTest::newRow("empty") << QString();
+			QTest::newRow("lower case") << u"get_info"_s;
+			QTest::newRow("prefix") << u"GET_INF"_s;
+			QTest::newRow("suffix") << u"GET_INFOS"_s;
+			QTest::newRow("unicode") << u"GET_İNFO"_s;
+			QTest::newRow("whitespace") << u" GET_INFO"_s;
+		}
+
+
+		void unknownCommands()
+		{
+			QFETCH(QString, cmd);
+
+			QCOMPARE(getMsgCmdType(cmd), MsgCmdType::UNDEFINED);
+		}
+
+
+};
+
+QTEST_GUILESS_MAIN(test_MsgTypes)
+#include "test_MsgTypes.moc"
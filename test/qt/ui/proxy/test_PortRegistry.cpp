@@ -0,0 +1,114 @@
+/**
+ * Copyright (c) 2025 Governikus GmbH & Co. KG, Germany
+ */
+
+#include "PortRegistry.h"
+
+#include "Env.h"
+#include "PortFile.h"
+
+#include <QtTest>
+
+#include <algorithm>
+
+
+using namespace Qt::Literals::StringLiterals;
+using namespace governikus;
+
+
+class test_PortRegistry
+	: public QObject
+{
+	Q_OBJECT
+
+	private:
+		static bool hasBackend(const PortRegistry* pRegistry, quint16 pPort)
+		{
+			return std::any_of(pRegistry->mBackends.constBegin(), pRegistry->mBackends.constEnd(), [pPort](const auto& pBackend){
+						return pBackend.mPort == pPort;
+					});
+		}
+
+	private Q_SLOTS:
+		void init()
+		{
+#ifdef Q_OS_WIN
+			QSKIP("Windows does not use PortFile");
+#endif
+		}
+
+
+		void getPorts()
+		{
+			auto* registry = Env::getSingleton<PortRegistry>();
+
+			PortFile first(u"first"_s);
+			first.handlePort(1001);
+			PortFile second(u"second"_s);
+			second.handlePort(1002);
+
+			auto ports = registry->getPorts(1001);
+			QVERIFY(ports.contains(1002));
+			QVERIFY(!ports.contains(1001));
+
+			ports = registry->getPorts(0);
+			QVERIFY(ports.contains(1001));
+			QVERIFY(ports.contains(1002));
+
+			second.remove();
+			ports = registry->getPorts(0);
+			QVERIFY(ports.contains(1001));
+			QVERIFY(!ports.contains(1002));
+		}
+
+
+		void health()
+		{
+			auto* registry = Env::getSingleton<PortRegistry>();
+
+			PortFile first(u"first"_s);
+			first.handlePort(1001);
+			PortFile second(u"second"_s);
+			second.handlePort(1002);
+
+			QTest::ignoreMessage(QtDebugMsg, "Instance on port 1001 failed 1 times, deprioritize it for 1000 ms");
+			registry->reportHealth(1001, false);
+			QCOMPARE(registry->getPorts(0).constLast(), quint16(1001));
+
+			QTest::ignoreMessage(QtDebugMsg, "Instance on port 1001 failed 2 times, deprioritize it for 2000 ms");
+			registry->reportHealth(1001, false);
+			QCOMPARE(registry->getPorts(0).constLast(), quint16(1001));
+
+			registry->reportHealth(1001, true);
+			QVERIFY(registry->getPorts(0).contains(1001));
+			for (const auto& backend : std::as_const(registry->mBackends))
+			{
+				QVERIFY(backend.mPort != 1001 || backend.isHealthy());
+			}
+		}
+
+
+		void watchDirectory()
+		{
+			auto* registry = Env::getSingleton<PortRegistry>();
+			if (registry->mWatcher.directories().isEmpty())
+			{
+				QSKIP("Temp directory cannot be watched");
+			}
+
+			Q_UNUSED(registry->getPorts(0))
+			QVERIFY(!hasBackend(registry, 1003));
+
+			PortFile third(u"third"_s);
+			third.handlePort(1003);
+			QTRY_VERIFY(hasBackend(registry, 1003)); // clazy:exclude=qstring-allocations
+
+			third.remove();
+			QTRY_VERIFY(!hasBackend(registry, 1003)); // clazy:exclude=qstring-allocations
+		}
+
+
+};
+
+QTEST_GUILESS_MAIN(test_PortRegistry)
+#include "test_PortRegistry.moc"
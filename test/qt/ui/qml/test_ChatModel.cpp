@@ -84,7 +84,7 @@ class test_ChatModel
 			QVERIFY(mModel->mAllRights.isEmpty());
 			QVERIFY(mModel->mOptionalRights.isEmpty());
 			QVERIFY(mModel->mSelectedRights.isEmpty());
-			auto uniqueRights = QSet<AccessRight>(mModel->mAllRights.constBegin(), mModel->mAllRights.constEnd());
+			auto uniqueRights = AccessRights(mModel->mAllRights.constBegin(), mModel->mAllRights.constEnd());
 			QCOMPARE(mModel->mSelectedRights, uniqueRights);
 
 			accessRightManager->mRequiredAccessRights += AccessRight::READ_DG01;
@@ -96,7 +96,7 @@ class test_ChatModel
 			QVERIFY(mModel->mSelectedRights.contains(AccessRight::READ_DG01));
 			QVERIFY(mModel->mSelectedRights.contains(AccessRight::READ_DG04));
 			QVERIFY(mModel->mOptionalRights.isEmpty());
-			uniqueRights = QSet<AccessRight>(mModel->mAllRights.constBegin(), mModel->mAllRights.constEnd());
+			uniqueRights = AccessRights(mModel->mAllRights.constBegin(), mModel->mAllRights.constEnd());
 			QCOMPARE(mModel->mSelectedRights, uniqueRights);
 
 			accessRightManager->mOptionalAccessRights += AccessRight::READ_DG10;
@@ -111,14 +111,14 @@ class test_ChatModel
 			QVERIFY(mModel->mSelectedRights.contains(AccessRight::READ_DG04));
 			QVERIFY(mModel->mSelectedRights.contains(AccessRight::READ_DG10));
 			QVERIFY(mModel->mSelectedRights.contains(AccessRight::READ_DG17));
-			uniqueRights = QSet<AccessRight>(mModel->mAllRights.constBegin(), mModel->mAllRights.constEnd());
+			uniqueRights = AccessRights(mModel->mAllRights.constBegin(), mModel->mAllRights.constEnd());
 			QCOMPARE(mModel->mSelectedRights, uniqueRights);
 		}
 
 
 		void test_SetOrderedAllRights()
 		{
-			QSet<AccessRight> rights;
+			AccessRights rights;
 			rights.insert(AccessRight::READ_DG01);
 			rights.insert(AccessRight::INSTALL_QUAL_CERT);
 			rights.insert(AccessRight::CAN_ALLOWED);
@@ -172,7 +172,7 @@ class test_ChatModel
 			QModelIndex index = mModel->createIndex(0, 0);
 			QList<AccessRight> rights = {AccessRight::READ_DG16, AccessRight::READ_DG02};
 			mModel->mAllRights = rights;
-			mModel->mSelectedRights = QSet<AccessRight>();
+			mModel->mSelectedRights = AccessRights();
 
 			QCOMPARE(mModel->data(index, ChatModel::ChatRoles::SELECTED_ROLE), false);
 			QVERIFY(mModel->setData(index, true, ChatModel::ChatRoles::SELECTED_ROLE));
@@ -0,0 +1,134 @@
+/**
+ * Copyright (c) 2025 Governikus GmbH & Co. KG, Germany
+ */
+
+#include "LogIndex.h"
+
+#include <QTest>
+
+
+using namespace Qt::Literals::StringLiterals;
+using namespace governikus;
+
+
+class test_LogIndex
+	: public QObject
+{
+	Q_OBJECT
+
+	private Q_SLOTS:
+		void isHeader_data()
+		{
+			QTest::addColumn<QByteArray>("line");
+			QTest::addColumn<bool>("header");
+
+			QTest::newRow("valid") << "cat           2025.01.02 03:04:05.006 123 W test"_ba << true;
+			QTest::newRow("longPid") << "card_pcsc.x   2025.01.02 03:04:05.006 1234567 D test"_ba << true;
+			QTest::newRow("shortPid") << "cat           2025.01.02 03:04:05.006 12 W test"_ba << false;
+			QTest::newRow("shortCategory") << "cat 2025.01.02 03:04:05.006 123 W test"_ba << false;
+			QTest::newRow("upperCategory") << "Cat           2025.01.02 03:04:05.006 123 W test"_ba << false;
+			QTest::newRow("invalidDate") << "cat           2025-01-02 03:04:05.006 123 W test"_ba << false;
+			QTest::newRow("truncated") << "cat           2025.01.02 03:04:05.006 123"_ba << false;
+			QTest::newRow("empty") << QByteArray() << false;
+		}
+
+
+		void isHeader()
+		{
+			QFETCH(QByteArray, line);
+			QFETCH(bool, header);
+
+			QCOMPARE(LogIndex::isHeader(line), header);
+		}
+
+
+		void parseLevel_data()
+		{
+			QTest::addColumn<QByteArray>("entry");
+			QTest::addColumn<char>("level");
+
+			QTest::newRow("warning") << "cat 123 W abc"_ba << 'W';
+			QTest::newRow("default") << "cat abc"_ba << 'D';
+			QTest::newRow("shortPid") << "cat 12 W 1234 I abc"_ba << 'I';
+			QTest::newRow("lowerCase") << "cat 123 w abc"_ba << 'D';
+			QTest::newRow("end") << "cat 123 W"_ba << 'D';
+			QTest::newRow("multiline") << "cat abc\n123 C abc"_ba << 'C';
+		}
+
+
+		void parseLevel()
+		{
+			QFETCH(QByteArray, entry);
+			QFETCH(char, level);
+
+			QCOMPARE(LogIndex::parseLevel(entry), level);
+		}
+
+
+		void incrementalUpdate()
+		{
+			QByteArray data("dog           2025.01.02 03:04:05.006 123 I first\r\n"
+							"cat           2025.01.02 03:04:05.006 123 W second\r\n");
+
+			LogIndex index;
+			index.update(data);
+			QCOMPARE(index.size(), 2);
+			QCOMPARE(index.getText(1, data), "cat           2025.01.02 03:04:05.006 123 W second"_L1);
+			QCOMPARE(index.getLevels(), QSet<QString>({"I"_L1, "W"_L1}));
+			QCOMPARE(index.getCategories(), QSet<QString>({"dog"_L1, "cat"_L1}));
+
+			data += "continued 123 C\r\n";
+			auto chunk = index.scan(data);
+			QVERIFY(chunk.mEntries.isEmpty());
+			QCOMPARE(chunk.mContinuation, data.size() - 2);
+			index.commit(chunk, data);
+			QCOMPARE(index.size(), 2);
+			QCOMPARE(index.getText(1, data), "cat           2025.01.02 03:04:05.006 123 W second\ncontinued 123 C"_L1);
+			QCOMPARE(index.getLevel(1), "W"_L1);
+
+			data += "dog           2025.01.02 03:04:05.006 123 C third\n";
+			chunk = index.scan(data);
+			QCOMPARE(chunk.mEntries.size(), 1);
+			QCOMPARE(chunk.mContinuation, -1);
+			index.commit(chunk, data);
+			QCOMPARE(index.size(), 3);
+			QCOMPARE(index.getLevel(2), "C"_L1);
+			QCOMPARE(index.getCategory(2), "dog"_L1);
+			QCOMPARE(index.getCategories().size(), 2);
+			QCOMPARE(index.getLevels().size(), 3);
+		}
+
+
+		void partialLine()
+		{
+			QByteArray data("dog           2025.01.02 03:04:05.006 123 I first\n"
+							"cat           2025.01.02 03:04:05.006 123");
+
+			LogIndex index;
+			auto chunk = index.scan(data);
+			QCOMPARE(chunk.mEntries.size(), 1);
+			QCOMPARE(chunk.mEnd, data.indexOf('\n') + 1);
+			index.commit(chunk, data);
+			QCOMPARE(index.size(), 1);
+
+			data += " W second\n";
+			index.update(data);
+			QCOMPARE(index.size(), 2);
+			QCOMPARE(index.getText(1, data), "cat           2025.01.02 03:04:05.006 123 W second"_L1);
+			QCOMPARE(index.getLevel(1), "W"_L1);
+			QCOMPARE(index.getCategory(1), "cat"_L1);
+
+			data += "continued";
+			index.update(data);
+			QCOMPARE(index.getText(1, data), "cat           2025.01.02 03:04:05.006 123 W second"_L1);
+
+			index.update(data, true);
+			QCOMPARE(index.size(), 2);
+			QCOMPARE(index.getText(1, data), "cat           2025.01.02 03:04:05.006 123 W second\ncontinued"_L1);
+		}
+
+
+};
+
+QTEST_GUILESS_MAIN(test_LogIndex)
+#include "test_LogIndex.moc"
@@ -8,6 +8,7 @@
 
 #include <QDebug>
 #include <QSignalSpy>
+#include <QTemporaryFile>
 #include <QTest>
 
 using namespace Qt::Literals::StringLiterals;
@@ -39,7 +40,7 @@ class test_LogModel
 			mModel = new LogModel();
 			// The test only covers the LogModel functionality, LogHandler will return an
 			// error message to the LogModel if not properly initialised; discard that.
-			mModel->mLogEntries.clear();
+			mModel->setLogEntries(QByteArray());
 		}
 
 
@@ -89,7 +90,7 @@ class test_LogModel
 			QSignalSpy spyCategory(mModel, &LogModel::fireCategoriesChanged);
 
 			mModel->addLogEntry(input);
-			QCOMPARE(mModel->mLogEntries.at(0), input);
+			QCOMPARE(mModel->rowCount(QModelIndex()), 1);
 			const QModelIndex index = mModel->index(0);
 			QCOMPARE(mModel->data(index, LogModel::OriginRole), origin);
 			QCOMPARE(mModel->data(index, LogModel::LevelRole), level);
@@ -147,35 +148,35 @@ class test_LogModel
 		void test_AddMultilineLogEntry()
 		{
 			mModel->addLogEntry(QStringLiteral("FooBar"));
-			QCOMPARE(mModel->mLogEntries.size(), 1);
-			QCOMPARE(mModel->mLogEntries.at(0), QLatin1String("FooBar"));
+			QCOMPARE(mModel->rowCount(QModelIndex()), 1);
+			QCOMPARE(mModel->data(mModel->index(0)).toString(), QLatin1String("FooBar"));
 
 			mModel->addLogEntry(QStringLiteral("FooBar"));
-			QCOMPARE(mModel->mLogEntries.size(), 1);
-			QCOMPARE(mModel->mLogEntries.at(0), QLatin1String("FooBar\nFooBar"));
+			QCOMPARE(mModel->rowCount(QModelIndex()), 1);
+			QCOMPARE(mModel->data(mModel->index(0)).toString(), QLatin1String("FooBar\nFooBar"));
 
 			mModel->addLogEntry(QStringLiteral("cat           0000.00.00 00:00:00.000 000 test"));
-			QCOMPARE(mModel->mLogEntries.size(), 2);
-			QCOMPARE(mModel->mLogEntries.at(0), QLatin1String("FooBar\nFooBar"));
-			QCOMPARE(mModel->mLogEntries.at(1), QLatin1String("cat           0000.00.00 00:00:00.000 000 test"));
+			QCOMPARE(mModel->rowCount(QModelIndex()), 2);
+			QCOMPARE(mModel->data(mModel->index(0)).toString(), QLatin1String("FooBar\nFooBar"));
+			QCOMPARE(mModel->data(mModel->index(1)).toString(), QLatin1String("cat           0000.00.00 00:00:00.000 000 test"));
 
 			mModel->addLogEntry(QStringLiteral("cat           0001.02.03 04:05:06.007 0000008 test"));
-			QCOMPARE(mModel->mLogEntries.size(), 3);
-			QCOMPARE(mModel->mLogEntries.at(0), QLatin1String("FooBar\nFooBar"));
-			QCOMPARE(mModel->mLogEntries.at(1), QLatin1String("cat           0000.00.00 00:00:00.000 000 test"));
-			QCOMPARE(mModel->mLogEntries.at(2), QLatin1String("cat           0001.02.03 04:05:06.007 0000008 test"));
+			QCOMPARE(mModel->rowCount(QModelIndex()), 3);
+			QCOMPARE(mModel->data(mModel->index(0)).toString(), QLatin1String("FooBar\nFooBar"));
+			QCOMPARE(mModel->data(mModel->index(1)).toString(), QLatin1String("cat           0000.00.00 00:00:00.000 000 test"));
+			QCOMPARE(mModel->data(mModel->index(2)).toString(), QLatin1String("cat           0001.02.03 04:05:06.007 0000008 test"));
 
 			mModel->addLogEntry(QStringLiteral("BarFoo"));
-			QCOMPARE(mModel->mLogEntries.size(), 3);
-			QCOMPARE(mModel->mLogEntries.at(0), QLatin1String("FooBar\nFooBar"));
-			QCOMPARE(mModel->mLogEntries.at(1), QLatin1String("cat           0000.00.00 00:00:00.000 000 test"));
-			QCOMPARE(mModel->mLogEntries.at(2), QLatin1String("cat           0001.02.03 04:05:06.007 0000008 test\nBarFoo"));
+			QCOMPARE(mModel->rowCount(QModelIndex()), 3);
+			QCOMPARE(mModel->data(mModel->index(0)).toString(), QLatin1String("FooBar\nFooBar"));
+			QCOMPARE(mModel->data(mModel->index(1)).toString(), QLatin1String("cat           0000.00.00 00:00:00.000 000 test"));
+			QCOMPARE(mModel->data(mModel->index(2)).toString(), QLatin1String("cat           0001.02.03 04:05:06.007 0000008 test\nBarFoo"));
 
 			mModel->addLogEntry(QStringLiteral("cat 0000.00.00 00:00:00.000 000 test"));
-			QCOMPARE(mModel->mLogEntries.size(), 3);
-			QCOMPARE(mModel->mLogEntries.at(0), QLatin1String("FooBar\nFooBar"));
-			QCOMPARE(mModel->mLogEntries.at(1), QLatin1String("cat           0000.00.00 00:00:00.000 000 test"));
-			QCOMPARE(mModel->mLogEntries.at(2), QLatin1String("cat           0001.02.03 04:05:06.007 0000008 test\nBarFoo\ncat 0000.00.00 00:00:00.000 000 test"));
+			QCOMPARE(mModel->rowCount(QModelIndex()), 3);
+			QCOMPARE(mModel->data(mModel->index(0)).toString(), QLatin1String("FooBar\nFooBar"));
+			QCOMPARE(mModel->data(mModel->index(1)).toString(), QLatin1String("cat           0000.00.00 00:00:00.000 000 test"));
+			QCOMPARE(mModel->data(mModel->index(2)).toString(), QLatin1String("cat           0001.02.03 04:05:06.007 0000008 test\nBarFoo\ncat 0000.00.00 00:00:00.000 000 test"));
 		}
 
 
@@ -206,11 +207,10 @@ class test_LogModel
 
 			QFile file(fileName);
 			QVERIFY(file.open(QIODevice::ReadOnly));
-			QTextStream stream(&file);
 
-			mModel->setLogEntries(stream);
+			mModel->setLogEntries(file.readAll());
 			QCOMPARE(spyNewLogMsg.size(), 0);
-			QCOMPARE(mModel->mLogEntries.size(), logEntriesSize);
+			QCOMPARE(mModel->rowCount(QModelIndex()), logEntriesSize);
 			QCOMPARE(spyLevel.size(), 1);
 			QCOMPARE(mModel->getLevels().size(), logLevelSize);
 			QCOMPARE(spyCategory.size(), 1);
@@ -218,6 +218,80 @@ class test_LogModel
 		}
 
 
+		void test_SetSourceIndexedInBackground()
+		{
+			QTemporaryFile file;
+			QVERIFY(file.open());
+			const QByteArray entry("cat           2025.01.02 03:04:05.006 12345 W LogModel.cpp:1 : test\n  continued\n");
+			const auto count = static_cast<int>(LogModel::cAsyncIndexThreshold / entry.size()) + 1;
+			for (int i = 0; i < count; ++i)
+			{
+				file.write(entry);
+			}
+			QVERIFY(file.flush());
+
+			QSignalSpy spyLevel(mModel, &LogModel::fireLevelsChanged);
+			mModel->setSource(file.fileName());
+			QVERIFY(mModel->isLoading());
+			QCOMPARE(mModel->rowCount(QModelIndex()), 0);
+
+			QTRY_VERIFY(!mModel->isLoading()); // clazy:exclude=qstring-allocations
+			QCOMPARE(mModel->rowCount(QModelIndex()), count);
+			QCOMPARE(spyLevel.size(), 2);
+			QCOMPARE(mModel->getLevels(), QSet<QString>({"W"_L1}));
+			QCOMPARE(mModel->getCategories(), QSet<QString>({"cat"_L1}));
+
+			const auto index = mModel->index(count - 1);
+			QCOMPARE(mModel->data(index).toString(), QString::fromLatin1(entry.chopped(1)));
+			QCOMPARE(mModel->data(index, LogModel::MessageRole).toString(), "test\n  continued"_L1);
+		}
+
+
+		void test_SourceChangedWhileIndexing()
+		{
+			QTemporaryFile file;
+			QVERIFY(file.open());
+			QVERIFY(file.write(QByteArray(LogModel::cAsyncIndexThreshold, 'a')) > 0);
+			QVERIFY(file.flush());
+
+			mModel->setSource(file.fileName());
+			QVERIFY(mModel->isLoading());
+
+			mModel->setSource(QStringLiteral(":/logfiles/size42.txt"));
+			QVERIFY(!mModel->isLoading());
+			QCOMPARE(mModel->rowCount(QModelIndex()), 42);
+
+			QTest::qWait(100);
+			QCOMPARE(mModel->rowCount(QModelIndex()), 42);
+		}
+
+
+		void test_TruncatedSourceIsRead()
+		{
+#ifdef Q_OS_WIN
+			QSKIP("Logs are not mapped on Windows");
+#endif
+
+			QTemporaryFile file;
+			QVERIFY(file.open());
+			const QByteArray entry("cat           2025.01.02 03:04:05.006 12345 W LogModel.cpp:1 : test\n");
+			for (int i = 0; i < 10; ++i)
+			{
+				file.write(entry);
+			}
+			QVERIFY(file.flush());
+
+			mModel->setSource(file.fileName());
+			QCOMPARE(mModel->rowCount(QModelIndex()), 10);
+			QVERIFY(mModel->mMappedFile);
+
+			QVERIFY(file.resize(entry.size() * 3));
+			QTRY_COMPARE(mModel->rowCount(QModelIndex()), 3); // clazy:exclude=qstring-allocations
+			QVERIFY(!mModel->mMappedFile);
+			QCOMPARE(mModel->data(mModel->index(2), LogModel::MessageRole).toString(), "test"_L1);
+		}
+
+
 		void test_OnNewLogMsg_currentLog_messageAddedAndSignalFired()
 		{
 			mModel->setSource(QString());
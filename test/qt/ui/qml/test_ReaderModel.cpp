@@ -213,6 +213,40 @@ class test_ReaderModel
 		}
 
 
+		void test_readerInfoChanged_data()
+		{
+			QTest::addColumn<ReaderManagerPluginType>("type");
+			QTest::addColumn<int>("changes");
+			QTest::addColumn<bool>("updated");
+
+			QTest::newRow("pcsc added") << ReaderManagerPluginType::PCSC << int(ReaderInfo::AllChanged) << true;
+			QTest::newRow("nfc added") << ReaderManagerPluginType::NFC << int(ReaderInfo::AllChanged) << true;
+			QTest::newRow("remote added") << ReaderManagerPluginType::REMOTE_IFD << int(ReaderInfo::AllChanged) << false;
+			QTest::newRow("card") << ReaderManagerPluginType::PCSC << (ReaderInfo::CardTypeChanged | ReaderInfo::CardAccessChanged).toInt() << false;
+			QTest::newRow("retry counter") << ReaderManagerPluginType::PCSC << int(ReaderInfo::RetryCounterChanged) << false;
+		}
+
+
+		void test_readerInfoChanged()
+		{
+			QFETCH(ReaderManagerPluginType, type);
+			QFETCH(int, changes);
+			QFETCH(bool, updated);
+
+			ReaderModel readerModel;
+			QSignalSpy spy(&readerModel, &ReaderModel::fireModelChanged);
+
+			Q_EMIT mMockReaderManager.fireReaderInfoChanged(ReaderInfo("Reader"_L1, type), ReaderInfo::Changes(changes));
+			QCOMPARE(spy.count(), updated ? 1 : 0);
+
+			Q_EMIT mMockReaderManager.fireReaderRemoved(ReaderInfo("Reader"_L1, type));
+			Q_EMIT mMockReaderManager.fireStatusChanged(ReaderManagerPluginInfo(type));
+			const bool listed = type == ReaderManagerPluginType::PCSC || type == ReaderManagerPluginType::NFC;
+			const bool pcsc = type == ReaderManagerPluginType::PCSC;
+			QCOMPARE(spy.count(), (updated ? 1 : 0) + (listed ? 1 : 0) + (pcsc ? 1 : 0));
+		}
+
+
 };
 
 
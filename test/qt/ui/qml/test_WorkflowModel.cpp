@@ -134,6 +134,25 @@ class test_WorkflowModel
 		}
 
 
+		void test_InitialPluginTypes()
+		{
+#if defined(Q_OS_ANDROID) || defined(Q_OS_IOS)
+			QSKIP("Mobile workflows select a single plugin type");
+#endif
+
+			WorkflowModel model;
+			QSharedPointer<WorkflowContext> context(new TestWorkflowContext());
+			model.mContext = context;
+
+			model.setInitialPluginType();
+			const auto& types = context->getReaderPluginTypes();
+			QVERIFY(types.contains(ReaderManagerPluginType::PCSC));
+			QVERIFY(types.contains(ReaderManagerPluginType::REMOTE_IFD));
+			QVERIFY(types.contains(ReaderManagerPluginType::SIMULATOR));
+			QVERIFY(types.contains(ReaderManagerPluginType::REPLAY));
+		}
+
+
 		void test_isCurrentSmartCardAllowed()
 		{
 			WorkflowModel workflowModel;
@@ -5,6 +5,7 @@
 #include "UiPluginWebService.h"
 
 #include "HttpServerRequestor.h"
+#include "Metrics.h"
 #include "MockNetworkManager.h"
 #include "ResourceLoader.h"
 #include "VersionInfo.h"
@@ -277,6 +278,46 @@ class test_UiPluginWebService
 		}
 
 
+		void metrics_data()
+		{
+			QTest::addColumn<bool>("enabled");
+			QTest::addColumn<QNetworkReply::NetworkError>("error");
+
+			QTest::newRow("enabled") << true << QNetworkReply::NoError;
+			QTest::newRow("disabled") << false << QNetworkReply::ContentNotFoundError;
+		}
+
+
+		void metrics()
+		{
+			QFETCH(bool, enabled);
+			QFETCH(QNetworkReply::NetworkError, error);
+
+			auto* metrics = Env::getSingleton<Metrics>();
+			metrics->setExportEnabled(enabled);
+			metrics->increment(Metric::IFD_RECONNECTS);
+
+			HttpServerRequestor requestor;
+			QSharedPointer<QNetworkReply> reply = requestor.getRequest(getUrl("/metrics"_L1));
+			metrics->setExportEnabled(false);
+			QVERIFY(reply);
+			QCOMPARE(reply->error(), error);
+			QCOMPARE(mShowUiSpy->count(), 0);
+			QCOMPARE(mAuthenticationSpy->count(), 0);
+			if (!enabled)
+			{
+				return;
+			}
+
+			QCOMPARE(reply->header(QNetworkRequest::ContentTypeHeader).toString(), "text/plain; version=0.0.4; charset=utf-8"_L1);
+			QVERIFY(!containsHeader(reply, "access-control-allow-origin"));
+
+			const auto& body = reply->readAll();
+			QVERIFY(body.contains("# TYPE ausweisapp_ifd_reconnects_total counter\n"));
+			QVERIFY(body.contains("\nausweisapp_ifd_reconnects_total "));
+		}
+
+
 		void unknownRequest()
 		{
 			HttpServerRequestor requestor;
@@ -0,0 +1,188 @@
+/**
+ * Copyright (c) 2025 Governikus GmbH & Co. KG, Germany
+ */
+
+#include "UiPluginWebSocket.h"
+
+#include "UiLoader.h"
+#include "UiPluginJson.h"
+#include "WorkflowRequest.h"
+
+#include <QHostAddress>
+#include <QtTest>
+
+
+Q_IMPORT_PLUGIN(UiPluginJson)
+
+using namespace Qt::Literals::StringLiterals;
+using namespace governikus;
+
+
+class test_UiPluginWebSocket
+	: public QObject
+{
+	Q_OBJECT
+
+	private:
+		QScopedPointer<UiPluginWebSocket> mPlugin;
+		QList<QSharedPointer<QWebSocket>> mClients;
+
+		QSharedPointer<QWebSocket> connectClient(const QString& pPath = u"/eID-Kernel"_s)
+		{
+			const auto sessions = mPlugin->mSessions.size();
+			auto client = QSharedPointer<QWebSocket>::create();
+			client->open(QUrl(QStringLiteral("ws://127.0.0.1:%1%2").arg(mPlugin->mServer.serverPort()).arg(pPath)));
+			if (!QTest::qWaitFor([this, sessions] {
+						return mPlugin->mSessions.size() > sessions;
+					}))
+			{
+				return QSharedPointer<QWebSocket>();
+			}
+
+			mClients << client;
+			return client;
+		}
+
+
+		static QJsonObject runAuth()
+		{
+			return QJsonObject {
+				{"cmd"_L1, "RUN_AUTH"_L1},
+				{"tcTokenURL"_L1, "https://localhost/"_L1}
+			};
+		}
+
+	private Q_SLOTS:
+		void init()
+		{
+			QVERIFY(Env::getSingleton<UiLoader>()->load<UiPluginJson>());
+
+			mPlugin.reset(new UiPluginWebSocket());
+			mPlugin->mJson = Env::getSingleton<UiLoader>()->getLoaded<UiPluginJson>();
+			connect(mPlugin->mJson.data(), &UiPlugin::fireWorkflowRequested, mPlugin.data(), &UiPluginWebSocket::onWorkflowRequested);
+			connect(&mPlugin->mServer, &QWebSocketServer::newConnection, mPlugin.data(), &UiPluginWebSocket::onNewConnection);
+			QVERIFY(mPlugin->mServer.listen(QHostAddress::LocalHost));
+		}
+
+
+		void cleanup()
+		{
+			mClients.clear();
+			mPlugin.reset();
+
+			auto* uiLoader = Env::getSingleton<UiLoader>();
+			if (uiLoader->isLoaded())
+			{
+				QSignalSpy spyUi(uiLoader, &UiLoader::fireRemovedAllPlugins);
+				uiLoader->shutdown();
+				QTRY_COMPARE(spyUi.count(), 1); // clazy:exclude=qstring-allocations
+			}
+		}
+
+
+		void queueWorkflowOfOtherSession()
+		{
+			const auto owner = connectClient();
+			QVERIFY(owner);
+			const auto other = connectClient();
+			QVERIFY(other);
+			auto* ownerSession = mPlugin->mSessions.at(0);
+			auto* otherSession = mPlugin->mSessions.at(1);
+
+			mPlugin->onSessionCommand(ownerSession, runAuth(), MsgCmdType::RUN_AUTH);
+			QCOMPARE(mPlugin->mWorkflowOwner.data(), ownerSession);
+			QVERIFY(mPlugin->mPendingCommands.isEmpty());
+
+			mPlugin->onSessionCommand(otherSession, runAuth(), MsgCmdType::RUN_AUTH);
+			QCOMPARE(mPlugin->mWorkflowOwner.data(), ownerSession);
+			QCOMPARE(mPlugin->mPendingCommands.size(), 1);
+			QVERIFY(mPlugin->isPending(otherSession));
+
+			QSignalSpy spyOther(other.data(), &QWebSocket::textMessageReceived);
+			mPlugin->onSessionCommand(otherSession, runAuth(), MsgCmdType::RUN_AUTH);
+			QCOMPARE(mPlugin->mPendingCommands.size(), 1);
+			QTRY_COMPARE(spyOther.count(), 1); // clazy:exclude=qstring-allocations
+			QVERIFY(spyOther.at(0).at(0).toString().contains(R"("msg":"BAD_STATE")"_L1));
+
+			mPlugin->onSessionCommand(otherSession, QJsonObject {{"cmd"_L1, "GET_INFO"_L1}}, MsgCmdType::GET_INFO);
+			QTRY_COMPARE(spyOther.count(), 2); // clazy:exclude=qstring-allocations
+			QVERIFY(spyOther.at(1).at(0).toString().contains(R"("msg":"INFO")"_L1));
+			QCOMPARE(mPlugin->mPendingCommands.size(), 1);
+		}
+
+
+		void handOverOwnership()
+		{
+			const auto owner = connectClient();
+			QVERIFY(owner);
+			const auto other = connectClient();
+			QVERIFY(other);
+			auto* ownerSession = mPlugin->mSessions.at(0);
+			auto* otherSession = mPlugin->mSessions.at(1);
+
+			mPlugin->onSessionCommand(ownerSession, runAuth(), MsgCmdType::RUN_AUTH);
+			mPlugin->onSessionCommand(otherSession, runAuth(), MsgCmdType::RUN_AUTH);
+			QCOMPARE(mPlugin->mWorkflowOwner.data(), ownerSession);
+			QCOMPARE(mPlugin->mPendingCommands.size(), 1);
+
+			mPlugin->onWorkflowUnhandled(QSharedPointer<WorkflowRequest>());
+			QCOMPARE(mPlugin->mWorkflowOwner.data(), otherSession);
+			QVERIFY(mPlugin->mPendingCommands.isEmpty());
+
+			mPlugin->onWorkflowFinished(QSharedPointer<WorkflowRequest>());
+			QVERIFY(mPlugin->mWorkflowOwner.isNull());
+		}
+
+
+		void disconnectDropsPending()
+		{
+			const auto owner = connectClient();
+			QVERIFY(owner);
+			const auto other = connectClient();
+			QVERIFY(other);
+			auto* ownerSession = mPlugin->mSessions.at(0);
+			auto* otherSession = mPlugin->mSessions.at(1);
+
+			mPlugin->onSessionCommand(ownerSession, runAuth(), MsgCmdType::RUN_AUTH);
+			mPlugin->onSessionCommand(otherSession, runAuth(), MsgCmdType::RUN_AUTH);
+			QCOMPARE(mPlugin->mPendingCommands.size(), 1);
+
+			other->close();
+			QTRY_COMPARE(mPlugin->mSessions.size(), 1); // clazy:exclude=qstring-allocations
+			QVERIFY(mPlugin->mPendingCommands.isEmpty());
+			QCOMPARE(mPlugin->mWorkflowOwner.data(), ownerSession);
+
+			QSignalSpy spyRelease(mPlugin.data(), &UiPlugin::fireUiDominationRelease);
+			owner->close();
+			QTRY_COMPARE(mPlugin->mSessions.size(), 0); // clazy:exclude=qstring-allocations
+			QVERIFY(mPlugin->mWorkflowOwner.isNull());
+			QCOMPARE(spyRelease.count(), 1);
+		}
+
+
+		void fanOutReaderEvents()
+		{
+			QList<QSharedPointer<QSignalSpy>> spies;
+			for (const auto& path : {u"/eID-Kernel"_s, u"/eID-Kernel/observe"_s, u"/eID-Kernel/observe"_s})
+			{
+				const auto client = connectClient(path);
+				QVERIFY(client);
+				spies << QSharedPointer<QSignalSpy>::create(client.data(), &QWebSocket::textMessageReceived);
+			}
+			QCOMPARE(mPlugin->mSessions.size(), 3);
+
+			mPlugin->onReaderEvent(ReaderInfo(u"reader"_s));
+			for (const auto& spy : std::as_const(spies))
+			{
+				QTRY_COMPARE(spy->count(), 1); // clazy:exclude=qstring-allocations
+				const auto& msg = spy->at(0).at(0).toString();
+				QVERIFY(msg.contains(R"("msg":"READER")"_L1));
+				QVERIFY(msg.contains(R"("name":"reader")"_L1));
+			}
+		}
+
+
+};
+
+QTEST_GUILESS_MAIN(test_UiPluginWebSocket)
+#include "test_UiPluginWebSocket.moc"
@@ -0,0 +1,150 @@
+/**
+ * Copyright (c) 2025 Governikus GmbH & Co. KG, Germany
+ */
+
+#include "WebSocketSession.h"
+
+#include <QHostAddress>
+#include <QWebSocketServer>
+#include <QtTest>
+
+using namespace Qt::Literals::StringLiterals;
+using namespace governikus;
+
+
+class test_WebSocketSession
+	: public QObject
+{
+	Q_OBJECT
+
+	private:
+		QScopedPointer<QWebSocketServer> mServer;
+		QScopedPointer<QWebSocket> mClient;
+
+		WebSocketSession* connectSession(const QString& pPath)
+		{
+			const QUrl url(QStringLiteral("ws://127.0.0.1:%1%2").arg(mServer->serverPort()).arg(pPath));
+			mClient->open(url);
+			if (!QTest::qWaitFor([this] {
+						return mServer->hasPendingConnections();
+					}))
+			{
+				return nullptr;
+			}
+
+			return new WebSocketSession(mServer->nextPendingConnection(), this);
+		}
+
+	private Q_SLOTS:
+		void init()
+		{
+			mServer.reset(new QWebSocketServer(QStringLiteral("test"), QWebSocketServer::NonSecureMode));
+			QVERIFY(mServer->listen(QHostAddress::LocalHost));
+			mClient.reset(new QWebSocket());
+		}
+
+
+		void cleanup()
+		{
+			mClient.reset();
+			mServer.reset();
+		}
+
+
+		void readOnlyPath_data()
+		{
+			QTest::addColumn<QString>("path");
+			QTest::addColumn<bool>("readOnly");
+
+			QTest::newRow("kernel") << u"/eID-Kernel"_s << false;
+			QTest::newRow("kernel slash") << u"/eID-Kernel/"_s << false;
+			QTest::newRow("observe") << u"/eID-Kernel/observe"_s << true;
+			QTest::newRow("observe slash") << u"/eID-Kernel/observe/"_s << true;
+			QTest::newRow("other") << u"/eID-Kernel/observer"_s << false;
+		}
+
+
+		void readOnlyPath()
+		{
+			QFETCH(QString, path);
+			QFETCH(bool, readOnly);
+
+			QCOMPARE(WebSocketSession::isReadOnlyPath(path), readOnly);
+		}
+
+
+		void commandClassification()
+		{
+			QVERIFY(WebSocketSession::isWorkflowCommand(MsgCmdType::RUN_AUTH));
+			QVERIFY(WebSocketSession::isWorkflowCommand(MsgCmdType::RUN_CHANGE_PIN));
+			QVERIFY(!WebSocketSession::isWorkflowCommand(MsgCmdType::GET_INFO));
+
+			QVERIFY(WebSocketSession::isReadOnlyCommand(MsgCmdType::GET_READER_LIST));
+			QVERIFY(WebSocketSession::isReadOnlyCommand(MsgCmdType::GET_METRICS));
+			QVERIFY(!WebSocketSession::isReadOnlyCommand(MsgCmdType::CANCEL));
+			QVERIFY(!WebSocketSession::isReadOnlyCommand(MsgCmdType::RUN_AUTH));
+			QVERIFY(!WebSocketSession::isReadOnlyCommand(MsgCmdType::GET_TRACE));
+		}
+
+
+		void forwardCommand()
+		{
+			auto* session = connectSession(u"/eID-Kernel"_s);
+			QVERIFY(session);
+			QVERIFY(!session->isReadOnly());
+
+			QSignalSpy spy(session, &WebSocketSession::fireCommand);
+			mClient->sendTextMessage(uR"({"cmd": "RUN_AUTH", "tcTokenURL": "https://localhost/"})"_s);
+			QTRY_COMPARE(spy.count(), 1); // clazy:exclude=qstring-allocations
+			QCOMPARE(spy.at(0).at(2).value<MsgCmdType>(), MsgCmdType::RUN_AUTH);
+		}
+
+
+		void rejectOnReadOnly()
+		{
+			auto* session = connectSession(u"/eID-Kernel/observe"_s);
+			QVERIFY(session);
+			QVERIFY(session->isReadOnly());
+
+			QSignalSpy commandSpy(session, &WebSocketSession::fireCommand);
+			QSignalSpy messageSpy(mClient.data(), &QWebSocket::textMessageReceived);
+			mClient->sendTextMessage(uR"({"cmd": "CANCEL"})"_s);
+			QTRY_COMPARE(messageSpy.count(), 1); // clazy:exclude=qstring-allocations
+			QVERIFY(messageSpy.at(0).at(0).toString().contains(R"("msg":"BAD_STATE")"_L1));
+			QCOMPARE(commandSpy.count(), 0);
+
+			mClient->sendTextMessage(uR"({"cmd": "GET_READER_LIST"})"_s);
+			QTRY_COMPARE(commandSpy.count(), 1); // clazy:exclude=qstring-allocations
+		}
+
+
+		void invalidJson()
+		{
+			auto* session = connectSession(u"/eID-Kernel"_s);
+			QVERIFY(session);
+
+			QSignalSpy messageSpy(mClient.data(), &QWebSocket::textMessageReceived);
+			mClient->sendTextMessage(u"{ not json"_s);
+			QTRY_COMPARE(messageSpy.count(), 1); // clazy:exclude=qstring-allocations
+			QVERIFY(messageSpy.at(0).at(0).toString().contains(R"("msg":"INVALID")"_L1));
+		}
+
+
+		void slowConsumer()
+		{
+			auto* session = connectSession(u"/eID-Kernel"_s);
+			QVERIFY(session);
+
+			QSignalSpy disconnectSpy(session, &WebSocketSession::fireDisconnected);
+			const QByteArray chunk(static_cast<int>(WebSocketSession::cMaxPendingBytes / 2), 'x');
+			session->send(chunk, false);
+			session->send(chunk, false);
+			session->send(chunk, false);
+			QTRY_COMPARE(disconnectSpy.count(), 1); // clazy:exclude=qstring-allocations
+		}
+
+
+};
+
+QTEST_GUILESS_MAIN(test_WebSocketSession)
+#include "test_WebSocketSession.moc"
@@ -31,7 +31,7 @@ class test_AccessRightManager
 		QSharedPointer<CHAT> getChat(const std::initializer_list<AccessRight>& pList)
 		{
 			auto chat = newObject<CHAT>();
-			chat->setAccessRights(QSet<AccessRight>(pList));
+			chat->setAccessRights(AccessRights(pList));
 			return chat;
 		}
 
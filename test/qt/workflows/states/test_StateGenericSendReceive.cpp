@@ -3,6 +3,9 @@
  */
 
 #include "Env.h"
+#include "KeyPair.h"
+#include "ResourceLoader.h"
+#include "SecureStorage.h"
 #include "states/StateBuilder.h"
 #include "states/StateGenericSendReceive.h"
 
@@ -11,6 +14,7 @@
 #include "VolatileSettings.h"
 
 #include <QList>
+#include <QSslServer>
 #include <QtTest>
 
 #include <utility>
@@ -37,6 +41,12 @@ class test_StateGenericSendReceive
 		void fireStateStart(QEvent* pEvent);
 
 	private Q_SLOTS:
+		void initTestCase()
+		{
+			ResourceLoader::getInstance().init();
+		}
+
+
 		void init()
 		{
 			mAuthContext.reset(new TestAuthContext(":/paos/DIDAuthenticateEAC1.xml"_L1));
@@ -394,6 +404,116 @@ class test_StateGenericSendReceive
 		}
 
 
+		void preconnectPsk_data()
+		{
+			QTest::addColumn<bool>("validCertificate");
+			QTest::addColumn<bool>("pending");
+
+			QTest::newRow("valid certificate") << true << false;
+			QTest::newRow("hash not in description") << false << false;
+			QTest::newRow("valid certificate - pending") << true << true;
+			QTest::newRow("hash not in description - pending") << false << true;
+		}
+
+
+		void preconnectPsk()
+		{
+			QFETCH(bool, validCertificate);
+			QFETCH(bool, pending);
+
+			const auto& pair = KeyPair::generate();
+			auto cfg = Env::getSingleton<SecureStorage>()->getTlsConfig(SecureStorage::TlsSuite::PSK).getConfiguration();
+			cfg.setLocalCertificate(pair.getCertificate());
+			cfg.setPrivateKey(pair.getKey());
+			cfg.setPeerVerifyMode(QSslSocket::VerifyNone);
+			cfg.setOcspStaplingEnabled(false);
+
+			int connections = 0;
+			QByteArray received;
+			QSslServer server;
+			server.setSslConfiguration(cfg);
+			connect(&server, &QSslServer::preSharedKeyAuthenticationRequired, this, [](QSslSocket*, QSslPreSharedKeyAuthenticator* pAuthenticator){
+						pAuthenticator->setPreSharedKey(QByteArray::fromHex("4BC1A0B5"));
+					});
+			connect(&server, &QSslServer::pendingConnectionAvailable, this, [&server, &connections, &received] {
+						auto* socket = server.nextPendingConnection();
+						++connections;
+						connect(socket, &QSslSocket::readyRead, socket, [socket, &received] {
+									received += socket->readAll();
+								});
+					});
+			QVERIFY(server.listen(QHostAddress::LocalHost));
+			if (pending)
+			{
+				// The TCP connection is established but the TLS handshake waits for the server
+				server.pauseAccepting();
+			}
+
+			const auto& url = QStringLiteral("https://localhost:%1/entrypoint").arg(server.serverPort());
+			const QByteArray tokenData("<?xml version=\"1.0\"?>"
+									   "<TCTokenType>"
+									   "  <ServerAddress>" + url.toUtf8() + "</ServerAddress>"
+									   "  <SessionIdentifier>1A2BB129</SessionIdentifier>"
+									   "  <RefreshAddress>https://service.example.de/loggedin?7eb39f62</RefreshAddress>"
+									   "  <Binding> urn:liberty:paos:2006-08 </Binding>"
+									   "  <PathSecurity-Protocol> urn:ietf:rfc:4279 </PathSecurity-Protocol>"
+									   "  <PathSecurity-Parameters>"
+									   "    <PSK> 4BC1A0B5 </PSK>"
+									   "  </PathSecurity-Parameters>"
+									   "</TCTokenType>");
+			mAuthContext->setTcToken(QSharedPointer<TcToken>::create(tokenData));
+			mAuthContext->setInitializeFrameworkResponse(QSharedPointer<InitializeFrameworkResponse>::create());
+			mAuthContext->setSslSessionPsk("outdated");
+			if (validCertificate)
+			{
+				// Without a DV certificate the hash of the certificate description is not checked.
+				mAuthContext->setDvCvc(nullptr);
+			}
+
+			Env::set(NetworkManager::staticMetaObject);
+			auto* networkManager = Env::getSingleton<NetworkManager>();
+			networkManager->preconnect(QUrl(url), "1A2BB129", QByteArray::fromHex("4BC1A0B5"));
+			if (pending)
+			{
+				QCOMPARE(networkManager->getOpenConnectionCount(), 1);
+			}
+			else
+			{
+				QTRY_COMPARE(connections, 1); // clazy:exclude=qstring-allocations
+				QTRY_COMPARE(networkManager->getOpenConnectionCount(), 0); // clazy:exclude=qstring-allocations
+			}
+
+			QSignalSpy spyAbort(mState.data(), &StateGenericSendReceive::fireAbort);
+			mAuthContext->setStateApproved();
+
+			if (pending)
+			{
+				// The pre-connect is aborted, so only the request is left. On the
+				// pending channel it would never see the handshake.
+				QTRY_COMPARE(networkManager->getOpenConnectionCount(), 1); // clazy:exclude=qstring-allocations
+				server.resumeAccepting();
+			}
+
+			if (validCertificate)
+			{
+				QTRY_VERIFY(received.startsWith("POST /entrypoint")); // clazy:exclude=qstring-allocations
+				QCOMPARE(connections, 1);
+				QCOMPARE(spyAbort.count(), 0);
+				QVERIFY(mAuthContext->getCertificateList().contains(pair.getCertificate()));
+				QVERIFY(mAuthContext->getSslSessionPsk() != QByteArray("outdated"));
+			}
+			else
+			{
+				QTRY_COMPARE(spyAbort.count(), 1); // clazy:exclude=qstring-allocations
+				QCOMPARE(mAuthContext->getFailureCode(), FailureCode::Reason::Generic_Send_Receive_Certificate_Error);
+				QTRY_COMPARE(networkManager->getOpenConnectionCount(), 0); // clazy:exclude=qstring-allocations
+				QVERIFY(received.isEmpty());
+			}
+
+			networkManager->clearConnections();
+		}
+
+
 		void checkAndSaveSessionResumptionPsk_data()
 		{
 			QTest::addColumn<QByteArray>("sessionTicket");
@@ -8,6 +8,7 @@
 #include "HttpServerRequestor.h"
 #include "ResourceLoader.h"
 
+#include "MockNetworkManager.h"
 #include "MockNetworkReply.h"
 
 #include <QByteArrayList>
@@ -201,6 +202,9 @@ class test_StateGetTcToken
 								  "  </PathSecurity-Parameters>"
 								  "</TCTokenType>");
 
+			MockNetworkManager networkManager;
+			Env::set(NetworkManager::staticMetaObject, &networkManager);
+
 			const QSharedPointer<AuthContext> context(new AuthContext());
 			StateGetTcToken state(context);
 			state.mReply.reset(new MockNetworkReply(data), &QObject::deleteLater);
@@ -211,6 +215,9 @@ class test_StateGetTcToken
 			QVERIFY(context->getTcToken());
 			QVERIFY(!context->isTcTokenNotFound());
 			QCOMPARE(spyContinue.count(), 1);
+			QCOMPARE(networkManager.getLastPreconnect(), QUrl("https://eid-server.example.de/entrypoint"_L1));
+
+			Env::set(NetworkManager::staticMetaObject);
 		}
 
 